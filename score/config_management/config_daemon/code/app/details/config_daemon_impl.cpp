@@ -1,4 +1,5 @@
 #include "score/config_management/config_daemon/code/app/details/config_daemon_impl.h"
+#include "score/config_management/config_daemon/code/metrics/metrics_snapshot_file.h"
 #include "score/concurrency/interruptible_wait.h"
 #include "score/filesystem/error.h"
 #include "score/json/json_parser.h"
@@ -7,6 +8,10 @@
 
 #include <score/utility.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <map>
+
 namespace score
 {
 namespace config_management
@@ -18,6 +23,12 @@ namespace
 {
 constexpr const std::int32_t kExitCodeSuccess{0};
 constexpr const std::int32_t kExitCodeFailure{1};
+constexpr const std::string_view kMetricsSnapshotFileArgument{"--metrics_snapshot_file"};
+constexpr const std::chrono::milliseconds kMetricsSnapshotPeriod{1000};
+constexpr const std::string_view kOfferAfterPluginsArgument{"--offer_after_plugins"};
+constexpr const std::string_view kCollectionSnapshotFileArgument{"--collection_snapshot_file"};
+constexpr const std::chrono::milliseconds kCollectionSnapshotPeriod{10000};
+constexpr const std::string_view kFileSourceDirectoryArgument{"--file_source_directory"};
 
 }  // namespace
 
@@ -27,7 +38,15 @@ ConfigDaemon::ConfigDaemon(std::unique_ptr<IFactory> factory) noexcept
       factory_{std::move(factory)},
       parameterset_collection_{factory_->CreateParameterSetCollection()},
       fault_event_reporter_{factory_->CreateFaultEventReporter()},
-      plugins_{}
+      plugins_{},
+      plugin_dependencies_{},
+      ready_plugins_{},
+      is_offered_after_all_plugins_{false},
+      daemon_metrics_{factory_->GetDaemonMetrics()},
+      metrics_snapshot_file_path_{},
+      collection_snapshot_file_path_{},
+      is_collection_restored_{false},
+      last_updated_parameter_set_senders_{}
 {
     logger_.LogDebug() << "ConfigDaemon::" << __func__;
     // 0x7F(hexadecimal) is equivalent to 0177(octal) in UNix permissions
@@ -41,30 +60,57 @@ ConfigDaemon::ConfigDaemon(std::unique_ptr<IFactory> factory) noexcept
 
 std::int32_t ConfigDaemon::Initialize(const ApplicationContext& context)
 {
-    score::cpp::ignore = context;
     logger_.LogInfo() << "ConfigDaemon::" << __func__;
 
-    const auto prepare_plugins_result = PreparePlugins();
-    if (prepare_plugins_result == kExitCodeFailure)
+    metrics_snapshot_file_path_ = context.get_argument(kMetricsSnapshotFileArgument);
+    if ((!metrics_snapshot_file_path_.empty()) && (daemon_metrics_ == nullptr))
     {
-        return prepare_plugins_result;
+        logger_.LogWarn() << "ConfigDaemon::" << __func__ << "Metrics are not collected, no snapshot file is written";
     }
 
-    for (const auto& plugin : plugins_)
+    collection_snapshot_file_path_ = context.get_argument(kCollectionSnapshotFileArgument);
+    if (!collection_snapshot_file_path_.empty())
     {
-        if (plugin == nullptr)
+        const auto restore_result = parameterset_collection_->RestoreSnapshot(collection_snapshot_file_path_);
+        if (restore_result.has_value())
         {
-            logger_.LogError() << "ConfigDaemon::" << __func__ << "Plugin is nullptr";
-            return kExitCodeFailure;
+            logger_.LogInfo() << "ConfigDaemon::" << __func__ << "Restored " << restore_result.value()
+                              << " parameter sets from " << collection_snapshot_file_path_;
+            is_collection_restored_ = (restore_result.value() > 0U);
         }
+    }
 
-        const auto init_plugin_result = plugin->Initialize();
-        if (init_plugin_result.has_value() == false)
-        {
-            logger_.LogWarn() << "ConfigDaemon::" << __func__
-                              << "Plugin.Initialize() failed:" << init_plugin_result.error();
-            return kExitCodeFailure;
-        }
+    const auto prepare_plugins_result = PreparePlugins(context.get_argument(kOfferAfterPluginsArgument),
+                                                       context.get_argument(kFileSourceDirectoryArgument));
+    if (prepare_plugins_result == kExitCodeFailure)
+    {
+        return prepare_plugins_result;
+    }
+
+    PluginScheduler plugin_scheduler{plugin_dependencies_};
+    const auto initialize_results = plugin_scheduler.Execute(
+        [this](const std::size_t plugin_index) {
+            const auto& plugin = plugins_[plugin_index];
+            if (plugin == nullptr)
+            {
+                logger_.LogError() << "ConfigDaemon::Initialize" << "Plugin is nullptr";
+                return false;
+            }
+
+            const auto init_plugin_result = plugin->Initialize();
+            if (init_plugin_result.has_value() == false)
+            {
+                logger_.LogWarn() << "ConfigDaemon::Initialize"
+                                  << "Plugin.Initialize() failed:" << init_plugin_result.error();
+                return false;
+            }
+            return true;
+        },
+        {},
+        []() {});
+    if (!EvaluatePluginSteps(initialize_results, false))
+    {
+        return kExitCodeFailure;
     }
 
     provided_services_container_ = factory_->CreateInternalConfigProviderService(parameterset_collection_);
@@ -97,11 +143,15 @@ std::int32_t ConfigDaemon::Run(const score::cpp::stop_token& token)
             // LCOV_EXCL_STOP
         }
     });
-    for (const auto& plugin : plugins_)
+    // The wrapped senders refer to the stored callbacks, so the storage must not be reallocated while running
+    last_updated_parameter_set_senders_.reserve(plugins_.size());
+    std::vector<InitialQualifierStateSender> initial_qualifier_state_senders{};
+    std::vector<LastUpdatedParameterSetSender> last_updated_parameter_set_senders{};
+    for (std::size_t plugin_index = 0U; plugin_index < plugins_.size(); ++plugin_index)
     {
         // LCOV_EXCL_START Can't be covered by unit tests. It has already been checked for nullptr
         // earlier in the Initialize method, and there is no way to set it to nullptr in the test.
-        if (plugin == nullptr)
+        if (plugins_[plugin_index] == nullptr)
         {
             logger_.LogError() << "ConfigDaemon::" << __func__ << "Plugin is nullptr";
             return kExitCodeFailure;
@@ -125,32 +175,77 @@ std::int32_t ConfigDaemon::Run(const score::cpp::stop_token& token)
             return kExitCodeFailure;
         }
 
-        const auto plugin_run_result = plugin->Run(parameterset_collection_,
-                                                   std::move(last_updated_parameter_set_sender),
-                                                   std::move(initial_qualifier_state_sender),
-                                                   token,
-                                                   fault_event_reporter_);
-        if (plugin_run_result == kExitCodeFailure)
+        initial_qualifier_state_senders.push_back(std::move(initial_qualifier_state_sender));
+        last_updated_parameter_set_senders.push_back(
+            CountParameterSetUpdates(std::move(last_updated_parameter_set_sender), plugin_index));
+    }
+
+    // A restored collection is served right away, the plugins reconcile it with the current parameters meanwhile
+    bool is_offered{is_collection_restored_};
+    if (is_offered)
+    {
+        logger_.LogInfo() << "ConfigDaemon::" << __func__ << "InternalConfigProviderService offered from snapshot.";
+        provided_services_container_.StartServices();
+    }
+
+    // Independent plugins run concurrently, the services are offered as soon as the ready plugins finished their Run,
+    // or after all plugins if some of them do not mark their parameter sets ready. Until all plugins finished, clients
+    // are only served parameter sets which are marked ready or were restored.
+    parameterset_collection_->SetLoadingCompleted(false);
+    PluginScheduler plugin_scheduler{plugin_dependencies_};
+    const auto run_results = plugin_scheduler.Execute(
+        [this, &initial_qualifier_state_senders, &last_updated_parameter_set_senders, &token](
+            const std::size_t plugin_index) {
+            const auto plugin_run_result =
+                plugins_[plugin_index]->Run(parameterset_collection_,
+                                            std::move(last_updated_parameter_set_senders[plugin_index]),
+                                            std::move(initial_qualifier_state_senders[plugin_index]),
+                                            token,
+                                            fault_event_reporter_);
+            if (plugin_run_result == kExitCodeFailure)
+            {
+                logger_.LogError() << "ConfigDaemon::Run" << "Plugin.Run() failed";
+                return false;
+            }
+            return true;
+        },
+        ready_plugins_,
+        [this, &is_offered]() {
+            if ((!is_offered) && (!is_offered_after_all_plugins_))
+            {
+                logger_.LogInfo() << "ConfigDaemon::Run" << "InternalConfigProviderService offered.";
+                provided_services_container_.StartServices();
+                is_offered = true;
+            }
+        });
+    parameterset_collection_->SetLoadingCompleted(true);
+    if (!EvaluatePluginSteps(run_results, true))
+    {
+        if (is_offered)
         {
-            logger_.LogError() << "ConfigDaemon::" << __func__ << "Plugin.Run() failed";
-            return kExitCodeFailure;
+            provided_services_container_.StopServices();
         }
+        return kExitCodeFailure;
+    }
+    if (!is_offered)
+    {
+        logger_.LogInfo() << "ConfigDaemon::" << __func__ << "InternalConfigProviderService offered after all plugins.";
+        provided_services_container_.StartServices();
     }
 
-    logger_.LogInfo() << "ConfigDaemon::" << __func__ << "InternalConfigProviderService offered.";
-    provided_services_container_.StartServices();
-
-    score::concurrency::wait_until_stop_requested(token);
+    WaitUntilStopRequested(token);
 
     logger_.LogInfo() << "ConfigDaemon::" << __func__ << "Stop requested";
     provided_services_container_.StopServices();
+    WriteCollectionSnapshot();
 
     return kExitCodeSuccess;
 }
 
-std::int32_t ConfigDaemon::PreparePlugins()
+std::int32_t ConfigDaemon::PreparePlugins(const std::string_view offer_after_plugins,
+                                          const std::string& file_source_directory)
 {
-    auto plugin_collector = factory_->CreatePluginCollector();
+    auto plugin_collector = factory_->CreatePluginCollector(file_source_directory);
     if (plugin_collector == nullptr)
     {
         logger_.LogError() << "ConfigDaemon::" << __func__ << "factory could not create PluginCollector";
@@ -160,9 +255,180 @@ std::int32_t ConfigDaemon::PreparePlugins()
     plugins_ = plugin_collector->CreatePlugins();
     logger_.LogDebug() << "ConfigDaemon::" << __func__ << "Created " << plugins_.size() << " plugins.";
 
+    std::map<std::string_view, std::size_t> plugin_indices{};
+    for (std::size_t plugin_index = 0U; plugin_index < plugins_.size(); ++plugin_index)
+    {
+        const auto name = (plugins_[plugin_index] == nullptr) ? std::string_view{} : plugins_[plugin_index]->GetName();
+        if ((!name.empty()) && (!plugin_indices.emplace(name, plugin_index).second))
+        {
+            logger_.LogError() << "ConfigDaemon::" << __func__ << "Plugin name " << name << " is not unique";
+            return kExitCodeFailure;
+        }
+    }
+
+    plugin_dependencies_.assign(plugins_.size(), std::vector<std::size_t>{});
+    for (std::size_t plugin_index = 0U; plugin_index < plugins_.size(); ++plugin_index)
+    {
+        if (plugins_[plugin_index] == nullptr)
+        {
+            continue;
+        }
+        for (const auto& dependency : plugins_[plugin_index]->GetDependencies())
+        {
+            const auto dependency_it = plugin_indices.find(dependency);
+            if (dependency_it == plugin_indices.end())
+            {
+                logger_.LogError() << "ConfigDaemon::" << __func__ << "Plugin dependency " << dependency
+                                   << " does not exist";
+                return kExitCodeFailure;
+            }
+            plugin_dependencies_[plugin_index].push_back(dependency_it->second);
+        }
+    }
+    if (!PluginScheduler{plugin_dependencies_}.HasValidDependencies())
+    {
+        logger_.LogError() << "ConfigDaemon::" << __func__ << "Plugin dependencies are cyclic";
+        return kExitCodeFailure;
+    }
+
+    // Without readiness condition the services are offered right away and the parameter sets become available one by
+    // one, unless a plugin does not mark its parameter sets ready: clients would then wait for each of its sets until
+    // all plugins finished, so the services are offered only after all plugins
+    ready_plugins_.clear();
+    if (offer_after_plugins.empty())
+    {
+        is_offered_after_all_plugins_ =
+            std::any_of(plugins_.cbegin(), plugins_.cend(), [](const std::shared_ptr<IPlugin>& plugin) {
+                return (plugin == nullptr) || (!plugin->MarksParameterSetsReady());
+            });
+        if (is_offered_after_all_plugins_)
+        {
+            logger_.LogInfo() << "ConfigDaemon::" << __func__
+                              << "Not all plugins mark their parameter sets ready, offering after all plugins.";
+        }
+        return kExitCodeSuccess;
+    }
+    is_offered_after_all_plugins_ = false;
+    std::size_t name_start{0U};
+    while (name_start <= offer_after_plugins.size())
+    {
+        const auto name_end = std::min(offer_after_plugins.find(',', name_start), offer_after_plugins.size());
+        const auto name = offer_after_plugins.substr(name_start, name_end - name_start);
+        const auto plugin_it = plugin_indices.find(name);
+        if (plugin_it == plugin_indices.end())
+        {
+            logger_.LogError() << "ConfigDaemon::" << __func__ << "Plugin " << name << " to offer after does not exist";
+            return kExitCodeFailure;
+        }
+        ready_plugins_.push_back(plugin_it->second);
+        name_start = name_end + 1U;
+    }
     return kExitCodeSuccess;
 }
 
+std::string ConfigDaemon::GetPluginName(const std::size_t plugin_index) const
+{
+    // unnamed plugins are told apart by their creation order
+    const auto name = (plugins_[plugin_index] == nullptr) ? std::string_view{} : plugins_[plugin_index]->GetName();
+    return name.empty() ? ("plugin_" + std::to_string(plugin_index)) : std::string{name};
+}
+
+bool ConfigDaemon::EvaluatePluginSteps(const std::vector<PluginStepResult>& results, const bool is_run) const
+{
+    bool all_succeeded{true};
+    for (std::size_t plugin_index = 0U; plugin_index < results.size(); ++plugin_index)
+    {
+        const auto& result = results[plugin_index];
+        const auto plugin_name = GetPluginName(plugin_index);
+        all_succeeded = all_succeeded && result.succeeded;
+        if (!result.is_executed)
+        {
+            logger_.LogWarn() << "ConfigDaemon::" << __func__ << "Plugin " << plugin_name
+                              << " skipped, as one of its dependencies failed";
+            continue;
+        }
+        logger_.LogInfo() << "ConfigDaemon::" << __func__ << "Plugin " << plugin_name
+                          << (is_run ? " ran in " : " initialized in ")
+                          << std::chrono::duration_cast<std::chrono::milliseconds>(result.duration).count() << " ms";
+        if (daemon_metrics_ != nullptr)
+        {
+            if (is_run)
+            {
+                daemon_metrics_->RecordPluginRun(plugin_name, result.duration);
+            }
+            else
+            {
+                daemon_metrics_->RecordPluginInitialize(plugin_name, result.duration);
+            }
+        }
+    }
+    return all_succeeded;
+}
+
+LastUpdatedParameterSetSender ConfigDaemon::CountParameterSetUpdates(LastUpdatedParameterSetSender sender,
+                                                                     const std::size_t plugin_index)
+{
+    if (daemon_metrics_ == nullptr)
+    {
+        return sender;
+    }
+    last_updated_parameter_set_senders_.push_back(std::move(sender));
+    return [stored_sender = &last_updated_parameter_set_senders_.back(),
+            metrics = daemon_metrics_.get(),
+            plugin_name = GetPluginName(plugin_index)](const std::string_view parameter_set_name) noexcept -> bool {
+        const bool sent = (*stored_sender)(parameter_set_name);
+        metrics->RecordParameterSetUpdate(plugin_name, sent);
+        return sent;
+    };
+}
+
+void ConfigDaemon::WaitUntilStopRequested(const score::cpp::stop_token& token) const
+{
+    const bool write_metrics_snapshot = (daemon_metrics_ != nullptr) && (!metrics_snapshot_file_path_.empty());
+    const bool write_collection_snapshot = !collection_snapshot_file_path_.empty();
+    if ((!write_metrics_snapshot) && (!write_collection_snapshot))
+    {
+        score::concurrency::wait_until_stop_requested(token);
+        return;
+    }
+
+    if (write_metrics_snapshot)
+    {
+        logger_.LogInfo() << "ConfigDaemon::" << __func__ << "Writing metrics snapshots to "
+                          << metrics_snapshot_file_path_;
+    }
+    const auto period = write_metrics_snapshot ? kMetricsSnapshotPeriod : kCollectionSnapshotPeriod;
+    auto next_collection_snapshot = std::chrono::steady_clock::now() + kCollectionSnapshotPeriod;
+    while (!token.stop_requested())
+    {
+        score::cpp::ignore = score::concurrency::wait_for(token, period);
+        if (write_metrics_snapshot)
+        {
+            score::cpp::ignore =
+                metrics::WriteMetricsSnapshotFile(daemon_metrics_->GetSnapshot(), metrics_snapshot_file_path_);
+        }
+        if (write_collection_snapshot && (std::chrono::steady_clock::now() >= next_collection_snapshot))
+        {
+            WriteCollectionSnapshot();
+            next_collection_snapshot = std::chrono::steady_clock::now() + kCollectionSnapshotPeriod;
+        }
+    }
+}
+
+void ConfigDaemon::WriteCollectionSnapshot() const
+{
+    if (collection_snapshot_file_path_.empty())
+    {
+        return;
+    }
+    const auto write_result = parameterset_collection_->WriteSnapshot(collection_snapshot_file_path_);
+    if (!write_result.has_value())
+    {
+        logger_.LogWarn() << "ConfigDaemon::" << __func__ << "Failed to write collection snapshot "
+                          << collection_snapshot_file_path_ << ": " << write_result.error();
+    }
+}
+
 }  // namespace config_daemon
 }  // namespace config_management
 }  // namespace score
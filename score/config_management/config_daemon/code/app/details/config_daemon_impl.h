@@ -2,8 +2,10 @@
 #define CODE_APP_DETAILS_CONFIG_DAEMON_IMPL_H
 
 #include "score/config_management/config_daemon/code/app/config_daemon.h"
+#include "score/config_management/config_daemon/code/app/details/plugin_scheduler.h"
 #include "score/config_management/config_daemon/code/factory/factory.h"
 #include "score/config_management/config_daemon/code/fault_event_reporter/fault_event_reporter.h"
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
 #include "score/config_management/config_daemon/code/plugins/plugin.h"
 
 #include "score/result/result.h"
@@ -11,6 +13,8 @@
 #include "platform/aas/mw/service/provided_service_container.h"
 
 #include "memory"
+#include "string"
+#include "string_view"
 #include "vector"
 
 namespace score
@@ -36,7 +40,13 @@ class ConfigDaemon final : public IConfigDaemon
     std::int32_t Run(const score::cpp::stop_token& token) override;
 
   private:
-    std::int32_t PreparePlugins();
+    std::int32_t PreparePlugins(const std::string_view offer_after_plugins, const std::string& file_source_directory);
+    std::string GetPluginName(const std::size_t plugin_index) const;
+    bool EvaluatePluginSteps(const std::vector<PluginStepResult>& results, const bool is_run) const;
+    LastUpdatedParameterSetSender CountParameterSetUpdates(LastUpdatedParameterSetSender sender,
+                                                           const std::size_t plugin_index);
+    void WaitUntilStopRequested(const score::cpp::stop_token& token) const;
+    void WriteCollectionSnapshot() const;
 
     mw::log::Logger& logger_;
     std::unique_ptr<IFactory> factory_;
@@ -44,6 +54,17 @@ class ConfigDaemon final : public IConfigDaemon
     std::shared_ptr<fault_event_reporter::IFaultEventReporter> fault_event_reporter_;
     mw::service::ProvidedServiceContainer provided_services_container_;
     std::vector<std::shared_ptr<IPlugin>> plugins_;
+    // indices of the plugins every plugin depends on and of the plugins which must have run before the services are
+    // offered
+    std::vector<std::vector<std::size_t>> plugin_dependencies_;
+    std::vector<std::size_t> ready_plugins_;
+    // set if no plugins to offer after are given and not every plugin marks its parameter sets ready
+    bool is_offered_after_all_plugins_;
+    std::shared_ptr<metrics::DaemonMetrics> daemon_metrics_;
+    std::string metrics_snapshot_file_path_;
+    std::string collection_snapshot_file_path_;
+    bool is_collection_restored_;
+    std::vector<LastUpdatedParameterSetSender> last_updated_parameter_set_senders_;
 };
 
 }  // namespace config_daemon
@@ -75,6 +75,7 @@ class ConfigDaemonFixture : public ::testing::Test
     void FactoryDefaultSetup();
     void ComponentsDefaultSetup();
     void PluginCollectorSetup();
+    void SecondPluginDependsOnFirstSetup();
 
     score::os::StatMock stat_mock_;
     std::unique_ptr<score::config_management::config_daemon::FactoryMock> factory_mock_;
@@ -123,7 +124,13 @@ void ConfigDaemonFixture::PluginCollectorSetup()
     ON_CALL(*plugin_collector_mock_, CreatePlugins()).WillByDefault(Return(plugins));
     ON_CALL(*first_plugin_mock_, Initialize()).WillByDefault(Return(Result<Blank>{}));
     ON_CALL(*second_plugin_mock_, Initialize()).WillByDefault(Return(Result<Blank>{}));
-    ON_CALL(*factory_mock_, CreatePluginCollector()).WillByDefault(Return(ByMove(std::move(plugin_collector_mock_))));
+    ON_CALL(*factory_mock_, CreatePluginCollector(_)).WillByDefault(Return(ByMove(std::move(plugin_collector_mock_))));
+}
+
+void ConfigDaemonFixture::SecondPluginDependsOnFirstSetup()
+{
+    ON_CALL(*first_plugin_mock_, GetName()).WillByDefault(Return(std::string_view{"first_plugin"}));
+    ON_CALL(*second_plugin_mock_, GetDependencies()).WillByDefault(Return(std::vector<std::string>{"first_plugin"}));
 }
 
 TEST_F(ConfigDaemonFixture, ConfigDaemonAppInitializeSuccess)
@@ -256,12 +263,33 @@ TEST_F(ConfigDaemonFixture, ConfigDaemonAppFailedToCreatePluginCollector)
 
     // Given the factory is able to create all necessary components
     FactoryDefaultSetup();
-    EXPECT_CALL(*factory_mock_, CreatePluginCollector()).WillOnce(Return(ByMove(std::move(nullptr))));
+    EXPECT_CALL(*factory_mock_, CreatePluginCollector("")).WillOnce(Return(ByMove(std::move(nullptr))));
 
     config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
     ASSERT_EQ(config_daemon_app_->Initialize(gDummyContext), kExitCodeFailure);
 }
 
+TEST_F(ConfigDaemonFixture, ConfigDaemonAppForwardsFileSourceDirectory)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Initialize()");
+    RecordProperty("Description",
+                   "This test ensures that the --file_source_directory argument is forwarded to the PluginCollector");
+
+    // Given the parameter sets shall be loaded from a directory
+    const char* file_source_args[]{"ConfigDaemon", "--file_source_directory", "/parameter_sets"};
+    const auto file_source_context = score::mw::lifecycle::ApplicationContext(3, file_source_args);
+    FactoryDefaultSetup();
+    EXPECT_CALL(*factory_mock_, CreatePluginCollector("/parameter_sets")).WillOnce(Return(ByMove(nullptr)));
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+
+    // When the daemon is initialized
+    // Then the directory is handed to the PluginCollector
+    ASSERT_EQ(config_daemon_app_->Initialize(file_source_context), kExitCodeFailure);
+}
+
 TEST_F(ConfigDaemonFixture, ConfigDaemonAppFailedToSetupPlugins)
 {
     RecordProperty("Priority", "3");
@@ -273,6 +301,7 @@ TEST_F(ConfigDaemonFixture, ConfigDaemonAppFailedToSetupPlugins)
 
     ComponentsDefaultSetup();
     FactoryDefaultSetup();
+    SecondPluginDependsOnFirstSetup();
 
     ResultBlank error_result{score::MakeUnexpected(score::json::Error::kParsingError, "")};
     EXPECT_CALL(*first_plugin_mock_, Initialize()).WillOnce(Return(error_result));
@@ -313,6 +342,7 @@ TEST_F(ConfigDaemonFixture, ConfigDaemonAppFailedToRunFirstPlugin)
     RecordProperty("Description", "This test ensures that Run would fail, when Plugin->Run return error");
 
     FactoryDefaultSetup();
+    SecondPluginDependsOnFirstSetup();
 
     EXPECT_CALL(*first_plugin_mock_, Run(_, _, _, _, _)).WillOnce(Return(kExitCodeFailure));
     EXPECT_CALL(*second_plugin_mock_, Run(_, _, _, _, _)).Times(0);
@@ -400,6 +430,230 @@ TEST_F(ConfigDaemonFixture, ConfigDaemonRunFailDueToLastUpdatedParameterSetSende
     ASSERT_EQ(config_daemon_app_->Run(source.get_token()), 1);
 }
 
+TEST_F(ConfigDaemonFixture, ConfigDaemonRunCountsParameterSetUpdatesPerPlugin)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Run()");
+    RecordProperty("Description",
+                   "This test ensures that parameter set updates sent by the plugins and failures to send them are "
+                   "recorded per plugin name in the daemon metrics, and per creation order for unnamed plugins");
+
+    // Given the factory provides daemon metrics, the first plugin is named and the sender of the second unnamed
+    // plugin fails to send the update
+    ComponentsDefaultSetup();
+    FactoryDefaultSetup();
+    ON_CALL(*first_plugin_mock_, GetName()).WillByDefault(Return(std::string_view{"first_plugin"}));
+    const auto daemon_metrics = std::make_shared<metrics::DaemonMetrics>();
+    ON_CALL(*factory_mock_, GetDaemonMetrics()).WillByDefault(Return(daemon_metrics));
+    EXPECT_CALL(*factory_mock_, CreateLastUpdatedParameterSetSender(_))
+        .WillOnce(Invoke([](auto&&) {
+            return [](const std::string_view) noexcept {
+                return true;
+            };
+        }))
+        .WillOnce(Invoke([](auto&&) {
+            return [](const std::string_view) noexcept {
+                return false;
+            };
+        }));
+    EXPECT_CALL(*first_plugin_mock_, Run(_, _, _, _, _))
+        .WillOnce(Invoke([](auto&&, LastUpdatedParameterSetSender sender, auto&&, auto&&, auto&&) {
+            EXPECT_TRUE(sender("set_name"));
+            EXPECT_TRUE(sender("set_name"));
+            return kExitCodeSuccess;
+        }));
+    EXPECT_CALL(*second_plugin_mock_, Run(_, _, _, _, _))
+        .WillOnce(Invoke([](auto&&, LastUpdatedParameterSetSender sender, auto&&, auto&&, auto&&) {
+            EXPECT_FALSE(sender("set_name"));
+            return kExitCodeSuccess;
+        }));
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+    score::cpp::stop_source source;
+    source.request_stop();
+
+    // When the plugins send updates while running
+    ASSERT_EQ(config_daemon_app_->Initialize(gDummyContext), kExitCodeSuccess);
+    ASSERT_EQ(config_daemon_app_->Run(source.get_token()), kExitCodeSuccess);
+
+    // Then the updates are counted per plugin and the failure is recorded
+    const auto snapshot = daemon_metrics->GetSnapshot();
+    ASSERT_EQ(snapshot.updates_per_plugin.size(), 2U);
+    EXPECT_EQ(snapshot.updates_per_plugin.at("first_plugin"), 2U);
+    EXPECT_EQ(snapshot.updates_per_plugin.at("plugin_1"), 1U);
+    ASSERT_EQ(snapshot.plugin_startup_times.size(), 2U);
+    EXPECT_EQ(snapshot.plugin_startup_times.count("first_plugin"), 1U);
+    EXPECT_EQ(snapshot.plugin_startup_times.count("plugin_1"), 1U);
+    EXPECT_EQ(snapshot.send_last_updated_parameter_set_failures, 1U);
+}
+
+TEST_F(ConfigDaemonFixture, ConfigDaemonAppFailedDueToInvalidPluginDependencies)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Initialize()");
+    RecordProperty("Description",
+                   "This test ensures that Initialize fails without initializing any plugin, if the plugins depend on "
+                   "each other cyclically");
+
+    // Given both plugins depend on each other
+    ComponentsDefaultSetup();
+    FactoryDefaultSetup();
+    SecondPluginDependsOnFirstSetup();
+    ON_CALL(*second_plugin_mock_, GetName()).WillByDefault(Return(std::string_view{"second_plugin"}));
+    ON_CALL(*first_plugin_mock_, GetDependencies()).WillByDefault(Return(std::vector<std::string>{"second_plugin"}));
+    EXPECT_CALL(*first_plugin_mock_, Initialize()).Times(0);
+    EXPECT_CALL(*second_plugin_mock_, Initialize()).Times(0);
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+
+    // When the daemon is initialized
+    // Then the initialization fails
+    ASSERT_EQ(config_daemon_app_->Initialize(gDummyContext), kExitCodeFailure);
+}
+
+TEST_F(ConfigDaemonFixture, ConfigDaemonAppFailedDueToUnknownReadyPlugin)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Initialize()");
+    RecordProperty("Description",
+                   "This test ensures that Initialize fails, if the services shall be offered after an unknown plugin");
+
+    // Given the services shall be offered after a plugin which does not exist
+    const char* ready_args[]{"ConfigDaemon", "--offer_after_plugins", "first_plugin,unknown_plugin"};
+    const auto ready_context = score::mw::lifecycle::ApplicationContext(3, ready_args);
+    ComponentsDefaultSetup();
+    FactoryDefaultSetup();
+    SecondPluginDependsOnFirstSetup();
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+
+    // When the daemon is initialized
+    // Then the initialization fails
+    ASSERT_EQ(config_daemon_app_->Initialize(ready_context), kExitCodeFailure);
+}
+
+TEST_F(ConfigDaemonFixture, ConfigDaemonServesReadyParameterSetsWhilePluginsAreRunning)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Run()");
+    RecordProperty("Description",
+                   "This test ensures that the parameter set collection only serves ready parameter sets while the "
+                   "plugins are running and all parameter sets once every plugin finished");
+
+    // Given the factory is able to create necessary components
+    ComponentsDefaultSetup();
+    FactoryDefaultSetup();
+    auto parameterset_collection_mock = std::make_unique<data_model::ParameterSetCollectionMock>();
+    {
+        testing::InSequence sequence{};
+        EXPECT_CALL(*parameterset_collection_mock, SetLoadingCompleted(false));
+        EXPECT_CALL(*first_plugin_mock_, Run(_, _, _, _, _)).WillOnce(Return(kExitCodeSuccess));
+        EXPECT_CALL(*parameterset_collection_mock, SetLoadingCompleted(true));
+    }
+    EXPECT_CALL(*second_plugin_mock_, Run(_, _, _, _, _)).WillOnce(Return(kExitCodeSuccess));
+    EXPECT_CALL(*factory_mock_, CreateParameterSetCollection())
+        .WillOnce(Return(ByMove(std::move(parameterset_collection_mock))));
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+    score::cpp::stop_source source;
+    source.request_stop();
+
+    // When the daemon is initialized and run
+    // Then the loading is marked as completed after the plugins ran
+    ASSERT_EQ(config_daemon_app_->Initialize(gDummyContext), kExitCodeSuccess);
+    ASSERT_EQ(config_daemon_app_->Run(source.get_token()), kExitCodeSuccess);
+}
+
+TEST_F(ConfigDaemonFixture, ConfigDaemonAsksEveryPluginWhetherItMarksParameterSetsReady)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Initialize()");
+    RecordProperty("Description",
+                   "This test ensures that without plugins to offer after, every plugin is asked whether it marks its "
+                   "parameter sets ready, to decide whether the services are offered before all plugins ran");
+
+    // Given the first plugin marks its parameter sets ready and the second one does not
+    ComponentsDefaultSetup();
+    FactoryDefaultSetup();
+    EXPECT_CALL(*first_plugin_mock_, MarksParameterSetsReady()).WillOnce(Return(true));
+    EXPECT_CALL(*second_plugin_mock_, MarksParameterSetsReady()).WillOnce(Return(false));
+    EXPECT_CALL(*first_plugin_mock_, Run(_, _, _, _, _)).WillOnce(Return(kExitCodeSuccess));
+    EXPECT_CALL(*second_plugin_mock_, Run(_, _, _, _, _)).WillOnce(Return(kExitCodeSuccess));
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+    score::cpp::stop_source source;
+    source.request_stop();
+
+    // When the daemon is initialized and run
+    // Then both plugins are asked and the services are offered once they ran
+    ASSERT_EQ(config_daemon_app_->Initialize(gDummyContext), kExitCodeSuccess);
+    ASSERT_EQ(config_daemon_app_->Run(source.get_token()), kExitCodeSuccess);
+}
+
+TEST_F(ConfigDaemonFixture, ConfigDaemonOffersAfterGivenPluginsRegardlessOfParameterSetReadiness)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Initialize()");
+    RecordProperty("Description",
+                   "This test ensures that the plugins to offer after take precedence over whether the plugins mark "
+                   "their parameter sets ready");
+
+    // Given the services shall be offered after the first plugin
+    const char* ready_args[]{"ConfigDaemon", "--offer_after_plugins", "first_plugin"};
+    const auto ready_context = score::mw::lifecycle::ApplicationContext(3, ready_args);
+    ComponentsDefaultSetup();
+    FactoryDefaultSetup();
+    SecondPluginDependsOnFirstSetup();
+    EXPECT_CALL(*first_plugin_mock_, MarksParameterSetsReady()).Times(0);
+    EXPECT_CALL(*second_plugin_mock_, MarksParameterSetsReady()).Times(0);
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+
+    // When the daemon is initialized
+    // Then the plugins are not asked whether they mark their parameter sets ready
+    ASSERT_EQ(config_daemon_app_->Initialize(ready_context), kExitCodeSuccess);
+}
+
+TEST_F(ConfigDaemonFixture, ConfigDaemonRestoresAndWritesCollectionSnapshot)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::ConfigDaemon::Run()");
+    RecordProperty("Description",
+                   "This test ensures that the collection is restored from the snapshot file on start up and that the "
+                   "snapshot is written again on shutdown");
+
+    // Given a collection snapshot file is configured and holds parameter sets
+    const char* snapshot_args[]{"ConfigDaemon", "--collection_snapshot_file", "/persistent/collection.snapshot"};
+    const auto snapshot_context = score::mw::lifecycle::ApplicationContext(3, snapshot_args);
+    ComponentsDefaultSetup();
+    FactoryDefaultSetup();
+    auto parameterset_collection_mock = std::make_unique<data_model::ParameterSetCollectionMock>();
+    EXPECT_CALL(*parameterset_collection_mock, RestoreSnapshot(std::string{"/persistent/collection.snapshot"}))
+        .WillOnce(Return(Result<std::size_t>{2U}));
+    EXPECT_CALL(*parameterset_collection_mock, WriteSnapshot(std::string{"/persistent/collection.snapshot"}))
+        .WillOnce(Return(ResultBlank{}));
+    EXPECT_CALL(*factory_mock_, CreateParameterSetCollection())
+        .WillOnce(Return(ByMove(std::move(parameterset_collection_mock))));
+    EXPECT_CALL(*first_plugin_mock_, Run(_, _, _, _, _)).WillOnce(Return(kExitCodeSuccess));
+    EXPECT_CALL(*second_plugin_mock_, Run(_, _, _, _, _)).WillOnce(Return(kExitCodeSuccess));
+    config_daemon_app_ = std::make_unique<score::config_management::config_daemon::ConfigDaemon>(std::move(factory_mock_));
+    score::cpp::stop_source source;
+    source.request_stop();
+
+    // When the daemon is initialized and run until stop is requested
+    // Then the snapshot is restored before the plugins run and written once on shutdown
+    ASSERT_EQ(config_daemon_app_->Initialize(snapshot_context), kExitCodeSuccess);
+    ASSERT_EQ(config_daemon_app_->Run(source.get_token()), kExitCodeSuccess);
+}
+
 }  // namespace test
 }  // namespace config_daemon
 }  // namespace config_management
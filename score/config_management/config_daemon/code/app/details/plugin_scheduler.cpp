@@ -0,0 +1,165 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/app/details/plugin_scheduler.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+PluginScheduler::PluginScheduler(std::vector<std::vector<std::size_t>> dependencies)
+    : dependencies_{std::move(dependencies)}, mutex_{}, state_changed_{}, states_{}
+{
+}
+
+bool PluginScheduler::HasValidDependencies() const
+{
+    const std::size_t plugin_count{dependencies_.size()};
+    std::vector<std::size_t> missing_dependencies(plugin_count, 0U);
+    std::vector<std::vector<std::size_t>> dependents(plugin_count);
+    for (std::size_t plugin_index = 0U; plugin_index < plugin_count; ++plugin_index)
+    {
+        for (const auto dependency : dependencies_[plugin_index])
+        {
+            if ((dependency >= plugin_count) || (dependency == plugin_index))
+            {
+                return false;
+            }
+            dependents[dependency].push_back(plugin_index);
+            ++missing_dependencies[plugin_index];
+        }
+    }
+
+    // Kahn's algorithm: the dependencies are acyclic if every plugin can be started in some order
+    std::vector<std::size_t> startable_plugins{};
+    for (std::size_t plugin_index = 0U; plugin_index < plugin_count; ++plugin_index)
+    {
+        if (missing_dependencies[plugin_index] == 0U)
+        {
+            startable_plugins.push_back(plugin_index);
+        }
+    }
+    std::size_t started_plugins{0U};
+    while (!startable_plugins.empty())
+    {
+        const std::size_t plugin_index{startable_plugins.back()};
+        startable_plugins.pop_back();
+        ++started_plugins;
+        for (const auto dependent : dependents[plugin_index])
+        {
+            if (--missing_dependencies[dependent] == 0U)
+            {
+                startable_plugins.push_back(dependent);
+            }
+        }
+    }
+    return started_plugins == plugin_count;
+}
+
+std::vector<PluginStepResult> PluginScheduler::Execute(const Step& step,
+                                                       const std::vector<std::size_t>& ready_plugins,
+                                                       const ReadyCallback& on_ready)
+{
+    std::vector<PluginStepResult> results(dependencies_.size());
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        states_.assign(dependencies_.size(), StepState::kPending);
+    }
+
+    bool is_ready{ready_plugins.empty()};
+    if (is_ready)
+    {
+        on_ready();
+    }
+
+    std::vector<std::thread> threads{};
+    threads.reserve(dependencies_.size());
+    for (std::size_t plugin_index = 0U; plugin_index < dependencies_.size(); ++plugin_index)
+    {
+        threads.emplace_back([this, plugin_index, &step, &results]() {
+            ExecuteStep(plugin_index, step, results);
+        });
+    }
+
+    if (!is_ready)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        state_changed_.wait(lock, [this, &ready_plugins]() {
+            return std::none_of(ready_plugins.cbegin(), ready_plugins.cend(), [this](const std::size_t plugin_index) {
+                return states_[plugin_index] == StepState::kPending;
+            });
+        });
+        is_ready = AreReady(ready_plugins);
+    }
+    // the remaining steps continue while on_ready is executed
+    if (is_ready && (!ready_plugins.empty()))
+    {
+        on_ready();
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    return results;
+}
+
+void PluginScheduler::ExecuteStep(const std::size_t plugin_index,
+                                  const Step& step,
+                                  std::vector<PluginStepResult>& results)
+{
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        const auto& dependencies = dependencies_[plugin_index];
+        state_changed_.wait(lock, [this, &dependencies]() {
+            return std::none_of(dependencies.cbegin(), dependencies.cend(), [this](const std::size_t dependency) {
+                return states_[dependency] == StepState::kPending;
+            });
+        });
+        if (!AreReady(dependencies))
+        {
+            states_[plugin_index] = StepState::kFailed;
+            lock.unlock();
+            state_changed_.notify_all();
+            return;
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const bool succeeded = step(plugin_index);
+    const auto duration = std::chrono::steady_clock::now() - start;
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        results[plugin_index] = PluginStepResult{true, succeeded, duration};
+        states_[plugin_index] = succeeded ? StepState::kSucceeded : StepState::kFailed;
+    }
+    state_changed_.notify_all();
+}
+
+bool PluginScheduler::AreReady(const std::vector<std::size_t>& ready_plugins) const
+{
+    return std::all_of(ready_plugins.cbegin(), ready_plugins.cend(), [this](const std::size_t plugin_index) {
+        return states_[plugin_index] == StepState::kSucceeded;
+    });
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,93 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef CODE_APP_DETAILS_PLUGIN_SCHEDULER_H
+#define CODE_APP_DETAILS_PLUGIN_SCHEDULER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+/// @brief Outcome of one lifecycle step of a plugin
+struct PluginStepResult
+{
+    /// @brief false if the step was skipped because a dependency failed
+    bool is_executed{false};
+    bool succeeded{false};
+    std::chrono::steady_clock::duration duration{};
+};
+
+///
+/// @brief Executes a lifecycle step, e.g. Initialize() or Run(), of all plugins concurrently
+///
+/// Every plugin gets its own thread. The step of a plugin starts as soon as the steps of all plugins it depends on
+/// succeeded, independent plugins are therefore not delayed by each other. A plugin whose dependency failed is skipped.
+///
+class PluginScheduler final
+{
+  public:
+    using Step = std::function<bool(const std::size_t plugin_index)>;
+    using ReadyCallback = std::function<void()>;
+
+    /// @param dependencies indices of the plugins each plugin depends on, indexed in plugin creation order
+    explicit PluginScheduler(std::vector<std::vector<std::size_t>> dependencies);
+
+    /// @brief Checks that all dependencies refer to existing plugins and contain no cycle
+    bool HasValidDependencies() const;
+
+    /// @brief Executes step for every plugin and waits until all steps are finished or skipped
+    ///
+    /// @param step executed once per plugin, returns whether it succeeded
+    /// @param ready_plugins plugins whose steps must have succeeded before on_ready is called
+    /// @param on_ready called once, as soon as the steps of all ready_plugins succeeded, while other steps may still
+    ///                 be executed. It is called right away if ready_plugins is empty and never if one of them fails.
+    /// @return result of every plugin, indexed in plugin creation order
+    ///
+    std::vector<PluginStepResult> Execute(const Step& step,
+                                          const std::vector<std::size_t>& ready_plugins,
+                                          const ReadyCallback& on_ready);
+
+  private:
+    enum class StepState : std::uint8_t
+    {
+        kPending,
+        kSucceeded,
+        kFailed,
+    };
+
+    void ExecuteStep(const std::size_t plugin_index, const Step& step, std::vector<PluginStepResult>& results);
+    bool AreReady(const std::vector<std::size_t>& ready_plugins) const;
+
+    const std::vector<std::vector<std::size_t>> dependencies_;
+    std::mutex mutex_;
+    std::condition_variable state_changed_;
+    std::vector<StepState> states_;
+};
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_APP_DETAILS_PLUGIN_SCHEDULER_H
@@ -0,0 +1,150 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/app/details/plugin_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace test
+{
+
+constexpr std::chrono::seconds kTimeout{5};
+
+TEST(PluginSchedulerTest, IndependentPluginsAreExecutedConcurrently)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::PluginScheduler::Execute()");
+    RecordProperty("Description", "This test ensures that the steps of independent plugins overlap.");
+
+    // Given two independent plugins whose steps only succeed if the other one runs at the same time
+    PluginScheduler scheduler{{{}, {}}};
+    ASSERT_TRUE(scheduler.HasValidDependencies());
+    std::promise<void> first_started{};
+    std::promise<void> second_started{};
+
+    // When the steps are executed
+    const auto results = scheduler.Execute(
+        [&first_started, &second_started](const std::size_t plugin_index) {
+            (plugin_index == 0U ? first_started : second_started).set_value();
+            auto other_started = (plugin_index == 0U ? second_started : first_started).get_future();
+            return other_started.wait_for(kTimeout) == std::future_status::ready;
+        },
+        {},
+        []() {});
+
+    // Then both steps succeed
+    ASSERT_EQ(results.size(), 2U);
+    EXPECT_TRUE(results[0].is_executed && results[0].succeeded);
+    EXPECT_TRUE(results[1].is_executed && results[1].succeeded);
+}
+
+TEST(PluginSchedulerTest, DependentPluginIsSkippedIfDependencyFails)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::PluginScheduler::Execute()");
+    RecordProperty("Description",
+                   "This test ensures that a dependent plugin is executed after its dependency succeeded and skipped "
+                   "if the dependency failed.");
+
+    // Given plugin 1 depends on plugin 0 and plugin 2 depends on plugin 1 which fails
+    PluginScheduler scheduler{{{}, {0U}, {1U}}};
+    ASSERT_TRUE(scheduler.HasValidDependencies());
+    std::atomic<bool> is_first_finished{false};
+    bool is_ready_called{false};
+
+    // When the steps are executed
+    const auto results = scheduler.Execute(
+        [&is_first_finished](const std::size_t plugin_index) {
+            if (plugin_index == 0U)
+            {
+                is_first_finished = true;
+                return true;
+            }
+            EXPECT_TRUE(is_first_finished);
+            return false;
+        },
+        {0U, 2U},
+        [&is_ready_called]() {
+            is_ready_called = true;
+        });
+
+    // Then plugin 2 is skipped and the readiness is never reached
+    EXPECT_TRUE(results[0].succeeded);
+    EXPECT_TRUE(results[1].is_executed);
+    EXPECT_FALSE(results[1].succeeded);
+    EXPECT_FALSE(results[2].is_executed);
+    EXPECT_FALSE(is_ready_called);
+}
+
+TEST(PluginSchedulerTest, ReadyCallbackDoesNotWaitForRemainingPlugins)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::PluginScheduler::Execute()");
+    RecordProperty("Description",
+                   "This test ensures that on_ready is called once the ready plugins succeeded, while other plugins "
+                   "are still executed.");
+
+    // Given plugin 1 only finishes after the readiness was reached
+    PluginScheduler scheduler{{{}, {}}};
+    std::promise<void> ready{};
+    auto ready_future = ready.get_future();
+
+    // When only plugin 0 is required for the readiness
+    const auto results = scheduler.Execute(
+        [&ready_future](const std::size_t plugin_index) {
+            return (plugin_index == 0U) || (ready_future.wait_for(kTimeout) == std::future_status::ready);
+        },
+        {0U},
+        [&ready]() {
+            ready.set_value();
+        });
+
+    // Then plugin 1 observes the readiness
+    EXPECT_TRUE(results[0].succeeded);
+    EXPECT_TRUE(results[1].succeeded);
+}
+
+TEST(PluginSchedulerTest, InvalidDependenciesAreDetected)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::PluginScheduler::HasValidDependencies()");
+    RecordProperty("Description", "This test ensures that cyclic and unknown dependencies are rejected.");
+
+    EXPECT_FALSE((PluginScheduler{{{1U}, {2U}, {0U}}}.HasValidDependencies()));
+    EXPECT_FALSE((PluginScheduler{{{0U}}}.HasValidDependencies()));
+    EXPECT_FALSE((PluginScheduler{{{}, {2U}}}.HasValidDependencies()));
+    EXPECT_TRUE((PluginScheduler{{{}, {0U}, {0U, 1U}}}.HasValidDependencies()));
+}
+
+}  // namespace test
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,479 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/app/details/config_daemon_impl.h"
+#include "score/config_management/config_daemon/code/factory/details/factory_loopback_impl.h"
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
+#include "score/config_management/config_daemon/code/plugins/plugin.h"
+#include "score/config_management/config_provider/code/config_provider/factory/factory_loopback.h"
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+#include "score/config_management/config_provider/code/memory/allocation_tracking.h"
+#include "score/config_management/config_provider/code/metrics/latency_histogram.h"
+#include "score/config_management/config_provider/code/persistency/persistency.h"
+#include "score/config_management/config_provider/code/proxies/details/loopback/internal_config_provider_impl.h"
+
+#include "platform/aas/mw/lifecycle/application.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/detail/common/recorder_factory.h"
+#include "score/mw/log/runtime.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/stop_token.hpp>
+#include <score/utility.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+using config_provider::loopback::LoopbackChannel;
+using config_provider::metrics::LatencyHistogram;
+
+constexpr std::array<std::size_t, 3U> kSetSizes{8U, 64U, 512U};
+constexpr std::size_t kSetsPerSize{16U};
+constexpr std::chrono::milliseconds kRequestTimeout{1000};
+constexpr std::chrono::seconds kNotificationTimeout{5};
+
+std::string GetSetName(const std::size_t set_size, const std::size_t index)
+{
+    return "set_" + std::to_string(set_size) + "_" + std::to_string(index);
+}
+
+std::vector<std::string> GetSetNames(const std::size_t set_size)
+{
+    std::vector<std::string> set_names{};
+    for (std::size_t index = 0U; index < kSetsPerSize; ++index)
+    {
+        set_names.push_back(GetSetName(set_size, index));
+    }
+    return set_names;
+}
+
+// Parameters of a synthetic parameter set, a mix of integers, float arrays and strings like in calibration data
+json::Object CreateParameters(const std::size_t set_size)
+{
+    std::string parameters{"{"};
+    for (std::size_t index = 0U; index < set_size; ++index)
+    {
+        parameters += (index == 0U) ? "" : ", ";
+        parameters += "\"parameter_" + std::to_string(index) + "\": ";
+        switch (index % 3U)
+        {
+            case 0U:
+                parameters += std::to_string(index);
+                break;
+            case 1U:
+                parameters += "[0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5]";
+                break;
+            default:
+                parameters += "\"value_" + std::to_string(index) + "\"";
+                break;
+        }
+    }
+    parameters += "}";
+    auto parsed = json::JsonParser{}.FromBuffer(parameters);
+    return std::move(parsed.value().As<json::Object>().value().get());
+}
+
+// Persistency which neither provides nor stores parameter sets, so every set is fetched from the ConfigDaemon
+class NoPersistency final : public config_provider::Persistency
+{
+  public:
+    void ReadCachedParameterSets(config_provider::ParameterMap&,
+                                 score::cpp::pmr::memory_resource*,
+                                 std::unique_ptr<score::filesystem::Filesystem>) noexcept override
+    {
+    }
+
+    void CacheParameterSet(const config_provider::ParameterMap&,
+                           const score::cpp::pmr::string,
+                           const std::shared_ptr<const config_provider::ParameterSet>,
+                           bool) noexcept override
+    {
+    }
+
+    void SyncToStorage() noexcept override {}
+};
+
+// Plugin which loads kSetsPerSize parameter sets of every size in kSetSizes and updates them on request, like a
+// calibration tool connected to the ConfigDaemon
+class SyntheticPlugin final : public IPlugin
+{
+  public:
+    bool MarksParameterSetsReady() const noexcept override
+    {
+        return true;
+    }
+
+    ResultBlank Initialize() override
+    {
+        return {};
+    }
+
+    void Deinitialize() noexcept override {}
+
+    std::int32_t Run(std::shared_ptr<data_model::IParameterSetCollection> parameterset_collection,
+                     LastUpdatedParameterSetSender cbk_send_last_updated_parameter_set,
+                     InitialQualifierStateSender,
+                     score::cpp::stop_token,
+                     std::shared_ptr<fault_event_reporter::IFaultEventReporter>) override
+    {
+        for (const auto set_size : kSetSizes)
+        {
+            for (std::size_t index = 0U; index < kSetsPerSize; ++index)
+            {
+                const auto set_name = GetSetName(set_size, index);
+                score::cpp::ignore = parameterset_collection->ReplaceParameterSet(set_name, CreateParameters(set_size));
+                score::cpp::ignore = parameterset_collection->SetCalibratable(set_name, true);
+                score::cpp::ignore = parameterset_collection->MarkParameterSetReady(set_name);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock{mutex_};
+        parameterset_collection_ = std::move(parameterset_collection);
+        send_last_updated_parameter_set_ = std::move(cbk_send_last_updated_parameter_set);
+        is_loaded_ = true;
+        loaded_.notify_all();
+        return 0;
+    }
+
+    void WaitUntilLoaded()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        loaded_.wait(lock, [this]() {
+            return is_loaded_;
+        });
+    }
+
+    // Sets the first parameter of the parameter set to value and announces the update to the clients
+    bool Update(const std::string& set_name, const std::int64_t value)
+    {
+        const std::string parameters{R"({"parameter_0": )" + std::to_string(value) + "}"};
+        std::lock_guard<std::mutex> lock{mutex_};
+        return parameterset_collection_->UpdateParameterSet(set_name, parameters).has_value() &&
+               send_last_updated_parameter_set_(set_name);
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable loaded_;
+    bool is_loaded_{false};
+    std::shared_ptr<data_model::IParameterSetCollection> parameterset_collection_;
+    LastUpdatedParameterSetSender send_last_updated_parameter_set_;
+};
+
+// ConfigDaemon running on its own thread with the SyntheticPlugin, serving its clients through a loopback channel
+class InProcessConfigDaemon
+{
+  public:
+    InProcessConfigDaemon()
+        : channel_{std::make_shared<LoopbackChannel>()}, plugin_{std::make_shared<SyntheticPlugin>()}
+    {
+        mw::log::detail::Configuration config{};
+        config.SetLogMode({mw::LogMode::kConsole});
+        config.SetDefaultConsoleLogLevel(mw::log::LogLevel::kWarn);
+        recorder_ = mw::log::detail::RecorderFactory().CreateRecorderFromLogMode(mw::LogMode::kConsole, config);
+        mw::log::detail::Runtime::SetRecorder(recorder_.get());
+
+        auto factory = std::make_unique<LoopbackFactory>(channel_, std::vector<std::shared_ptr<IPlugin>>{plugin_});
+        daemon_metrics_ = factory->GetDaemonMetrics();
+        config_daemon_ = std::make_unique<ConfigDaemon>(std::move(factory));
+
+        const char* arguments[]{"ConfigDaemon"};
+        score::cpp::ignore = config_daemon_->Initialize(ConfigDaemon::ApplicationContext{1, arguments});
+        daemon_thread_ = std::thread{[this]() {
+            score::cpp::ignore = config_daemon_->Run(stop_source_.get_token());
+        }};
+        plugin_->WaitUntilLoaded();
+        while (!channel_->IsOffered())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+
+        // fetch every parameter set once, so the benchmarks don't measure the first serialization in the ConfigDaemon
+        config_provider::LoopbackInternalConfigProvider proxy{channel_};
+        for (const auto set_size : kSetSizes)
+        {
+            for (const auto& set_name : GetSetNames(set_size))
+            {
+                score::cpp::ignore = proxy.GetParameterSet(set_name, kRequestTimeout);
+            }
+        }
+    }
+
+    InProcessConfigDaemon(InProcessConfigDaemon&&) = delete;
+    InProcessConfigDaemon(const InProcessConfigDaemon&) = delete;
+    InProcessConfigDaemon& operator=(InProcessConfigDaemon&&) = delete;
+    InProcessConfigDaemon& operator=(const InProcessConfigDaemon&) = delete;
+
+    ~InProcessConfigDaemon()
+    {
+        score::cpp::ignore = stop_source_.request_stop();
+        daemon_thread_.join();
+        config_daemon_.reset();
+        mw::log::detail::Runtime::SetRecorder(nullptr);
+    }
+
+    const std::shared_ptr<LoopbackChannel>& GetChannel() const noexcept
+    {
+        return channel_;
+    }
+
+    SyntheticPlugin& GetPlugin() noexcept
+    {
+        return *plugin_;
+    }
+
+    const metrics::DaemonMetrics& GetDaemonMetrics() const noexcept
+    {
+        return *daemon_metrics_;
+    }
+
+  private:
+    std::unique_ptr<mw::log::detail::Recorder> recorder_;
+    const std::shared_ptr<LoopbackChannel> channel_;
+    const std::shared_ptr<SyntheticPlugin> plugin_;
+    std::shared_ptr<metrics::DaemonMetrics> daemon_metrics_;
+    std::unique_ptr<ConfigDaemon> config_daemon_;
+    score::cpp::stop_source stop_source_;
+    std::thread daemon_thread_;
+};
+
+// The ConfigDaemon is started once and shared by all benchmarks, like the daemon of a real system
+InProcessConfigDaemon& GetConfigDaemon()
+{
+    static InProcessConfigDaemon config_daemon{};
+    return config_daemon;
+}
+
+void ReportLatency(benchmark::State& state, const std::string& prefix, const LatencyHistogram& histogram)
+{
+    const auto snapshot = histogram.GetSnapshot();
+    state.counters[prefix + "_p50_us"] = static_cast<double>(snapshot.p50_us);
+    state.counters[prefix + "_p99_us"] = static_cast<double>(snapshot.p99_us);
+    state.counters[prefix + "_max_us"] = static_cast<double>(snapshot.max_us);
+}
+
+// Average of the histogram values recorded between two snapshots
+double GetAverageUs(const metrics::LatencyHistogramSnapshot& before, const metrics::LatencyHistogramSnapshot& after)
+{
+    const auto count = after.count - before.count;
+    return (count == 0U) ? 0.0 : static_cast<double>(after.sum_us - before.sum_us) / static_cast<double>(count);
+}
+
+// Fetch of a whole parameter set from the ConfigDaemon, i.e. a cache miss of a ConfigProvider, with one client per
+// thread. The ConfigDaemon serves the requests on the requesting threads, so daemon_us_per_request is the time spent
+// in the ConfigDaemon per request, i.e. its CPU time as long as the threads don't outnumber the cores. lock_wait_us is
+// the part of it the ConfigDaemon waited for the lock of its parameter set collection.
+void BM_FetchParameterSet(benchmark::State& state)
+{
+    auto& config_daemon = GetConfigDaemon();
+    static std::unique_ptr<LatencyHistogram> latency{};
+    static config_provider::loopback::LoopbackChannelStatistics channel_before{};
+    static metrics::DaemonMetricsSnapshot daemon_before{};
+    if (state.thread_index() == 0)
+    {
+        latency = std::make_unique<LatencyHistogram>();
+        channel_before = config_daemon.GetChannel()->GetStatistics();
+        daemon_before = config_daemon.GetDaemonMetrics().GetSnapshot();
+    }
+
+    const auto set_names = GetSetNames(static_cast<std::size_t>(state.range(0)));
+    config_provider::LoopbackInternalConfigProvider proxy{config_daemon.GetChannel()};
+    auto index = static_cast<std::size_t>(state.thread_index());
+    for (auto _ : state)
+    {
+        const auto start = Clock::now();
+        auto parameter_set = proxy.GetParameterSet(set_names[index % kSetsPerSize], kRequestTimeout);
+        latency->Record(Clock::now() - start);
+        if (!parameter_set.has_value())
+        {
+            state.SkipWithError("Fetching the parameter set failed");
+            break;
+        }
+        benchmark::DoNotOptimize(parameter_set);
+        ++index;
+    }
+
+    if (state.thread_index() == 0)
+    {
+        const auto channel_after = config_daemon.GetChannel()->GetStatistics();
+        const auto daemon_after = config_daemon.GetDaemonMetrics().GetSnapshot();
+        ReportLatency(state, "fetch", *latency);
+        state.counters["daemon_us_per_request"] =
+            GetAverageUs(channel_before.request_latency, channel_after.request_latency);
+        state.counters["lock_wait_us"] = GetAverageUs(daemon_before.lock_wait_time, daemon_after.lock_wait_time);
+        state.counters["failed_requests"] =
+            static_cast<double>(channel_after.failed_requests - channel_before.failed_requests);
+    }
+}
+BENCHMARK(BM_FetchParameterSet)
+    ->ArgName("parameters")
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(512)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->UseRealTime();
+
+// Clients waiting for updates of one parameter set, the callbacks count the ones which observed the awaited value
+class UpdateObserver
+{
+  public:
+    void Expect(const std::int64_t value)
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        expected_value_ = value;
+        notified_clients_ = 0U;
+        update_time_ = Clock::now();
+    }
+
+    void OnChanged(const std::shared_ptr<const config_provider::ParameterSet>& parameter_set)
+    {
+        const auto value = parameter_set->GetParameterAs<std::int64_t>("parameter_0");
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (value.has_value() && (value.value() == expected_value_))
+        {
+            latency_.Record(Clock::now() - update_time_);
+            ++notified_clients_;
+            notified_.notify_all();
+        }
+    }
+
+    bool WaitUntilNotified(const std::size_t client_count)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        return notified_.wait_for(lock, kNotificationTimeout, [this, client_count]() {
+            return notified_clients_ == client_count;
+        });
+    }
+
+    const LatencyHistogram& GetLatency() const noexcept
+    {
+        return latency_;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable notified_;
+    std::int64_t expected_value_{-1};
+    std::size_t notified_clients_{0U};
+    Clock::time_point update_time_{};
+    LatencyHistogram latency_{};
+};
+
+// Time from an update by a plugin until the OnChangedParameterSet callbacks of all clients observed it, including the
+// event delivery and the fetch of the changes by every client
+void BM_UpdateToCallback(benchmark::State& state)
+{
+    // values written by earlier runs never match, the ConfigDaemon keeps its parameter sets across the benchmarks
+    static std::int64_t last_value{0};
+    auto& config_daemon = GetConfigDaemon();
+    const auto set_name = GetSetName(static_cast<std::size_t>(state.range(0)), 0U);
+    const auto client_count = static_cast<std::size_t>(state.range(1));
+
+    UpdateObserver observer{};
+    score::cpp::stop_source stop_source{};
+    std::vector<score::cpp::pmr::unique_ptr<config_provider::ConfigProvider>> clients{};
+    for (std::size_t index = 0U; index < client_count; ++index)
+    {
+        clients.push_back(config_provider::LoopbackConfigProviderFactory{}.Create(
+            config_daemon.GetChannel(),
+            stop_source.get_token(),
+            kRequestTimeout,
+            score::cpp::pmr::make_unique<NoPersistency>(score::cpp::pmr::get_default_resource())));
+        score::cpp::ignore = clients.back()->GetParameterSet(set_name, kRequestTimeout);
+        score::cpp::ignore = clients.back()->OnChangedParameterSet(
+            set_name, [&observer](std::shared_ptr<const config_provider::ParameterSet> parameter_set) {
+                observer.OnChanged(parameter_set);
+            });
+    }
+
+    for (auto _ : state)
+    {
+        ++last_value;
+        observer.Expect(last_value);
+        if (!config_daemon.GetPlugin().Update(set_name, last_value) || !observer.WaitUntilNotified(client_count))
+        {
+            state.SkipWithError("Not all clients were notified about the update");
+            break;
+        }
+    }
+
+    ReportLatency(state, "callback", observer.GetLatency());
+    score::cpp::ignore = stop_source.request_stop();
+    clients.clear();
+}
+BENCHMARK(BM_UpdateToCallback)
+    ->ArgNames({"parameters", "clients"})
+    ->ArgsProduct({{8, 512}, {1, 4, 16}})
+    ->UseRealTime();
+
+// Heap memory a ConfigProvider allocates per parameter set in its cache
+void BM_MemoryPerCachedSet(benchmark::State& state)
+{
+    auto& config_daemon = GetConfigDaemon();
+    const auto set_names = GetSetNames(static_cast<std::size_t>(state.range(0)));
+    std::int64_t bytes_per_set{0};
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        score::cpp::stop_source stop_source{};
+        auto client = config_provider::LoopbackConfigProviderFactory{}.Create(
+            config_daemon.GetChannel(),
+            stop_source.get_token(),
+            kRequestTimeout,
+            score::cpp::pmr::make_unique<NoPersistency>(score::cpp::pmr::get_default_resource()));
+        const auto live_bytes_before = config_provider::memory::GetLiveHeapBytes();
+        state.ResumeTiming();
+
+        for (const auto& set_name : set_names)
+        {
+            benchmark::DoNotOptimize(client->GetParameterSet(set_name, kRequestTimeout));
+        }
+
+        state.PauseTiming();
+        bytes_per_set = (config_provider::memory::GetLiveHeapBytes() - live_bytes_before) /
+                        static_cast<std::int64_t>(kSetsPerSize);
+        score::cpp::ignore = stop_source.request_stop();
+        client.reset();
+        state.ResumeTiming();
+    }
+    state.counters["bytes_per_set"] = static_cast<double>(bytes_per_set);
+}
+BENCHMARK(BM_MemoryPerCachedSet)->ArgName("parameters")->Arg(8)->Arg(64)->Arg(512)->Iterations(16);
+
+}  // namespace
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,190 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/data_model/details/collection_snapshot.h"
+#include "score/config_management/config_daemon/code/data_model/error/error.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace data_model
+{
+namespace
+{
+
+constexpr std::string_view kSnapshotMagic{"CDSN"};
+constexpr std::uint32_t kSnapshotVersion{1U};
+constexpr std::size_t kHeaderSize{kSnapshotMagic.size() + (2U * sizeof(std::uint32_t))};
+constexpr std::size_t kEntryHeaderSize{4U * sizeof(std::uint32_t)};
+constexpr std::size_t kTrailerSize{sizeof(std::uint32_t)};
+
+void AppendUint32(std::string& buffer, const std::uint32_t value)
+{
+    score::cpp::ignore = buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::uint32_t ReadUint32(const char* const data) noexcept
+{
+    std::uint32_t value{0U};
+    score::cpp::ignore = std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+std::uint32_t CalculateCrc(const char* const data, const std::size_t size) noexcept
+{
+    return static_cast<std::uint32_t>(
+        ::crc32(::crc32(0UL, Z_NULL, 0U), reinterpret_cast<const Bytef*>(data), static_cast<uInt>(size)));
+}
+
+}  // namespace
+
+std::string EncodeCollectionSnapshot(const std::vector<CollectionSnapshotEntry>& entries)
+{
+    std::size_t snapshot_size{kHeaderSize + kTrailerSize};
+    for (const auto& entry : entries)
+    {
+        snapshot_size += kEntryHeaderSize + entry.set_name.size() + entry.serialized_set.size();
+    }
+
+    std::string buffer{};
+    buffer.reserve(snapshot_size);
+    score::cpp::ignore = buffer.append(kSnapshotMagic);
+    AppendUint32(buffer, kSnapshotVersion);
+    AppendUint32(buffer, static_cast<std::uint32_t>(entries.size()));
+    for (const auto& entry : entries)
+    {
+        AppendUint32(buffer, static_cast<std::uint32_t>(score::cpp::to_underlying(entry.qualifier)));
+        AppendUint32(buffer, entry.is_calibratable ? 1U : 0U);
+        AppendUint32(buffer, static_cast<std::uint32_t>(entry.set_name.size()));
+        AppendUint32(buffer, static_cast<std::uint32_t>(entry.serialized_set.size()));
+        score::cpp::ignore = buffer.append(entry.set_name);
+        score::cpp::ignore = buffer.append(entry.serialized_set);
+    }
+    AppendUint32(buffer, CalculateCrc(buffer.data(), buffer.size()));
+    return buffer;
+}
+
+ResultBlank WriteCollectionSnapshot(const std::string& path, const std::string_view encoded_snapshot) noexcept
+{
+    const std::string temporary_path{path + ".tmp"};
+    const int file_descriptor = ::open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file_descriptor < 0)
+    {
+        return MakeUnexpected(DataModelError::kSnapshotWriteError, "Unable to create snapshot file");
+    }
+    std::size_t written{0U};
+    while (written < encoded_snapshot.size())
+    {
+        const auto result =
+            ::write(file_descriptor, encoded_snapshot.data() + written, encoded_snapshot.size() - written);
+        if ((result < 0) && (errno != EINTR))
+        {
+            break;
+        }
+        written += (result < 0) ? 0U : static_cast<std::size_t>(result);
+    }
+    const bool is_synced = (written == encoded_snapshot.size()) && (::fsync(file_descriptor) == 0);
+    score::cpp::ignore = ::close(file_descriptor);
+    if ((!is_synced) || (std::rename(temporary_path.c_str(), path.c_str()) != 0))
+    {
+        score::cpp::ignore = std::remove(temporary_path.c_str());
+        return MakeUnexpected(DataModelError::kSnapshotWriteError, "Unable to replace snapshot file");
+    }
+    return {};
+}
+
+Result<CollectionSnapshot> ReadCollectionSnapshot(const std::string& path) noexcept
+{
+    const int file_descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0)
+    {
+        return MakeUnexpected(DataModelError::kSnapshotReadError, "Snapshot file does not exist");
+    }
+    struct stat file_status
+    {
+    };
+    std::size_t file_size{0U};
+    void* address{MAP_FAILED};
+    if ((::fstat(file_descriptor, &file_status) == 0) &&
+        (static_cast<std::size_t>(file_status.st_size) >= (kHeaderSize + kTrailerSize)))
+    {
+        file_size = static_cast<std::size_t>(file_status.st_size);
+        address = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    }
+    score::cpp::ignore = ::close(file_descriptor);
+    if (address == MAP_FAILED)
+    {
+        return MakeUnexpected(DataModelError::kSnapshotReadError, "Unable to map snapshot file");
+    }
+
+    CollectionSnapshot snapshot{};
+    snapshot.storage = std::shared_ptr<const void>{address, [file_size](const void* const mapped_address) noexcept {
+                                                       score::cpp::ignore =
+                                                           ::munmap(const_cast<void*>(mapped_address), file_size);
+                                                   }};
+    const char* const data = static_cast<const char*>(address);
+    const std::size_t content_size{file_size - kTrailerSize};
+    if ((std::string_view{data, kSnapshotMagic.size()} != kSnapshotMagic) ||
+        (ReadUint32(data + kSnapshotMagic.size()) != kSnapshotVersion) ||
+        (ReadUint32(data + content_size) != CalculateCrc(data, content_size)))
+    {
+        return MakeUnexpected(DataModelError::kSnapshotReadError, "Snapshot file is corrupted");
+    }
+
+    const std::uint32_t entry_count = ReadUint32(data + kSnapshotMagic.size() + sizeof(std::uint32_t));
+    std::size_t offset{kHeaderSize};
+    for (std::uint32_t index{0U}; index < entry_count; ++index)
+    {
+        if ((content_size - offset) < kEntryHeaderSize)
+        {
+            return MakeUnexpected(DataModelError::kSnapshotReadError, "Snapshot file is truncated");
+        }
+        CollectionSnapshotEntry entry{};
+        entry.qualifier = static_cast<ParameterSetQualifier>(ReadUint32(data + offset));
+        entry.is_calibratable = (ReadUint32(data + offset + sizeof(std::uint32_t)) != 0U);
+        const std::size_t name_size = ReadUint32(data + offset + (2U * sizeof(std::uint32_t)));
+        const std::size_t set_size = ReadUint32(data + offset + (3U * sizeof(std::uint32_t)));
+        offset += kEntryHeaderSize;
+        if ((content_size - offset) < (name_size + set_size))
+        {
+            return MakeUnexpected(DataModelError::kSnapshotReadError, "Snapshot file is truncated");
+        }
+        entry.set_name = std::string_view{data + offset, name_size};
+        entry.serialized_set = std::string_view{data + offset + name_size, set_size};
+        offset += name_size + set_size;
+        snapshot.entries.push_back(entry);
+    }
+    return snapshot;
+}
+
+}  // namespace data_model
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,89 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef CODE_DATA_MODEL_DETAILS_COLLECTION_SNAPSHOT_H
+#define CODE_DATA_MODEL_DETAILS_COLLECTION_SNAPSHOT_H
+
+#include "score/config_management/config_daemon/code/data_model/parameter_set_qualifier.h"
+
+#include "score/result/result.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace data_model
+{
+
+///
+/// @brief Warm-restart snapshot of a ParameterSetCollection
+///
+/// The snapshot holds every parameter set as served to the clients together with its qualifier and calibratable
+/// flag. All numbers are stored as unsigned 32-bit integers in host byte order, the file is only read again by the
+/// daemon on the same ECU:
+///
+///   header:  | magic "CDSN" | version | entry count |
+///   entry:   | qualifier | calibratable | name size | set size | name | serialized parameter set |
+///   trailer: | crc |
+///
+/// The CRC-32 covers everything in front of the trailer. A snapshot with an unknown version, a wrong CRC or a
+/// truncated entry is rejected as a whole.
+///
+
+struct CollectionSnapshotEntry
+{
+    std::string_view set_name;
+    std::string_view serialized_set;
+    ParameterSetQualifier qualifier{ParameterSetQualifier::kUnqualified};
+    bool is_calibratable{false};
+};
+
+struct CollectionSnapshot
+{
+    /// @brief Owner of the memory the entries refer to
+    std::shared_ptr<const void> storage;
+    std::vector<CollectionSnapshotEntry> entries;
+};
+
+/// @brief Encodes the entries into the snapshot file format
+std::string EncodeCollectionSnapshot(const std::vector<CollectionSnapshotEntry>& entries);
+
+/// @brief Replaces the snapshot file by the encoded snapshot
+///
+/// The snapshot is written and synced to a temporary file next to the target which is then renamed, so a crash
+/// during the write leaves the previous snapshot intact.
+///
+/// @return blank or kSnapshotWriteError
+///
+ResultBlank WriteCollectionSnapshot(const std::string& path, const std::string_view encoded_snapshot) noexcept;
+
+/// @brief Maps the snapshot file into memory, the serialized parameter sets are neither copied nor parsed
+///
+/// @return snapshot or kSnapshotReadError if the file does not exist or is corrupted
+///
+Result<CollectionSnapshot> ReadCollectionSnapshot(const std::string& path) noexcept;
+
+}  // namespace data_model
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_DATA_MODEL_DETAILS_COLLECTION_SNAPSHOT_H
@@ -0,0 +1,91 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/data_model/details/collection_snapshot.h"
+#include "score/config_management/config_daemon/code/data_model/error/error.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace data_model
+{
+namespace test
+{
+
+class CollectionSnapshotTest : public ::testing::Test
+{
+  protected:
+    const std::string snapshot_path_{::testing::TempDir() + "collection_snapshot_test.snapshot"};
+};
+
+TEST_F(CollectionSnapshotTest, WrittenSnapshotIsReadBack)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::data_model::ReadCollectionSnapshot()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that all entries of a written snapshot are read back unchanged.");
+
+    const std::vector<CollectionSnapshotEntry> entries{
+        {"set_name_1", R"({"parameters":{"a":1},"qualifier":1})", ParameterSetQualifier::kQualified, true},
+        {"set_name_2", R"({"parameters":{},"qualifier":3})", ParameterSetQualifier::kModified, false}};
+    ASSERT_TRUE(WriteCollectionSnapshot(snapshot_path_, EncodeCollectionSnapshot(entries)).has_value());
+
+    const auto snapshot = ReadCollectionSnapshot(snapshot_path_);
+
+    ASSERT_TRUE(snapshot.has_value());
+    ASSERT_EQ(snapshot.value().entries.size(), entries.size());
+    for (std::size_t index{0U}; index < entries.size(); ++index)
+    {
+        EXPECT_EQ(snapshot.value().entries[index].set_name, entries[index].set_name);
+        EXPECT_EQ(snapshot.value().entries[index].serialized_set, entries[index].serialized_set);
+        EXPECT_EQ(snapshot.value().entries[index].qualifier, entries[index].qualifier);
+        EXPECT_EQ(snapshot.value().entries[index].is_calibratable, entries[index].is_calibratable);
+    }
+}
+
+TEST_F(CollectionSnapshotTest, CorruptedSnapshotIsRejected)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::data_model::ReadCollectionSnapshot()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a snapshot with a modified or truncated content is rejected.");
+
+    std::string encoded_snapshot = EncodeCollectionSnapshot(
+        {{"set_name", R"({"parameters":{"a":1},"qualifier":0})", ParameterSetQualifier::kUnqualified, false}});
+    encoded_snapshot[encoded_snapshot.size() / 2U] ^= 0x01;
+    ASSERT_TRUE(WriteCollectionSnapshot(snapshot_path_, encoded_snapshot).has_value());
+    EXPECT_EQ(ReadCollectionSnapshot(snapshot_path_).error(), DataModelError::kSnapshotReadError);
+
+    std::ofstream{snapshot_path_, std::ios::trunc} << "CDSN";
+    EXPECT_EQ(ReadCollectionSnapshot(snapshot_path_).error(), DataModelError::kSnapshotReadError);
+}
+
+}  // namespace test
+}  // namespace data_model
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -14,7 +14,9 @@
 #include "score/config_management/config_daemon/code/data_model/details/parameter_set_impl.h"
 #include "score/config_management/config_daemon/code/data_model/details/common.h"
 #include "score/config_management/config_daemon/code/data_model/error/error.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
 
+#include "score/json/json_parser.h"
 #include "score/json/json_writer.h"
 
 namespace score
@@ -31,18 +33,92 @@ ParameterSet::ParameterSet(std::unique_ptr<json::IJsonWriter> json_writer)
       data_{},
       json_writer_{std::move(json_writer)},
       qualifier_{},
-      is_calibratable_{false}
+      is_calibratable_{false},
+      restored_set_{},
+      restored_storage_{},
+      restored_parameters_{},
+      is_reconciled_{true},
+      version_{0U},
+      oldest_base_version_{0U},
+      change_history_{},
+      pending_changes_{},
+      digest_{}
 {
 }
 
+ParameterSet::ParameterSet(std::unique_ptr<json::IJsonWriter> json_writer,
+                           const std::string_view restored_set,
+                           std::shared_ptr<const void> restored_storage)
+    : ParameterSet{std::move(json_writer)}
+{
+    restored_set_ = restored_set;
+    restored_storage_ = std::move(restored_storage);
+    is_reconciled_ = false;
+}
+
+ResultBlank ParameterSet::Materialize()
+{
+    if (restored_storage_ == nullptr)
+    {
+        return {};
+    }
+
+    const json::JsonParser json_parser{};
+    auto parsing_result = json_parser.FromBuffer(restored_set_);
+    restored_set_ = std::string_view{};
+    restored_storage_.reset();
+    if (!parsing_result.has_value())
+    {
+        logger_.LogError() << "ParameterSet::" << __func__ << "restored parameter set can't be parsed";
+        return MakeUnexpected(DataModelError::kParsingError, "Restored parameter set can't be parsed");
+    }
+    auto set_object = parsing_result.value().As<json::Object>();
+    if (!set_object.has_value())
+    {
+        return MakeUnexpected(DataModelError::kParsingError, "Restored parameter set is not an object");
+    }
+    auto parameters = set_object.value().get().find("parameters");
+    if (parameters == set_object.value().get().end())
+    {
+        return MakeUnexpected(DataModelError::kParsingError, "Restored parameter set has no parameters");
+    }
+    auto parameters_object = parameters->second.As<json::Object>();
+    if (!parameters_object.has_value())
+    {
+        return MakeUnexpected(DataModelError::kParsingError, "Restored parameters are not an object");
+    }
+    for (auto& parameter : parameters_object.value().get())
+    {
+        const auto parameter_name = AsString(parameter.first.GetAsStringView());
+        data_[parameter_name].SetValue(std::move(parameter.second));
+        score::cpp::ignore = restored_parameters_.insert(parameter_name);
+    }
+    return {};
+}
+
 ResultBlank ParameterSet::Add(const score::cpp::string_view parameter_name, json::Any&& parameter_value)
 {
+    score::cpp::ignore = Materialize();
+    is_reconciled_ = true;
+
     Parameter parameter;
     parameter.SetValue(std::move(parameter_value));
 
+    // the first Add of a restored parameter reconciles it with the value provided by the plugin
+    const auto restored_parameter = restored_parameters_.find(AsString(parameter_name));
+    if (restored_parameter != restored_parameters_.end())
+    {
+        data_[*restored_parameter] = std::move(parameter);
+        RecordChange(*restored_parameter);
+        score::cpp::ignore = restored_parameters_.erase(restored_parameter);
+        logger_.LogDebug() << __func__ << "restored parameter with name:" << parameter_name << "reconciled";
+        return ResultBlank{};
+    }
+
     const bool inserted = data_.try_emplace(AsString(parameter_name), std::move(parameter)).second;
     if (inserted)
     {
+        RecordChange(AsString(parameter_name));
         logger_.LogDebug() << __func__ << "parameter with name:" << parameter_name << "added";
     }
     else
@@ -59,6 +135,12 @@ ResultBlank ParameterSet::Update(json::Object&& parameters)
     // check if the parameter set is calibratable
     if (is_calibratable_)
     {
+        const auto materialize_result = Materialize();
+        if (!materialize_result.has_value())
+        {
+            return materialize_result;
+        }
+
         // check if any input parameters is not found
         // and if so, the whole update request will be reject
         auto all_parameters_exist = true;
@@ -80,6 +162,7 @@ ResultBlank ParameterSet::Update(json::Object&& parameters)
             {
                 const auto parameter_name = AsString(param.first.GetAsStringView());
                 data_[parameter_name].SetValue(std::move(param.second));
+                RecordChange(parameter_name);
                 logger_.LogInfo() << __func__ << "parameter with name:" << parameter_name << "updated";
             }
             return score::cpp::blank{};
@@ -95,8 +178,182 @@ ResultBlank ParameterSet::Update(json::Object&& parameters)
     }
 }
 
+void ParameterSet::Replace(json::Object&& parameters)
+{
+    if (restored_storage_ != nullptr)
+    {
+        // the parameters of a restored set are not known without parsing it, so no delta can be served across Replace
+        oldest_base_version_ = 0U;
+    }
+    restored_set_ = std::string_view{};
+    restored_storage_.reset();
+    restored_parameters_.clear();
+    is_reconciled_ = true;
+    auto previous_data = std::move(data_);
+    data_.clear();
+    for (auto& parameter : parameters)
+    {
+        // only parameters whose value differs are recorded, so reloading an unchanged set yields an empty delta
+        const auto parameter_name = AsString(parameter.first.GetAsStringView());
+        const auto previous_parameter = previous_data.find(parameter_name);
+        const bool is_unchanged = (previous_parameter != previous_data.end()) &&
+                                  (previous_parameter->second.GetValue() == parameter.second);
+        if (!is_unchanged)
+        {
+            RecordChange(parameter_name);
+        }
+        data_[parameter_name].SetValue(std::move(parameter.second));
+    }
+    for (const auto& previous_parameter : previous_data)
+    {
+        if (data_.count(previous_parameter.first) == 0U)
+        {
+            RecordChange(previous_parameter.first);
+        }
+    }
+    logger_.LogDebug() << __func__ << data_.size() << "parameters replaced";
+}
+
+void ParameterSet::RecordChange(const score::cpp::pmr::string& parameter_name)
+{
+    score::cpp::ignore = pending_changes_.insert(parameter_name);
+}
+
+std::uint64_t ParameterSet::GetVersion() const
+{
+    return version_;
+}
+
+void ParameterSet::CommitChanges(const std::uint64_t version)
+{
+    if (oldest_base_version_ == 0U)
+    {
+        // the set is created (or replaced without known parameters), clients only get deltas based on this version
+        change_history_.clear();
+        oldest_base_version_ = version;
+    }
+    else
+    {
+        change_history_.push_back(Change{version, {pending_changes_.begin(), pending_changes_.end()}});
+        if (change_history_.size() > kChangeHistoryLength)
+        {
+            oldest_base_version_ = change_history_.front().version;
+            change_history_.pop_front();
+        }
+    }
+    pending_changes_.clear();
+    version_ = version;
+    digest_ = score::cpp::nullopt;
+}
+
+Result<std::uint64_t> ParameterSet::GetDigest()
+{
+    if (!digest_.has_value())
+    {
+        const auto binary_set = GetParameterSetAsBinary();
+        if (!binary_set.has_value())
+        {
+            return MakeUnexpected<std::uint64_t>(binary_set.error());
+        }
+        digest_ = config_provider::wire_format::ComputeBinarySetDigest(
+            std::string_view{binary_set.value().data(), binary_set.value().size()});
+    }
+    return digest_.value();
+}
+
+bool ParameterSet::IsModifiedSince(const std::uint64_t base_version, const std::uint64_t base_digest)
+{
+    if ((version_ != 0U) && (base_version == version_))
+    {
+        return false;
+    }
+    if (base_digest == 0U)
+    {
+        return true;
+    }
+    const auto digest = GetDigest();
+    return (!digest.has_value()) || (digest.value() != base_digest);
+}
+
+Result<score::cpp::pmr::string> ParameterSet::GetChangesAsString(const std::uint64_t base_version,
+                                                                 const std::uint64_t base_digest)
+{
+    json::Object changes{};
+    if (!IsModifiedSince(base_version, base_digest))
+    {
+        // the client rebases its set on the current version, neither the parameters nor the qualifier are serialized
+        changes["version"] = json::Any{version_};
+        changes["is_modified"] = json::Any{false};
+        return Serialize(changes);
+    }
+
+    const auto materialize_result = Materialize();
+    if (!materialize_result.has_value())
+    {
+        return MakeUnexpected<score::cpp::pmr::string>(materialize_result.error());
+    }
+
+    bool is_complete =
+        (oldest_base_version_ == 0U) || (base_version < oldest_base_version_) || (base_version > version_);
+    std::unordered_set<score::cpp::pmr::string> changed_parameters{};
+    if (!is_complete)
+    {
+        for (const auto& change : change_history_)
+        {
+            if (change.version > base_version)
+            {
+                changed_parameters.insert(change.parameter_names.begin(), change.parameter_names.end());
+            }
+        }
+        is_complete = (!data_.empty()) && (changed_parameters.size() >= data_.size());
+    }
+
+    if (is_complete)
+    {
+        changes = GetParameterSetAsJson();
+    }
+    else
+    {
+        json::Object parameters{};
+        json::List removed_parameters{};
+        for (const auto& parameter_name : changed_parameters)
+        {
+            const auto parameter = data_.find(parameter_name);
+            if (parameter != data_.end())
+            {
+                parameters[parameter_name.c_str()] = parameter->second.GetValue().CloneByValue();
+            }
+            else
+            {
+                removed_parameters.emplace_back(std::string{parameter_name.data(), parameter_name.size()});
+            }
+        }
+        changes["parameters"] = std::move(parameters);
+        changes["removed_parameters"] = std::move(removed_parameters);
+        changes["qualifier"] = json::Any{score::cpp::to_underlying(qualifier_)};
+    }
+    changes["version"] = json::Any{version_};
+    changes["is_complete"] = json::Any{is_complete};
+    return Serialize(changes);
+}
+
+Result<score::cpp::pmr::string> ParameterSet::Serialize(const json::Object& changes) const
+{
+    auto result = json_writer_->ToBuffer(changes);
+    if (not result.has_value())
+    {
+        const auto error = result.error().Message();
+        return MakeUnexpected(DataModelError::kConvertingError, error);
+    }
+    return score::cpp::pmr::string{result.value().data(), result.value().size()};
+}
+
 Result<score::cpp::pmr::string> ParameterSet::GetParameterSetAsString() const
 {
+    if (restored_storage_ != nullptr)
+    {
+        return score::cpp::pmr::string{restored_set_.data(), restored_set_.size()};
+    }
     auto result = json_writer_->ToBuffer(GetParameterSetAsJson());
     if (not result.has_value())
     {
@@ -106,8 +363,42 @@ Result<score::cpp::pmr::string> ParameterSet::GetParameterSetAsString() const
     return result.value().c_str();
 }
 
+Result<score::cpp::pmr::string> ParameterSet::GetParameterSetAsBinary() const
+{
+    Result<std::string> encode_result{};
+    if (restored_storage_ != nullptr)
+    {
+        // a restored set is not materialized for a read, its serialized parameters are encoded as they are
+        const json::JsonParser json_parser{};
+        const auto parsing_result = json_parser.FromBuffer(restored_set_);
+        if ((!parsing_result.has_value()) || (!parsing_result.value().As<json::Object>().has_value()))
+        {
+            logger_.LogError() << "ParameterSet::" << __func__ << "restored parameter set can't be parsed";
+            return MakeUnexpected(DataModelError::kParsingError, "Restored parameter set can't be parsed");
+        }
+        const auto& set_object = parsing_result.value().As<json::Object>().value().get();
+        encode_result = config_provider::wire_format::EncodeBinarySet(set_object);
+    }
+    else
+    {
+        encode_result = config_provider::wire_format::EncodeBinarySet(GetParameterSetAsJson());
+    }
+
+    if (!encode_result.has_value())
+    {
+        const auto error = encode_result.error().Message();
+        return MakeUnexpected(DataModelError::kConvertingError, error);
+    }
+    return score::cpp::pmr::string{encode_result.value().data(), encode_result.value().size()};
+}
+
 Result<json::Any> ParameterSet::GetParameter(const score::cpp::string_view parameter_name)
 {
+    const auto materialize_result = Materialize();
+    if (!materialize_result.has_value())
+    {
+        return MakeUnexpected<json::Any>(materialize_result.error());
+    }
     auto iter = data_.find(AsString(parameter_name));
     if (iter == data_.end())
     {
@@ -136,11 +427,34 @@ json::Object ParameterSet::GetParameterSetAsJson() const
     return parameter_set;
 }
 
+bool ParameterSet::IsReconciled() const
+{
+    return is_reconciled_;
+}
+
+bool ParameterSet::RemoveUnreconciledParameters()
+{
+    for (const auto& parameter_name : restored_parameters_)
+    {
+        score::cpp::ignore = data_.erase(parameter_name);
+        RecordChange(parameter_name);
+        logger_.LogDebug() << __func__ << "restored parameter with name:" << parameter_name << "removed";
+    }
+    const bool is_removed = !restored_parameters_.empty();
+    restored_parameters_.clear();
+    return is_removed;
+}
+
 void ParameterSet::SetCalibratable(const bool is_calibratable)
 {
     is_calibratable_ = is_calibratable;
 }
 
+bool ParameterSet::IsCalibratable() const
+{
+    return is_calibratable_;
+}
+
 void ParameterSet::SetQualifier(const ParameterSetQualifier qualifier)
 {
     qualifier_ = qualifier;
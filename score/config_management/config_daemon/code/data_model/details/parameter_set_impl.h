@@ -24,8 +24,14 @@
 #include <score/optional.hpp>
 #include <score/string.hpp>
 
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace score
 {
@@ -40,6 +46,18 @@ class ParameterSet final
 {
   public:
     explicit ParameterSet(std::unique_ptr<json::IJsonWriter> json_writer);
+    /// @brief Creates a parameter set restored from a collection snapshot
+    ///
+    /// The restored set is served as is until it is changed for the first time, only then it is parsed. Parameters
+    /// added afterwards replace the restored parameters of the same name, so the plugins can reconcile the set. The
+    /// restored parameters which are not added again are removed by RemoveUnreconciledParameters().
+    ///
+    /// @param restored_set serialized parameter set as returned by GetParameterSetAsString()
+    /// @param restored_storage owner of the memory restored_set refers to
+    ///
+    ParameterSet(std::unique_ptr<json::IJsonWriter> json_writer,
+                 const std::string_view restored_set,
+                 std::shared_ptr<const void> restored_storage);
 
     ~ParameterSet() = default;
     ParameterSet(ParameterSet&&) = delete;
@@ -49,21 +67,77 @@ class ParameterSet final
     ParameterSet& operator=(const ParameterSet&) = delete;
 
     Result<score::cpp::pmr::string> GetParameterSetAsString() const;
+    /// @brief Encodes the set in the binary wire format, which ConfigProvider users read without parsing it
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary() const;
     ResultBlank Add(const score::cpp::string_view parameter_name, json::Any&& parameter_value);
     ResultBlank Update(json::Object&& parameters);
+    /// @brief Replaces all parameters of the set, a restored set is replaced as a whole
+    void Replace(json::Object&& parameters);
     void SetCalibratable(const bool is_calibratable);
+    bool IsCalibratable() const;
     void SetQualifier(const score::config_management::config_daemon::ParameterSetQualifier qualifier);
     score::config_management::config_daemon::ParameterSetQualifier GetQualifier() const;
     Result<json::Any> GetParameter(const score::cpp::string_view parameter_name);
 
+    /// @brief Whether the set was created or replaced, or a parameter was added to it since it got restored
+    bool IsReconciled() const;
+    /// @brief Removes the restored parameters which were not added again since the set got restored
+    ///
+    /// @return true if a parameter was removed, the removal is recorded as change
+    ///
+    bool RemoveUnreconciledParameters();
+
+    /// @brief Version of the set, zero until the first change is committed
+    std::uint64_t GetVersion() const;
+    /// @brief Assigns version to the changes made since the last commit and records them in the change history
+    ///
+    /// The first commit creates the set, later commits are kept in a history of kChangeHistoryLength entries.
+    ///
+    void CommitChanges(const std::uint64_t version);
+    /// @brief Digest of the binary encoding of the set, computed once per version
+    Result<std::uint64_t> GetDigest();
+    /// @brief Serializes the changes made since base_version as parameter-level delta
+    ///
+    /// The delta contains the current values of the changed parameters, the names of the removed parameters and the
+    /// qualifier. The complete set is serialized instead if base_version is not covered by the change history or the
+    /// delta would not be smaller than the set, which "is_complete" tells the client.
+    ///
+    /// If base_version is the current version or base_digest is the digest of the set, only the current version is
+    /// serialized with "is_modified": false. The digest identifies the content of a set held by a client across
+    /// restarts of the daemon, zero stands for an unknown digest.
+    ///
+    Result<score::cpp::pmr::string> GetChangesAsString(const std::uint64_t base_version,
+                                                       const std::uint64_t base_digest);
+
+    static constexpr std::size_t kChangeHistoryLength{16U};
+
   private:
+    struct Change
+    {
+        std::uint64_t version;
+        std::vector<score::cpp::pmr::string> parameter_names;
+    };
+
     json::Object GetParameterSetAsJson() const;
+    ResultBlank Materialize();
+    void RecordChange(const score::cpp::pmr::string& parameter_name);
+    bool IsModifiedSince(const std::uint64_t base_version, const std::uint64_t base_digest);
+    Result<score::cpp::pmr::string> Serialize(const json::Object& changes) const;
 
     mw::log::Logger& logger_;
     std::unordered_map<score::cpp::pmr::string, Parameter> data_;
     std::unique_ptr<json::IJsonWriter> json_writer_;
     score::config_management::config_daemon::ParameterSetQualifier qualifier_;
     bool is_calibratable_;
+    std::string_view restored_set_;
+    std::shared_ptr<const void> restored_storage_;
+    std::unordered_set<score::cpp::pmr::string> restored_parameters_;
+    bool is_reconciled_;
+    std::uint64_t version_;
+    std::uint64_t oldest_base_version_;
+    std::deque<Change> change_history_;
+    std::unordered_set<score::cpp::pmr::string> pending_changes_;
+    score::cpp::optional<std::uint64_t> digest_;
 };
 
 }  // namespace data_model
@@ -12,14 +12,20 @@
 // *******************************************************************************
 
 #include "score/config_management/config_daemon/code/data_model/details/parameterset_collection_impl.h"
+#include "score/config_management/config_daemon/code/data_model/details/collection_snapshot.h"
 #include "score/config_management/config_daemon/code/data_model/details/common.h"
 #include "score/config_management/config_daemon/code/data_model/details/parameter_set_impl.h"
 #include "score/config_management/config_daemon/code/data_model/error/error.h"
+#include "score/config_management/config_daemon/code/metrics/timed_lock_guard.h"
 
 #include "score/json/internal/model/any.h"
 #include "score/json/json_parser.h"
 #include "score/json/json_writer.h"
 
+#include <random>
+#include <string>
+#include <vector>
+
 namespace score
 {
 namespace config_management
@@ -29,8 +35,42 @@ namespace config_daemon
 namespace data_model
 {
 
-ParameterSetCollection::ParameterSetCollection()
-    : IParameterSetCollection{}, logger_{mw::log::CreateLogger(std::string_view{"DtMd"})}, mutex_{}, parameter_sets_{}
+namespace
+{
+constexpr std::chrono::milliseconds kDefaultReadinessTimeout{100};
+constexpr std::uint32_t kVersionEpochShift{32U};
+
+std::uint64_t CreateVersionEpoch()
+{
+    std::random_device random_device{};
+    return static_cast<std::uint64_t>(random_device()) << kVersionEpochShift;
+}
+}  // namespace
+
+ParameterSetCollection::ParameterSetCollection() : ParameterSetCollection{nullptr} {}
+
+ParameterSetCollection::ParameterSetCollection(std::shared_ptr<metrics::DaemonMetrics> daemon_metrics)
+    : ParameterSetCollection{std::move(daemon_metrics), kDefaultReadinessTimeout}
+{
+}
+
+ParameterSetCollection::ParameterSetCollection(std::shared_ptr<metrics::DaemonMetrics> daemon_metrics,
+                                               const std::chrono::milliseconds readiness_timeout)
+    : IParameterSetCollection{},
+      logger_{mw::log::CreateLogger(std::string_view{"DtMd"})},
+      daemon_metrics_{std::move(daemon_metrics)},
+      mutex_{},
+      parameter_sets_{},
+      parameter_set_names_{},
+      parameter_set_ids_{},
+      revision_{0U},
+      snapshot_revision_{0U},
+      last_version_{CreateVersionEpoch()},
+      readiness_timeout_{readiness_timeout},
+      readiness_mutex_{},
+      readiness_changed_{},
+      is_loading_completed_{true},
+      ready_parameter_sets_{}
 {
 }
 
@@ -41,7 +81,7 @@ ResultBlank ParameterSetCollection::Insert(const score::cpp::string_view set_nam
     logger_.LogDebug() << "ParameterSetCollection::" << __func__ << "set_name:" << set_name
                        << "parameter_name:" << parameter_name;
 
-    const std::lock_guard<std::mutex> lock{mutex_};
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
 
     std::shared_ptr<ParameterSet> parameter_set;
     auto result = parameter_sets_.find(AsString(set_name));
@@ -54,19 +94,64 @@ ResultBlank ParameterSetCollection::Insert(const score::cpp::string_view set_nam
     {
         parameter_set = std::make_shared<ParameterSet>(std::make_unique<json::JsonWriter>());
         score::cpp::ignore = parameter_sets_.emplace(AsString(set_name), parameter_set);
+        AssignParameterSetId(AsString(set_name));
     }
 
-    return parameter_set->Add(parameter_name, std::move(parameter_value));
+    ++revision_;
+    auto add_result = parameter_set->Add(parameter_name, std::move(parameter_value));
+    if (add_result.has_value())
+    {
+        CommitChanges(*parameter_set);
+    }
+    return add_result;
 }
 
 Result<score::cpp::pmr::string> ParameterSetCollection::GetParameterSet(const std::string set_name) const
 {
-    const std::lock_guard<std::mutex> lock{mutex_};
+    return Serialize(set_name, [](ParameterSet& parameter_set) { return parameter_set.GetParameterSetAsString(); });
+}
+
+Result<score::cpp::pmr::string> ParameterSetCollection::GetParameterSetAsBinary(const std::string set_name) const
+{
+    return Serialize(set_name, [](ParameterSet& parameter_set) { return parameter_set.GetParameterSetAsBinary(); });
+}
+
+Result<score::cpp::pmr::string> ParameterSetCollection::GetParameterSetChanges(const std::string set_name,
+                                                                               const std::uint64_t base_version,
+                                                                               const std::uint64_t base_digest) const
+{
+    return Serialize(set_name, [base_version, base_digest](ParameterSet& parameter_set) {
+        return parameter_set.GetChangesAsString(base_version, base_digest);
+    });
+}
+
+template <typename Serializer>
+Result<score::cpp::pmr::string> ParameterSetCollection::Serialize(const std::string& set_name,
+                                                                  const Serializer serialize) const
+{
+    const auto readiness = WaitUntilReady(set_name);
+    if (!readiness.has_value())
+    {
+        return MakeUnexpected<score::cpp::pmr::string>(readiness.error());
+    }
+
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
 
     const auto parameter_set = Find(set_name);
     if (parameter_set.has_value() == true)
     {
-        return parameter_set.value()->GetParameterSetAsString();
+        if (daemon_metrics_ == nullptr)
+        {
+            return serialize(*parameter_set.value());
+        }
+        const auto serialization_start = metrics::DaemonMetrics::Clock::now();
+        auto serialized_parameter_set = serialize(*parameter_set.value());
+        if (serialized_parameter_set.has_value())
+        {
+            daemon_metrics_->RecordSerialization(metrics::DaemonMetrics::Clock::now() - serialization_start,
+                                                 serialized_parameter_set.value().size());
+        }
+        return serialized_parameter_set;
     }
     return MakeUnexpected<score::cpp::pmr::string>(parameter_set.error());
 }
@@ -74,7 +159,7 @@ Result<score::cpp::pmr::string> ParameterSetCollection::GetParameterSet(const st
 Result<json::Any> ParameterSetCollection::GetParameterFromSet(const score::cpp::string_view set_name,
                                                               const score::cpp::string_view parameter_name) const
 {
-    const std::lock_guard<std::mutex> lock{mutex_};
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
 
     const auto parameter_set = Find(set_name);
     if (parameter_set.has_value() == true)
@@ -101,7 +186,7 @@ Result<std::shared_ptr<ParameterSet>> ParameterSetCollection::Find(const score::
 
 ResultBlank ParameterSetCollection::UpdateParameterSet(const score::cpp::string_view set_name, const score::cpp::string_view set)
 {
-    const std::lock_guard<std::mutex> lock{mutex_};
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
 
     const json::JsonParser json_parser{};
     const std::string buffer{set.begin(), set.end()};
@@ -130,12 +215,74 @@ ResultBlank ParameterSetCollection::UpdateParameterSet(const score::cpp::string_
         return MakeUnexpected(DataModelError::kParameterSetNotFound, "Parameter set is not found");
     }
 
-    return (*set_data)->Update(std::move(set_object_result.value().get()));
+    ++revision_;
+    auto update_result = (*set_data)->Update(std::move(set_object_result.value().get()));
+    if (update_result.has_value())
+    {
+        CommitChanges(**set_data);
+    }
+    return update_result;
+}
+
+ResultBlank ParameterSetCollection::ReplaceParameterSet(const score::cpp::string_view set_name,
+                                                        json::Object&& parameters)
+{
+    logger_.LogDebug() << "ParameterSetCollection::" << __func__ << "set_name:" << set_name;
+
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
+
+    auto& parameter_set = parameter_sets_[AsString(set_name)];
+    if (parameter_set == nullptr)
+    {
+        parameter_set = std::make_shared<ParameterSet>(std::make_unique<json::JsonWriter>());
+        AssignParameterSetId(AsString(set_name));
+    }
+    parameter_set->Replace(std::move(parameters));
+    CommitChanges(*parameter_set);
+    ++revision_;
+    return {};
+}
+
+void ParameterSetCollection::CommitChanges(ParameterSet& parameter_set)
+{
+    ++last_version_;
+    parameter_set.CommitChanges(last_version_);
+}
+
+void ParameterSetCollection::AssignParameterSetId(const score::cpp::pmr::string& set_name)
+{
+    if (parameter_set_ids_.emplace(set_name, parameter_set_names_.size()).second)
+    {
+        parameter_set_names_.push_back(set_name);
+    }
+}
+
+Result<score::cpp::pmr::string> ParameterSetCollection::GetParameterSetDictionary() const
+{
+    json::List names{};
+    {
+        const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
+        names.reserve(parameter_set_names_.size());
+        for (const auto& set_name : parameter_set_names_)
+        {
+            names.emplace_back(std::string{set_name.data(), set_name.size()});
+        }
+    }
+    json::Object dictionary{};
+    dictionary["parameter_sets"] = std::move(names);
+
+    auto result = json::JsonWriter{}.ToBuffer(dictionary);
+    if (not result.has_value())
+    {
+        const auto error = result.error().Message();
+        return MakeUnexpected(DataModelError::kConvertingError, error);
+    }
+    return score::cpp::pmr::string{result.value().data(), result.value().size()};
 }
 
 bool ParameterSetCollection::SetCalibratable(const score::cpp::string_view set_name, const bool is_calibratable) const noexcept
 {
-    const std::lock_guard<std::mutex> lock{mutex_};
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
 
     bool result = false;
 
@@ -144,6 +291,7 @@ bool ParameterSetCollection::SetCalibratable(const score::cpp::string_view set_n
     if (found_parameter_set.has_value() == true)
     {
         (*found_parameter_set)->SetCalibratable(is_calibratable);
+        ++revision_;
         result = true;
     }
 
@@ -153,7 +301,7 @@ bool ParameterSetCollection::SetCalibratable(const score::cpp::string_view set_n
 score::Result<score::config_management::config_daemon::ParameterSetQualifier> ParameterSetCollection::GetParameterSetQualifier(
     const score::cpp::string_view set_name) const
 {
-    const std::lock_guard<std::mutex> lock{mutex_};
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
     const auto parameter_set = Find(set_name);
     if (parameter_set.has_value() == true)
     {
@@ -168,11 +316,13 @@ ResultBlank ParameterSetCollection::SetParameterSetQualifier(
     const score::cpp::string_view set_name,
     const score::config_management::config_daemon::ParameterSetQualifier qualifier)
 {
-    const std::lock_guard<std::mutex> lock{mutex_};
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
     const auto parameter_set = Find(set_name);
     if (parameter_set.has_value() == true)
     {
         parameter_set.value()->SetQualifier(qualifier);
+        CommitChanges(*parameter_set.value());
+        ++revision_;
         return {};
     }
     logger_.LogError() << "ParameterSetCollection::" << __func__ << "ParameterSet with name:" << set_name
@@ -180,6 +330,173 @@ ResultBlank ParameterSetCollection::SetParameterSetQualifier(
     return MakeUnexpected(DataModelError::kParameterSetNotFound, "Parameter set not found");
 }
 
+void ParameterSetCollection::SetLoadingCompleted(const bool is_completed) noexcept
+{
+    if (is_completed)
+    {
+        ReconcileRestoredParameterSets();
+    }
+    {
+        const std::lock_guard<std::mutex> lock{readiness_mutex_};
+        is_loading_completed_ = is_completed;
+    }
+    readiness_changed_.notify_all();
+}
+
+void ParameterSetCollection::ReconcileRestoredParameterSets()
+{
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
+    for (auto parameter_set = parameter_sets_.begin(); parameter_set != parameter_sets_.end();)
+    {
+        // a restored set which no plugin provided anymore is outdated, its identifier stays assigned so that a set
+        // created again later on keeps it
+        if (!parameter_set->second->IsReconciled())
+        {
+            logger_.LogInfo() << "ParameterSetCollection::" << __func__ << "restored ParameterSet with name:"
+                              << parameter_set->first << "is not provided anymore and dropped";
+            {
+                const std::lock_guard<std::mutex> readiness_lock{readiness_mutex_};
+                score::cpp::ignore = ready_parameter_sets_.erase(parameter_set->first);
+            }
+            parameter_set = parameter_sets_.erase(parameter_set);
+            ++revision_;
+            continue;
+        }
+        if (parameter_set->second->RemoveUnreconciledParameters())
+        {
+            CommitChanges(*parameter_set->second);
+            ++revision_;
+        }
+        ++parameter_set;
+    }
+}
+
+ResultBlank ParameterSetCollection::MarkParameterSetReady(const score::cpp::string_view set_name)
+{
+    {
+        const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
+        if (!Find(set_name).has_value())
+        {
+            return MakeUnexpected(DataModelError::kParameterSetNotFound, "Parameter set not found");
+        }
+    }
+    {
+        const std::lock_guard<std::mutex> lock{readiness_mutex_};
+        score::cpp::ignore = ready_parameter_sets_.insert(AsString(set_name));
+    }
+    readiness_changed_.notify_all();
+    return {};
+}
+
+ResultBlank ParameterSetCollection::WaitUntilReady(const score::cpp::string_view set_name) const
+{
+    std::unique_lock<std::mutex> lock{readiness_mutex_};
+    if (is_loading_completed_)
+    {
+        return {};
+    }
+    const auto name = AsString(set_name);
+    const bool is_ready = readiness_changed_.wait_for(lock, readiness_timeout_, [this, &name]() {
+        return is_loading_completed_ || (ready_parameter_sets_.count(name) != 0U);
+    });
+    if (!is_ready)
+    {
+        logger_.LogWarn() << "ParameterSetCollection::" << __func__ << "ParameterSet with name:" << set_name
+                          << "is not loaded yet";
+        return MakeUnexpected(DataModelError::kParameterSetNotReady, "Parameter set is not loaded yet, retry later");
+    }
+    return {};
+}
+
+ResultBlank ParameterSetCollection::WriteSnapshot(const std::string& snapshot_path)
+{
+    std::string encoded_snapshot{};
+    std::uint64_t encoded_revision{0U};
+    {
+        // only the encoding happens under the lock, the snapshot file is written without blocking the clients
+        const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
+        if (revision_ == snapshot_revision_)
+        {
+            return {};
+        }
+
+        std::vector<score::cpp::pmr::string> serialized_sets{};
+        serialized_sets.reserve(parameter_sets_.size());
+        std::vector<CollectionSnapshotEntry> entries{};
+        entries.reserve(parameter_sets_.size());
+        for (const auto& parameter_set : parameter_sets_)
+        {
+            auto serialized_set = parameter_set.second->GetParameterSetAsString();
+            if (!serialized_set.has_value())
+            {
+                logger_.LogError() << "ParameterSetCollection::" << __func__ << "ParameterSet with name:"
+                                   << parameter_set.first << "can't be serialized";
+                return MakeUnexpected(DataModelError::kSnapshotWriteError, "Parameter set can't be serialized");
+            }
+            serialized_sets.push_back(std::move(serialized_set).value());
+            CollectionSnapshotEntry entry{};
+            entry.set_name = std::string_view{parameter_set.first.data(), parameter_set.first.size()};
+            entry.serialized_set = std::string_view{serialized_sets.back().data(), serialized_sets.back().size()};
+            entry.qualifier = parameter_set.second->GetQualifier();
+            entry.is_calibratable = parameter_set.second->IsCalibratable();
+            entries.push_back(entry);
+        }
+        encoded_snapshot = EncodeCollectionSnapshot(entries);
+        encoded_revision = revision_;
+    }
+
+    const auto write_result = WriteCollectionSnapshot(snapshot_path, encoded_snapshot);
+    if (!write_result.has_value())
+    {
+        logger_.LogError() << "ParameterSetCollection::" << __func__ << "snapshot:" << snapshot_path
+                           << "can't be written";
+        return write_result;
+    }
+
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
+    snapshot_revision_ = encoded_revision;
+    return {};
+}
+
+Result<std::size_t> ParameterSetCollection::RestoreSnapshot(const std::string& snapshot_path)
+{
+    auto snapshot = ReadCollectionSnapshot(snapshot_path);
+    if (!snapshot.has_value())
+    {
+        logger_.LogWarn() << "ParameterSetCollection::" << __func__ << "snapshot:" << snapshot_path
+                          << "can't be restored:" << snapshot.error().Message();
+        return MakeUnexpected<std::size_t>(snapshot.error());
+    }
+
+    const metrics::TimedLockGuard<std::mutex> lock{mutex_, daemon_metrics_.get()};
+    std::size_t restored_sets{0U};
+    for (const auto& entry : snapshot.value().entries)
+    {
+        const auto set_name = AsString(score::cpp::string_view{entry.set_name.data(), entry.set_name.size()});
+        if (parameter_sets_.count(set_name) != 0U)
+        {
+            continue;
+        }
+        auto parameter_set = std::make_shared<ParameterSet>(
+            std::make_unique<json::JsonWriter>(), entry.serialized_set, snapshot.value().storage);
+        parameter_set->SetQualifier(entry.qualifier);
+        parameter_set->SetCalibratable(entry.is_calibratable);
+        CommitChanges(*parameter_set);
+        score::cpp::ignore = parameter_sets_.emplace(set_name, std::move(parameter_set));
+        AssignParameterSetId(set_name);
+        {
+            // a restored parameter set is complete, so it is served while the plugins are still loading
+            const std::lock_guard<std::mutex> readiness_lock{readiness_mutex_};
+            score::cpp::ignore = ready_parameter_sets_.insert(set_name);
+        }
+        ++restored_sets;
+    }
+    // the restored collection equals the snapshot, so it is not written again before it changes
+    snapshot_revision_ = revision_;
+    logger_.LogInfo() << "ParameterSetCollection::" << __func__ << "restored" << restored_sets << "parameter sets";
+    return restored_sets;
+}
+
 }  // namespace data_model
 }  // namespace config_daemon
 }  // namespace config_management
@@ -15,15 +15,21 @@
 #define CODE_DATA_MODEL_DETAILS_PARAMETERSET_COLLECTION_IMPL_H
 
 #include "score/config_management/config_daemon/code/data_model/parameterset_collection.h"
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
 
 #include "score/result/result.h"
 #include "score/mw/log/logger.h"
 
 #include <score/optional.hpp>
 #include <score/string.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace score
 {
@@ -39,6 +45,11 @@ class ParameterSetCollection final : public IParameterSetCollection
 {
   public:
     ParameterSetCollection();
+    /// @brief Records lock wait and hold times as well as serialization times and sizes into daemon_metrics
+    explicit ParameterSetCollection(std::shared_ptr<metrics::DaemonMetrics> daemon_metrics);
+    /// @brief Lets GetParameterSet() wait up to readiness_timeout for a parameter set which is not loaded yet
+    ParameterSetCollection(std::shared_ptr<metrics::DaemonMetrics> daemon_metrics,
+                           const std::chrono::milliseconds readiness_timeout);
     ~ParameterSetCollection() noexcept override = default;
     ParameterSetCollection(ParameterSetCollection&&) = delete;
     ParameterSetCollection(const ParameterSetCollection&) = delete;
@@ -52,20 +63,58 @@ class ParameterSetCollection final : public IParameterSetCollection
     Result<json::Any> GetParameterFromSet(const score::cpp::string_view set_name,
                                           const score::cpp::string_view parameter_name) const override;
     Result<score::cpp::pmr::string> GetParameterSet(const std::string set_name) const override;
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary(const std::string set_name) const override;
+    Result<score::cpp::pmr::string> GetParameterSetChanges(const std::string set_name,
+                                                           const std::uint64_t base_version,
+                                                           const std::uint64_t base_digest) const override;
+    Result<score::cpp::pmr::string> GetParameterSetDictionary() const override;
     ResultBlank UpdateParameterSet(const score::cpp::string_view set_name, const score::cpp::string_view set) override;
+    ResultBlank ReplaceParameterSet(const score::cpp::string_view set_name, json::Object&& parameters) override;
     bool SetCalibratable(const score::cpp::string_view set_name, const bool is_calibratable) const noexcept override;
 
     score::Result<score::config_management::config_daemon::ParameterSetQualifier> GetParameterSetQualifier(
         const score::cpp::string_view set_name) const override;
     ResultBlank SetParameterSetQualifier(const score::cpp::string_view set_name,
                                          const score::config_management::config_daemon::ParameterSetQualifier qualifier) override;
+    void SetLoadingCompleted(const bool is_completed) noexcept override;
+    ResultBlank MarkParameterSetReady(const score::cpp::string_view set_name) override;
+    ResultBlank WriteSnapshot(const std::string& snapshot_path) override;
+    Result<std::size_t> RestoreSnapshot(const std::string& snapshot_path) override;
 
   private:
     Result<std::shared_ptr<ParameterSet>> Find(const score::cpp::string_view set_name) const noexcept;
+    ResultBlank WaitUntilReady(const score::cpp::string_view set_name) const;
+    /// @brief Serializes a parameter set once it is ready, all serializations are recorded in the same metrics
+    template <typename Serializer>
+    Result<score::cpp::pmr::string> Serialize(const std::string& set_name, const Serializer serialize) const;
+    /// @brief Commits the changes of parameter_set with the next version of the collection
+    void CommitChanges(ParameterSet& parameter_set);
+    /// @brief Assigns the next identifier to a newly created parameter set, a set created again keeps its identifier
+    void AssignParameterSetId(const score::cpp::pmr::string& set_name);
+    /// @brief Drops the restored parameter sets and parameters which the plugins did not insert again
+    void ReconcileRestoredParameterSets();
 
     mw::log::Logger& logger_;
+    const std::shared_ptr<metrics::DaemonMetrics> daemon_metrics_;
     mutable std::mutex mutex_;
     std::unordered_map<score::cpp::pmr::string, std::shared_ptr<ParameterSet>> parameter_sets_;
+    // the names of the parameter sets indexed by their identifier, see GetParameterSetDictionary()
+    std::vector<score::cpp::pmr::string> parameter_set_names_;
+    // the identifiers of the parameter sets by name, identifiers of dropped sets stay assigned for a set created again
+    std::unordered_map<score::cpp::pmr::string, std::size_t> parameter_set_ids_;
+    // counts the changes of the collection, a snapshot is only written if it differs from snapshot_revision_
+    mutable std::uint64_t revision_;
+    std::uint64_t snapshot_revision_;
+    // the versions of the parameter sets start at a random epoch, so versions held by clients from before a restart
+    // of the daemon are not mistaken for versions of this run
+    std::uint64_t last_version_;
+
+    // the readiness has its own lock, so waiting requests never block the plugins loading the parameter sets
+    const std::chrono::milliseconds readiness_timeout_;
+    mutable std::mutex readiness_mutex_;
+    mutable std::condition_variable readiness_changed_;
+    bool is_loading_completed_;
+    std::unordered_set<score::cpp::pmr::string> ready_parameter_sets_;
 };
 
 }  // namespace data_model
@@ -0,0 +1,159 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/data_model/details/parameterset_collection_impl.h"
+#include "score/config_management/config_provider/code/memory/allocation_tracking.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace data_model
+{
+namespace test
+{
+namespace
+{
+
+using config_provider::memory::AllocationScope;
+
+constexpr std::size_t kSetCount{32U};
+constexpr std::size_t kParametersPerSet{64U};
+constexpr std::size_t kUpdatesPerSet{16U};
+
+std::string GetSetName(const std::size_t index)
+{
+    return "set_name_" + std::to_string(index);
+}
+
+std::string FormatParameters(const std::size_t parameter_count, const std::size_t value)
+{
+    std::string parameters{"{"};
+    for (std::size_t index = 0U; index < parameter_count; ++index)
+    {
+        parameters += ((index == 0U) ? "\"parameter_" : ", \"parameter_") + std::to_string(index) +
+                      "\": " + std::to_string(value) + ".5";
+    }
+    return parameters + "}";
+}
+
+void LoadParameterSets(ParameterSetCollection& collection, const std::size_t set_count)
+{
+    for (std::size_t index = 0U; index < set_count; ++index)
+    {
+        auto parameters = json::JsonParser{}.FromBuffer(FormatParameters(kParametersPerSet, 0U)).value();
+        auto& parameters_object = parameters.As<json::Object>().value().get();
+        const auto set_name = GetSetName(index);
+        ASSERT_TRUE(collection.ReplaceParameterSet(set_name, std::move(parameters_object)).has_value());
+        ASSERT_TRUE(collection.SetCalibratable(set_name, true));
+        ASSERT_TRUE(collection.MarkParameterSetReady(set_name).has_value());
+    }
+}
+
+}  // namespace
+
+TEST(ParameterSetCollectionAllocationTest, ReportsMemoryFootprintPerParameterSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::data_model::ParameterSetCollection");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test reports the memory the ParameterSetCollection holds per parameter set of 64 parameters, "
+                   "before and after updates, and verifies that all of it is released with the collection.");
+
+    {
+        // the first collection, set and update create the logger contexts and other process-wide state
+        ParameterSetCollection collection{};
+        LoadParameterSets(collection, 1U);
+        ASSERT_TRUE(collection.UpdateParameterSet(GetSetName(0U), FormatParameters(1U, 1U)).has_value());
+    }
+
+    const AllocationScope scope{};
+    auto collection = std::make_unique<ParameterSetCollection>();
+    const auto bytes_without_sets = scope.GetHeapStatistics().GetLiveBytes();
+    LoadParameterSets(*collection, kSetCount);
+    const auto bytes_with_sets = scope.GetHeapStatistics().GetLiveBytes();
+    for (std::size_t update = 1U; update <= kUpdatesPerSet; ++update)
+    {
+        for (std::size_t index = 0U; index < kSetCount; ++index)
+        {
+            ASSERT_TRUE(collection->UpdateParameterSet(GetSetName(index), FormatParameters(1U, update)).has_value());
+        }
+    }
+    const auto bytes_with_updates = scope.GetHeapStatistics().GetLiveBytes();
+    collection.reset();
+    const auto statistics = scope.GetHeapStatistics();
+
+    const auto bytes_per_set = (bytes_with_sets - bytes_without_sets) / static_cast<std::int64_t>(kSetCount);
+    const auto bytes_per_update =
+        (bytes_with_updates - bytes_with_sets) / static_cast<std::int64_t>(kSetCount * kUpdatesPerSet);
+    RecordProperty("HeapBytesPerParameterSet", std::to_string(bytes_per_set));
+    RecordProperty("HeapBytesPerRecordedUpdate", std::to_string(bytes_per_update));
+    RecordProperty("HeapPeakBytes", std::to_string(statistics.peak_bytes));
+    EXPECT_GT(bytes_per_set, 0);
+    EXPECT_EQ(statistics.GetLiveBytes(), 0);
+}
+
+TEST(ParameterSetCollectionAllocationTest, ReportsAllocationsPerSerialization)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test reports the allocations and the peak memory of serving a parameter set of 64 "
+                   "parameters as JSON and in the binary wire format and verifies that no memory is retained by it.");
+
+    ParameterSetCollection collection{};
+    LoadParameterSets(collection, 1U);
+    const auto set_name = GetSetName(0U);
+    // the digest of a set is computed once
+    ASSERT_TRUE(collection.GetParameterSetAsBinary(set_name).has_value());
+
+    for (const bool is_binary : {false, true})
+    {
+        const AllocationScope scope{};
+        {
+            const auto serialized_set = is_binary ? collection.GetParameterSetAsBinary(set_name)
+                                                  : collection.GetParameterSet(set_name);
+            ASSERT_TRUE(serialized_set.has_value());
+        }
+        const auto statistics = scope.GetHeapStatistics();
+
+        const std::string format{is_binary ? "Binary" : "Json"};
+        RecordProperty(format + "SerializationAllocations", std::to_string(statistics.allocations));
+        RecordProperty(format + "SerializationPeakBytes", std::to_string(statistics.peak_bytes));
+        EXPECT_GT(statistics.allocations, 0U) << "binary: " << is_binary;
+        EXPECT_EQ(statistics.GetLiveBytes(), 0) << "binary: " << is_binary;
+    }
+}
+
+}  // namespace test
+}  // namespace data_model
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
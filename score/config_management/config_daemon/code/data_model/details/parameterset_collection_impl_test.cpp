@@ -12,7 +12,9 @@
 // *******************************************************************************
 
 #include "score/config_management/config_daemon/code/data_model/details/parameterset_collection_impl.h"
+#include "score/config_management/config_daemon/code/data_model/details/parameter_set_impl.h"
 #include "score/config_management/config_daemon/code/data_model/error/error.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
 
 #include "score/json/internal/model/any.h"
 #include "score/json/json_parser.h"
@@ -20,6 +22,7 @@
 #include <score/vector.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <fstream>
 #include <memory>
 #include <thread>
 
@@ -57,6 +60,18 @@ class ParameterSetCollectionFixture : public ::testing::Test
     }
 
   protected:
+    json::Object GetChanges(const std::string& set_name,
+                            const std::uint64_t base_version,
+                            const std::uint64_t base_digest = 0U) const
+    {
+        const auto changes = parameter_data_->GetParameterSetChanges(set_name, base_version, base_digest);
+        EXPECT_TRUE(changes.has_value());
+        const std::string changes_str{changes.value().data(), changes.value().size()};
+        auto parsing_result = json::JsonParser{}.FromBuffer(changes_str);
+        EXPECT_TRUE(parsing_result.has_value());
+        return std::move(parsing_result.value().As<json::Object>().value().get());
+    }
+
     std::shared_ptr<ParameterSetCollection> parameter_data_;
     std::string set_name_for_update_tests_;
 };
@@ -543,6 +558,479 @@ TEST_F(ParameterSetCollectionFixture, GetSetParameterSetQualifier_NonExistentSet
     ASSERT_EQ(set_qualifier_result.error(), DataModelError::kParameterSetNotFound);
 }
 
+TEST(ParameterSetCollectionMetricsTest, GetParameterSetRecordsMetrics)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSet");
+    RecordProperty("Description",
+                   "Verifies that lock times and the serialization of served parameter sets are recorded");
+
+    const auto daemon_metrics = std::make_shared<metrics::DaemonMetrics>();
+    ParameterSetCollection parameter_data{daemon_metrics};
+    ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_name", json::Any{1}).has_value());
+
+    const auto result = parameter_data.GetParameterSet("set_name");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_FALSE(parameter_data.GetParameterSet("unknown_set_name").has_value());
+
+    const auto snapshot = daemon_metrics->GetSnapshot();
+    EXPECT_EQ(snapshot.serialization_time.count, 1U);
+    EXPECT_EQ(snapshot.serialized_bytes, result.value().size());
+    EXPECT_EQ(snapshot.lock_wait_time.count, 3U);
+    EXPECT_EQ(snapshot.lock_hold_time.count, 3U);
+}
+
+TEST_F(ParameterSetCollectionFixture, ReplaceParameterSetCreatesAndReplacesAllParameters)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::ReplaceParameterSet");
+    RecordProperty("Description",
+                   "Verifies that ReplaceParameterSet creates a parameter set and replaces all of its parameters");
+
+    json::Object parameters{};
+    parameters["parameter_1"] = json::Any{1};
+    parameters["parameter_2"] = json::Any{2};
+    ASSERT_TRUE(parameter_data_->ReplaceParameterSet("set_name", std::move(parameters)).has_value());
+    EXPECT_EQ(parameter_data_->GetParameterFromSet("set_name", "parameter_2").value().As<std::int32_t>().value(), 2);
+
+    json::Object replacing_parameters{};
+    replacing_parameters["parameter_1"] = json::Any{10};
+    ASSERT_TRUE(parameter_data_->ReplaceParameterSet("set_name", std::move(replacing_parameters)).has_value());
+    EXPECT_EQ(parameter_data_->GetParameterFromSet("set_name", "parameter_1").value().As<std::int32_t>().value(), 10);
+    EXPECT_EQ(parameter_data_->GetParameterFromSet("set_name", "parameter_2").error(),
+              DataModelError::kParameterMissedError);
+}
+
+TEST_F(ParameterSetCollectionFixture, GetParameterSetAsBinaryEncodesParametersAndQualifier)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty(
+        "Verifies",
+        "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSetAsBinary");
+    RecordProperty("Description",
+                   "Verifies that a parameter set is served in the binary wire format including its qualifier");
+
+    json::List curve{};
+    curve.emplace_back(0.5);
+    curve.emplace_back(1.5);
+    ASSERT_TRUE(parameter_data_->Insert("set_name", "parameter_1", json::Any{1}).has_value());
+    ASSERT_TRUE(parameter_data_->Insert("set_name", "curve", json::Any{std::move(curve)}).has_value());
+    ASSERT_TRUE(parameter_data_->SetParameterSetQualifier("set_name", ParameterSetQualifier::kQualified).has_value());
+
+    const auto binary_set = parameter_data_->GetParameterSetAsBinary("set_name");
+
+    ASSERT_TRUE(binary_set.has_value());
+    const auto view = config_provider::wire_format::BinarySetView::Create(
+        std::string_view{binary_set.value().data(), binary_set.value().size()});
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view.value().GetParameterCount(), 2U);
+    EXPECT_EQ(view.value().FindParameter("parameter_1").value().As<std::int32_t>().value(), 1);
+    EXPECT_EQ(view.value().FindParameter("curve").value().GetElementAs<double>(1U).value(), 1.5);
+    EXPECT_EQ(view.value().GetQualifier(), score::cpp::to_underlying(ParameterSetQualifier::kQualified));
+    EXPECT_EQ(parameter_data_->GetParameterSetAsBinary("unknown_set").error(), DataModelError::kParameterSetNotFound);
+}
+
+TEST_F(ParameterSetCollectionFixture, GetParameterSetChangesServesOnlyChangedParameters)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty(
+        "Verifies",
+        "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSetChanges");
+    RecordProperty("Description",
+                   "Verifies that the changes since a known version only contain the changed parameters, while an "
+                   "unknown version is answered with the complete parameter set");
+
+    for (std::int32_t index = 0; index < 100; ++index)
+    {
+        const auto parameter_name = "parameter_" + std::to_string(index);
+        ASSERT_TRUE(parameter_data_->Insert("set_name", parameter_name, json::Any{index}).has_value());
+    }
+    ASSERT_TRUE(parameter_data_->SetCalibratable("set_name", true));
+
+    auto complete_set = GetChanges("set_name", 0U);
+    EXPECT_TRUE(complete_set["is_complete"].As<bool>().value());
+    EXPECT_EQ(complete_set["parameters"].As<json::Object>().value().get().size(), 100U);
+    const auto base_version = complete_set["version"].As<std::uint64_t>().value();
+
+    ASSERT_TRUE(parameter_data_->UpdateParameterSet("set_name", R"({"parameter_7": 700})").has_value());
+
+    auto delta = GetChanges("set_name", base_version);
+    EXPECT_FALSE(delta["is_complete"].As<bool>().value());
+    EXPECT_GT(delta["version"].As<std::uint64_t>().value(), base_version);
+    const auto& changed_parameters = delta["parameters"].As<json::Object>().value().get();
+    ASSERT_EQ(changed_parameters.size(), 1U);
+    EXPECT_EQ(changed_parameters.at("parameter_7").As<std::int32_t>().value(), 700);
+    EXPECT_TRUE(delta["removed_parameters"].As<json::List>().value().get().empty());
+    EXPECT_LT(parameter_data_->GetParameterSetChanges("set_name", base_version, 0U).value().size() * 10U,
+              parameter_data_->GetParameterSet("set_name").value().size());
+
+    auto no_changes = GetChanges("set_name", delta["version"].As<std::uint64_t>().value());
+    EXPECT_FALSE(no_changes["is_modified"].As<bool>().value());
+    EXPECT_EQ(no_changes.count("parameters"), 0U);
+    EXPECT_TRUE(GetChanges("set_name", delta["version"].As<std::uint64_t>().value() + 1U)["is_complete"]
+                    .As<bool>()
+                    .value());
+    EXPECT_EQ(parameter_data_->GetParameterSetChanges("unknown_set", 0U, 0U).error(),
+              DataModelError::kParameterSetNotFound);
+}
+
+TEST_F(ParameterSetCollectionFixture, GetParameterSetChangesReportsRemovedParametersAndExpiredVersions)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty(
+        "Verifies",
+        "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSetChanges");
+    RecordProperty("Description",
+                   "Verifies that parameters removed by a replacement are listed as removed and that versions older "
+                   "than the change history are answered with the complete parameter set");
+
+    json::Object parameters{};
+    for (std::int32_t index = 0; index < 10; ++index)
+    {
+        parameters["kept_" + std::to_string(index)] = json::Any{index};
+    }
+    parameters["removed"] = json::Any{2};
+    parameters["other"] = json::Any{3};
+    ASSERT_TRUE(parameter_data_->ReplaceParameterSet("set_name", std::move(parameters)).has_value());
+    const auto base_version = GetChanges("set_name", 0U)["version"].As<std::uint64_t>().value();
+
+    json::Object replacement{};
+    for (std::int32_t index = 0; index < 10; ++index)
+    {
+        replacement["kept_" + std::to_string(index)] = json::Any{index};
+    }
+    replacement["other"] = json::Any{4};
+    replacement["added"] = json::Any{5};
+    replacement["more"] = json::Any{6};
+    ASSERT_TRUE(parameter_data_->ReplaceParameterSet("set_name", std::move(replacement)).has_value());
+
+    auto delta = GetChanges("set_name", base_version);
+    ASSERT_FALSE(delta["is_complete"].As<bool>().value());
+    const auto& removed_parameters = delta["removed_parameters"].As<json::List>().value().get();
+    ASSERT_EQ(removed_parameters.size(), 1U);
+    EXPECT_EQ(removed_parameters[0].As<std::string>().value().get(), "removed");
+    const auto& changed_parameters = delta["parameters"].As<json::Object>().value().get();
+    EXPECT_EQ(changed_parameters.size(), 3U);
+    EXPECT_EQ(changed_parameters.count("kept_0"), 0U);
+
+    const auto recent_version = delta["version"].As<std::uint64_t>().value();
+    for (std::size_t change = 0U; change < ParameterSet::kChangeHistoryLength; ++change)
+    {
+        ASSERT_TRUE(parameter_data_->SetParameterSetQualifier("set_name", ParameterSetQualifier::kQualified).has_value());
+    }
+    EXPECT_TRUE(GetChanges("set_name", base_version)["is_complete"].As<bool>().value());
+    auto recent_delta = GetChanges("set_name", recent_version);
+    EXPECT_FALSE(recent_delta["is_complete"].As<bool>().value());
+    EXPECT_EQ(recent_delta["qualifier"].As<std::uint8_t>().value(),
+              score::cpp::to_underlying(ParameterSetQualifier::kQualified));
+}
+
+TEST_F(ParameterSetCollectionFixture, GetParameterSetChangesAnswersNotModifiedForKnownDigest)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty(
+        "Verifies",
+        "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSetChanges");
+    RecordProperty("Description",
+                   "Verifies that a client holding the content of a set from before a restart of the daemon is "
+                   "answered with not modified, while changed content is served completely");
+
+    for (std::int32_t index = 0; index < 100; ++index)
+    {
+        const auto parameter_name = "parameter_" + std::to_string(index);
+        ASSERT_TRUE(parameter_data_->Insert("set_name", parameter_name, json::Any{index}).has_value());
+    }
+    const auto binary_set = parameter_data_->GetParameterSetAsBinary("set_name");
+    ASSERT_TRUE(binary_set.has_value());
+    const auto digest = config_provider::wire_format::ComputeBinarySetDigest(
+        std::string_view{binary_set.value().data(), binary_set.value().size()});
+    const auto version = GetChanges("set_name", 0U)["version"].As<std::uint64_t>().value();
+
+    // the restarted daemon loads the same content in a different order and counts its versions from another epoch
+    ParameterSetCollection restarted_collection{};
+    for (std::int32_t index = 99; index >= 0; --index)
+    {
+        const auto parameter_name = "parameter_" + std::to_string(index);
+        ASSERT_TRUE(restarted_collection.Insert("set_name", parameter_name, json::Any{index}).has_value());
+    }
+    ASSERT_TRUE(restarted_collection.SetCalibratable("set_name", true));
+    const auto not_modified = restarted_collection.GetParameterSetChanges("set_name", version, digest);
+    ASSERT_TRUE(not_modified.has_value());
+    EXPECT_LT(not_modified.value().size() * 10U, restarted_collection.GetParameterSet("set_name").value().size());
+    auto parsing_result =
+        json::JsonParser{}.FromBuffer(std::string{not_modified.value().data(), not_modified.value().size()});
+    ASSERT_TRUE(parsing_result.has_value());
+    auto& not_modified_object = parsing_result.value().As<json::Object>().value().get();
+    EXPECT_FALSE(not_modified_object["is_modified"].As<bool>().value());
+    EXPECT_NE(not_modified_object["version"].As<std::uint64_t>().value(), version);
+
+    ASSERT_TRUE(restarted_collection.UpdateParameterSet("set_name", R"({"parameter_7": 700})").has_value());
+    const auto modified = restarted_collection.GetParameterSetChanges("set_name", version, digest);
+    ASSERT_TRUE(modified.has_value());
+    EXPECT_NE(std::string_view(modified.value().data(), modified.value().size()).find(R"("is_complete")"),
+              std::string_view::npos);
+}
+
+TEST_F(ParameterSetCollectionFixture, GetParameterSetDictionaryListsSetsInOrderOfCreation)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty(
+        "Verifies",
+        "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSetDictionary");
+    RecordProperty("Description",
+                   "Verifies that every parameter set gets the next identifier when it is created and keeps it when "
+                   "it is changed or replaced");
+
+    ASSERT_TRUE(parameter_data_->Insert("set_name_1", "parameter", json::Any{1}).has_value());
+    ASSERT_TRUE(parameter_data_->ReplaceParameterSet("set_name_2", json::Object{}).has_value());
+    ASSERT_TRUE(parameter_data_->Insert("set_name_1", "other_parameter", json::Any{2}).has_value());
+    ASSERT_TRUE(parameter_data_->ReplaceParameterSet("set_name_1", json::Object{}).has_value());
+    ASSERT_TRUE(parameter_data_->Insert("set_name_0", "parameter", json::Any{3}).has_value());
+
+    const auto dictionary = parameter_data_->GetParameterSetDictionary();
+    ASSERT_TRUE(dictionary.has_value());
+    auto parsing_result =
+        json::JsonParser{}.FromBuffer(std::string{dictionary.value().data(), dictionary.value().size()});
+    ASSERT_TRUE(parsing_result.has_value());
+    auto& dictionary_object = parsing_result.value().As<json::Object>().value().get();
+    const auto& set_names = dictionary_object["parameter_sets"].As<json::List>().value().get();
+    ASSERT_EQ(set_names.size(), 4U);
+    EXPECT_EQ(set_names[0].As<std::string>().value().get(), set_name_for_update_tests_);
+    EXPECT_EQ(set_names[1].As<std::string>().value().get(), "set_name_1");
+    EXPECT_EQ(set_names[2].As<std::string>().value().get(), "set_name_2");
+    EXPECT_EQ(set_names[3].As<std::string>().value().get(), "set_name_0");
+}
+
+TEST(ParameterSetCollectionReadinessTest, ParameterSetIsOnlyServedOnceReady)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSet");
+    RecordProperty("Description",
+                   "Verifies that while loading is not completed only parameter sets marked ready are served and "
+                   "requests for other parameter sets fail with the retryable kParameterSetNotReady");
+
+    ParameterSetCollection parameter_data{nullptr, std::chrono::milliseconds{1}};
+    parameter_data.SetLoadingCompleted(false);
+    ASSERT_TRUE(parameter_data.Insert("early_set", "parameter_name", json::Any{1}).has_value());
+    ASSERT_TRUE(parameter_data.Insert("late_set", "parameter_name", json::Any{2}).has_value());
+
+    EXPECT_EQ(parameter_data.GetParameterSet("early_set").error(), DataModelError::kParameterSetNotReady);
+    ASSERT_TRUE(parameter_data.MarkParameterSetReady("early_set").has_value());
+    EXPECT_TRUE(parameter_data.GetParameterSet("early_set").has_value());
+    EXPECT_EQ(parameter_data.GetParameterSet("late_set").error(), DataModelError::kParameterSetNotReady);
+    EXPECT_EQ(parameter_data.GetParameterSet("unknown_set").error(), DataModelError::kParameterSetNotReady);
+
+    parameter_data.SetLoadingCompleted(true);
+    EXPECT_TRUE(parameter_data.GetParameterSet("late_set").has_value());
+    EXPECT_EQ(parameter_data.GetParameterSet("unknown_set").error(), DataModelError::kParameterSetNotFound);
+    EXPECT_EQ(parameter_data.MarkParameterSetReady("unknown_set").error(), DataModelError::kParameterSetNotFound);
+}
+
+TEST(ParameterSetCollectionReadinessTest, WaitingRequestIsServedOnceParameterSetIsReady)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSet");
+    RecordProperty("Description",
+                   "Verifies that a request for a parameter set which is not loaded yet waits for its readiness");
+
+    ParameterSetCollection parameter_data{nullptr, std::chrono::seconds{10}};
+    parameter_data.SetLoadingCompleted(false);
+    ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_name", json::Any{1}).has_value());
+
+    std::thread loading_plugin{[&parameter_data]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        EXPECT_TRUE(parameter_data.MarkParameterSetReady("set_name").has_value());
+    }};
+    const auto result = parameter_data.GetParameterSet("set_name");
+    loading_plugin.join();
+
+    EXPECT_TRUE(result.has_value());
+}
+
+TEST(ParameterSetCollectionSnapshotTest, RestoredParameterSetIsServedAndReconciled)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::RestoreSnapshot");
+    RecordProperty("Description",
+                   "Verifies that a restored parameter set is served with its qualifier and calibratable flag and that "
+                   "parameters inserted afterwards replace the restored ones");
+
+    const std::string snapshot_path = ::testing::TempDir() + "restored_collection.snapshot";
+    std::string served_set{};
+    {
+        ParameterSetCollection parameter_data{};
+        ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_1", json::Any{1}).has_value());
+        ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_2", json::Any{2}).has_value());
+        ASSERT_TRUE(parameter_data.SetCalibratable("set_name", true));
+        ASSERT_TRUE(parameter_data.SetParameterSetQualifier("set_name", ParameterSetQualifier::kQualified).has_value());
+        ASSERT_TRUE(parameter_data.WriteSnapshot(snapshot_path).has_value());
+        served_set = parameter_data.GetParameterSet("set_name").value().c_str();
+    }
+
+    ParameterSetCollection restored_data{};
+    restored_data.SetLoadingCompleted(false);
+    const auto restore_result = restored_data.RestoreSnapshot(snapshot_path);
+    ASSERT_TRUE(restore_result.has_value());
+    EXPECT_EQ(restore_result.value(), 1U);
+    EXPECT_EQ(restored_data.GetParameterSet("set_name").value().c_str(), served_set);
+    EXPECT_EQ(restored_data.GetParameterSetQualifier("set_name").value(), ParameterSetQualifier::kQualified);
+    EXPECT_EQ(restored_data.GetParameterFromSet("set_name", "parameter_2").value().As<std::int32_t>().value(), 2);
+
+    // the plugin reconciles the restored parameter once, inserting it again is rejected as before
+    ASSERT_TRUE(restored_data.Insert("set_name", "parameter_1", json::Any{10}).has_value());
+    EXPECT_FALSE(restored_data.Insert("set_name", "parameter_1", json::Any{11}).has_value());
+    EXPECT_EQ(restored_data.GetParameterFromSet("set_name", "parameter_1").value().As<std::int32_t>().value(), 10);
+    EXPECT_TRUE(restored_data.UpdateParameterSet("set_name", R"({"parameter_2": 20})").has_value());
+}
+
+TEST(ParameterSetCollectionSnapshotTest, RestoredParametersNotInsertedAgainAreDroppedOnLoadingCompleted)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty(
+        "Verifies",
+        "::score::config_management::config_daemon::data_model::ParameterSetCollection::SetLoadingCompleted");
+    RecordProperty("Description",
+                   "Verifies that restored parameters and parameter sets which the plugins did not insert again after "
+                   "a restart are dropped once loading is completed");
+
+    const std::string snapshot_path = ::testing::TempDir() + "reconciled_collection.snapshot";
+    {
+        ParameterSetCollection parameter_data{};
+        ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_1", json::Any{1}).has_value());
+        ASSERT_TRUE(parameter_data.Insert("set_name", "dropped_parameter", json::Any{2}).has_value());
+        ASSERT_TRUE(parameter_data.Insert("dropped_set_name", "parameter_1", json::Any{3}).has_value());
+        ASSERT_TRUE(parameter_data.WriteSnapshot(snapshot_path).has_value());
+    }
+
+    ParameterSetCollection restored_data{};
+    restored_data.SetLoadingCompleted(false);
+    ASSERT_TRUE(restored_data.RestoreSnapshot(snapshot_path).has_value());
+    ASSERT_TRUE(restored_data.Insert("set_name", "parameter_1", json::Any{10}).has_value());
+    EXPECT_TRUE(restored_data.GetParameterFromSet("set_name", "dropped_parameter").has_value());
+    EXPECT_TRUE(restored_data.GetParameterSet("dropped_set_name").has_value());
+
+    restored_data.SetLoadingCompleted(true);
+
+    EXPECT_EQ(restored_data.GetParameterFromSet("set_name", "parameter_1").value().As<std::int32_t>().value(), 10);
+    EXPECT_EQ(restored_data.GetParameterFromSet("set_name", "dropped_parameter").error(),
+              DataModelError::kParameterMissedError);
+    EXPECT_EQ(restored_data.GetParameterSet("dropped_set_name").error(), DataModelError::kParameterSetNotFound);
+    // the reconciled collection differs from the snapshot, so it is written again
+    ParameterSetCollection written_data{};
+    ASSERT_TRUE(restored_data.WriteSnapshot(snapshot_path).has_value());
+    ASSERT_TRUE(written_data.RestoreSnapshot(snapshot_path).has_value());
+    EXPECT_EQ(written_data.GetParameterFromSet("set_name", "dropped_parameter").error(),
+              DataModelError::kParameterMissedError);
+    EXPECT_EQ(written_data.GetParameterSet("dropped_set_name").error(), DataModelError::kParameterSetNotFound);
+}
+
+TEST(ParameterSetCollectionSnapshotTest, DroppedRestoredParameterSetCreatedAgainKeepsItsIdentifier)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty(
+        "Verifies",
+        "::score::config_management::config_daemon::data_model::ParameterSetCollection::GetParameterSetDictionary");
+    RecordProperty("Description",
+                   "Verifies that a restored parameter set which got dropped on loading completed and is created "
+                   "again keeps its identifier, so that the dictionary lists every name once");
+
+    const std::string snapshot_path = ::testing::TempDir() + "recreated_collection.snapshot";
+    {
+        ParameterSetCollection parameter_data{};
+        ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_1", json::Any{1}).has_value());
+        ASSERT_TRUE(parameter_data.Insert("dropped_set_name", "parameter_1", json::Any{2}).has_value());
+        ASSERT_TRUE(parameter_data.WriteSnapshot(snapshot_path).has_value());
+    }
+    ParameterSetCollection restored_data{};
+    restored_data.SetLoadingCompleted(false);
+    ASSERT_TRUE(restored_data.RestoreSnapshot(snapshot_path).has_value());
+    ASSERT_TRUE(restored_data.Insert("set_name", "parameter_1", json::Any{1}).has_value());
+    restored_data.SetLoadingCompleted(true);
+    ASSERT_EQ(restored_data.GetParameterSet("dropped_set_name").error(), DataModelError::kParameterSetNotFound);
+
+    ASSERT_TRUE(restored_data.Insert("dropped_set_name", "parameter_1", json::Any{3}).has_value());
+    ASSERT_TRUE(restored_data.ReplaceParameterSet("dropped_set_name", json::Object{}).has_value());
+
+    const auto dictionary = restored_data.GetParameterSetDictionary();
+    ASSERT_TRUE(dictionary.has_value());
+    auto parsing_result =
+        json::JsonParser{}.FromBuffer(std::string{dictionary.value().data(), dictionary.value().size()});
+    ASSERT_TRUE(parsing_result.has_value());
+    auto& dictionary_object = parsing_result.value().As<json::Object>().value().get();
+    const auto& set_names = dictionary_object["parameter_sets"].As<json::List>().value().get();
+    ASSERT_EQ(set_names.size(), 2U);
+    EXPECT_NE(set_names[0].As<std::string>().value().get(), set_names[1].As<std::string>().value().get());
+}
+
+TEST(ParameterSetCollectionSnapshotTest, UnchangedCollectionIsNotWrittenAgain)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::WriteSnapshot");
+    RecordProperty("Description", "Verifies that the snapshot is only written if the collection changed");
+
+    const std::string snapshot_path = ::testing::TempDir() + "unchanged_collection.snapshot";
+    ParameterSetCollection parameter_data{};
+    ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_1", json::Any{1}).has_value());
+    ASSERT_TRUE(parameter_data.WriteSnapshot(snapshot_path).has_value());
+    ASSERT_EQ(std::remove(snapshot_path.c_str()), 0);
+
+    ASSERT_TRUE(parameter_data.WriteSnapshot(snapshot_path).has_value());
+    EXPECT_FALSE(std::ifstream{snapshot_path}.good());
+
+    ASSERT_TRUE(parameter_data.Insert("set_name", "parameter_2", json::Any{2}).has_value());
+    ASSERT_TRUE(parameter_data.WriteSnapshot(snapshot_path).has_value());
+    EXPECT_TRUE(std::ifstream{snapshot_path}.good());
+}
+
+TEST(ParameterSetCollectionSnapshotTest, RestoreMissingSnapshotFails)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::data_model::ParameterSetCollection::RestoreSnapshot");
+    RecordProperty("Description", "Verifies that restoring a missing snapshot fails with kSnapshotReadError");
+
+    ParameterSetCollection parameter_data{};
+    const auto restore_result = parameter_data.RestoreSnapshot("/non/existing/collection.snapshot");
+
+    ASSERT_FALSE(restore_result.has_value());
+    EXPECT_EQ(restore_result.error(), DataModelError::kSnapshotReadError);
+    EXPECT_FALSE(parameter_data.GetParameterSet("set_name").has_value());
+}
+
 }  // namespace test
 }  // namespace data_model
 }  // namespace config_daemon
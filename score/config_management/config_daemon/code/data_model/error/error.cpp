@@ -35,7 +35,7 @@ class DataModelErrorDomain final : public score::result::ErrorDomain
     std::string_view MessageFor(const score::result::ErrorCode& code) const noexcept override
     {
         if ((code < score::cpp::to_underlying(DataModelError::kParameterMissedError)) ||
-            (code > score::cpp::to_underlying(DataModelError::kParameterAlreadyExists)))
+            (code > score::cpp::to_underlying(DataModelError::kParameterSetNotReady)))
         {
             return std::string_view{"Unknown Error!"};
         }
@@ -67,6 +67,15 @@ class DataModelErrorDomain final : public score::result::ErrorDomain
             case DataModelError::kParameterAlreadyExists:
                 message = std::string_view{"Parameter with input name already exists"};
                 break;
+            case DataModelError::kSnapshotReadError:
+                message = std::string_view{"Snapshot could not be read"};
+                break;
+            case DataModelError::kSnapshotWriteError:
+                message = std::string_view{"Snapshot could not be written"};
+                break;
+            case DataModelError::kParameterSetNotReady:
+                message = std::string_view{"Parameter set is not loaded yet"};
+                break;
             // LCOV_EXCL_START (Reaching this default case is not possible as range is checked above.)
             default:
                 message = std::string_view{"Unknown Error!"};
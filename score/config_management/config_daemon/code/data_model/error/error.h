@@ -37,6 +37,9 @@ enum class DataModelError : score::result::ErrorCode
     kParentParameterDataNotfound,
     kParameterSetNotCalibratable,
     kParameterAlreadyExists,
+    kSnapshotReadError,
+    kSnapshotWriteError,
+    kParameterSetNotReady,
 };
 
 /// @brief ADL overload to fulfill design requirements from lib/result
@@ -45,6 +45,9 @@ TEST(DataModelErrorTest, CanConvertToString)
     TestMessage(DataModelError::kParentParameterDataNotfound, "Parent ParameterData not found");
     TestMessage(DataModelError::kParameterSetNotCalibratable, "Parameter Set is not calibratable");
     TestMessage(DataModelError::kParameterAlreadyExists, "Parameter with input name already exists");
+    TestMessage(DataModelError::kSnapshotReadError, "Snapshot could not be read");
+    TestMessage(DataModelError::kSnapshotWriteError, "Snapshot could not be written");
+    TestMessage(DataModelError::kParameterSetNotReady, "Parameter set is not loaded yet");
     TestMessage(static_cast<DataModelError>(0xff), "Unknown Error!");
     TestMessage(static_cast<DataModelError>(-1), "Unknown Error!");
 }
@@ -21,6 +21,9 @@
 
 #include <score/string_view.hpp>
 
+#include <cstddef>
+#include <string>
+
 namespace score
 {
 namespace config_management
@@ -44,6 +47,12 @@ class IParameterSetCollection : public IReadOnlyParameterSetCollection
                                const score::cpp::string_view parameter_name,
                                json::Any&& parameter_value) noexcept = 0;
     virtual ResultBlank UpdateParameterSet(const score::cpp::string_view set_name, const score::cpp::string_view set) = 0;
+    /// @brief Creates the parameter set or replaces all of its parameters at once
+    ///
+    /// In contrast to one Insert() per parameter, the collection is locked only once for the whole parameter set, so
+    /// clients never observe a partially loaded or partially replaced parameter set.
+    ///
+    virtual ResultBlank ReplaceParameterSet(const score::cpp::string_view set_name, json::Object&& parameters) = 0;
     virtual bool SetCalibratable(const score::cpp::string_view set_name, const bool is_calibratable) const noexcept = 0;
 
     virtual score::Result<score::config_management::config_daemon::ParameterSetQualifier> GetParameterSetQualifier(
@@ -51,6 +60,31 @@ class IParameterSetCollection : public IReadOnlyParameterSetCollection
     virtual ResultBlank SetParameterSetQualifier(
         const score::cpp::string_view set_name,
         const score::config_management::config_daemon::ParameterSetQualifier qualifier) = 0;
+
+    /// @brief Marks whether all plugins finished loading their parameter sets, initially they are considered loaded
+    ///
+    /// While loading is not completed, GetParameterSet() only serves parameter sets marked by MarkParameterSetReady()
+    /// or restored from a snapshot. Requests for other parameter sets wait for their readiness for a short time and
+    /// fail with the retryable error kParameterSetNotReady afterwards. Once loading is completed, the restored
+    /// parameter sets and parameters which no plugin inserted again are dropped.
+    ///
+    virtual void SetLoadingCompleted(const bool is_completed) noexcept = 0;
+    /// @brief Marks a parameter set as completely loaded, so it is served before all plugins finished loading
+    virtual ResultBlank MarkParameterSetReady(const score::cpp::string_view set_name) = 0;
+
+    /// @brief Writes all parameter sets with their qualifiers and calibratable flags to a warm-restart snapshot
+    ///
+    /// Nothing is written if the collection did not change since the last snapshot was written or restored.
+    ///
+    virtual ResultBlank WriteSnapshot(const std::string& snapshot_path) = 0;
+    /// @brief Restores the parameter sets of a warm-restart snapshot which do not exist in the collection yet
+    ///
+    /// The restored parameter sets are served right away, parameters inserted afterwards replace the restored ones.
+    /// Restored parameters which are not inserted again until SetLoadingCompleted(true) are dropped.
+    ///
+    /// @return number of restored parameter sets or kSnapshotReadError
+    ///
+    virtual Result<std::size_t> RestoreSnapshot(const std::string& snapshot_path) = 0;
 };
 
 }  // namespace data_model
@@ -18,6 +18,7 @@
 #include "score/result/result.h"
 
 #include <score/string.hpp>
+#include <cstdint>
 #include <string>
 
 namespace score
@@ -40,6 +41,28 @@ class IReadOnlyParameterSetCollection
     virtual ~IReadOnlyParameterSetCollection() noexcept;
 
     virtual Result<score::cpp::pmr::string> GetParameterSet(const std::string set_name) const = 0;
+    /// @brief Returns the parameter set encoded in the binary wire format of config_provider/code/wire_format
+    virtual Result<score::cpp::pmr::string> GetParameterSetAsBinary(const std::string set_name) const = 0;
+    /// @brief Returns the changes of the parameter set since base_version as JSON delta
+    ///
+    /// The delta has the format {"version": v, "is_complete": b, "parameters": {...}, "removed_parameters": [...],
+    /// "qualifier": q}. If base_version is unknown, e.g. zero or from before a restart, the delta is the complete set.
+    ///
+    /// The fetch is conditional: if base_version is the current version, or base_digest is the digest of the current
+    /// content (wire_format::ComputeBinarySetDigest()), only {"version": v, "is_modified": false} is returned. So a
+    /// client holding an unchanged set doesn't cause its serialization, also across restarts of the daemon. Zero
+    /// stands for an unknown digest.
+    ///
+    virtual Result<score::cpp::pmr::string> GetParameterSetChanges(const std::string set_name,
+                                                                   const std::uint64_t base_version,
+                                                                   const std::uint64_t base_digest) const = 0;
+    /// @brief Returns the dictionary of the compact numeric identifiers of the parameter sets
+    ///
+    /// The dictionary has the format {"parameter_sets": ["set_name_0", "set_name_1", ...]}, the identifier of a
+    /// parameter set is its index. Identifiers are assigned when a parameter set is created and never change or get
+    /// reused while the daemon runs, so a client fetches the dictionary once per connection.
+    ///
+    virtual Result<score::cpp::pmr::string> GetParameterSetDictionary() const = 0;
     virtual Result<json::Any> GetParameterFromSet(const score::cpp::string_view set_name,
                                                   const score::cpp::string_view parameter_name) const = 0;
 };
@@ -38,6 +38,15 @@ class ReadOnlyParameterSetCollectionMock final : public IReadOnlyParameterSetCol
     virtual ~ReadOnlyParameterSetCollectionMock() noexcept;
 
     MOCK_METHOD(Result<score::cpp::pmr::string>, GetParameterSet, (const std::string set_name), (const, noexcept, override));
+    MOCK_METHOD(Result<score::cpp::pmr::string>,
+                GetParameterSetAsBinary,
+                (const std::string set_name),
+                (const, noexcept, override));
+    MOCK_METHOD(Result<score::cpp::pmr::string>,
+                GetParameterSetChanges,
+                (const std::string set_name, const std::uint64_t base_version, const std::uint64_t base_digest),
+                (const, noexcept, override));
+    MOCK_METHOD(Result<score::cpp::pmr::string>, GetParameterSetDictionary, (), (const, noexcept, override));
     MOCK_METHOD(Result<json::Any>,
                 GetParameterFromSet,
                 (const score::cpp::string_view set_name, const score::cpp::string_view parameter_name),
@@ -35,7 +35,20 @@ class ParameterSetCollectionMock final : public IParameterSetCollection
                 (const score::cpp::string_view, const score::cpp::string_view, json::Any&&),
                 (noexcept, override));
     MOCK_METHOD(ResultBlank, UpdateParameterSet, (const score::cpp::string_view, const score::cpp::string_view set), (override));
+    MOCK_METHOD(ResultBlank,
+                ReplaceParameterSet,
+                (const score::cpp::string_view set_name, json::Object&& parameters),
+                (override));
     MOCK_METHOD(Result<score::cpp::pmr::string>, GetParameterSet, (const std::string set_name), (const, override));
+    MOCK_METHOD(Result<score::cpp::pmr::string>,
+                GetParameterSetAsBinary,
+                (const std::string set_name),
+                (const, override));
+    MOCK_METHOD(Result<score::cpp::pmr::string>,
+                GetParameterSetChanges,
+                (const std::string set_name, const std::uint64_t base_version, const std::uint64_t base_digest),
+                (const, override));
+    MOCK_METHOD(Result<score::cpp::pmr::string>, GetParameterSetDictionary, (), (const, override));
     MOCK_METHOD(Result<json::Any>,
                 GetParameterFromSet,
                 (const score::cpp::string_view set_name, const score::cpp::string_view parameter_name),
@@ -52,6 +65,10 @@ class ParameterSetCollectionMock final : public IParameterSetCollection
                 SetParameterSetQualifier,
                 (const score::cpp::string_view set_name, const score::config_management::config_daemon::ParameterSetQualifier qualifier),
                 (override));
+    MOCK_METHOD(void, SetLoadingCompleted, (const bool is_completed), (noexcept, override));
+    MOCK_METHOD(ResultBlank, MarkParameterSetReady, (const score::cpp::string_view set_name), (override));
+    MOCK_METHOD(ResultBlank, WriteSnapshot, (const std::string& snapshot_path), (override));
+    MOCK_METHOD(Result<std::size_t>, RestoreSnapshot, (const std::string& snapshot_path), (override));
 };
 
 }  // namespace data_model
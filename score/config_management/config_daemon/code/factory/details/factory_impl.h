@@ -50,11 +50,14 @@ class Factory final : public IFactory
     std::shared_ptr<data_model::IParameterSetCollection> CreateParameterSetCollection() const override;
     std::shared_ptr<fault_event_reporter::IFaultEventReporter> CreateFaultEventReporter() const override;
 
-    std::unique_ptr<IPluginCollector> CreatePluginCollector() const override;
+    std::unique_ptr<IPluginCollector> CreatePluginCollector(const std::string& file_source_directory) const override;
+
+    std::shared_ptr<metrics::DaemonMetrics> GetDaemonMetrics() const override;
 
   private:
     std::shared_ptr<common::IJsonHelper> json_helper_;
     std::shared_ptr<score::hash::IHashCalculatorFactory> hash_calculator_factory_;
+    std::shared_ptr<metrics::DaemonMetrics> daemon_metrics_;
 };
 
 }  // namespace config_daemon
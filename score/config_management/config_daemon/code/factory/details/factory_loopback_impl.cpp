@@ -0,0 +1,126 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_daemon/code/factory/details/factory_loopback_impl.h"
+#include "score/config_management/config_daemon/code/data_model/details/parameterset_collection_impl.h"
+#include "score/config_management/config_daemon/code/fault_event_reporter/details/fault_event_reporter_score_impl.h"
+#include "score/config_management/config_daemon/code/services/details/internal_config_provider_service_reactor_impl.h"
+#include "score/config_management/config_daemon/code/services/details/loopback/internal_config_provider_service_impl.h"
+
+#include "platform/aas/mw/service/backend/mw_com/provided_service_builder.h"
+#include "platform/aas/mw/service/backend/mw_com/provided_service_decorator.h"
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+namespace
+{
+
+class GivenPluginCollector final : public IPluginCollector
+{
+  public:
+    explicit GivenPluginCollector(std::vector<std::shared_ptr<IPlugin>> plugins)
+        : IPluginCollector{}, plugins_{std::move(plugins)}
+    {
+    }
+
+    std::vector<std::shared_ptr<IPlugin>> CreatePlugins() override
+    {
+        return plugins_;
+    }
+
+  private:
+    const std::vector<std::shared_ptr<IPlugin>> plugins_;
+};
+
+}  // namespace
+
+LoopbackFactory::LoopbackFactory(std::shared_ptr<config_provider::loopback::LoopbackChannel> channel,
+                                 std::vector<std::shared_ptr<IPlugin>> plugins)
+    : IFactory{},
+      channel_{std::move(channel)},
+      plugins_{std::move(plugins)},
+      daemon_metrics_{std::make_shared<metrics::DaemonMetrics>()}
+{
+}
+
+mw::service::ProvidedServiceContainer LoopbackFactory::CreateInternalConfigProviderService(
+    const std::shared_ptr<data_model::IParameterSetCollection> read_only_parameter_data_interface) const
+{
+    mw::service::ProvidedServiceBuilder builder{};
+    auto service_reactor =
+        std::make_shared<InternalConfigProviderServiceReactorImpl>(read_only_parameter_data_interface, daemon_metrics_);
+    score::cpp::ignore = builder.With<LoopbackInternalConfigProviderService>(
+        LoopbackInternalConfigProviderService{std::move(service_reactor), channel_});
+    return builder.GetServices();
+}
+
+LastUpdatedParameterSetSender LoopbackFactory::CreateLastUpdatedParameterSetSender(
+    mw::service::ProvidedServiceContainer& services)
+{
+    auto* const provided_service_container =
+        services.GetServices<mw::service::backend::mw_com::ProvidedServiceBuilder::DecoratorType>();
+    if ((provided_service_container != nullptr) && provided_service_container->Has<IInternalConfigProviderService>())
+    {
+        return [internal_config_provider_service{provided_service_container->Get<IInternalConfigProviderService>()}](
+                   const std::string_view parameter_set_name) noexcept -> bool {
+            return internal_config_provider_service->SendLastUpdatedParameterSet(parameter_set_name);
+        };
+    }
+    return {};
+}
+
+InitialQualifierStateSender LoopbackFactory::CreateInitialQualifierStateSender(
+    mw::service::ProvidedServiceContainer& services)
+{
+    auto* const provided_service_container =
+        services.GetServices<mw::service::backend::mw_com::ProvidedServiceBuilder::DecoratorType>();
+    if ((provided_service_container != nullptr) && provided_service_container->Has<IInternalConfigProviderService>())
+    {
+        return [internal_config_provider_service{provided_service_container->Get<IInternalConfigProviderService>()}](
+                   const config_daemon::InitialQualifierState initial_qualifier_state) noexcept -> void {
+            internal_config_provider_service->SetInitialQualifierState(initial_qualifier_state);
+        };
+    }
+    return {};
+}
+
+std::shared_ptr<data_model::IParameterSetCollection> LoopbackFactory::CreateParameterSetCollection() const
+{
+    return std::make_shared<data_model::ParameterSetCollection>(daemon_metrics_);
+}
+
+std::unique_ptr<IPluginCollector> LoopbackFactory::CreatePluginCollector(const std::string&) const
+{
+    return std::make_unique<GivenPluginCollector>(plugins_);
+}
+
+std::shared_ptr<fault_event_reporter::IFaultEventReporter> LoopbackFactory::CreateFaultEventReporter() const
+{
+    return std::make_shared<fault_event_reporter::FaultEventReporter>();
+}
+
+std::shared_ptr<metrics::DaemonMetrics> LoopbackFactory::GetDaemonMetrics() const
+{
+    return daemon_metrics_;
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
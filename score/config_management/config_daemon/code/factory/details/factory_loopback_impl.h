@@ -0,0 +1,75 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef CODE_FACTORY_DETAILS_FACTORY_LOOPBACK_IMPL_H
+#define CODE_FACTORY_DETAILS_FACTORY_LOOPBACK_IMPL_H
+
+#include "score/config_management/config_daemon/code/factory/factory.h"
+#include "score/config_management/config_daemon/code/plugins/plugin.h"
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+///
+/// @brief Factory of a ConfigDaemon which serves ConfigProviders in its own process instead of via mw::com
+///
+/// The InternalConfigProviderService is offered on the given loopback channel and the given plugins are run instead of
+/// the ones of the PluginCollector. So the ConfigDaemon runs e.g. in end-to-end benchmarks with synthetic plugins.
+///
+class LoopbackFactory final : public IFactory
+{
+  public:
+    LoopbackFactory(std::shared_ptr<config_provider::loopback::LoopbackChannel> channel,
+                    std::vector<std::shared_ptr<IPlugin>> plugins);
+    ~LoopbackFactory() override = default;
+    LoopbackFactory(LoopbackFactory&&) = delete;
+    LoopbackFactory(const LoopbackFactory&) = delete;
+
+    LoopbackFactory& operator=(LoopbackFactory&&) = delete;
+    LoopbackFactory& operator=(const LoopbackFactory&) = delete;
+
+    mw::service::ProvidedServiceContainer CreateInternalConfigProviderService(
+        const std::shared_ptr<data_model::IParameterSetCollection> read_only_parameter_data_interface) const override;
+    LastUpdatedParameterSetSender CreateLastUpdatedParameterSetSender(
+        mw::service::ProvidedServiceContainer& services) override;
+    InitialQualifierStateSender CreateInitialQualifierStateSender(
+        mw::service::ProvidedServiceContainer& services) override;
+
+    std::shared_ptr<data_model::IParameterSetCollection> CreateParameterSetCollection() const override;
+    std::shared_ptr<fault_event_reporter::IFaultEventReporter> CreateFaultEventReporter() const override;
+
+    /// @brief Returns a collector of the plugins given on construction, file_source_directory is ignored
+    std::unique_ptr<IPluginCollector> CreatePluginCollector(const std::string& file_source_directory) const override;
+
+    std::shared_ptr<metrics::DaemonMetrics> GetDaemonMetrics() const override;
+
+  private:
+    const std::shared_ptr<config_provider::loopback::LoopbackChannel> channel_;
+    const std::vector<std::shared_ptr<IPlugin>> plugins_;
+    std::shared_ptr<metrics::DaemonMetrics> daemon_metrics_;
+};
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_FACTORY_DETAILS_FACTORY_LOOPBACK_IMPL_H
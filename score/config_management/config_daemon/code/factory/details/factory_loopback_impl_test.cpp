@@ -0,0 +1,146 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/factory/details/factory_loopback_impl.h"
+#include "score/config_management/config_daemon/code/plugins/plugin_mock.h"
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+
+#include "platform/aas/mw/service/backend/mw_com/provided_service_builder.h"
+#include "platform/aas/mw/service/backend/mw_com/provided_service_decorator.h"
+
+#include <gtest/gtest.h>
+
+#include <score/utility.hpp>
+
+#include <memory>
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace test
+{
+namespace
+{
+
+using config_provider::loopback::LoopbackChannel;
+
+class TestFactoryLoopbackImpl : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        channel_ = std::make_shared<LoopbackChannel>();
+        plugin_ = std::make_shared<PluginMock>();
+        unit_ = std::make_unique<LoopbackFactory>(channel_, std::vector<std::shared_ptr<IPlugin>>{plugin_});
+    }
+
+    std::shared_ptr<LoopbackChannel> channel_;
+    std::shared_ptr<PluginMock> plugin_;
+    std::unique_ptr<LoopbackFactory> unit_;
+};
+
+TEST_F(TestFactoryLoopbackImpl, CreateInternalConfigProviderServiceOffersOnChannel)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "LoopbackFactory::CreateInternalConfigProviderService()");
+    RecordProperty("Description",
+                   "Ensure the created service serves the parameter set collection on the channel while it is started");
+
+    const auto parameter_data = unit_->CreateParameterSetCollection();
+    json::Object parameters{};
+    parameters["parameter_1"] = json::Any{1};
+    ASSERT_TRUE(parameter_data->ReplaceParameterSet("set_name", std::move(parameters)).has_value());
+    ASSERT_TRUE(parameter_data->MarkParameterSetReady("set_name").has_value());
+
+    auto provided_service_container = unit_->CreateInternalConfigProviderService(parameter_data);
+    ASSERT_EQ(provided_service_container.NumServices(), 1);
+    EXPECT_FALSE(channel_->IsOffered());
+
+    provided_service_container.StartServices();
+    EXPECT_TRUE(channel_->IsOffered());
+    EXPECT_TRUE(channel_->GetParameterSet("set_name").has_value());
+    EXPECT_EQ(unit_->GetDaemonMetrics()->GetSnapshot().requests_per_parameter_set.at("set_name"), 1U);
+
+    provided_service_container.StopServices();
+    EXPECT_FALSE(channel_->IsOffered());
+}
+
+TEST_F(TestFactoryLoopbackImpl, SendersPublishOnChannel)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "LoopbackFactory::CreateLastUpdatedParameterSetSender(), "
+                   "LoopbackFactory::CreateInitialQualifierStateSender()");
+    RecordProperty("Description", "Ensure updates and the initial qualifier state are published on the channel");
+
+    auto provided_service_container = unit_->CreateInternalConfigProviderService(unit_->CreateParameterSetCollection());
+    auto send_last_updated_parameter_set = unit_->CreateLastUpdatedParameterSetSender(provided_service_container);
+    auto send_initial_qualifier_state = unit_->CreateInitialQualifierStateSender(provided_service_container);
+    ASSERT_FALSE(send_last_updated_parameter_set.empty());
+    ASSERT_FALSE(send_initial_qualifier_state.empty());
+
+    std::string updated_set_name{};
+    score::cpp::ignore = channel_->Subscribe([&updated_set_name](const score::cpp::string_view set_name) {
+        updated_set_name = std::string{set_name.data(), set_name.size()};
+    });
+    provided_service_container.StartServices();
+
+    EXPECT_TRUE(send_last_updated_parameter_set("set_name"));
+    EXPECT_EQ(updated_set_name, "set_name");
+
+    send_initial_qualifier_state(InitialQualifierState::kQualified);
+    EXPECT_EQ(channel_->GetInitialQualifierState(), config_provider::InitialQualifierState::kQualified);
+
+    provided_service_container.StopServices();
+}
+
+TEST_F(TestFactoryLoopbackImpl, SendersAreEmptyWithoutService)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "LoopbackFactory::CreateLastUpdatedParameterSetSender(), "
+                   "LoopbackFactory::CreateInitialQualifierStateSender()");
+    RecordProperty("Description", "Ensure no senders are created for a container without the service");
+
+    mw::service::ProvidedServiceContainer provided_service_container{};
+
+    EXPECT_TRUE(unit_->CreateLastUpdatedParameterSetSender(provided_service_container).empty());
+    EXPECT_TRUE(unit_->CreateInitialQualifierStateSender(provided_service_container).empty());
+}
+
+TEST_F(TestFactoryLoopbackImpl, CreatePluginCollectorReturnsGivenPlugins)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "LoopbackFactory::CreatePluginCollector()");
+    RecordProperty("Description", "Ensure the plugins given on construction are run instead of collected ones");
+
+    const auto plugins = unit_->CreatePluginCollector("/non/existing/directory")->CreatePlugins();
+
+    ASSERT_EQ(plugins.size(), 1U);
+    EXPECT_EQ(plugins.front(), plugin_);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -42,7 +42,8 @@ const auto kICPServiceInstanceSpecifierName =
 Factory::Factory()
     : IFactory{},
       json_helper_{std::make_shared<common::JsonHelper>()},
-      hash_calculator_factory_{std::make_shared<hash::SafeHashCalculatorFactory>()}
+      hash_calculator_factory_{std::make_shared<hash::SafeHashCalculatorFactory>()},
+      daemon_metrics_{std::make_shared<metrics::DaemonMetrics>()}
 {
 }
 
@@ -51,7 +52,7 @@ mw::service::ProvidedServiceContainer Factory::CreateInternalConfigProviderServi
 {
     mw::service::ProvidedServiceBuilder builder{};
     auto service_reactor =
-        std::make_unique<InternalConfigProviderServiceReactorImpl>(read_only_parameter_data_interface);
+        std::make_unique<InternalConfigProviderServiceReactorImpl>(read_only_parameter_data_interface, daemon_metrics_);
 
     score::Result<InternalConfigProviderService> icp_creation_result =
         InternalConfigProviderService::Create(std::move(service_reactor), kICPServiceInstanceSpecifierName);
@@ -98,12 +99,12 @@ InitialQualifierStateSender Factory::CreateInitialQualifierStateSender(mw::servi
 
 std::shared_ptr<data_model::IParameterSetCollection> Factory::CreateParameterSetCollection() const
 {
-    return std::make_shared<data_model::ParameterSetCollection>();
+    return std::make_shared<data_model::ParameterSetCollection>(daemon_metrics_);
 }
 
-std::unique_ptr<IPluginCollector> Factory::CreatePluginCollector() const
+std::unique_ptr<IPluginCollector> Factory::CreatePluginCollector(const std::string& file_source_directory) const
 {
-    return std::make_unique<PluginCollector>();
+    return std::make_unique<PluginCollector>(file_source_directory);
 }
 
 std::shared_ptr<fault_event_reporter::IFaultEventReporter> Factory::CreateFaultEventReporter() const
@@ -111,6 +112,11 @@ std::shared_ptr<fault_event_reporter::IFaultEventReporter> Factory::CreateFaultE
     return std::make_shared<fault_event_reporter::FaultEventReporter>();
 }
 
+std::shared_ptr<metrics::DaemonMetrics> Factory::GetDaemonMetrics() const
+{
+    return daemon_metrics_;
+}
+
 }  // namespace config_daemon
 }  // namespace config_management
 }  // namespace score
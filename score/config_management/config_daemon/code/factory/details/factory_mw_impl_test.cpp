@@ -229,6 +229,18 @@ TEST_F(TestFactoryMwImpl, CreateParameterSetCollection)
     ASSERT_NE(nullptr, impl);
 }
 
+TEST_F(TestFactoryMwImpl, GetDaemonMetrics)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "Factory::GetDaemonMetrics()");
+    RecordProperty("Description", "Ensure the same DaemonMetrics instance is shared by all created components");
+
+    const auto daemon_metrics = unit_->GetDaemonMetrics();
+    ASSERT_NE(nullptr, daemon_metrics);
+    EXPECT_EQ(daemon_metrics, unit_->GetDaemonMetrics());
+}
+
 TEST_F(TestFactoryMwImpl, CreatePluginCollector)
 {
     RecordProperty("Priority", "3");
@@ -236,8 +248,9 @@ TEST_F(TestFactoryMwImpl, CreatePluginCollector)
     RecordProperty("Verifies", "Factory::CreatePluginCollector()");
     RecordProperty("Description", "Ensure valid PluginCollector is created");
 
-    const auto plugin_collector = unit_->CreatePluginCollector();
+    const auto plugin_collector = unit_->CreatePluginCollector("");
     ASSERT_NE(nullptr, plugin_collector);
+    EXPECT_EQ(unit_->CreatePluginCollector("/parameter_sets")->CreatePlugins().size(), 1U);
 }
 TEST_F(TestFactoryMwImpl, CreateFaultEventReporter)
 {
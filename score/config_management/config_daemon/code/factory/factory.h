@@ -16,6 +16,7 @@
 
 #include "score/config_management/config_daemon/code/data_model/parameterset_collection.h"
 #include "score/config_management/config_daemon/code/fault_event_reporter/fault_event_reporter.h"
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
 #include "score/config_management/config_daemon/code/plugins/plugin_collector/plugin_collector.h"
 #include "score/config_management/config_daemon/code/services/internal_config_provider_service.h"
 
@@ -23,6 +24,7 @@
 
 #include <score/memory.hpp>
 #include <memory>
+#include <string>
 
 namespace score
 {
@@ -51,8 +53,12 @@ class IFactory
 
     virtual std::shared_ptr<data_model::IParameterSetCollection> CreateParameterSetCollection() const = 0;
 
-    virtual std::unique_ptr<IPluginCollector> CreatePluginCollector() const = 0;
+    /// @brief Creates the collector of all plugins, the FileSourcePlugin is only created for a file_source_directory
+    virtual std::unique_ptr<IPluginCollector> CreatePluginCollector(const std::string& file_source_directory) const = 0;
     virtual std::shared_ptr<fault_event_reporter::IFaultEventReporter> CreateFaultEventReporter() const = 0;
+
+    /// @brief Metrics shared by all components created by the factory, nullptr if metrics are not collected
+    virtual std::shared_ptr<metrics::DaemonMetrics> GetDaemonMetrics() const = 0;
 };
 
 }  // namespace config_daemon
@@ -53,12 +53,17 @@ class FactoryMock final : public IFactory
                 (),
                 (const, override));
 
-    MOCK_METHOD(std::unique_ptr<IPluginCollector>, CreatePluginCollector, (), (const, override));
+    MOCK_METHOD(std::unique_ptr<IPluginCollector>,
+                CreatePluginCollector,
+                (const std::string& file_source_directory),
+                (const, override));
 
     MOCK_METHOD(std::shared_ptr<fault_event_reporter::IFaultEventReporter>,
                 CreateFaultEventReporter,
                 (),
                 (const, override));
+
+    MOCK_METHOD(std::shared_ptr<metrics::DaemonMetrics>, GetDaemonMetrics, (), (const, override));
 };
 
 }  // namespace config_daemon
@@ -0,0 +1,144 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace metrics
+{
+
+namespace
+{
+
+// the plugin tables are bounded by the number of plugins, so unlike the per parameter set table they are not limited
+template <typename Value>
+Value& GetOrAdd(std::map<std::string, Value, std::less<>>& table, const std::string_view plugin_name)
+{
+    const auto it = table.find(plugin_name);
+    if (it != table.end())
+    {
+        return it->second;
+    }
+    return table.emplace(std::string{plugin_name}, Value{}).first->second;
+}
+
+}  // namespace
+
+DaemonMetrics::DaemonMetrics() noexcept
+    : start_time_{Clock::now()},
+      failed_requests_{},
+      serialized_bytes_{},
+      send_failures_{},
+      serialization_time_{},
+      lock_wait_time_{},
+      lock_hold_time_{},
+      tables_mutex_{},
+      requests_per_parameter_set_{},
+      untracked_requests_{0U},
+      updates_per_plugin_{},
+      plugin_startup_times_{}
+{
+}
+
+void DaemonMetrics::RecordRequest(const std::string_view parameter_set_name, const bool served)
+{
+    if (!served)
+    {
+        failed_requests_.Increment();
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock{tables_mutex_};
+    const auto it = requests_per_parameter_set_.find(parameter_set_name);
+    if (it != requests_per_parameter_set_.end())
+    {
+        ++it->second;
+    }
+    else if (requests_per_parameter_set_.size() < kMaxTrackedParameterSets)
+    {
+        static_cast<void>(requests_per_parameter_set_.emplace(std::string{parameter_set_name}, 1U));
+    }
+    else
+    {
+        ++untracked_requests_;
+    }
+}
+
+void DaemonMetrics::RecordSerialization(const Clock::duration duration, const std::size_t serialized_bytes) noexcept
+{
+    serialization_time_.Record(duration);
+    serialized_bytes_.Increment(static_cast<std::uint64_t>(serialized_bytes));
+}
+
+void DaemonMetrics::RecordLockWait(const Clock::duration duration) noexcept
+{
+    lock_wait_time_.Record(duration);
+}
+
+void DaemonMetrics::RecordLockHold(const Clock::duration duration) noexcept
+{
+    lock_hold_time_.Record(duration);
+}
+
+void DaemonMetrics::RecordParameterSetUpdate(const std::string_view plugin_name, const bool sent)
+{
+    if (!sent)
+    {
+        send_failures_.Increment();
+    }
+
+    const std::lock_guard<std::mutex> lock{tables_mutex_};
+    ++GetOrAdd(updates_per_plugin_, plugin_name);
+}
+
+void DaemonMetrics::RecordPluginInitialize(const std::string_view plugin_name, const Clock::duration duration)
+{
+    const std::lock_guard<std::mutex> lock{tables_mutex_};
+    GetOrAdd(plugin_startup_times_, plugin_name).initialize =
+        std::chrono::duration_cast<std::chrono::microseconds>(duration);
+}
+
+void DaemonMetrics::RecordPluginRun(const std::string_view plugin_name, const Clock::duration duration)
+{
+    const std::lock_guard<std::mutex> lock{tables_mutex_};
+    GetOrAdd(plugin_startup_times_, plugin_name).run = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+}
+
+DaemonMetricsSnapshot DaemonMetrics::GetSnapshot() const
+{
+    DaemonMetricsSnapshot snapshot{};
+    snapshot.uptime = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_time_);
+    snapshot.failed_requests = failed_requests_.Get();
+    snapshot.serialized_bytes = serialized_bytes_.Get();
+    snapshot.serialization_time = serialization_time_.GetSnapshot();
+    snapshot.lock_wait_time = lock_wait_time_.GetSnapshot();
+    snapshot.lock_hold_time = lock_hold_time_.GetSnapshot();
+    snapshot.send_last_updated_parameter_set_failures = send_failures_.Get();
+
+    const std::lock_guard<std::mutex> lock{tables_mutex_};
+    snapshot.requests_per_parameter_set = requests_per_parameter_set_;
+    snapshot.untracked_requests = untracked_requests_;
+    snapshot.updates_per_plugin = updates_per_plugin_;
+    snapshot.plugin_startup_times = plugin_startup_times_;
+    return snapshot;
+}
+
+}  // namespace metrics
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,128 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef CODE_METRICS_DAEMON_METRICS_H
+#define CODE_METRICS_DAEMON_METRICS_H
+
+#include "score/config_management/config_provider/code/metrics/counter.h"
+#include "score/config_management/config_provider/code/metrics/latency_histogram.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace metrics
+{
+
+using Counter = config_provider::metrics::Counter;
+using LatencyHistogram = config_provider::metrics::LatencyHistogram;
+using LatencyHistogramSnapshot = config_provider::metrics::LatencyHistogramSnapshot;
+
+/// @brief Startup durations of a plugin, zero if the step was not executed
+struct PluginStartupTime
+{
+    std::chrono::microseconds initialize;
+    std::chrono::microseconds run;
+};
+
+/// @brief Point-in-time view of the DaemonMetrics
+///
+/// All values are totals since the start of the ConfigDaemon. Rates are derived by the consumer from the difference of
+/// two snapshots divided by the difference of their uptime.
+///
+struct DaemonMetricsSnapshot
+{
+    std::chrono::milliseconds uptime;
+    /// Successfully served InternalConfigProviderService requests per parameter set
+    std::map<std::string, std::uint64_t, std::less<>> requests_per_parameter_set;
+    /// Served requests for parameter sets beyond DaemonMetrics::kMaxTrackedParameterSets
+    std::uint64_t untracked_requests;
+    std::uint64_t failed_requests;
+    /// Total size of all parameter sets serialized for clients
+    std::uint64_t serialized_bytes;
+    LatencyHistogramSnapshot serialization_time;
+    LatencyHistogramSnapshot lock_wait_time;
+    LatencyHistogramSnapshot lock_hold_time;
+    /// Parameter set updates announced by every plugin, keyed by plugin name
+    std::map<std::string, std::uint64_t, std::less<>> updates_per_plugin;
+    std::uint64_t send_last_updated_parameter_set_failures;
+    /// Durations of the plugin Initialize() and Run() calls, keyed by plugin name
+    std::map<std::string, PluginStartupTime, std::less<>> plugin_startup_times;
+};
+
+///
+/// @brief Counters and latency histograms of the ConfigDaemon
+///
+/// Shared by all components of the daemon which serve requests or change parameter sets. All methods are thread-safe.
+/// Counters and histograms are lock-free, only the per parameter set and per plugin tables take a short internal lock.
+///
+class DaemonMetrics final
+{
+  public:
+    using Clock = LatencyHistogram::Clock;
+
+    /// Bound of the per parameter set table, so that requests for arbitrary names can not grow it without limit
+    static constexpr std::size_t kMaxTrackedParameterSets{256U};
+
+    DaemonMetrics() noexcept;
+    ~DaemonMetrics() noexcept = default;
+
+    DaemonMetrics(DaemonMetrics&&) noexcept = delete;
+    DaemonMetrics(const DaemonMetrics&) noexcept = delete;
+    DaemonMetrics& operator=(DaemonMetrics&&) & noexcept = delete;
+    DaemonMetrics& operator=(const DaemonMetrics&) & noexcept = delete;
+
+    void RecordRequest(const std::string_view parameter_set_name, const bool served);
+    void RecordSerialization(const Clock::duration duration, const std::size_t serialized_bytes) noexcept;
+    void RecordLockWait(const Clock::duration duration) noexcept;
+    void RecordLockHold(const Clock::duration duration) noexcept;
+    void RecordParameterSetUpdate(const std::string_view plugin_name, const bool sent);
+    void RecordPluginInitialize(const std::string_view plugin_name, const Clock::duration duration);
+    void RecordPluginRun(const std::string_view plugin_name, const Clock::duration duration);
+
+    DaemonMetricsSnapshot GetSnapshot() const;
+
+  private:
+    const Clock::time_point start_time_;
+
+    Counter failed_requests_;
+    Counter serialized_bytes_;
+    Counter send_failures_;
+    LatencyHistogram serialization_time_;
+    LatencyHistogram lock_wait_time_;
+    LatencyHistogram lock_hold_time_;
+
+    mutable std::mutex tables_mutex_;
+    std::map<std::string, std::uint64_t, std::less<>> requests_per_parameter_set_;
+    std::uint64_t untracked_requests_;
+    std::map<std::string, std::uint64_t, std::less<>> updates_per_plugin_;
+    std::map<std::string, PluginStartupTime, std::less<>> plugin_startup_times_;
+};
+
+}  // namespace metrics
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_METRICS_DAEMON_METRICS_H
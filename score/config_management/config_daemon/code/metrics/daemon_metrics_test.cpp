@@ -0,0 +1,128 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
+#include "score/config_management/config_daemon/code/metrics/timed_lock_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace metrics
+{
+namespace test
+{
+
+TEST(DaemonMetricsTest, RecordRequestsPerParameterSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::metrics::DaemonMetrics::RecordRequest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that served requests are counted per parameter set and failed ones in total.");
+
+    DaemonMetrics metrics{};
+    metrics.RecordRequest("set_name_1", true);
+    metrics.RecordRequest("set_name_1", true);
+    metrics.RecordRequest("set_name_2", true);
+    metrics.RecordRequest("unknown_set", false);
+
+    const auto snapshot = metrics.GetSnapshot();
+    ASSERT_EQ(snapshot.requests_per_parameter_set.size(), 2U);
+    EXPECT_EQ(snapshot.requests_per_parameter_set.at("set_name_1"), 2U);
+    EXPECT_EQ(snapshot.requests_per_parameter_set.at("set_name_2"), 1U);
+    EXPECT_EQ(snapshot.untracked_requests, 0U);
+    EXPECT_EQ(snapshot.failed_requests, 1U);
+}
+
+TEST(DaemonMetricsTest, RequestTableIsBounded)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::metrics::DaemonMetrics::RecordRequest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that requests beyond kMaxTrackedParameterSets are counted as untracked.");
+
+    DaemonMetrics metrics{};
+    for (std::size_t index = 0U; index <= DaemonMetrics::kMaxTrackedParameterSets; ++index)
+    {
+        metrics.RecordRequest("set_name_" + std::to_string(index), true);
+    }
+    metrics.RecordRequest("set_name_0", true);
+
+    const auto snapshot = metrics.GetSnapshot();
+    EXPECT_EQ(snapshot.requests_per_parameter_set.size(), DaemonMetrics::kMaxTrackedParameterSets);
+    EXPECT_EQ(snapshot.requests_per_parameter_set.at("set_name_0"), 2U);
+    EXPECT_EQ(snapshot.untracked_requests, 1U);
+}
+
+TEST(DaemonMetricsTest, RecordUpdatesSerializationAndLocking)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::metrics::DaemonMetrics");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that plugin updates, startup times, send failures, serialization and lock times "
+                   "are recorded.");
+
+    DaemonMetrics metrics{};
+    metrics.RecordPluginInitialize("second_plugin", std::chrono::milliseconds{2});
+    metrics.RecordPluginRun("first_plugin", std::chrono::milliseconds{10});
+    metrics.RecordPluginRun("second_plugin", std::chrono::milliseconds{30});
+    metrics.RecordParameterSetUpdate("second_plugin", true);
+    metrics.RecordParameterSetUpdate("second_plugin", false);
+    metrics.RecordSerialization(std::chrono::microseconds{5}, 100U);
+    metrics.RecordSerialization(std::chrono::microseconds{7}, 50U);
+    std::mutex mutex{};
+    {
+        const TimedLockGuard<std::mutex> lock{mutex, &metrics};
+    }
+    {
+        const TimedLockGuard<std::mutex> lock{mutex, nullptr};
+    }
+
+    const auto snapshot = metrics.GetSnapshot();
+    ASSERT_EQ(snapshot.updates_per_plugin.size(), 1U);
+    EXPECT_EQ(snapshot.updates_per_plugin.at("second_plugin"), 2U);
+    EXPECT_EQ(snapshot.send_last_updated_parameter_set_failures, 1U);
+    ASSERT_EQ(snapshot.plugin_startup_times.size(), 2U);
+    EXPECT_EQ(snapshot.plugin_startup_times.at("first_plugin").initialize.count(), 0);
+    EXPECT_EQ(snapshot.plugin_startup_times.at("first_plugin").run, std::chrono::milliseconds{10});
+    EXPECT_EQ(snapshot.plugin_startup_times.at("second_plugin").initialize, std::chrono::milliseconds{2});
+    EXPECT_EQ(snapshot.plugin_startup_times.at("second_plugin").run, std::chrono::milliseconds{30});
+    EXPECT_EQ(snapshot.serialized_bytes, 150U);
+    EXPECT_EQ(snapshot.serialization_time.count, 2U);
+    EXPECT_EQ(snapshot.serialization_time.max_us, 7U);
+    EXPECT_EQ(snapshot.lock_wait_time.count, 1U);
+    EXPECT_EQ(snapshot.lock_hold_time.count, 1U);
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+}  // namespace test
+}  // namespace metrics
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,108 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_daemon/code/metrics/metrics_snapshot_file.h"
+
+#include "score/json/json_writer.h"
+#include "score/mw/log/logging.h"
+
+#include <cstdio>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace metrics
+{
+
+namespace
+{
+
+json::Object ToJson(const LatencyHistogramSnapshot& histogram)
+{
+    json::Object histogram_json;
+    histogram_json["count"] = histogram.count;
+    histogram_json["sum_us"] = histogram.sum_us;
+    histogram_json["max_us"] = histogram.max_us;
+    histogram_json["p50_us"] = histogram.p50_us;
+    histogram_json["p90_us"] = histogram.p90_us;
+    histogram_json["p99_us"] = histogram.p99_us;
+    return histogram_json;
+}
+
+}  // namespace
+
+json::Object ToJson(const DaemonMetricsSnapshot& snapshot)
+{
+    json::Object requests_per_parameter_set;
+    for (const auto& requests : snapshot.requests_per_parameter_set)
+    {
+        requests_per_parameter_set[requests.first.c_str()] = requests.second;
+    }
+
+    json::Object updates_per_plugin;
+    for (const auto& updates : snapshot.updates_per_plugin)
+    {
+        updates_per_plugin[updates.first.c_str()] = updates.second;
+    }
+
+    json::Object plugin_startup_times;
+    for (const auto& startup_time : snapshot.plugin_startup_times)
+    {
+        json::Object startup_time_json;
+        startup_time_json["initialize_us"] = static_cast<std::uint64_t>(startup_time.second.initialize.count());
+        startup_time_json["run_us"] = static_cast<std::uint64_t>(startup_time.second.run.count());
+        plugin_startup_times[startup_time.first.c_str()] = std::move(startup_time_json);
+    }
+
+    json::Object snapshot_json;
+    snapshot_json["uptime_ms"] = static_cast<std::uint64_t>(snapshot.uptime.count());
+    snapshot_json["requests_per_parameter_set"] = std::move(requests_per_parameter_set);
+    snapshot_json["untracked_requests"] = snapshot.untracked_requests;
+    snapshot_json["failed_requests"] = snapshot.failed_requests;
+    snapshot_json["serialized_bytes"] = snapshot.serialized_bytes;
+    snapshot_json["serialization_time"] = ToJson(snapshot.serialization_time);
+    snapshot_json["lock_wait_time"] = ToJson(snapshot.lock_wait_time);
+    snapshot_json["lock_hold_time"] = ToJson(snapshot.lock_hold_time);
+    snapshot_json["updates_per_plugin"] = std::move(updates_per_plugin);
+    snapshot_json["send_last_updated_parameter_set_failures"] = snapshot.send_last_updated_parameter_set_failures;
+    snapshot_json["plugin_startup_times"] = std::move(plugin_startup_times);
+    return snapshot_json;
+}
+
+bool WriteMetricsSnapshotFile(const DaemonMetricsSnapshot& snapshot, const std::string& file_path)
+{
+    const std::string temporary_file_path{file_path + ".tmp"};
+    json::JsonWriter json_writer{};
+    const auto write_result = json_writer.ToFile(ToJson(snapshot), temporary_file_path);
+    if (!write_result.has_value())
+    {
+        mw::log::LogError("App") << __func__ << ": Failed to write metrics snapshot " << temporary_file_path << ": "
+                                 << write_result.error();
+        return false;
+    }
+
+    if (std::rename(temporary_file_path.c_str(), file_path.c_str()) != 0)
+    {
+        mw::log::LogError("App") << __func__ << ": Failed to replace metrics snapshot " << file_path;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace metrics
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
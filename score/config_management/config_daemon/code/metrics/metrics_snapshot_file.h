@@ -0,0 +1,51 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef CODE_METRICS_METRICS_SNAPSHOT_FILE_H
+#define CODE_METRICS_METRICS_SNAPSHOT_FILE_H
+
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
+
+#include "score/json/internal/model/any.h"
+
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace metrics
+{
+
+/// @brief Converts a metrics snapshot into its JSON representation, durations are given in microseconds
+json::Object ToJson(const DaemonMetricsSnapshot& snapshot);
+
+/// @brief Writes a metrics snapshot as JSON file
+///
+/// The snapshot is written to a temporary file next to the target which is then renamed, so readers polling the file
+/// never observe a partially written snapshot.
+///
+/// @param snapshot metrics to write
+/// @param file_path path of the snapshot file
+/// @return true if the snapshot file was replaced, false otherwise
+///
+bool WriteMetricsSnapshotFile(const DaemonMetricsSnapshot& snapshot, const std::string& file_path);
+
+}  // namespace metrics
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_METRICS_METRICS_SNAPSHOT_FILE_H
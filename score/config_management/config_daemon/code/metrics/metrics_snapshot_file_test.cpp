@@ -0,0 +1,85 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_daemon/code/metrics/metrics_snapshot_file.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace metrics
+{
+namespace test
+{
+
+TEST(MetricsSnapshotFileTest, WriteSnapshotFile)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::metrics::WriteMetricsSnapshotFile()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a metrics snapshot is written as JSON file.");
+
+    DaemonMetrics metrics{};
+    metrics.RecordRequest("set_name_1", true);
+    metrics.RecordParameterSetUpdate("file_source", false);
+    metrics.RecordSerialization(std::chrono::microseconds{3}, 42U);
+    metrics.RecordPluginRun("file_source", std::chrono::microseconds{250});
+
+    const std::string file_path = ::testing::TempDir() + "config_daemon_metrics.json";
+    ASSERT_TRUE(WriteMetricsSnapshotFile(metrics.GetSnapshot(), file_path));
+
+    const auto snapshot_json = json::JsonParser{}.FromFile(file_path);
+    ASSERT_TRUE(snapshot_json.has_value());
+    const auto& snapshot = snapshot_json.value().As<json::Object>().value().get();
+    const auto& requests = snapshot.at("requests_per_parameter_set").As<json::Object>().value().get();
+    EXPECT_EQ(requests.at("set_name_1").As<std::uint64_t>().value(), 1U);
+    EXPECT_EQ(snapshot.at("serialized_bytes").As<std::uint64_t>().value(), 42U);
+    const auto& serialization_time = snapshot.at("serialization_time").As<json::Object>().value().get();
+    EXPECT_EQ(serialization_time.at("max_us").As<std::uint64_t>().value(), 3U);
+    const auto& updates_per_plugin = snapshot.at("updates_per_plugin").As<json::Object>().value().get();
+    ASSERT_EQ(updates_per_plugin.size(), 1U);
+    EXPECT_EQ(updates_per_plugin.at("file_source").As<std::uint64_t>().value(), 1U);
+    EXPECT_EQ(snapshot.at("send_last_updated_parameter_set_failures").As<std::uint64_t>().value(), 1U);
+    const auto& plugin_startup_times = snapshot.at("plugin_startup_times").As<json::Object>().value().get();
+    ASSERT_EQ(plugin_startup_times.size(), 1U);
+    const auto& startup_time = plugin_startup_times.at("file_source").As<json::Object>().value().get();
+    EXPECT_EQ(startup_time.at("run_us").As<std::uint64_t>().value(), 250U);
+}
+
+TEST(MetricsSnapshotFileTest, WriteSnapshotFileToInvalidPath)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::metrics::WriteMetricsSnapshotFile()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a failure to write the snapshot file is reported.");
+
+    const DaemonMetrics metrics{};
+
+    EXPECT_FALSE(WriteMetricsSnapshotFile(metrics.GetSnapshot(), "/non/existing/config_daemon_metrics.json"));
+}
+
+}  // namespace test
+}  // namespace metrics
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
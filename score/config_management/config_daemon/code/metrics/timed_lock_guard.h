@@ -0,0 +1,75 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef CODE_METRICS_TIMED_LOCK_GUARD_H
+#define CODE_METRICS_TIMED_LOCK_GUARD_H
+
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace metrics
+{
+
+///
+/// @brief Lock guard which records the time spent waiting for and holding the mutex
+///
+/// Behaves like std::lock_guard if no DaemonMetrics are given, without reading the clock.
+///
+template <typename Mutex>
+class TimedLockGuard final
+{
+  public:
+    TimedLockGuard(Mutex& mutex, DaemonMetrics* const metrics) noexcept : mutex_{mutex}, metrics_{metrics}, acquired_{}
+    {
+        if (metrics_ == nullptr)
+        {
+            mutex_.lock();
+            return;
+        }
+        const auto wait_start = DaemonMetrics::Clock::now();
+        mutex_.lock();
+        acquired_ = DaemonMetrics::Clock::now();
+        metrics_->RecordLockWait(acquired_ - wait_start);
+    }
+
+    ~TimedLockGuard() noexcept
+    {
+        if (metrics_ != nullptr)
+        {
+            metrics_->RecordLockHold(DaemonMetrics::Clock::now() - acquired_);
+        }
+        mutex_.unlock();
+    }
+
+    TimedLockGuard(TimedLockGuard&&) noexcept = delete;
+    TimedLockGuard(const TimedLockGuard&) noexcept = delete;
+    TimedLockGuard& operator=(TimedLockGuard&&) & noexcept = delete;
+    TimedLockGuard& operator=(const TimedLockGuard&) & noexcept = delete;
+
+  private:
+    Mutex& mutex_;
+    DaemonMetrics* const metrics_;
+    DaemonMetrics::Clock::time_point acquired_;
+};
+
+}  // namespace metrics
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_METRICS_TIMED_LOCK_GUARD_H
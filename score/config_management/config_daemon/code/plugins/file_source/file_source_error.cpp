@@ -0,0 +1,73 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_error.h"
+
+#include "score/result/error_domain.h"
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+namespace
+{
+class FileSourceErrorDomain final : public score::result::ErrorDomain
+{
+  public:
+    std::string_view MessageFor(const score::result::ErrorCode& code) const noexcept override
+    {
+        if ((code < score::cpp::to_underlying(FileSourceError::kDirectoryNotAccessible)) ||
+            (code > score::cpp::to_underlying(FileSourceError::kParsingFailed)))
+        {
+            return std::string_view{"Unknown Error!"};
+        }
+
+        std::string_view message;
+        switch (static_cast<FileSourceError>(code))
+        {
+            case FileSourceError::kDirectoryNotAccessible:
+                message = std::string_view{"Parameter set directory is not accessible"};
+                break;
+            case FileSourceError::kWatchFailed:
+                message = std::string_view{"Parameter set directory can't be watched"};
+                break;
+            case FileSourceError::kParsingFailed:
+                message = std::string_view{"Parameter set file can't be parsed"};
+                break;
+            // LCOV_EXCL_START (Reaching this default case is not possible as range is checked above.)
+            default:
+                message = std::string_view{"Unknown Error!"};
+                break;
+                // LCOV_EXCL_STOP
+        }
+        return message;
+    }
+};
+
+constexpr FileSourceErrorDomain kFileSourceErrorDomain;
+}  // namespace
+
+score::result::Error MakeError(const FileSourceError code, const std::string_view user_message) noexcept
+{
+    return {static_cast<score::result::ErrorCode>(code), kFileSourceErrorDomain, user_message};
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,43 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_ERROR_H
+#define CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_ERROR_H
+
+#include "score/result/error.h"
+#include "score/result/error_code.h"
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+/// @brief Represents all errors that can be returned by the FileSourcePlugin
+enum class FileSourceError : score::result::ErrorCode
+{
+    kDirectoryNotAccessible,
+    kWatchFailed,
+    kParsingFailed,
+};
+
+/// @brief ADL overload to fulfill design requirements from lib/result
+score::result::Error MakeError(const FileSourceError code, const std::string_view user_message = "") noexcept;
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_ERROR_H
@@ -0,0 +1,339 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_plugin.h"
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_error.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/logging.h"
+
+#include <dirent.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <set>
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+namespace
+{
+constexpr const std::int32_t kRunSuccess{0};
+constexpr const std::int32_t kRunFailure{1};
+constexpr const std::string_view kPluginName{"file_source"};
+constexpr const std::string_view kFileExtension{".json"};
+constexpr const std::chrono::milliseconds kWatchPollPeriod{100};
+constexpr const std::uint32_t kWatchedEvents{IN_CLOSE_WRITE | IN_MOVED_TO};
+constexpr const std::size_t kEventBufferSize{4096U};
+
+bool IsParameterSetFile(const std::string_view file_name) noexcept
+{
+    return (file_name.size() > kFileExtension.size()) &&
+           (file_name.compare(file_name.size() - kFileExtension.size(), kFileExtension.size(), kFileExtension) == 0);
+}
+
+std::string_view ToParameterSetName(const std::string_view file_name) noexcept
+{
+    return file_name.substr(0U, file_name.size() - kFileExtension.size());
+}
+}  // namespace
+
+FileSourcePlugin::FileSourcePlugin(std::string directory, const std::size_t worker_count) noexcept
+    : IPlugin{},
+      logger_{mw::log::CreateLogger(std::string_view{"FSrc"})},
+      directory_{std::move(directory)},
+      worker_count_{std::max(worker_count, std::size_t{1U})},
+      inotify_fd_{-1},
+      is_stop_requested_{false},
+      watcher_{}
+{
+}
+
+FileSourcePlugin::~FileSourcePlugin()
+{
+    Deinitialize();
+}
+
+std::string_view FileSourcePlugin::GetName() const noexcept
+{
+    return kPluginName;
+}
+
+bool FileSourcePlugin::MarksParameterSetsReady() const noexcept
+{
+    return true;
+}
+
+ResultBlank FileSourcePlugin::Initialize()
+{
+    logger_.LogInfo() << "FileSourcePlugin::" << __func__ << "directory:" << directory_;
+
+    DIR* const directory = ::opendir(directory_.c_str());
+    if (directory == nullptr)
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "directory:" << directory_ << "can't be opened";
+        return MakeUnexpected(FileSourceError::kDirectoryNotAccessible, "Directory can't be opened");
+    }
+    score::cpp::ignore = ::closedir(directory);
+
+    // the directory is watched before it is loaded, so no change between loading and watching gets lost
+    inotify_fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ < 0)
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "inotify instance can't be created";
+        return MakeUnexpected(FileSourceError::kWatchFailed, "Inotify instance can't be created");
+    }
+    if (::inotify_add_watch(inotify_fd_, directory_.c_str(), kWatchedEvents) < 0)
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "directory:" << directory_ << "can't be watched";
+        score::cpp::ignore = ::close(inotify_fd_);
+        inotify_fd_ = -1;
+        return MakeUnexpected(FileSourceError::kWatchFailed, "Directory can't be watched");
+    }
+    return {};
+}
+
+void FileSourcePlugin::Deinitialize() noexcept
+{
+    is_stop_requested_ = true;
+    if (watcher_.joinable())
+    {
+        watcher_.join();
+    }
+    if (inotify_fd_ >= 0)
+    {
+        score::cpp::ignore = ::close(inotify_fd_);
+        inotify_fd_ = -1;
+    }
+}
+
+std::int32_t FileSourcePlugin::Run(std::shared_ptr<data_model::IParameterSetCollection> parameterset_collection,
+                                   LastUpdatedParameterSetSender cbk_send_last_updated_parameter_set,
+                                   InitialQualifierStateSender,
+                                   score::cpp::stop_token stop_token,
+                                   std::shared_ptr<fault_event_reporter::IFaultEventReporter>)
+{
+    logger_.LogInfo() << "FileSourcePlugin::" << __func__;
+
+    if (parameterset_collection == nullptr)
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "ParameterSetCollection is nullptr";
+        return kRunFailure;
+    }
+
+    const auto file_names = ListParameterSetFiles();
+    if (!file_names.has_value())
+    {
+        return kRunFailure;
+    }
+    const auto loaded_sets = LoadParameterSetFiles(*parameterset_collection, file_names.value());
+    logger_.LogInfo() << "FileSourcePlugin::" << __func__ << "Loaded" << loaded_sets << "of"
+                      << file_names.value().size() << "parameter sets";
+
+    if (inotify_fd_ < 0)
+    {
+        logger_.LogWarn() << "FileSourcePlugin::" << __func__ << "Plugin is not initialized, changes are not watched";
+        return kRunSuccess;
+    }
+    // Run() returns once the initial load is done, the changes are watched until the daemon stops
+    watcher_ = std::thread{[this,
+                            collection = std::move(parameterset_collection),
+                            sender = std::move(cbk_send_last_updated_parameter_set),
+                            token = std::move(stop_token)]() {
+        Watch(*collection, sender, token);
+    }};
+    return kRunSuccess;
+}
+
+Result<std::vector<std::string>> FileSourcePlugin::ListParameterSetFiles() const
+{
+    DIR* const directory = ::opendir(directory_.c_str());
+    if (directory == nullptr)
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "directory:" << directory_ << "can't be opened";
+        return MakeUnexpected(FileSourceError::kDirectoryNotAccessible, "Directory can't be opened");
+    }
+
+    std::vector<std::string> file_names{};
+    for (const dirent* entry = ::readdir(directory); entry != nullptr; entry = ::readdir(directory))
+    {
+        if (IsParameterSetFile(entry->d_name))
+        {
+            file_names.emplace_back(entry->d_name);
+        }
+    }
+    score::cpp::ignore = ::closedir(directory);
+    std::sort(file_names.begin(), file_names.end());
+    return file_names;
+}
+
+ResultBlank FileSourcePlugin::LoadParameterSetFile(data_model::IParameterSetCollection& parameterset_collection,
+                                                   const std::string& file_name) const
+{
+    const auto set_name = ToParameterSetName(file_name);
+    const json::JsonParser json_parser{};
+    auto parsing_result = json_parser.FromFile(directory_ + "/" + file_name);
+    if (!parsing_result.has_value())
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "file:" << file_name
+                           << "can't be parsed:" << parsing_result.error();
+        return MakeUnexpected(FileSourceError::kParsingFailed, "File can't be parsed");
+    }
+
+    auto set_object = parsing_result.value().As<json::Object>();
+    if (!set_object.has_value())
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "file:" << file_name << "is not a JSON object";
+        return MakeUnexpected(FileSourceError::kParsingFailed, "File is not a JSON object");
+    }
+    auto& set = set_object.value().get();
+
+    const auto parameters = set.find("parameters");
+    if (parameters == set.end())
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "file:" << file_name << "has no parameters";
+        return MakeUnexpected(FileSourceError::kParsingFailed, "File has no parameters");
+    }
+    auto parameters_object = parameters->second.As<json::Object>();
+    if (!parameters_object.has_value())
+    {
+        logger_.LogError() << "FileSourcePlugin::" << __func__ << "file:" << file_name
+                           << "parameters are not a JSON object";
+        return MakeUnexpected(FileSourceError::kParsingFailed, "File parameters are not a JSON object");
+    }
+
+    bool is_calibratable{false};
+    const auto calibratable = set.find("calibratable");
+    if (calibratable != set.end())
+    {
+        const auto calibratable_flag = calibratable->second.As<bool>();
+        if (!calibratable_flag.has_value())
+        {
+            logger_.LogError() << "FileSourcePlugin::" << __func__ << "file:" << file_name
+                               << "calibratable is not a boolean";
+            return MakeUnexpected(FileSourceError::kParsingFailed, "File calibratable flag is not a boolean");
+        }
+        is_calibratable = calibratable_flag.value();
+    }
+
+    const score::cpp::string_view collection_set_name{set_name.data(), set_name.size()};
+    const auto replace_result =
+        parameterset_collection.ReplaceParameterSet(collection_set_name, std::move(parameters_object.value().get()));
+    if (!replace_result.has_value())
+    {
+        return replace_result;
+    }
+    score::cpp::ignore = parameterset_collection.SetCalibratable(collection_set_name, is_calibratable);
+    return parameterset_collection.MarkParameterSetReady(collection_set_name);
+}
+
+std::size_t FileSourcePlugin::LoadParameterSetFiles(data_model::IParameterSetCollection& parameterset_collection,
+                                                    const std::vector<std::string>& file_names) const
+{
+    // the workers pull the next file to parse, so a few large files don't delay the other ones
+    std::atomic<std::size_t> next_file{0U};
+    std::atomic<std::size_t> loaded_sets{0U};
+    const auto load_files = [this, &parameterset_collection, &file_names, &next_file, &loaded_sets]() {
+        for (auto file = next_file.fetch_add(1U); file < file_names.size(); file = next_file.fetch_add(1U))
+        {
+            if (LoadParameterSetFile(parameterset_collection, file_names[file]).has_value())
+            {
+                score::cpp::ignore = loaded_sets.fetch_add(1U);
+            }
+        }
+    };
+
+    // the calling thread is one of the workers
+    std::vector<std::thread> workers{};
+    const auto worker_count = std::min(worker_count_, file_names.size());
+    for (std::size_t worker = 1U; worker < worker_count; ++worker)
+    {
+        workers.emplace_back(load_files);
+    }
+    load_files();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    return loaded_sets.load();
+}
+
+void FileSourcePlugin::Watch(data_model::IParameterSetCollection& parameterset_collection,
+                             const LastUpdatedParameterSetSender& cbk_send_last_updated_parameter_set,
+                             const score::cpp::stop_token& stop_token)
+{
+    alignas(inotify_event) std::array<char, kEventBufferSize> events{};
+    while ((!is_stop_requested_) && (!stop_token.stop_requested()))
+    {
+        pollfd watched_fd{inotify_fd_, POLLIN, 0};
+        if (::poll(&watched_fd, 1U, static_cast<std::int32_t>(kWatchPollPeriod.count())) <= 0)
+        {
+            continue;
+        }
+        const auto read_bytes = ::read(inotify_fd_, events.data(), events.size());
+        if (read_bytes <= 0)
+        {
+            continue;
+        }
+
+        // a file written in several steps raises several events, but it is loaded and sent only once
+        std::set<std::string> changed_files{};
+        bool is_overflowed{false};
+        for (std::size_t offset = 0U; offset < static_cast<std::size_t>(read_bytes);)
+        {
+            const auto* const event = reinterpret_cast<const inotify_event*>(&events[offset]);
+            if ((event->mask & IN_Q_OVERFLOW) != 0U)
+            {
+                is_overflowed = true;
+            }
+            else if ((event->len > 0U) && IsParameterSetFile(event->name))
+            {
+                score::cpp::ignore = changed_files.emplace(event->name);
+            }
+            offset += sizeof(inotify_event) + event->len;
+        }
+        if (is_overflowed)
+        {
+            logger_.LogWarn() << "FileSourcePlugin::" << __func__ << "Events were lost, all files are loaded again";
+            const auto file_names = ListParameterSetFiles();
+            if (file_names.has_value())
+            {
+                changed_files.insert(file_names.value().begin(), file_names.value().end());
+            }
+        }
+
+        for (const auto& file_name : changed_files)
+        {
+            if (LoadParameterSetFile(parameterset_collection, file_name).has_value() &&
+                (!cbk_send_last_updated_parameter_set.empty()))
+            {
+                logger_.LogDebug() << "FileSourcePlugin::" << __func__ << "file:" << file_name << "reloaded";
+                score::cpp::ignore = cbk_send_last_updated_parameter_set(ToParameterSetName(file_name));
+            }
+        }
+    }
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,95 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_PLUGIN_H
+#define CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_PLUGIN_H
+
+#include "score/config_management/config_daemon/code/plugins/plugin.h"
+
+#include "score/mw/log/logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+///
+/// @brief Reference plugin loading the parameter sets from a directory of JSON files
+///
+/// Every file <set_name>.json of the directory holds one parameter set of the following format:
+///
+/// {
+///     "parameters": {"parameter_name": <any JSON value>},
+///     "calibratable": false
+/// }
+///
+/// Run() parses the files with a pool of worker threads and replaces each parameter set with one collection update.
+/// Afterwards the directory is watched with inotify: a file which is written or moved into the directory is loaded
+/// again and its parameter set name is sent to the clients as last updated parameter set.
+///
+class FileSourcePlugin final : public IPlugin
+{
+  public:
+    /// @param directory directory of the parameter set files
+    /// @param worker_count number of threads parsing the files concurrently, at least one thread is used
+    FileSourcePlugin(std::string directory, const std::size_t worker_count) noexcept;
+    ~FileSourcePlugin() override;
+    FileSourcePlugin(FileSourcePlugin&&) = delete;
+    FileSourcePlugin(const FileSourcePlugin&) = delete;
+    FileSourcePlugin& operator=(FileSourcePlugin&&) = delete;
+    FileSourcePlugin& operator=(const FileSourcePlugin&) = delete;
+
+    std::string_view GetName() const noexcept override;
+    bool MarksParameterSetsReady() const noexcept override;
+    ResultBlank Initialize() override;
+    void Deinitialize() noexcept override;
+    std::int32_t Run(std::shared_ptr<data_model::IParameterSetCollection> parameterset_collection,
+                     LastUpdatedParameterSetSender cbk_send_last_updated_parameter_set,
+                     InitialQualifierStateSender cbk_update_initial_qualifier_state,
+                     score::cpp::stop_token stop_token,
+                     std::shared_ptr<fault_event_reporter::IFaultEventReporter> fault_event_reporter) override;
+
+  private:
+    Result<std::vector<std::string>> ListParameterSetFiles() const;
+    ResultBlank LoadParameterSetFile(data_model::IParameterSetCollection& parameterset_collection,
+                                     const std::string& file_name) const;
+    std::size_t LoadParameterSetFiles(data_model::IParameterSetCollection& parameterset_collection,
+                                      const std::vector<std::string>& file_names) const;
+    void Watch(data_model::IParameterSetCollection& parameterset_collection,
+               const LastUpdatedParameterSetSender& cbk_send_last_updated_parameter_set,
+               const score::cpp::stop_token& stop_token);
+
+    mw::log::Logger& logger_;
+    const std::string directory_;
+    const std::size_t worker_count_;
+    std::int32_t inotify_fd_;
+    std::atomic<bool> is_stop_requested_;
+    std::thread watcher_;
+};
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_PLUGIN_H
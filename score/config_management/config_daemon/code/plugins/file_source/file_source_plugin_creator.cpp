@@ -0,0 +1,39 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_plugin_creator.h"
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_plugin.h"
+
+#include <thread>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+FileSourcePluginCreator::FileSourcePluginCreator(std::string directory) noexcept
+    : IPluginCreator{}, directory_{std::move(directory)}
+{
+}
+
+std::shared_ptr<IPlugin> FileSourcePluginCreator::CreatePlugin()
+{
+    return std::make_shared<FileSourcePlugin>(directory_, std::thread::hardware_concurrency());
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
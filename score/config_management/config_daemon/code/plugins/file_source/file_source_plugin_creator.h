@@ -0,0 +1,50 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_PLUGIN_CREATOR_H
+#define CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_PLUGIN_CREATOR_H
+
+#include "score/config_management/config_daemon/code/plugins/plugin_creator.h"
+
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+class FileSourcePluginCreator final : public IPluginCreator
+{
+  public:
+    /// @param directory directory of the parameter set files loaded by the created FileSourcePlugin
+    explicit FileSourcePluginCreator(std::string directory) noexcept;
+    ~FileSourcePluginCreator() override = default;
+    FileSourcePluginCreator(FileSourcePluginCreator&&) = delete;
+    FileSourcePluginCreator(const FileSourcePluginCreator&) = delete;
+    FileSourcePluginCreator& operator=(FileSourcePluginCreator&&) = delete;
+    FileSourcePluginCreator& operator=(const FileSourcePluginCreator&) = delete;
+
+    std::shared_ptr<IPlugin> CreatePlugin() override;
+
+  private:
+    const std::string directory_;
+};
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_PLUGINS_FILE_SOURCE_FILE_SOURCE_PLUGIN_CREATOR_H
@@ -0,0 +1,202 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_plugin.h"
+#include "score/config_management/config_daemon/code/data_model/details/parameterset_collection_impl.h"
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_error.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <future>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace test
+{
+
+class FileSourcePluginFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        const auto* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        directory_ = ::testing::TempDir() + "file_source_" + test_info->name();
+        ASSERT_EQ(::mkdir(directory_.c_str(), 0700), 0);
+        collection_ = std::make_shared<data_model::ParameterSetCollection>();
+        plugin_ = std::make_unique<FileSourcePlugin>(directory_, 2U);
+    }
+
+    void TearDown() override
+    {
+        plugin_->Deinitialize();
+        for (const auto& file_name : file_names_)
+        {
+            score::cpp::ignore = std::remove((directory_ + "/" + file_name).c_str());
+        }
+        score::cpp::ignore = ::rmdir(directory_.c_str());
+    }
+
+    void WriteFile(const std::string& file_name, const std::string& content)
+    {
+        // the file is moved into the directory, so the plugin never observes it partially written
+        const std::string written_path = ::testing::TempDir() + file_name + ".tmp";
+        std::ofstream{written_path} << content;
+        ASSERT_EQ(std::rename(written_path.c_str(), (directory_ + "/" + file_name).c_str()), 0);
+        file_names_.push_back(file_name);
+    }
+
+    std::int32_t RunPlugin(LastUpdatedParameterSetSender sender = {})
+    {
+        return plugin_->Run(collection_, std::move(sender), {}, stop_source_.get_token(), nullptr);
+    }
+
+    std::int32_t GetParameter(const std::string& set_name, const std::string& parameter_name) const
+    {
+        const auto parameter = collection_->GetParameterFromSet(set_name, parameter_name);
+        return parameter.has_value() ? parameter.value().As<std::int32_t>().value() : -1;
+    }
+
+    std::string directory_{};
+    std::vector<std::string> file_names_{};
+    std::shared_ptr<data_model::ParameterSetCollection> collection_{};
+    score::cpp::stop_source stop_source_{};
+    std::unique_ptr<FileSourcePlugin> plugin_{};
+};
+
+TEST_F(FileSourcePluginFixture, AllParameterSetsOfDirectoryAreLoaded)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::FileSourcePlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the parameter sets of all JSON files are loaded by the worker threads and "
+                   "are served before all plugins finished loading.");
+
+    WriteFile("set_1.json", R"({"parameters": {"parameter": 1}})");
+    WriteFile("set_2.json", R"({"parameters": {"parameter": 2}, "calibratable": true})");
+    WriteFile("set_3.json", R"({"parameters": {"parameter": 3}})");
+    WriteFile("ignored.txt", R"({"parameters": {"parameter": 4}})");
+    collection_->SetLoadingCompleted(false);
+
+    ASSERT_TRUE(plugin_->Initialize().has_value());
+    EXPECT_EQ(plugin_->GetName(), "file_source");
+    EXPECT_EQ(RunPlugin(), 0);
+
+    EXPECT_EQ(GetParameter("set_1", "parameter"), 1);
+    EXPECT_EQ(GetParameter("set_2", "parameter"), 2);
+    EXPECT_EQ(GetParameter("set_3", "parameter"), 3);
+    EXPECT_TRUE(collection_->GetParameterSet("set_3").has_value());
+    EXPECT_FALSE(collection_->UpdateParameterSet("set_1", R"({"parameter": 10})").has_value());
+    EXPECT_TRUE(collection_->UpdateParameterSet("set_2", R"({"parameter": 20})").has_value());
+    EXPECT_FALSE(collection_->GetParameterFromSet("ignored", "parameter").has_value());
+}
+
+TEST_F(FileSourcePluginFixture, MalformedFilesAreSkipped)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::FileSourcePlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that malformed files are skipped without affecting the other parameter sets.");
+
+    WriteFile("no_json.json", R"({"parameters": )");
+    WriteFile("no_object.json", R"([1, 2])");
+    WriteFile("no_parameters.json", R"({"parameter": 1})");
+    WriteFile("wrong_calibratable.json", R"({"parameters": {"parameter": 1}, "calibratable": 1})");
+    WriteFile("valid.json", R"({"parameters": {"parameter": 1}})");
+
+    ASSERT_TRUE(plugin_->Initialize().has_value());
+    EXPECT_EQ(RunPlugin(), 0);
+
+    EXPECT_EQ(GetParameter("valid", "parameter"), 1);
+    EXPECT_FALSE(collection_->GetParameterSet("no_json").has_value());
+    EXPECT_FALSE(collection_->GetParameterSet("no_object").has_value());
+    EXPECT_FALSE(collection_->GetParameterSet("no_parameters").has_value());
+    EXPECT_FALSE(collection_->GetParameterSet("wrong_calibratable").has_value());
+}
+
+TEST_F(FileSourcePluginFixture, ChangedFileIsReloadedAndSent)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::FileSourcePlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a file moved into the watched directory replaces its parameter set and "
+                   "that the parameter set name is sent as last updated parameter set.");
+
+    WriteFile("set_1.json", R"({"parameters": {"parameter": 1, "removed_parameter": 2}})");
+    std::atomic<bool> is_sent{false};
+    std::promise<std::string> sent_set_name{};
+    auto sent_set_name_future = sent_set_name.get_future();
+
+    ASSERT_TRUE(plugin_->Initialize().has_value());
+    EXPECT_EQ(RunPlugin([&is_sent, &sent_set_name](const std::string_view set_name) noexcept -> bool {
+                  if (!is_sent.exchange(true))
+                  {
+                      sent_set_name.set_value(std::string{set_name});
+                  }
+                  return true;
+              }),
+              0);
+    ASSERT_EQ(GetParameter("set_1", "parameter"), 1);
+
+    WriteFile("set_1.json", R"({"parameters": {"parameter": 10}})");
+
+    ASSERT_EQ(sent_set_name_future.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+    EXPECT_EQ(sent_set_name_future.get(), "set_1");
+    EXPECT_EQ(GetParameter("set_1", "parameter"), 10);
+    EXPECT_EQ(GetParameter("set_1", "removed_parameter"), -1);
+    plugin_->Deinitialize();
+}
+
+TEST_F(FileSourcePluginFixture, InitializeFailsForMissingDirectory)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::FileSourcePlugin::Initialize");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a missing directory is reported as kDirectoryNotAccessible and that the "
+                   "plugin fails to run without a ParameterSetCollection.");
+
+    FileSourcePlugin plugin{directory_ + "/missing", 1U};
+
+    const auto result = plugin.Initialize();
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), FileSourceError::kDirectoryNotAccessible);
+    EXPECT_EQ(plugin.Run(nullptr, {}, {}, stop_source_.get_token(), nullptr), 1);
+}
+
+}  // namespace test
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,337 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/app/details/config_daemon_impl.h"
+#include "score/config_management/config_daemon/code/factory/details/factory_loopback_impl.h"
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
+#include "score/config_management/config_daemon/code/plugins/load_generator/load_generator_plugin.h"
+#include "score/config_management/config_provider/code/config_provider/factory/factory_loopback.h"
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+#include "score/config_management/config_provider/code/persistency/persistency.h"
+
+#include "platform/aas/mw/lifecycle/application.h"
+#include "platform/aas/mw/lifecycle/runapplication.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/stop_token.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace
+{
+
+constexpr std::int32_t kExitCodeSuccess{0};
+constexpr std::int32_t kExitCodeFailure{1};
+constexpr std::chrono::milliseconds kConnectTimeout{std::chrono::seconds{5}};
+constexpr std::chrono::milliseconds kFinishPollPeriod{100};
+// time the clients get to process the last updates before their counters are read
+constexpr std::chrono::milliseconds kDrainTime{std::chrono::seconds{1}};
+
+using ApplicationContext = mw::lifecycle::ApplicationContext;
+
+// Persistency which neither provides nor stores parameter sets, so every client fetches the sets from the daemon
+class NoPersistency final : public config_provider::Persistency
+{
+  public:
+    void ReadCachedParameterSets(config_provider::ParameterMap&,
+                                 score::cpp::pmr::memory_resource*,
+                                 std::unique_ptr<score::filesystem::Filesystem>) noexcept override
+    {
+    }
+
+    void CacheParameterSet(const config_provider::ParameterMap&,
+                           const score::cpp::pmr::string,
+                           const std::shared_ptr<const config_provider::ParameterSet>,
+                           bool) noexcept override
+    {
+    }
+
+    void SyncToStorage() noexcept override {}
+};
+
+std::string FormatLatency(const metrics::LatencyHistogramSnapshot& snapshot)
+{
+    std::ostringstream latency{};
+    latency << R"({"count": )" << snapshot.count << R"(, "p50_us": )" << snapshot.p50_us << R"(, "p90_us": )"
+            << snapshot.p90_us << R"(, "p99_us": )" << snapshot.p99_us << R"(, "max_us": )" << snapshot.max_us << "}";
+    return latency.str();
+}
+
+///
+/// @brief Tool reproducing update storms of calibration tools against a ConfigDaemon and its ConfigProviders
+///
+/// The ConfigDaemon runs in this process with the LoadGeneratorPlugin as its only plugin and serves --clients
+/// ConfigProviders through a loopback channel. Every client caches all parameter sets and registers an
+/// OnChangedParameterSet callback for them. Once the generation finished, the statistics of the plugin, the daemon
+/// and the clients are printed as JSON to stdout. The drops of the clients show whether --max_samples_limit and
+/// --polling_cycle_interval_ms suffice for the generated load.
+///
+/// Arguments, besides the ones of the ConfigDaemon:
+///   --set_count, --parameters_per_set, --parameters_per_update, --updates_per_second, --duration_ms,
+///   --start_delay_ms, --timing uniform|bursty, --burst_size, --selection uniform|zipf, --zipf_exponent, --seed,
+///   --clients, --max_samples_limit, --polling_cycle_interval_ms
+///
+class LoadGenerator final : public mw::lifecycle::Application
+{
+  public:
+    LoadGenerator() noexcept
+        : Application{},
+          logger_{mw::log::CreateLogger(std::string_view{"LGen"})},
+          config_{},
+          client_count_{4U},
+          max_samples_limit_{},
+          polling_cycle_interval_{},
+          channel_{std::make_shared<config_provider::loopback::LoopbackChannel>()},
+          plugin_{},
+          daemon_metrics_{},
+          config_daemon_{},
+          notifications_{0U}
+    {
+        config_.start_delay = std::chrono::seconds{1};
+    }
+
+    std::int32_t Initialize(const ApplicationContext& context) override
+    {
+        if (!ReadArguments(context))
+        {
+            return kExitCodeFailure;
+        }
+        plugin_ = std::make_shared<LoadGeneratorPlugin>(config_);
+        auto factory = std::make_unique<LoopbackFactory>(channel_, std::vector<std::shared_ptr<IPlugin>>{plugin_});
+        daemon_metrics_ = factory->GetDaemonMetrics();
+        config_daemon_ = std::make_unique<ConfigDaemon>(std::move(factory));
+        return config_daemon_->Initialize(context);
+    }
+
+    std::int32_t Run(const score::cpp::stop_token& token) override
+    {
+        score::cpp::stop_source daemon_stop_source{};
+        std::int32_t daemon_exit_code{kExitCodeSuccess};
+        std::thread daemon_thread{[this, &daemon_stop_source, &daemon_exit_code]() {
+            daemon_exit_code = config_daemon_->Run(daemon_stop_source.get_token());
+        }};
+
+        score::cpp::stop_source clients_stop_source{};
+        auto clients = CreateClients(clients_stop_source.get_token());
+        while (!plugin_->WaitUntilFinished(kFinishPollPeriod))
+        {
+            if (token.stop_requested())
+            {
+                score::cpp::ignore = daemon_stop_source.request_stop();
+                break;
+            }
+        }
+        std::this_thread::sleep_for(kDrainTime);
+        PrintReport(clients);
+
+        score::cpp::ignore = clients_stop_source.request_stop();
+        clients.clear();
+        score::cpp::ignore = daemon_stop_source.request_stop();
+        daemon_thread.join();
+        return daemon_exit_code;
+    }
+
+  private:
+    template <typename T>
+    bool ReadArgument(const ApplicationContext& context, const std::string_view flag, T& value) const
+    {
+        const auto argument = context.get_argument(flag);
+        if (argument.empty())
+        {
+            return true;
+        }
+        std::istringstream stream{argument};
+        T parsed_value{};
+        stream >> parsed_value;
+        if (stream.fail() || (!stream.eof()))
+        {
+            logger_.LogError() << "LoadGenerator::" << __func__ << "Invalid value of" << flag << ":" << argument;
+            return false;
+        }
+        value = parsed_value;
+        return true;
+    }
+
+    bool ReadArgument(const ApplicationContext& context,
+                      const std::string_view flag,
+                      std::chrono::milliseconds& value) const
+    {
+        auto milliseconds = value.count();
+        const auto is_valid = ReadArgument(context, flag, milliseconds);
+        value = std::chrono::milliseconds{milliseconds};
+        return is_valid;
+    }
+
+    template <typename Enumeration>
+    bool ReadArgument(const ApplicationContext& context,
+                      const std::string_view flag,
+                      Enumeration& value,
+                      const std::string_view other_name,
+                      const Enumeration other_value) const
+    {
+        const auto argument = context.get_argument(flag);
+        if (argument.empty() || (argument == "uniform"))
+        {
+            return true;
+        }
+        if (argument == other_name)
+        {
+            value = other_value;
+            return true;
+        }
+        logger_.LogError() << "LoadGenerator::" << __func__ << "Invalid value of" << flag << ":" << argument;
+        return false;
+    }
+
+    bool ReadArguments(const ApplicationContext& context)
+    {
+        std::size_t max_samples_limit{0U};
+        std::chrono::milliseconds polling_cycle_interval{0};
+        const auto is_valid =
+            ReadArgument(context, "--set_count", config_.set_count) &&
+            ReadArgument(context, "--parameters_per_set", config_.parameters_per_set) &&
+            ReadArgument(context, "--parameters_per_update", config_.parameters_per_update) &&
+            ReadArgument(context, "--updates_per_second", config_.updates_per_second) &&
+            ReadArgument(context, "--duration_ms", config_.duration) &&
+            ReadArgument(context, "--start_delay_ms", config_.start_delay) &&
+            ReadArgument(context, "--timing", config_.timing, "bursty", UpdateTiming::kBursty) &&
+            ReadArgument(context, "--burst_size", config_.burst_size) &&
+            ReadArgument(context, "--selection", config_.selection, "zipf", SetSelection::kZipf) &&
+            ReadArgument(context, "--zipf_exponent", config_.zipf_exponent) &&
+            ReadArgument(context, "--seed", config_.seed) && ReadArgument(context, "--clients", client_count_) &&
+            ReadArgument(context, "--max_samples_limit", max_samples_limit) &&
+            ReadArgument(context, "--polling_cycle_interval_ms", polling_cycle_interval);
+        if (max_samples_limit > 0U)
+        {
+            max_samples_limit_ = max_samples_limit;
+        }
+        if (polling_cycle_interval.count() > 0)
+        {
+            polling_cycle_interval_ = polling_cycle_interval;
+        }
+        return is_valid;
+    }
+
+    std::vector<score::cpp::pmr::unique_ptr<config_provider::ConfigProvider>> CreateClients(
+        const score::cpp::stop_token& token)
+    {
+        std::vector<score::cpp::pmr::unique_ptr<config_provider::ConfigProvider>> clients{};
+        for (std::size_t client = 0U; client < client_count_; ++client)
+        {
+            auto config_provider = config_provider::LoopbackConfigProviderFactory{}.Create(
+                channel_,
+                token,
+                kConnectTimeout,
+                score::cpp::pmr::make_unique<NoPersistency>(score::cpp::pmr::get_default_resource()),
+                max_samples_limit_,
+                polling_cycle_interval_);
+            for (std::size_t set_index = 0U; set_index < config_.set_count; ++set_index)
+            {
+                const auto set_name = LoadGeneratorPlugin::GetSetName(set_index);
+                score::cpp::ignore = config_provider->GetParameterSet(set_name, kConnectTimeout);
+                score::cpp::ignore = config_provider->OnChangedParameterSet(
+                    set_name, [this](std::shared_ptr<const config_provider::ParameterSet>) noexcept {
+                        score::cpp::ignore = notifications_.fetch_add(1U, std::memory_order_relaxed);
+                    });
+            }
+            clients.push_back(std::move(config_provider));
+        }
+        return clients;
+    }
+
+    void PrintReport(const std::vector<score::cpp::pmr::unique_ptr<config_provider::ConfigProvider>>& clients) const
+    {
+        const auto plugin_statistics = plugin_->GetStatistics();
+        const auto daemon_snapshot = daemon_metrics_->GetSnapshot();
+        const auto channel_statistics = channel_->GetStatistics();
+        std::uint64_t received_samples{0U};
+        std::uint64_t dropped_samples{0U};
+        std::uint64_t polling_cycles{0U};
+        std::uint64_t max_fetch_latency_p99_us{0U};
+        for (const auto& client : clients)
+        {
+            const auto client_metrics = client->GetMetrics();
+            received_samples += client_metrics.received_samples;
+            dropped_samples += client_metrics.dropped_samples;
+            polling_cycles += client_metrics.polling_cycles;
+            max_fetch_latency_p99_us = std::max(max_fetch_latency_p99_us, client_metrics.proxy_fetch_latency.p99_us);
+        }
+        const auto elapsed_seconds = std::chrono::duration<double>(plugin_statistics.elapsed).count();
+        const auto achieved_rate =
+            (elapsed_seconds > 0.0) ? (static_cast<double>(plugin_statistics.sent_updates) / elapsed_seconds) : 0.0;
+
+        std::cout << "{\n"
+                  << R"(  "plugin": {"sent_updates": )" << plugin_statistics.sent_updates
+                  << R"(, "failed_updates": )" << plugin_statistics.failed_updates << R"(, "unannounced_updates": )"
+                  << plugin_statistics.unannounced_updates << R"(, "elapsed_ms": )"
+                  << plugin_statistics.elapsed.count() << R"(, "achieved_updates_per_second": )" << achieved_rate
+                  << ",\n"
+                  << R"(    "update_latency": )" << FormatLatency(plugin_statistics.update_latency) << ",\n"
+                  << R"(    "send_latency": )" << FormatLatency(plugin_statistics.send_latency) << ",\n"
+                  << R"(    "schedule_lag": )" << FormatLatency(plugin_statistics.schedule_lag) << "},\n"
+                  << R"(  "daemon": {"served_requests": )" << channel_statistics.served_requests
+                  << R"(, "failed_requests": )" << channel_statistics.failed_requests << R"(, "published_events": )"
+                  << channel_statistics.published_events << R"(, "delivered_events": )"
+                  << channel_statistics.delivered_events << ",\n"
+                  << R"(    "request_latency": )" << FormatLatency(channel_statistics.request_latency) << ",\n"
+                  << R"(    "serialization_time": )" << FormatLatency(daemon_snapshot.serialization_time) << ",\n"
+                  << R"(    "lock_wait_time": )" << FormatLatency(daemon_snapshot.lock_wait_time) << ",\n"
+                  << R"(    "lock_hold_time": )" << FormatLatency(daemon_snapshot.lock_hold_time) << "},\n"
+                  << R"(  "clients": {"count": )" << clients.size() << R"(, "polling_cycles": )" << polling_cycles
+                  << R"(, "received_samples": )" << received_samples << R"(, "dropped_samples": )" << dropped_samples
+                  << R"(, "notifications": )" << notifications_.load() << R"(, "max_fetch_latency_p99_us": )"
+                  << max_fetch_latency_p99_us << "}\n"
+                  << "}" << std::endl;
+    }
+
+    mw::log::Logger& logger_;
+    LoadGeneratorConfig config_;
+    std::size_t client_count_;
+    score::cpp::optional<std::size_t> max_samples_limit_;
+    score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval_;
+    const std::shared_ptr<config_provider::loopback::LoopbackChannel> channel_;
+    std::shared_ptr<LoadGeneratorPlugin> plugin_;
+    std::shared_ptr<metrics::DaemonMetrics> daemon_metrics_;
+    std::unique_ptr<ConfigDaemon> config_daemon_;
+    std::atomic<std::uint64_t> notifications_;
+};
+
+}  // namespace
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+// coverity[autosar_cpp14_a15_3_3_violation] see config_daemon/code/main.cpp
+// coverity[autosar_cpp14_a15_5_3_violation] see config_daemon/code/main.cpp
+int main(const int argc, const char* argv[])
+{
+    return score::mw::lifecycle::run_application<score::config_management::config_daemon::LoadGenerator>(argc, argv);
+}
@@ -0,0 +1,291 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/plugins/load_generator/load_generator_plugin.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/logging.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+namespace
+{
+constexpr const std::int32_t kRunSuccess{0};
+constexpr const std::int32_t kRunFailure{1};
+constexpr const std::string_view kPluginName{"load_generator"};
+// the generator checks for a stop request at least this often while it waits for the next update
+constexpr const std::chrono::milliseconds kStopPollPeriod{10};
+constexpr const double kMinUpdatesPerSecond{0.001};
+
+LoadGeneratorConfig RaiseInvalidSizes(LoadGeneratorConfig config) noexcept
+{
+    config.set_count = std::max(config.set_count, std::size_t{1U});
+    config.parameters_per_set = std::max(config.parameters_per_set, std::size_t{1U});
+    config.parameters_per_update = std::clamp(config.parameters_per_update, std::size_t{1U}, config.parameters_per_set);
+    config.updates_per_second = std::max(config.updates_per_second, kMinUpdatesPerSecond);
+    config.burst_size = std::max(config.burst_size, std::size_t{1U});
+    return config;
+}
+
+// parameters parameter_0 to parameter_<count - 1> as JSON object, all set to value
+std::string FormatParameters(const std::size_t count, const std::uint64_t value)
+{
+    std::string parameters{"{"};
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        parameters += (index == 0U) ? "\"parameter_" : ", \"parameter_";
+        parameters += std::to_string(index) + "\": " + std::to_string(value);
+    }
+    parameters += "}";
+    return parameters;
+}
+}  // namespace
+
+LoadGeneratorPlugin::LoadGeneratorPlugin(const LoadGeneratorConfig& config)
+    : IPlugin{},
+      logger_{mw::log::CreateLogger(std::string_view{"LGen"})},
+      config_{RaiseInvalidSizes(config)},
+      zipf_cumulative_weights_{},
+      random_engine_{config.seed},
+      sent_updates_{},
+      failed_updates_{},
+      unannounced_updates_{},
+      update_latency_{},
+      send_latency_{},
+      schedule_lag_{},
+      finished_mutex_{},
+      finished_{},
+      is_finished_{false},
+      elapsed_{0},
+      is_stop_requested_{false},
+      generator_{}
+{
+    if (config_.selection == SetSelection::kZipf)
+    {
+        zipf_cumulative_weights_.reserve(config_.set_count);
+        double cumulative_weight{0.0};
+        for (std::size_t rank = 1U; rank <= config_.set_count; ++rank)
+        {
+            cumulative_weight += 1.0 / std::pow(static_cast<double>(rank), config_.zipf_exponent);
+            zipf_cumulative_weights_.push_back(cumulative_weight);
+        }
+    }
+}
+
+LoadGeneratorPlugin::~LoadGeneratorPlugin()
+{
+    Deinitialize();
+}
+
+std::string_view LoadGeneratorPlugin::GetName() const noexcept
+{
+    return kPluginName;
+}
+
+bool LoadGeneratorPlugin::MarksParameterSetsReady() const noexcept
+{
+    return true;
+}
+
+ResultBlank LoadGeneratorPlugin::Initialize()
+{
+    logger_.LogInfo() << "LoadGeneratorPlugin::" << __func__ << "sets:" << config_.set_count
+                      << "parameters:" << config_.parameters_per_set << "updates per second:"
+                      << config_.updates_per_second;
+    return {};
+}
+
+void LoadGeneratorPlugin::Deinitialize() noexcept
+{
+    is_stop_requested_ = true;
+    if (generator_.joinable())
+    {
+        generator_.join();
+    }
+}
+
+std::int32_t LoadGeneratorPlugin::Run(std::shared_ptr<data_model::IParameterSetCollection> parameterset_collection,
+                                      LastUpdatedParameterSetSender cbk_send_last_updated_parameter_set,
+                                      InitialQualifierStateSender,
+                                      score::cpp::stop_token stop_token,
+                                      std::shared_ptr<fault_event_reporter::IFaultEventReporter>)
+{
+    logger_.LogInfo() << "LoadGeneratorPlugin::" << __func__;
+
+    if (parameterset_collection == nullptr)
+    {
+        logger_.LogError() << "LoadGeneratorPlugin::" << __func__ << "ParameterSetCollection is nullptr";
+        return kRunFailure;
+    }
+
+    const auto parameters = FormatParameters(config_.parameters_per_set, 0U);
+    for (std::size_t set_index = 0U; set_index < config_.set_count; ++set_index)
+    {
+        auto parameters_json = json::JsonParser{}.FromBuffer(parameters);
+        const auto set_name = GetSetName(set_index);
+        if ((!parameters_json.has_value()) ||
+            (!parameterset_collection
+                  ->ReplaceParameterSet(set_name, std::move(parameters_json.value().As<json::Object>().value().get()))
+                  .has_value()))
+        {
+            logger_.LogError() << "LoadGeneratorPlugin::" << __func__ << "Parameter set" << set_name
+                               << "can't be created";
+            return kRunFailure;
+        }
+        // only calibratable parameter sets accept updates
+        score::cpp::ignore = parameterset_collection->SetCalibratable(set_name, true);
+        score::cpp::ignore = parameterset_collection->MarkParameterSetReady(set_name);
+    }
+
+    // Run() returns once the parameter sets are loaded, the updates are generated until the duration elapsed
+    generator_ = std::thread{[this,
+                              collection = std::move(parameterset_collection),
+                              sender = std::move(cbk_send_last_updated_parameter_set),
+                              token = std::move(stop_token)]() {
+        Generate(*collection, sender, token);
+    }};
+    return kRunSuccess;
+}
+
+std::string LoadGeneratorPlugin::GetSetName(const std::size_t set_index)
+{
+    return "load_set_" + std::to_string(set_index);
+}
+
+bool LoadGeneratorPlugin::WaitUntilFinished(const std::chrono::milliseconds timeout) const
+{
+    std::unique_lock<std::mutex> lock{finished_mutex_};
+    return finished_.wait_for(lock, timeout, [this]() {
+        return is_finished_;
+    });
+}
+
+LoadGeneratorStatistics LoadGeneratorPlugin::GetStatistics() const noexcept
+{
+    std::chrono::milliseconds elapsed{};
+    {
+        std::lock_guard<std::mutex> lock{finished_mutex_};
+        elapsed = elapsed_;
+    }
+    return LoadGeneratorStatistics{sent_updates_.Get(),
+                                   failed_updates_.Get(),
+                                   unannounced_updates_.Get(),
+                                   update_latency_.GetSnapshot(),
+                                   send_latency_.GetSnapshot(),
+                                   schedule_lag_.GetSnapshot(),
+                                   elapsed};
+}
+
+void LoadGeneratorPlugin::Generate(data_model::IParameterSetCollection& parameterset_collection,
+                                   const LastUpdatedParameterSetSender& cbk_send_last_updated_parameter_set,
+                                   const score::cpp::stop_token& stop_token)
+{
+    const auto start_time = Clock::now() + config_.start_delay;
+    const auto end_time = start_time + config_.duration;
+    std::uint64_t update_index{0U};
+    for (auto scheduled_time = start_time; scheduled_time < end_time;
+         scheduled_time = GetScheduledTime(start_time, update_index))
+    {
+        if (!SleepUntil(scheduled_time, stop_token))
+        {
+            break;
+        }
+        const auto send_time = Clock::now();
+        schedule_lag_.Record(send_time - scheduled_time);
+
+        ++update_index;
+        const auto set_name = GetSetName(SelectSet());
+        const auto update_result = parameterset_collection.UpdateParameterSet(
+            set_name, FormatParameters(config_.parameters_per_update, update_index));
+        const auto update_time = Clock::now();
+        update_latency_.Record(update_time - send_time);
+        if (!update_result.has_value())
+        {
+            logger_.LogWarn() << "LoadGeneratorPlugin::" << __func__ << "Update of" << set_name
+                              << "failed:" << update_result.error();
+            failed_updates_.Increment();
+            continue;
+        }
+
+        const auto is_announced = cbk_send_last_updated_parameter_set(set_name);
+        send_latency_.Record(Clock::now() - update_time);
+        sent_updates_.Increment();
+        if (!is_announced)
+        {
+            unannounced_updates_.Increment();
+        }
+    }
+    Finish(std::max(Clock::now() - start_time, Clock::duration::zero()));
+    logger_.LogInfo() << "LoadGeneratorPlugin::" << __func__ << "Sent" << sent_updates_.Get() << "updates";
+}
+
+bool LoadGeneratorPlugin::SleepUntil(const Clock::time_point time_point, const score::cpp::stop_token& stop_token) const
+{
+    while (!(is_stop_requested_ || stop_token.stop_requested()))
+    {
+        const auto now = Clock::now();
+        if (now >= time_point)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::min<Clock::duration>(time_point - now, kStopPollPeriod));
+    }
+    return false;
+}
+
+LoadGeneratorPlugin::Clock::time_point LoadGeneratorPlugin::GetScheduledTime(const Clock::time_point start_time,
+                                                                             const std::uint64_t update_index) const
+{
+    // a burst is sent at the time its first update is due at the configured rate
+    const auto scheduled_index = (config_.timing == UpdateTiming::kBursty)
+                                     ? ((update_index / config_.burst_size) * config_.burst_size)
+                                     : update_index;
+    const std::chrono::duration<double> offset{static_cast<double>(scheduled_index) / config_.updates_per_second};
+    return start_time + std::chrono::duration_cast<Clock::duration>(offset);
+}
+
+std::size_t LoadGeneratorPlugin::SelectSet()
+{
+    if (config_.selection == SetSelection::kZipf)
+    {
+        std::uniform_real_distribution<double> distribution{0.0, zipf_cumulative_weights_.back()};
+        const auto weight = distribution(random_engine_);
+        const auto rank = std::upper_bound(zipf_cumulative_weights_.begin(), zipf_cumulative_weights_.end(), weight);
+        return std::min(static_cast<std::size_t>(rank - zipf_cumulative_weights_.begin()), config_.set_count - 1U);
+    }
+    std::uniform_int_distribution<std::size_t> distribution{0U, config_.set_count - 1U};
+    return distribution(random_engine_);
+}
+
+void LoadGeneratorPlugin::Finish(const Clock::duration elapsed)
+{
+    std::lock_guard<std::mutex> lock{finished_mutex_};
+    is_finished_ = true;
+    elapsed_ = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+    finished_.notify_all();
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,172 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef CODE_PLUGINS_LOAD_GENERATOR_LOAD_GENERATOR_PLUGIN_H
+#define CODE_PLUGINS_LOAD_GENERATOR_LOAD_GENERATOR_PLUGIN_H
+
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
+#include "score/config_management/config_daemon/code/plugins/plugin.h"
+
+#include "score/mw/log/logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+/// @brief Points in time at which the LoadGeneratorPlugin sends its updates
+enum class UpdateTiming : std::uint8_t
+{
+    /// Evenly spaced at the configured rate
+    kUniform,
+    /// Bursts of burst_size updates sent back-to-back, spaced so that the average rate is kept
+    kBursty,
+};
+
+/// @brief Choice of the parameter set the LoadGeneratorPlugin updates next
+enum class SetSelection : std::uint8_t
+{
+    /// Every parameter set is equally likely
+    kUniform,
+    /// The parameter set of rank k is chosen with a probability proportional to 1 / k^zipf_exponent, i.e. a few sets
+    /// receive most of the updates like the sets a calibration engineer is working on
+    kZipf,
+};
+
+struct LoadGeneratorConfig
+{
+    /// Parameter sets named load_set_<index>, all of them are updated
+    std::size_t set_count{100U};
+    /// Integer parameters named parameter_<index> of every set
+    std::size_t parameters_per_set{64U};
+    /// Parameters written by every update, starting with parameter_0
+    std::size_t parameters_per_update{1U};
+    double updates_per_second{200.0};
+    /// Time the updates are sent for, starting after start_delay
+    std::chrono::milliseconds duration{std::chrono::seconds{10}};
+    /// Time between loading the parameter sets and the first update, e.g. for the clients to connect
+    std::chrono::milliseconds start_delay{std::chrono::milliseconds{0}};
+    UpdateTiming timing{UpdateTiming::kUniform};
+    std::size_t burst_size{50U};
+    SetSelection selection{SetSelection::kUniform};
+    double zipf_exponent{1.0};
+    /// Seed of the set selection, so that a load can be repeated
+    std::uint32_t seed{1U};
+};
+
+/// @brief Point-in-time view of the updates sent by the LoadGeneratorPlugin
+struct LoadGeneratorStatistics
+{
+    /// Updates applied to the parameter set collection and announced to the clients
+    std::uint64_t sent_updates;
+    /// Updates rejected by the parameter set collection
+    std::uint64_t failed_updates;
+    /// Applied updates the LastUpdatedParameterSetSender failed to announce, e.g. while the service is not offered
+    std::uint64_t unannounced_updates;
+    /// Time of IParameterSetCollection::UpdateParameterSet()
+    metrics::LatencyHistogramSnapshot update_latency;
+    /// Time of the LastUpdatedParameterSetSender, i.e. until the event is handed to the middleware
+    metrics::LatencyHistogramSnapshot send_latency;
+    /// Delay of the updates behind their schedule, grows as soon as the ConfigDaemon can't keep up with the rate
+    metrics::LatencyHistogramSnapshot schedule_lag;
+    /// Time from the first scheduled update until the last one was sent
+    std::chrono::milliseconds elapsed;
+};
+
+///
+/// @brief Plugin generating synthetic parameter set updates, e.g. to reproduce the update storms of calibration tools
+///
+/// Run() loads set_count parameter sets and returns. Afterwards the updates are written with
+/// IParameterSetCollection::UpdateParameterSet() and announced with the LastUpdatedParameterSetSender at the
+/// configured rate, timing and set selection until the duration elapsed or the daemon stops. Invalid sizes of the
+/// configuration are raised to one.
+///
+class LoadGeneratorPlugin final : public IPlugin
+{
+  public:
+    explicit LoadGeneratorPlugin(const LoadGeneratorConfig& config);
+    ~LoadGeneratorPlugin() override;
+    LoadGeneratorPlugin(LoadGeneratorPlugin&&) = delete;
+    LoadGeneratorPlugin(const LoadGeneratorPlugin&) = delete;
+    LoadGeneratorPlugin& operator=(LoadGeneratorPlugin&&) = delete;
+    LoadGeneratorPlugin& operator=(const LoadGeneratorPlugin&) = delete;
+
+    std::string_view GetName() const noexcept override;
+    bool MarksParameterSetsReady() const noexcept override;
+    ResultBlank Initialize() override;
+    void Deinitialize() noexcept override;
+    std::int32_t Run(std::shared_ptr<data_model::IParameterSetCollection> parameterset_collection,
+                     LastUpdatedParameterSetSender cbk_send_last_updated_parameter_set,
+                     InitialQualifierStateSender cbk_update_initial_qualifier_state,
+                     score::cpp::stop_token stop_token,
+                     std::shared_ptr<fault_event_reporter::IFaultEventReporter> fault_event_reporter) override;
+
+    /// @brief Name of the parameter set with the given index
+    static std::string GetSetName(const std::size_t set_index);
+
+    /// @brief Blocks until all updates are sent or the generation is stopped, returns false if the timeout elapsed
+    bool WaitUntilFinished(const std::chrono::milliseconds timeout) const;
+    LoadGeneratorStatistics GetStatistics() const noexcept;
+
+  private:
+    using Clock = metrics::LatencyHistogram::Clock;
+
+    void Generate(data_model::IParameterSetCollection& parameterset_collection,
+                  const LastUpdatedParameterSetSender& cbk_send_last_updated_parameter_set,
+                  const score::cpp::stop_token& stop_token);
+    /// @brief Waits until time_point, returns false if the generation is stopped before
+    bool SleepUntil(const Clock::time_point time_point, const score::cpp::stop_token& stop_token) const;
+    Clock::time_point GetScheduledTime(const Clock::time_point start_time, const std::uint64_t update_index) const;
+    std::size_t SelectSet();
+    void Finish(const Clock::duration elapsed);
+
+    mw::log::Logger& logger_;
+    const LoadGeneratorConfig config_;
+    // cumulative weights of the set ranks for SetSelection::kZipf
+    std::vector<double> zipf_cumulative_weights_;
+    std::mt19937 random_engine_;
+
+    metrics::Counter sent_updates_;
+    metrics::Counter failed_updates_;
+    metrics::Counter unannounced_updates_;
+    metrics::LatencyHistogram update_latency_;
+    metrics::LatencyHistogram send_latency_;
+    metrics::LatencyHistogram schedule_lag_;
+
+    mutable std::mutex finished_mutex_;
+    mutable std::condition_variable finished_;
+    bool is_finished_;
+    std::chrono::milliseconds elapsed_;
+    std::atomic<bool> is_stop_requested_;
+    std::thread generator_;
+};
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_PLUGINS_LOAD_GENERATOR_LOAD_GENERATOR_PLUGIN_H
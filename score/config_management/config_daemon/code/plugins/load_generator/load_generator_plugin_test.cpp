@@ -0,0 +1,240 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_daemon/code/plugins/load_generator/load_generator_plugin.h"
+#include "score/config_management/config_daemon/code/data_model/details/parameterset_collection_impl.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+namespace test
+{
+
+constexpr std::chrono::milliseconds kFinishTimeout{std::chrono::seconds{10}};
+
+class LoadGeneratorPluginFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        collection_ = std::make_shared<data_model::ParameterSetCollection>();
+    }
+
+    void TearDown() override
+    {
+        if (plugin_ != nullptr)
+        {
+            plugin_->Deinitialize();
+        }
+    }
+
+    std::int32_t RunPlugin(const LoadGeneratorConfig& config, const bool is_announced = true)
+    {
+        plugin_ = std::make_unique<LoadGeneratorPlugin>(config);
+        EXPECT_TRUE(plugin_->Initialize().has_value());
+        return plugin_->Run(
+            collection_,
+            [this, is_announced](const std::string_view set_name) noexcept {
+                std::lock_guard<std::mutex> lock{mutex_};
+                ++updates_per_set_[std::string{set_name}];
+                return is_announced;
+            },
+            {},
+            stop_source_.get_token(),
+            nullptr);
+    }
+
+    std::size_t GetUpdates(const std::string& set_name)
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return updates_per_set_[set_name];
+    }
+
+    std::shared_ptr<data_model::ParameterSetCollection> collection_{};
+    score::cpp::stop_source stop_source_{};
+    std::unique_ptr<LoadGeneratorPlugin> plugin_{};
+    std::mutex mutex_{};
+    std::map<std::string, std::size_t> updates_per_set_{};
+};
+
+TEST_F(LoadGeneratorPluginFixture, ParameterSetsAreLoaded)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoadGeneratorPlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the configured number of calibratable parameter sets is loaded.");
+
+    LoadGeneratorConfig config{};
+    config.set_count = 3U;
+    config.parameters_per_set = 4U;
+    config.duration = std::chrono::milliseconds{0};
+
+    EXPECT_EQ(RunPlugin(config), 0);
+    EXPECT_EQ(plugin_->GetName(), "load_generator");
+    ASSERT_TRUE(plugin_->WaitUntilFinished(kFinishTimeout));
+
+    const auto parameter = collection_->GetParameterFromSet(LoadGeneratorPlugin::GetSetName(2U), "parameter_3");
+    ASSERT_TRUE(parameter.has_value());
+    EXPECT_EQ(parameter.value().As<std::int32_t>().value(), 0);
+    EXPECT_FALSE(collection_->GetParameterFromSet(LoadGeneratorPlugin::GetSetName(3U), "parameter_0").has_value());
+    EXPECT_TRUE(collection_->UpdateParameterSet(LoadGeneratorPlugin::GetSetName(0U), R"({"parameter_0": 1})")
+                    .has_value());
+    EXPECT_EQ(plugin_->GetStatistics().sent_updates, 0U);
+}
+
+TEST_F(LoadGeneratorPluginFixture, UpdatesAreSentAtConfiguredRate)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoadGeneratorPlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that rate times duration updates are written and announced, with uniform "
+                   "and with bursty timing.");
+
+    for (const auto timing : {UpdateTiming::kUniform, UpdateTiming::kBursty})
+    {
+        LoadGeneratorConfig config{};
+        config.set_count = 1U;
+        config.parameters_per_set = 2U;
+        config.parameters_per_update = 2U;
+        config.updates_per_second = 1000.0;
+        config.duration = std::chrono::milliseconds{50};
+        config.timing = timing;
+        config.burst_size = 10U;
+        updates_per_set_.clear();
+
+        EXPECT_EQ(RunPlugin(config), 0);
+        ASSERT_TRUE(plugin_->WaitUntilFinished(kFinishTimeout));
+
+        const auto statistics = plugin_->GetStatistics();
+        EXPECT_EQ(statistics.sent_updates, 50U);
+        EXPECT_EQ(statistics.failed_updates, 0U);
+        EXPECT_EQ(statistics.unannounced_updates, 0U);
+        EXPECT_EQ(statistics.update_latency.count, 50U);
+        EXPECT_EQ(statistics.send_latency.count, 50U);
+        EXPECT_EQ(statistics.schedule_lag.count, 50U);
+        EXPECT_GE(statistics.elapsed, std::chrono::milliseconds{40});
+        EXPECT_EQ(GetUpdates(LoadGeneratorPlugin::GetSetName(0U)), 50U);
+
+        const auto parameter = collection_->GetParameterFromSet(LoadGeneratorPlugin::GetSetName(0U), "parameter_1");
+        EXPECT_EQ(parameter.value().As<std::int32_t>().value(), 50);
+    }
+}
+
+TEST_F(LoadGeneratorPluginFixture, ZipfSelectionPrefersFirstParameterSets)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoadGeneratorPlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the parameter sets of lower rank receive more updates with Zipf "
+                   "distributed set selection.");
+
+    LoadGeneratorConfig config{};
+    config.set_count = 10U;
+    config.parameters_per_set = 1U;
+    config.updates_per_second = 100000.0;
+    config.duration = std::chrono::milliseconds{10};
+    config.selection = SetSelection::kZipf;
+    config.zipf_exponent = 1.5;
+
+    EXPECT_EQ(RunPlugin(config), 0);
+    ASSERT_TRUE(plugin_->WaitUntilFinished(kFinishTimeout));
+
+    EXPECT_EQ(plugin_->GetStatistics().sent_updates, 1000U);
+    EXPECT_GT(GetUpdates(LoadGeneratorPlugin::GetSetName(0U)), 5U * GetUpdates(LoadGeneratorPlugin::GetSetName(9U)));
+    EXPECT_GT(GetUpdates(LoadGeneratorPlugin::GetSetName(1U)), GetUpdates(LoadGeneratorPlugin::GetSetName(9U)));
+}
+
+TEST_F(LoadGeneratorPluginFixture, UnannouncedUpdatesAreCounted)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoadGeneratorPlugin::GetStatistics");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that updates which the LastUpdatedParameterSetSender failed to announce are "
+                   "counted.");
+
+    LoadGeneratorConfig config{};
+    config.set_count = 2U;
+    config.updates_per_second = 1000.0;
+    config.duration = std::chrono::milliseconds{10};
+
+    EXPECT_EQ(RunPlugin(config, false), 0);
+    ASSERT_TRUE(plugin_->WaitUntilFinished(kFinishTimeout));
+
+    const auto statistics = plugin_->GetStatistics();
+    EXPECT_EQ(statistics.sent_updates, 10U);
+    EXPECT_EQ(statistics.unannounced_updates, 10U);
+}
+
+TEST_F(LoadGeneratorPluginFixture, GenerationStopsOnStopRequest)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoadGeneratorPlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the generation ends as soon as the daemon stops.");
+
+    LoadGeneratorConfig config{};
+    config.updates_per_second = 1.0;
+    config.duration = std::chrono::seconds{60};
+    config.start_delay = std::chrono::seconds{60};
+
+    EXPECT_EQ(RunPlugin(config), 0);
+    EXPECT_FALSE(plugin_->WaitUntilFinished(std::chrono::milliseconds{1}));
+    score::cpp::ignore = stop_source_.request_stop();
+
+    ASSERT_TRUE(plugin_->WaitUntilFinished(kFinishTimeout));
+    EXPECT_EQ(plugin_->GetStatistics().sent_updates, 0U);
+}
+
+TEST_F(LoadGeneratorPluginFixture, RunFailsWithoutParameterSetCollection)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoadGeneratorPlugin::Run");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that Run() fails without a parameter set collection.");
+
+    LoadGeneratorPlugin plugin{LoadGeneratorConfig{}};
+
+    EXPECT_EQ(plugin.Run(nullptr, {}, {}, stop_source_.get_token(), nullptr), 1);
+}
+
+}  // namespace test
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
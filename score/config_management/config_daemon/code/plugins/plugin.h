@@ -20,6 +20,10 @@
 #include "score/config_management/config_daemon/code/services/internal_config_provider_service.h"
 #include <score/stop_token.hpp>
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace score
 {
 namespace config_management
@@ -37,9 +41,38 @@ class IPlugin
     IPlugin& operator=(const IPlugin&) = delete;
     virtual ~IPlugin() = default;
 
+    /// @brief Name other plugins and the --offer_after_plugins argument refer to, empty if the plugin is unnamed
+    virtual std::string_view GetName() const noexcept
+    {
+        return {};
+    }
+    /// @brief Names of the plugins whose Initialize() and Run() must have succeeded before the ones of this plugin
+    ///
+    /// Plugins without dependencies are initialized and run concurrently to each other.
+    ///
+    virtual std::vector<std::string> GetDependencies() const
+    {
+        return {};
+    }
+
+    /// @brief Whether Run() marks every parameter set it loads by IParameterSetCollection::MarkParameterSetReady()
+    ///
+    /// Unless all plugins do, the services are only offered once all plugins returned from Run().
+    ///
+    virtual bool MarksParameterSetsReady() const noexcept
+    {
+        return false;
+    }
+
     virtual ResultBlank Initialize() = 0;
     virtual void Deinitialize() noexcept = 0;
 
+    /// @brief Loads the parameter sets of the plugin into parameterset_collection
+    ///
+    /// If all plugins mark their parameter sets ready, the services are already offered while the plugins run. A
+    /// parameter set is served to clients once it is marked by IParameterSetCollection::MarkParameterSetReady(), or
+    /// once all plugins returned from Run().
+    ///
     virtual std::int32_t Run(std::shared_ptr<data_model::IParameterSetCollection> parameterset_collection,
                              LastUpdatedParameterSetSender cbk_send_last_updated_parameter_set,
                              InitialQualifierStateSender cbk_update_initial_qualifier_state,
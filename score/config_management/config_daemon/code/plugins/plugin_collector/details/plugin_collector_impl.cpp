@@ -12,6 +12,7 @@
 // *******************************************************************************
 
 #include "score/config_management/config_daemon/code/plugins/plugin_collector/details/plugin_collector_impl.h"
+#include "score/config_management/config_daemon/code/plugins/file_source/file_source_plugin_creator.h"
 
 namespace score
 {
@@ -26,6 +27,14 @@ PluginCollector::PluginCollector() noexcept
     // Add your plugings creator to plugin_creators_ here.
 }
 
+PluginCollector::PluginCollector(const std::string& file_source_directory) : PluginCollector{}
+{
+    if (!file_source_directory.empty())
+    {
+        plugin_creators_.push_back(std::make_unique<FileSourcePluginCreator>(file_source_directory));
+    }
+}
+
 std::vector<std::shared_ptr<IPlugin>> PluginCollector::CreatePlugins()
 {
     logger_.LogDebug() << "PluginCollector::" << __func__;
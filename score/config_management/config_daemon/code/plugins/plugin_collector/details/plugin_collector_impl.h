@@ -20,6 +20,7 @@
 #include "score/config_management/config_daemon/code/plugins/plugin_creator.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace score
@@ -33,6 +34,8 @@ class PluginCollector final : public IPluginCollector
 {
   public:
     PluginCollector() noexcept;
+    /// @brief Additionally creates the reference FileSourcePlugin if file_source_directory is not empty
+    explicit PluginCollector(const std::string& file_source_directory);
 
     ~PluginCollector() override = default; /* KW_SUPPRESS:MISRA.VIRTUAL.NOVIRTUAL: valid use*/
     PluginCollector(const PluginCollector&) = delete;
@@ -68,6 +68,22 @@ TEST_F(PluginCollectorFixture, PluginCollectorCreatePlugins)
     ASSERT_EQ((plugin_collector_->CreatePlugins()).size(), 0);
 }
 
+TEST(PluginCollectorTest, PluginCollectorCreatesFileSourcePlugin)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::PluginCollector::CreatePlugins()");
+    RecordProperty("Description",
+                   "This test ensures that the FileSourcePlugin is created if a file source directory is given");
+
+    PluginCollector plugin_collector{"/parameter_sets"};
+    const auto plugins = plugin_collector.CreatePlugins();
+
+    ASSERT_EQ(plugins.size(), 1U);
+    EXPECT_EQ(plugins.front()->GetName(), "file_source");
+}
+
 }  // namespace test
 }  // namespace config_daemon
 }  // namespace config_management
@@ -30,6 +30,9 @@ class PluginMock final : public IPlugin
   public:
     ~PluginMock() = default;
 
+    MOCK_METHOD(std::string_view, GetName, (), (const, noexcept, override));
+    MOCK_METHOD(std::vector<std::string>, GetDependencies, (), (const, override));
+    MOCK_METHOD(bool, MarksParameterSetsReady, (), (const, noexcept, override));
     MOCK_METHOD(ResultBlank, Initialize, (), (override));
     MOCK_METHOD(void, Deinitialize, (), (noexcept, override));
 
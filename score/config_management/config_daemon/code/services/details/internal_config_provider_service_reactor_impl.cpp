@@ -12,19 +12,39 @@
 // *******************************************************************************
 
 #include "score/config_management/config_daemon/code/services/details/internal_config_provider_service_reactor_impl.h"
+#include "score/config_management/config_daemon/code/data_model/error/error.h"
 #include "score/mw/log/logging.h"
 
+#include <string_view>
+
 namespace score
 {
 namespace config_management
 {
 namespace config_daemon
 {
+namespace
+{
+
+// a set which is not loaded yet is expected while the plugins run, the client retries it later
+void LogFailedRequest(const std::string_view function, const score::result::Error& error)
+{
+    if (error == data_model::DataModelError::kParameterSetNotReady)
+    {
+        mw::log::LogWarn() << function << ": Parameter set not loaded yet";
+        return;
+    }
+    mw::log::LogError() << function << ": Key not found";
+}
+
+}  // namespace
 
 InternalConfigProviderServiceReactorImpl::InternalConfigProviderServiceReactorImpl(
-    std::shared_ptr<data_model::IReadOnlyParameterSetCollection> read_only_parameter_data_interface)
+    std::shared_ptr<data_model::IReadOnlyParameterSetCollection> read_only_parameter_data_interface,
+    std::shared_ptr<metrics::DaemonMetrics> daemon_metrics)
     : InternalConfigProviderServiceReactor(),
-      read_only_parameter_data_interface_{std::move(read_only_parameter_data_interface)}
+      read_only_parameter_data_interface_{std::move(read_only_parameter_data_interface)},
+      daemon_metrics_{std::move(daemon_metrics)}
 {
 }
 
@@ -33,16 +53,72 @@ score::Result<score::cpp::pmr::string> InternalConfigProviderServiceReactorImpl:
 {
     auto param_set_result =
         read_only_parameter_data_interface_->GetParameterSet({parameter_set_name.data(), parameter_set_name.size()});
+    if (daemon_metrics_ != nullptr)
+    {
+        daemon_metrics_->RecordRequest(parameter_set_name, param_set_result.has_value());
+    }
+
+    if (!param_set_result.has_value())
+    {
+        LogFailedRequest(__func__, param_set_result.error());
+        return MakeUnexpected<score::cpp::pmr::string>(param_set_result.error());
+    }
+
+    return param_set_result;
+}
+
+score::Result<score::cpp::pmr::string> InternalConfigProviderServiceReactorImpl::GetParameterSetAsBinary(
+    const std::string_view parameter_set_name)
+{
+    auto param_set_result = read_only_parameter_data_interface_->GetParameterSetAsBinary(
+        {parameter_set_name.data(), parameter_set_name.size()});
+    if (daemon_metrics_ != nullptr)
+    {
+        daemon_metrics_->RecordRequest(parameter_set_name, param_set_result.has_value());
+    }
 
     if (!param_set_result.has_value())
     {
-        mw::log::LogError() << __func__ << ": Key not found";
+        LogFailedRequest(__func__, param_set_result.error());
         return MakeUnexpected<score::cpp::pmr::string>(param_set_result.error());
     }
 
     return param_set_result;
 }
 
+score::Result<score::cpp::pmr::string> InternalConfigProviderServiceReactorImpl::GetParameterSetChanges(
+    const std::string_view parameter_set_name,
+    const std::uint64_t base_version,
+    const std::uint64_t base_digest)
+{
+    auto changes_result = read_only_parameter_data_interface_->GetParameterSetChanges(
+        {parameter_set_name.data(), parameter_set_name.size()}, base_version, base_digest);
+    if (daemon_metrics_ != nullptr)
+    {
+        daemon_metrics_->RecordRequest(parameter_set_name, changes_result.has_value());
+    }
+
+    if (!changes_result.has_value())
+    {
+        LogFailedRequest(__func__, changes_result.error());
+        return MakeUnexpected<score::cpp::pmr::string>(changes_result.error());
+    }
+
+    return changes_result;
+}
+
+score::Result<score::cpp::pmr::string> InternalConfigProviderServiceReactorImpl::GetParameterSetDictionary()
+{
+    auto dictionary_result = read_only_parameter_data_interface_->GetParameterSetDictionary();
+    if (!dictionary_result.has_value())
+    {
+        mw::log::LogError() << __func__ << ": Dictionary can't be serialized";
+        return MakeUnexpected<score::cpp::pmr::string>(dictionary_result.error());
+    }
+
+    return dictionary_result;
+}
+
 }  // namespace config_daemon
 }  // namespace config_management
 }  // namespace score
@@ -15,6 +15,7 @@
 #define CODE_SERVICES_DETAILS_INTERNAL_CONFIG_PROVIDER_SERVICE_REACTOR_IMPL_H
 
 #include "score/config_management/config_daemon/code/data_model/parameterset_collection_interfaces/read_only_parameterset_collection.h"
+#include "score/config_management/config_daemon/code/metrics/daemon_metrics.h"
 #include "score/config_management/config_daemon/code/services/internal_config_provider_service_reactor.h"
 
 namespace score
@@ -28,11 +29,18 @@ class InternalConfigProviderServiceReactorImpl final : public InternalConfigProv
 {
   public:
     explicit InternalConfigProviderServiceReactorImpl(
-        std::shared_ptr<data_model::IReadOnlyParameterSetCollection> read_only_parameter_data_interface);
+        std::shared_ptr<data_model::IReadOnlyParameterSetCollection> read_only_parameter_data_interface,
+        std::shared_ptr<metrics::DaemonMetrics> daemon_metrics = nullptr);
     score::Result<score::cpp::pmr::string> GetParameterSet(const std::string_view parameter_set_name) override;
+    score::Result<score::cpp::pmr::string> GetParameterSetAsBinary(const std::string_view parameter_set_name) override;
+    score::Result<score::cpp::pmr::string> GetParameterSetChanges(const std::string_view parameter_set_name,
+                                                                const std::uint64_t base_version,
+                                                                const std::uint64_t base_digest) override;
+    score::Result<score::cpp::pmr::string> GetParameterSetDictionary() override;
 
   private:
     const std::shared_ptr<data_model::IReadOnlyParameterSetCollection> read_only_parameter_data_interface_;
+    const std::shared_ptr<metrics::DaemonMetrics> daemon_metrics_;
 };
 
 }  // namespace config_daemon
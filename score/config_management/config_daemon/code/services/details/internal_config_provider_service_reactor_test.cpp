@@ -89,6 +89,145 @@ TEST_F(InternalConfigProviderReactorTest, GetParameterSetFailsWithKeyNotFound)
     EXPECT_EQ(result.error(), data_model::DataModelError::kParameterSetNotFound);
 }
 
+TEST_F(InternalConfigProviderReactorTest, GetParameterSetFailsWithNotReady)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::InternalConfigProviderServiceReactorImpl::GetParameterSet()");
+    RecordProperty("Description",
+                   "This test ensures that GetParameterSet() returns kParameterSetNotReady instead of a missing "
+                   "ParameterSet, when the ParameterSet is not loaded yet");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    const std::string param_set_name = "loading_parameter_set";
+
+    EXPECT_CALL(*parameterset_collection_mock_, GetParameterSet(param_set_name))
+        .WillOnce(Return(MakeUnexpected(data_model::DataModelError::kParameterSetNotReady)));
+
+    InternalConfigProviderServiceReactorImpl reactor{parameterset_collection_mock_};
+    auto result = reactor.GetParameterSet(param_set_name);
+
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), data_model::DataModelError::kParameterSetNotReady);
+}
+
+TEST_F(InternalConfigProviderReactorTest, GetParameterSetRecordsRequests)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::InternalConfigProviderServiceReactorImpl::GetParameterSet()");
+    RecordProperty("Description",
+                   "This test ensures that served and failed GetParameterSet() requests are recorded in the metrics");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    EXPECT_CALL(*parameterset_collection_mock_, GetParameterSet(std::string{"parameter_set_1"}))
+        .Times(2)
+        .WillRepeatedly([](const std::string) {
+            return score::Result<score::cpp::pmr::string>(R"({"param_name_a": 42})");
+        });
+    EXPECT_CALL(*parameterset_collection_mock_, GetParameterSet(std::string{"non_existent_parameter_set"}))
+        .WillOnce(Return(MakeUnexpected(data_model::DataModelError::kParameterSetNotFound)));
+
+    const auto daemon_metrics = std::make_shared<metrics::DaemonMetrics>();
+    InternalConfigProviderServiceReactorImpl reactor{parameterset_collection_mock_, daemon_metrics};
+    EXPECT_TRUE(reactor.GetParameterSet("parameter_set_1").has_value());
+    EXPECT_TRUE(reactor.GetParameterSet("parameter_set_1").has_value());
+    EXPECT_FALSE(reactor.GetParameterSet("non_existent_parameter_set").has_value());
+
+    const auto snapshot = daemon_metrics->GetSnapshot();
+    ASSERT_EQ(snapshot.requests_per_parameter_set.size(), 1U);
+    EXPECT_EQ(snapshot.requests_per_parameter_set.at("parameter_set_1"), 2U);
+    EXPECT_EQ(snapshot.failed_requests, 1U);
+}
+
+TEST_F(InternalConfigProviderReactorTest, GetParameterSetAsBinaryRecordsRequests)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::InternalConfigProviderServiceReactorImpl::"
+                   "GetParameterSetAsBinary()");
+    RecordProperty("Description",
+                   "This test ensures that GetParameterSetAsBinary() returns the encoded ParameterSet and that its "
+                   "requests are recorded in the metrics as the ones of GetParameterSet()");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    EXPECT_CALL(*parameterset_collection_mock_, GetParameterSetAsBinary(std::string{"parameter_set_1"}))
+        .WillOnce(Return(score::Result<score::cpp::pmr::string>("CPWF")));
+    EXPECT_CALL(*parameterset_collection_mock_, GetParameterSetAsBinary(std::string{"non_existent_parameter_set"}))
+        .WillOnce(Return(MakeUnexpected(data_model::DataModelError::kParameterSetNotFound)));
+
+    const auto daemon_metrics = std::make_shared<metrics::DaemonMetrics>();
+    InternalConfigProviderServiceReactorImpl reactor{parameterset_collection_mock_, daemon_metrics};
+    const auto result = reactor.GetParameterSetAsBinary("parameter_set_1");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), "CPWF");
+    EXPECT_EQ(reactor.GetParameterSetAsBinary("non_existent_parameter_set").error(),
+              data_model::DataModelError::kParameterSetNotFound);
+
+    const auto snapshot = daemon_metrics->GetSnapshot();
+    EXPECT_EQ(snapshot.requests_per_parameter_set.at("parameter_set_1"), 1U);
+    EXPECT_EQ(snapshot.failed_requests, 1U);
+}
+
+TEST_F(InternalConfigProviderReactorTest, GetParameterSetChangesForwardsBaseVersionAndDigest)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::InternalConfigProviderServiceReactorImpl::"
+                   "GetParameterSetChanges()");
+    RecordProperty("Description",
+                   "This test ensures that GetParameterSetChanges() returns the delta since the given version and "
+                   "digest and that its requests are recorded in the metrics as the ones of GetParameterSet()");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const score::cpp::pmr::string delta{R"({"version": 43, "is_complete": false})"};
+    EXPECT_CALL(*parameterset_collection_mock_, GetParameterSetChanges(std::string{"parameter_set_1"}, 42U, 7U))
+        .WillOnce(Return(score::Result<score::cpp::pmr::string>(delta)));
+    EXPECT_CALL(*parameterset_collection_mock_,
+                GetParameterSetChanges(std::string{"non_existent_parameter_set"}, 0U, 0U))
+        .WillOnce(Return(MakeUnexpected(data_model::DataModelError::kParameterSetNotFound)));
+
+    const auto daemon_metrics = std::make_shared<metrics::DaemonMetrics>();
+    InternalConfigProviderServiceReactorImpl reactor{parameterset_collection_mock_, daemon_metrics};
+    const auto result = reactor.GetParameterSetChanges("parameter_set_1", 42U, 7U);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), delta);
+    EXPECT_EQ(reactor.GetParameterSetChanges("non_existent_parameter_set", 0U, 0U).error(),
+              data_model::DataModelError::kParameterSetNotFound);
+
+    const auto snapshot = daemon_metrics->GetSnapshot();
+    EXPECT_EQ(snapshot.requests_per_parameter_set.at("parameter_set_1"), 1U);
+    EXPECT_EQ(snapshot.failed_requests, 1U);
+}
+
+TEST_F(InternalConfigProviderReactorTest, GetParameterSetDictionaryForwardsDictionaryOfCollection)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_daemon::InternalConfigProviderServiceReactorImpl::"
+                   "GetParameterSetDictionary()");
+    RecordProperty("Description",
+                   "This test ensures that GetParameterSetDictionary() returns the dictionary of the collection and "
+                   "forwards its errors");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const score::cpp::pmr::string dictionary{R"({"parameter_sets": ["parameter_set_1"]})"};
+    EXPECT_CALL(*parameterset_collection_mock_, GetParameterSetDictionary())
+        .WillOnce(Return(score::Result<score::cpp::pmr::string>(dictionary)))
+        .WillOnce(Return(MakeUnexpected(data_model::DataModelError::kConvertingError)));
+
+    InternalConfigProviderServiceReactorImpl reactor{parameterset_collection_mock_};
+    const auto result = reactor.GetParameterSetDictionary();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), dictionary);
+    EXPECT_EQ(reactor.GetParameterSetDictionary().error(), data_model::DataModelError::kConvertingError);
+}
+
 }  // namespace config_daemon
 }  // namespace config_management
 }  // namespace score
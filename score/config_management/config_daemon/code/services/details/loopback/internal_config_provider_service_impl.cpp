@@ -0,0 +1,195 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_daemon/code/services/details/loopback/internal_config_provider_service_impl.h"
+#include "score/config_management/config_daemon/code/data_model/error/error.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/mw/log/logging.h"
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+namespace
+{
+config_provider::InitialQualifierState Convert(const InitialQualifierState& value)
+{
+    config_provider::InitialQualifierState result = config_provider::InitialQualifierState::kUndefined;
+
+    switch (value)
+    {
+        case InitialQualifierState::kDefault:
+        {
+            result = config_provider::InitialQualifierState::kDefault;
+        }
+        break;
+
+        case InitialQualifierState::kInProgress:
+        {
+            result = config_provider::InitialQualifierState::kInProgress;
+        }
+        break;
+
+        case InitialQualifierState::kQualified:
+        {
+            result = config_provider::InitialQualifierState::kQualified;
+        }
+        break;
+
+        case InitialQualifierState::kQualifying:
+        {
+            result = config_provider::InitialQualifierState::kQualifying;
+        }
+        break;
+
+        case InitialQualifierState::kUnqualified:
+        {
+            result = config_provider::InitialQualifierState::kUnqualified;
+        }
+        break;
+
+        case InitialQualifierState::kUndefined:
+        {
+            result = config_provider::InitialQualifierState::kUndefined;
+        }
+        break;
+
+        default:
+        {
+            result = config_provider::InitialQualifierState::kUndefined;
+        }
+        break;
+    }
+
+    return result;
+}
+
+// the mw::com proxies report a missing parameter set as kParameterSetNotFound and a service which is not ready yet
+// as kProxyNotReady, all other errors are passed on as they are
+Result<score::cpp::pmr::string> ConvertError(Result<score::cpp::pmr::string>&& response)
+{
+    if (response.has_value())
+    {
+        return std::move(response);
+    }
+    if (response.error() == data_model::DataModelError::kParameterSetNotFound)
+    {
+        return MakeUnexpected(config_provider::ConfigProviderError::kParameterSetNotFound,
+                              response.error().UserMessage());
+    }
+    if (response.error() == data_model::DataModelError::kParameterSetNotReady)
+    {
+        return MakeUnexpected(config_provider::ConfigProviderError::kProxyNotReady, response.error().UserMessage());
+    }
+    return std::move(response);
+}
+
+std::string_view ToStdStringView(const score::cpp::string_view value) noexcept
+{
+    return std::string_view{value.data(), value.size()};
+}
+}  // namespace
+
+LoopbackInternalConfigProviderService::Server::Server(
+    std::shared_ptr<InternalConfigProviderServiceReactor> internal_config_provider_service_reactor)
+    : config_provider::loopback::ILoopbackServer{},
+      internal_config_provider_service_reactor_{std::move(internal_config_provider_service_reactor)}
+{
+}
+
+Result<score::cpp::pmr::string> LoopbackInternalConfigProviderService::Server::GetParameterSet(
+    const score::cpp::string_view set_name)
+{
+    return ConvertError(internal_config_provider_service_reactor_->GetParameterSet(ToStdStringView(set_name)));
+}
+
+Result<score::cpp::pmr::string> LoopbackInternalConfigProviderService::Server::GetParameterSetAsBinary(
+    const score::cpp::string_view set_name)
+{
+    return ConvertError(
+        internal_config_provider_service_reactor_->GetParameterSetAsBinary(ToStdStringView(set_name)));
+}
+
+Result<score::cpp::pmr::string> LoopbackInternalConfigProviderService::Server::GetParameterSetChanges(
+    const score::cpp::string_view set_name,
+    const std::uint64_t base_version,
+    const std::uint64_t base_digest)
+{
+    return ConvertError(internal_config_provider_service_reactor_->GetParameterSetChanges(
+        ToStdStringView(set_name), base_version, base_digest));
+}
+
+Result<score::cpp::pmr::string> LoopbackInternalConfigProviderService::Server::GetParameterSetDictionary()
+{
+    return ConvertError(internal_config_provider_service_reactor_->GetParameterSetDictionary());
+}
+
+LoopbackInternalConfigProviderService::LoopbackInternalConfigProviderService(
+    std::shared_ptr<InternalConfigProviderServiceReactor> internal_config_provider_service_reactor,
+    std::shared_ptr<config_provider::loopback::LoopbackChannel> channel)
+    : IInternalConfigProviderService{},
+      server_{std::make_unique<Server>(std::move(internal_config_provider_service_reactor))},
+      channel_{std::move(channel)},
+      logger_{mw::log::CreateLogger(std::string_view{"Serv"})}
+{
+    LoopbackInternalConfigProviderService::SetInitialQualifierState(InitialQualifierState::kUndefined);
+}
+
+LoopbackInternalConfigProviderService::~LoopbackInternalConfigProviderService() noexcept
+{
+    // the channel may outlive the service, so it must not serve requests with the destroyed server
+    if (channel_ != nullptr)
+    {
+        channel_->StopOffer();
+    }
+}
+
+void LoopbackInternalConfigProviderService::StartService()
+{
+    logger_.LogInfo() << "LoopbackInternalConfigProviderService::" << __func__;
+    channel_->Offer(*server_);
+}
+
+void LoopbackInternalConfigProviderService::StopService()
+{
+    logger_.LogInfo() << "LoopbackInternalConfigProviderService::" << __func__;
+    channel_->StopOffer();
+}
+
+void LoopbackInternalConfigProviderService::SetInitialQualifierState(
+    const config_daemon::InitialQualifierState initial_qualifier_state) noexcept
+{
+    const auto state = Convert(initial_qualifier_state);
+    logger_.LogInfo() << "LoopbackInternalConfigProviderService::" << __func__ << "Setting InitialQualifierState: "
+                      << static_cast<std::underlying_type_t<config_provider::InitialQualifierState>>(state);
+    channel_->SetInitialQualifierState(state);
+}
+
+bool LoopbackInternalConfigProviderService::SendLastUpdatedParameterSet(
+    const std::string_view parameter_set_name) noexcept
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProviderService::" << __func__
+                       << "Sending LastUpdatedParameterSet: " << parameter_set_name;
+    // like the mw::com event, the event is sent successfully even if nobody subscribed to it
+    score::cpp::ignore =
+        channel_->Publish(score::cpp::string_view{parameter_set_name.data(), parameter_set_name.size()});
+    return true;
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
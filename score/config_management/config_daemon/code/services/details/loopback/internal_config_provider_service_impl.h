@@ -0,0 +1,85 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef CODE_SERVICES_DETAILS_LOOPBACK_INTERNAL_CONFIG_PROVIDER_SERVICE_IMPL_H
+#define CODE_SERVICES_DETAILS_LOOPBACK_INTERNAL_CONFIG_PROVIDER_SERVICE_IMPL_H
+
+#include "score/config_management/config_daemon/code/services/internal_config_provider_service.h"
+#include "score/config_management/config_daemon/code/services/internal_config_provider_service_reactor.h"
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+
+#include "score/mw/log/logger.h"
+
+#include <score/string_view.hpp>
+#include <memory>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+///
+/// @brief InternalConfigProvider service offered on a config_provider::loopback::LoopbackChannel instead of mw::com
+///
+/// The requests of the proxies are forwarded to the reactor on their calling threads. Errors of the data model are
+/// mapped to the errors the mw::com proxies report for them.
+///
+class LoopbackInternalConfigProviderService final : public IInternalConfigProviderService
+{
+  public:
+    LoopbackInternalConfigProviderService(
+        std::shared_ptr<InternalConfigProviderServiceReactor> internal_config_provider_service_reactor,
+        std::shared_ptr<config_provider::loopback::LoopbackChannel> channel);
+    /// @brief Only a service which is not offered may be moved, e.g. into a ProvidedServiceBuilder
+    LoopbackInternalConfigProviderService(LoopbackInternalConfigProviderService&&) noexcept = default;
+    LoopbackInternalConfigProviderService(const LoopbackInternalConfigProviderService&) noexcept = delete;
+    LoopbackInternalConfigProviderService& operator=(LoopbackInternalConfigProviderService&&) noexcept = delete;
+    LoopbackInternalConfigProviderService& operator=(const LoopbackInternalConfigProviderService&) noexcept = delete;
+    ~LoopbackInternalConfigProviderService() noexcept override;
+
+    void SetInitialQualifierState(const config_daemon::InitialQualifierState initial_qualifier_state) noexcept override;
+    bool SendLastUpdatedParameterSet(const std::string_view parameter_set_name) noexcept override;
+
+    void StartService() override;
+    void StopService() override;
+
+  private:
+    class Server final : public config_provider::loopback::ILoopbackServer
+    {
+      public:
+        explicit Server(std::shared_ptr<InternalConfigProviderServiceReactor> internal_config_provider_service_reactor);
+
+        Result<score::cpp::pmr::string> GetParameterSet(const score::cpp::string_view set_name) override;
+        Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view set_name) override;
+        Result<score::cpp::pmr::string> GetParameterSetChanges(const score::cpp::string_view set_name,
+                                                               const std::uint64_t base_version,
+                                                               const std::uint64_t base_digest) override;
+        Result<score::cpp::pmr::string> GetParameterSetDictionary() override;
+
+      private:
+        const std::shared_ptr<InternalConfigProviderServiceReactor> internal_config_provider_service_reactor_;
+    };
+
+    // the channel refers to the server, so it keeps its address when the service is moved
+    std::unique_ptr<Server> server_;
+    std::shared_ptr<config_provider::loopback::LoopbackChannel> channel_;
+    mw::log::Logger& logger_;
+};
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
+
+#endif  // CODE_SERVICES_DETAILS_LOOPBACK_INTERNAL_CONFIG_PROVIDER_SERVICE_IMPL_H
@@ -0,0 +1,120 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_daemon/code/services/details/loopback/internal_config_provider_service_impl.h"
+#include "score/config_management/config_daemon/code/data_model/error/error.h"
+#include "score/config_management/config_daemon/code/services/internal_config_provider_service_reactor_mock.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_daemon
+{
+
+using testing::Return;
+
+class LoopbackInternalConfigProviderServiceTest : public ::testing::Test
+{
+  protected:
+    std::shared_ptr<InternalConfigProviderServiceReactorMock> reactor_mock_{
+        std::make_shared<InternalConfigProviderServiceReactorMock>()};
+    std::shared_ptr<config_provider::loopback::LoopbackChannel> channel_{
+        std::make_shared<config_provider::loopback::LoopbackChannel>()};
+};
+
+TEST_F(LoopbackInternalConfigProviderServiceTest, RequestsAreServedWhileServiceIsOffered)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoopbackInternalConfigProviderService");
+    RecordProperty("Description",
+                   "This test ensures that requests on the channel are forwarded to the reactor between StartService() "
+                   "and StopService() only.");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    LoopbackInternalConfigProviderService unit{reactor_mock_, channel_};
+    EXPECT_CALL(*reactor_mock_, GetParameterSet(std::string_view{"set_name"}))
+        .WillOnce(Return(score::Result<score::cpp::pmr::string>(R"({"parameters": {}})")));
+    EXPECT_CALL(*reactor_mock_, GetParameterSetAsBinary(std::string_view{"set_name"}))
+        .WillOnce(Return(score::Result<score::cpp::pmr::string>("binary_set")));
+    EXPECT_CALL(*reactor_mock_, GetParameterSetChanges(std::string_view{"set_name"}, 3U, 4U))
+        .WillOnce(Return(score::Result<score::cpp::pmr::string>(R"({"not_modified": true})")));
+    EXPECT_CALL(*reactor_mock_, GetParameterSetDictionary())
+        .WillOnce(Return(score::Result<score::cpp::pmr::string>(R"({"parameter_sets": []})")));
+
+    EXPECT_FALSE(channel_->GetParameterSet("set_name").has_value());
+    unit.StartService();
+    EXPECT_EQ(channel_->GetParameterSet("set_name").value(), R"({"parameters": {}})");
+    EXPECT_EQ(channel_->GetParameterSetAsBinary("set_name").value(), "binary_set");
+    EXPECT_EQ(channel_->GetParameterSetChanges("set_name", 3U, 4U).value(), R"({"not_modified": true})");
+    EXPECT_EQ(channel_->GetParameterSetDictionary().value(), R"({"parameter_sets": []})");
+    unit.StopService();
+    EXPECT_EQ(channel_->GetParameterSet("set_name").error(), config_provider::ConfigProviderError::kProxyNotReady);
+}
+
+TEST_F(LoopbackInternalConfigProviderServiceTest, ErrorsOfDataModelAreMappedToErrorsOfProxies)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoopbackInternalConfigProviderService");
+    RecordProperty("Description",
+                   "This test ensures that missing and not yet ready parameter sets are reported like by the mw::com "
+                   "proxies.");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    LoopbackInternalConfigProviderService unit{reactor_mock_, channel_};
+    EXPECT_CALL(*reactor_mock_, GetParameterSet(std::string_view{"unknown_set"}))
+        .WillOnce(Return(score::MakeUnexpected(data_model::DataModelError::kParameterSetNotFound)));
+    EXPECT_CALL(*reactor_mock_, GetParameterSet(std::string_view{"loading_set"}))
+        .WillOnce(Return(score::MakeUnexpected(data_model::DataModelError::kParameterSetNotReady)));
+    unit.StartService();
+
+    EXPECT_EQ(channel_->GetParameterSet("unknown_set").error(),
+              config_provider::ConfigProviderError::kParameterSetNotFound);
+    EXPECT_EQ(channel_->GetParameterSet("loading_set").error(), config_provider::ConfigProviderError::kProxyNotReady);
+}
+
+TEST_F(LoopbackInternalConfigProviderServiceTest, EventsAndInitialQualifierStateArePassedToChannel)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_daemon::LoopbackInternalConfigProviderService");
+    RecordProperty("Description",
+                   "This test ensures that LastUpdatedParameterSet events are published to the subscribers of the "
+                   "channel and that the InitialQualifierState is converted.");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    LoopbackInternalConfigProviderService unit{reactor_mock_, channel_};
+    std::vector<std::string> events{};
+    score::cpp::ignore = channel_->Subscribe([&events](const score::cpp::string_view set_name) {
+        events.emplace_back(set_name.data(), set_name.size());
+    });
+
+    EXPECT_TRUE(unit.SendLastUpdatedParameterSet("set_name"));
+    unit.SetInitialQualifierState(InitialQualifierState::kUnqualified);
+
+    EXPECT_EQ(events, (std::vector<std::string>{"set_name"}));
+    EXPECT_EQ(channel_->GetInitialQualifierState(), config_provider::InitialQualifierState::kUnqualified);
+}
+
+}  // namespace config_daemon
+}  // namespace config_management
+}  // namespace score
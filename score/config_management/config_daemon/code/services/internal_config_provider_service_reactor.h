@@ -18,6 +18,8 @@
 
 #include <score/string.hpp>
 
+#include <cstdint>
+
 namespace score
 {
 namespace config_management
@@ -36,6 +38,18 @@ class InternalConfigProviderServiceReactor
     virtual ~InternalConfigProviderServiceReactor() noexcept = default;
 
     virtual score::Result<score::cpp::pmr::string> GetParameterSet(const std::string_view parameter_set_name) = 0;
+    /// @brief Returns the parameter set in the binary wire format, which ConfigProvider users read without parsing it
+    virtual score::Result<score::cpp::pmr::string> GetParameterSetAsBinary(
+        const std::string_view parameter_set_name) = 0;
+    /// @brief Returns the changes of the parameter set since base_version, so a client only fetches what changed
+    ///
+    /// Only "not modified" is returned if base_version or base_digest identify the current content of the set.
+    ///
+    virtual score::Result<score::cpp::pmr::string> GetParameterSetChanges(const std::string_view parameter_set_name,
+                                                                        const std::uint64_t base_version,
+                                                                        const std::uint64_t base_digest) = 0;
+    /// @brief Returns the names of the parameter sets indexed by their compact numeric identifiers
+    virtual score::Result<score::cpp::pmr::string> GetParameterSetDictionary() = 0;
 };
 
 }  // namespace config_daemon
@@ -40,6 +40,17 @@ class InternalConfigProviderServiceReactorMock : public InternalConfigProviderSe
                 GetParameterSet,
                 (const std::string_view parameter_set_name),
                 (noexcept, override));
+    MOCK_METHOD(score::Result<score::cpp::pmr::string>,
+                GetParameterSetAsBinary,
+                (const std::string_view parameter_set_name),
+                (noexcept, override));
+    MOCK_METHOD(score::Result<score::cpp::pmr::string>,
+                GetParameterSetChanges,
+                (const std::string_view parameter_set_name,
+                 const std::uint64_t base_version,
+                 const std::uint64_t base_digest),
+                (noexcept, override));
+    MOCK_METHOD(score::Result<score::cpp::pmr::string>, GetParameterSetDictionary, (), (noexcept, override));
 };
 
 }  // namespace config_daemon
@@ -15,13 +15,17 @@
 #define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_CONFIG_PROVIDER_H
 
 #include "score/config_management/config_provider/code/config_provider/initial_qualifier_state_types.h"
+#include "score/config_management/config_provider/code/metrics/latency_histogram.h"
 #include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
 
 #include "score/result/result.h"
 
 #include <score/memory_resource.hpp>
 #include <score/stop_token.hpp>
+#include <score/string.hpp>
 #include <score/unordered_map.hpp>
+#include <score/vector.hpp>
+#include <cstdint>
 #include <optional>
 
 namespace score
@@ -33,6 +37,55 @@ namespace config_provider
 
 using OnChangedParameterSetCallback = score::cpp::callback<void(std::shared_ptr<const ParameterSet>)>;
 using ParameterSetMap = score::cpp::pmr::unordered_map<score::cpp::pmr::string, Result<std::shared_ptr<const ParameterSet>>>;
+using ParameterSetNameList = score::cpp::pmr::vector<score::cpp::pmr::string>;
+
+/// @brief Counters of the cache remembering parameter set names which are unknown to the daemon
+struct NegativeResultCacheStatistics
+{
+    /// Requests answered from the cache without contacting the daemon
+    std::uint64_t hits;
+    /// Requests which were not found in the cache and had to be forwarded to the daemon
+    std::uint64_t misses;
+    /// Number of currently remembered parameter set names
+    std::size_t size;
+};
+
+/// @brief Cache accesses of a single parameter set
+struct ParameterSetAccessCounts
+{
+    /// Requests served from the in-memory cache
+    std::uint64_t hits;
+    /// Requests which were not found in the in-memory cache
+    std::uint64_t misses;
+};
+
+/// @brief Point-in-time view of the ConfigProvider metrics
+///
+/// Counters are collected from the start. Latency histograms are only filled after the metrics got read for the
+/// first time, so that the clock is not read on the hot paths as long as nobody is interested in them.
+///
+struct ConfigProviderMetrics
+{
+    using AccessCountsMap = score::cpp::pmr::unordered_map<score::cpp::pmr::string, ParameterSetAccessCounts>;
+
+    /// Cache accesses per parameter set, limited to a fixed number of distinct names
+    AccessCountsMap access_counts;
+    /// Cache accesses of all parameter sets
+    std::uint64_t cache_hits;
+    std::uint64_t cache_misses;
+    /// Counters of the routine polling LastUpdatedParameterSet event samples
+    std::uint64_t polling_cycles;
+    std::uint64_t received_samples;
+    std::uint64_t dropped_samples;
+    /// Time to fetch a parameter set from the ConfigDaemon
+    metrics::LatencyHistogramSnapshot proxy_fetch_latency;
+    /// Time spent waiting for the internal lock by client calls and update notifications
+    metrics::LatencyHistogramSnapshot mutex_wait_time;
+    /// Time spent in OnChangedParameterSet callbacks of the client
+    metrics::LatencyHistogramSnapshot callback_execution_time;
+    /// Time spent writing parameter sets into the persistency
+    metrics::LatencyHistogramSnapshot persistency_write_latency;
+};
 
 class ConfigProvider
 {
@@ -78,6 +131,8 @@ class ConfigProvider
                                     const score::cpp::stop_token& stop_token) noexcept = 0;
     [[nodiscard]] virtual ResultBlank CheckParameterSetUpdates() noexcept = 0;
     virtual std::size_t GetCachedParameterSetsCount() const noexcept = 0;
+    virtual NegativeResultCacheStatistics GetNegativeResultCacheStatistics() const noexcept = 0;
+    virtual ConfigProviderMetrics GetMetrics() const = 0;
 };
 
 }  // namespace config_provider
@@ -65,6 +65,8 @@ class ConfigProviderMock final : public ConfigProvider
                 (const std::chrono::milliseconds, const score::cpp::stop_token&),
                 (noexcept, override));
     MOCK_METHOD(std::size_t, GetCachedParameterSetsCount, (), (const, noexcept, override));
+    MOCK_METHOD(NegativeResultCacheStatistics, GetNegativeResultCacheStatistics, (), (const, noexcept, override));
+    MOCK_METHOD(ConfigProviderMetrics, GetMetrics, (), (const, override));
 
   private:
     std::shared_ptr<const ParameterSet> parameter_set_;
@@ -12,6 +12,8 @@
 // *******************************************************************************
 
 #include "score/config_management/config_provider/code/config_provider/details/config_provider_impl.h"
+#include "score/config_management/config_provider/code/config_provider/details/parameter_set_changes.h"
+#include "score/config_management/config_provider/code/config_provider/details/received_binary_set.h"
 #include "platform/aas/lib/concurrency/future/interruptible_promise.h"
 #include "score/json/json_parser.h"
 #include "score/config_management/config_provider/code/config_provider/error/error.h"
@@ -19,6 +21,9 @@
 #include <score/memory.hpp>
 #include <score/memory_resource.hpp>
 #include <score/utility.hpp>
+
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 
 namespace score
@@ -29,18 +34,39 @@ namespace config_provider
 {
 namespace
 {
-// Helper function to get parameter set value string only, if Debug log level is enabled, as getting the value as string
-// might be computationally expensive
-std::string GetParameterSetValue(mw::log::Logger& logger, const ParameterSet& param_set)
+// Streams the content of a parameter set. The content is only serialized when the record gets formatted and Debug log
+// level is enabled, as getting the value as string might be computationally expensive
+class ParameterSetValue final
 {
-    if (logger.IsEnabled(mw::log::LogLevel::kDebug))
+  public:
+    ParameterSetValue(mw::log::Logger& logger, const ParameterSet& param_set) noexcept
+        : logger_{logger}, param_set_{param_set}
+    {
+    }
+
+    friend mw::log::LogStream& operator<<(mw::log::LogStream& log_stream, const ParameterSetValue& value)
     {
-        if (auto param_set_str_result = param_set.GetParametersAsString(); param_set_str_result.has_value())
+        if (value.logger_.IsEnabled(mw::log::LogLevel::kDebug))
         {
-            return param_set_str_result.value();
+            if (auto param_set_str_result = value.param_set_.GetParametersAsString(); param_set_str_result.has_value())
+            {
+                log_stream << param_set_str_result.value();
+            }
         }
+        return log_stream;
     }
-    return "";
+
+  private:
+    mw::log::Logger& logger_;
+    const ParameterSet& param_set_;
+};
+
+// Errors meaning that the daemon does not know the requested parameter set. Other failures, e.g. timeouts, are
+// considered transient and are therefore not remembered.
+bool IsUnknownParameterSetError(const score::result::Error& error) noexcept
+{
+    return (error == ConfigProviderError::kProxyReturnedNoResult) ||
+           (error == ConfigProviderError::kParameterSetNotFound);
 }
 }  // namespace
 ConfigProviderImpl::ConfigProviderImpl(
@@ -50,7 +76,8 @@ ConfigProviderImpl::ConfigProviderImpl(
     score::cpp::optional<std::size_t> max_samples_limit,
     score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval,
     IsAvailableNotificationCallback callback,
-    score::cpp::pmr::unique_ptr<Persistency> persistency)
+    score::cpp::pmr::unique_ptr<Persistency> persistency,
+    ParameterSetNameList prefetch_parameter_set_names)
     : ConfigProvider(),
       logger_{mw::log::CreateLogger(std::string_view{"CfgP"})},
       parameter_sets_{ParameterMap::allocator_type{memory_resource}},  // LCOV_EXCL_LINE optimized by compiler
@@ -59,6 +86,13 @@ ConfigProviderImpl::ConfigProviderImpl(
       internal_config_provider_{},
       persistency_{std::move(persistency)},
       client_handlers_{ClientHandlersMap::allocator_type{memory_resource}},  // LCOV_EXCL_LINE optimized by compiler
+      notification_slots_{memory_resource},
+      notification_slots_generation_{1U},
+      negative_result_cache_{memory_resource},
+      are_parameter_set_changes_offered_{true},
+      are_binary_parameter_sets_offered_{true},
+      metrics_recorder_{memory_resource},
+      prefetch_parameter_set_names_{std::move(prefetch_parameter_set_names)},
       max_samples_limit_{max_samples_limit},
       polling_cycle_interval_{polling_cycle_interval},
       proxy_available_thread_{},
@@ -147,16 +181,22 @@ void ConfigProviderImpl::SetupInternalConfigProvider(std::shared_ptr<IInternalCo
                                                      const score::cpp::stop_token& stop_token)
 {
     if (not(internal_config_provider->TrySubscribeToLastUpdatedParameterSetEvent(
-            stop_token, [this](const score::cpp::string_view set) {
-                this->LastUpdatedParameterSetReceiveHandler(set);
+            stop_token, [this](const ParameterSetId set_id, const score::cpp::string_view set) {
+                this->LastUpdatedParameterSetReceiveHandler(set_id, set);
             })))
     {
         logger_.LogError() << __func__ << ": Failed to subscribe to LastUpdatedParameterSet event";
         return;
     }
     logger_.LogDebug() << __func__ << ": Subscribed to LastUpdatedParameterSet event.";
-    auto new_parameter_set_values = FetchInitialParameterSetValuesFrom(*internal_config_provider);
-    WriteInitialParameterSetValuesToPersistentCache(std::move(new_parameter_set_values));
+    const auto fetch_start = std::chrono::steady_clock::now();
+    const auto new_parameter_set_values = FetchInitialParameterSetValuesFrom(*internal_config_provider);
+    const auto fetched_count = new_parameter_set_values.size();
+    WriteInitialParameterSetValuesToPersistentCache(new_parameter_set_values);
+    const auto fetch_duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - fetch_start);
+    logger_.LogInfo() << __func__ << ": Fetched " << fetched_count << " initial parameter sets in "
+                      << fetch_duration.count() << "ms";
     CacheInitialQualifierState(internal_config_provider->GetInitialQualifierState(kDefaultResponseTimeout));
     RegisterCallbacksForPersistedParameterSetNames();
 
@@ -203,16 +243,16 @@ Result<std::shared_ptr<const ParameterSet>> ConfigProviderImpl::GetParameterSet(
 {
     const auto actual_timeout = timeout.value_or(kDefaultResponseTimeout);
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    const auto lock = LockMutex();
     const auto it =
         std::find_if(parameter_sets_.begin(), parameter_sets_.end(), [&set_name](const auto& param_set_pair) noexcept {
             return score::cpp::string_view{param_set_pair.first} == set_name;
         });
 
+    metrics_recorder_.RecordCacheAccess(set_name, it != parameter_sets_.end());
     if (it != parameter_sets_.end())
     {
-        logger_.LogDebug() << __func__ << " [" << set_name
-                           << "]: value: " << GetParameterSetValue(logger_, *it->second);
+        logger_.LogDebug() << __func__ << " [" << set_name << "]: Served from cache";
         return {it->second};
     }
 
@@ -222,19 +262,27 @@ Result<std::shared_ptr<const ParameterSet>> ConfigProviderImpl::GetParameterSet(
         return MakeUnexpected(ConfigProviderError::kProxyNotReady, "Proxy is not ready");
     }
 
+    const auto remembered_error = negative_result_cache_.Find(set_name, NegativeResultCache::Clock::now());
+    if (remembered_error.has_value())
+    {
+        logger_.LogDebug() << __func__ << " [" << set_name << "]: Parameter set is known to be unavailable";
+        return Unexpected{remembered_error.value()};
+    }
+
     const auto param_set =
         GetParameterSetFromInternalConfigProvider(set_name, *internal_config_provider_, actual_timeout);
     if (not param_set.has_value())
     {
+        RememberUnknownParameterSet(set_name, param_set.error());
         return param_set;
     }
 
     logger_.LogInfo() << __func__ << " [" << set_name << "]: Adding new parameter set to cache as "
                       << parameter_sets_.size() << " element";
     logger_.LogDebug() << __func__ << " [" << set_name
-                       << "]: New parameter set with value: " << GetParameterSetValue(logger_, *param_set.value());
+                       << "]: New parameter set with value: " << ParameterSetValue{logger_, *param_set.value()};
     score::cpp::pmr::string param_set_key{set_name.data(), set_name.size(), memory_resource_};
-    persistency_->CacheParameterSet(parameter_sets_, param_set_key, param_set.value(), true);
+    CacheParameterSetInPersistency(parameter_sets_, param_set_key, param_set.value(), true);
     score::cpp::ignore = parameter_sets_.try_emplace(param_set_key, param_set.value());
     // Register update handler to keep this newly cached parameter set up-to-date.
     // We ignore returned value because we always pass empty callback here which
@@ -251,7 +299,7 @@ ParameterSetMap ConfigProviderImpl::GetParameterSetsByNameList(const score::cpp:
     {
         for (const auto& set_name : set_names)
         {
-            std::lock_guard<std::mutex> lock{mutex_};
+            const auto lock = LockMutex();
             // Always use score::cpp::pmr::string as key for parameter_sets_ and parameter_set_map
             score::cpp::pmr::string set_name_key{set_name.data(), set_name.size(), memory_resource_};
             const auto it = std::find_if(
@@ -259,10 +307,10 @@ ParameterSetMap ConfigProviderImpl::GetParameterSetsByNameList(const score::cpp:
                     return param_set_pair.first == set_name_key;
                 });
 
+            metrics_recorder_.RecordCacheAccess(set_name, it != parameter_sets_.end());
             if (it != parameter_sets_.end())
             {
-                logger_.LogDebug() << __func__ << " [" << set_name
-                                   << "]: cached value: " << GetParameterSetValue(logger_, *it->second);
+                logger_.LogDebug() << __func__ << " [" << set_name << "]: Served from cache";
                 score::cpp::ignore = parameter_set_map.try_emplace(set_name_key, it->second);
                 continue;
             }
@@ -273,6 +321,14 @@ ParameterSetMap ConfigProviderImpl::GetParameterSetsByNameList(const score::cpp:
                     set_name_key, MakeUnexpected(ConfigProviderError::kProxyNotReady, "Proxy is not ready"));
                 continue;
             }
+            const auto remembered_error = negative_result_cache_.Find(set_name, NegativeResultCache::Clock::now());
+            if (remembered_error.has_value())
+            {
+                logger_.LogDebug() << __func__ << " [" << set_name << "]: Parameter set is known to be unavailable";
+                score::cpp::ignore = parameter_set_map.try_emplace(
+                    set_name_key, Result<std::shared_ptr<const ParameterSet>>{Unexpected{remembered_error.value()}});
+                continue;
+            }
 
             const auto param_set =
                 GetParameterSetFromInternalConfigProvider(set_name, *internal_config_provider_, actual_timeout);
@@ -281,24 +337,24 @@ ParameterSetMap ConfigProviderImpl::GetParameterSetsByNameList(const score::cpp:
                 logger_.LogError() << __func__ << " [" << set_name
                                    << "]: Failed to get parameter set from internal config provider: "
                                    << param_set.error();
+                RememberUnknownParameterSet(set_name, param_set.error());
                 score::cpp::ignore = parameter_set_map.try_emplace(
-                    set_name_key,
-                    MakeUnexpected(ConfigProviderError::kParameterSetNotFound, "Parameter set not found"));
+                    set_name_key, Result<std::shared_ptr<const ParameterSet>>{Unexpected{param_set.error()}});
                 continue;
             }
 
             score::cpp::pmr::string param_set_key{set_name.data(), set_name.size(), memory_resource_};
             score::cpp::ignore = parameter_set_map.try_emplace(set_name_key, param_set.value());
             logger_.LogDebug() << __func__ << " [" << set_name << "]: New parameter set with value: "
-                               << GetParameterSetValue(logger_, *param_set.value());
-            persistency_->CacheParameterSet(parameter_sets_, param_set_key, param_set.value(), false);
+                               << ParameterSetValue{logger_, *param_set.value()};
+            CacheParameterSetInPersistency(parameter_sets_, param_set_key, param_set.value(), false);
             score::cpp::ignore = parameter_sets_.try_emplace(param_set_key, param_set.value());
             // Register update handler to keep this newly cached parameter set up-to-date.
             // We ignore returned value because we always pass empty callback here which
             // can't trigger error branch inside RegisterUpdateHandlerForParameterSet method
             score::cpp::ignore = RegisterUpdateHandlerForParameterSetName(param_set_key, {});
         }
-        persistency_->SyncToStorage();
+        SyncPersistencyToStorage();
     }
 
     return parameter_set_map;
@@ -309,10 +365,35 @@ Result<std::shared_ptr<const ParameterSet>> ConfigProviderImpl::GetParameterSetF
     const IInternalConfigProvider& internal_config_provider,
     const std::chrono::milliseconds timeout)
 {
-    // NOTE: we assume here that `mutex_` got already acquired by the caller!
+    // NOTE: we assume here that `mutex_` got already acquired by the caller, or that the proxy is not published yet!
     logger_.LogDebug() << __func__ << " [" << set_name << "]: timeout: " << timeout;
 
-    auto parameter_set_result = internal_config_provider.GetParameterSet(set_name, timeout);
+    // the binary wire format is read in place, the JSON text is only fetched if the transport doesn't carry it
+    if (are_binary_parameter_sets_offered_)
+    {
+        auto binary_set_result = [this, &internal_config_provider, &set_name, &timeout]() {
+            const auto timer = metrics_recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kProxyFetch);
+            return internal_config_provider.GetParameterSetAsBinary(set_name, timeout);
+        }();
+        if (binary_set_result.has_value())
+        {
+            return CreateParameterSetFromBuffer(std::move(binary_set_result).value(), memory_resource_);
+        }
+        if (binary_set_result.error() != ConfigProviderError::kMethodNotSupported)
+        {
+            logger_.LogError() << __func__ << " [" << set_name
+                               << "]: Failed to get binary ParameterSet from InternalConfigProvider proxy: "
+                               << binary_set_result.error();
+            return Unexpected{binary_set_result.error()};
+        }
+        logger_.LogInfo() << __func__ << ": Binary parameter sets are not offered, fetching them as JSON";
+        are_binary_parameter_sets_offered_ = false;
+    }
+
+    auto parameter_set_result = [this, &internal_config_provider, &set_name, &timeout]() {
+        const auto timer = metrics_recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kProxyFetch);
+        return internal_config_provider.GetParameterSet(set_name, timeout);
+    }();
     if (not(parameter_set_result.has_value()))
     {
         logger_.LogError() << __func__ << " [" << set_name
@@ -325,6 +406,39 @@ Result<std::shared_ptr<const ParameterSet>> ConfigProviderImpl::GetParameterSetF
         memory_resource_, std::move(parameter_set_result).value(), memory_resource_)};
 }
 
+Result<std::shared_ptr<const ParameterSet>> ConfigProviderImpl::GetParameterSetChangesFromInternalConfigProvider(
+    const score::cpp::string_view set_name,
+    const std::shared_ptr<const ParameterSet>& cached_set,
+    const IInternalConfigProvider& internal_config_provider,
+    const std::chrono::milliseconds timeout,
+    const bool is_content_known)
+{
+    // NOTE: we assume here that `mutex_` got already acquired by the caller, or that the proxy is not published yet!
+    // a set without version, e.g. fetched as a whole or read from persistency, is requested completely once
+    const std::uint64_t base_version = (cached_set != nullptr) ? cached_set->GetVersion().value_or(0U) : 0U;
+    const std::uint64_t base_digest =
+        (is_content_known && (cached_set != nullptr)) ? cached_set->GetDigest().value_or(0U) : 0U;
+    logger_.LogDebug() << __func__ << " [" << set_name << "]: base_version: " << base_version
+                       << ", base_digest: " << base_digest;
+
+    auto changes_result = [&internal_config_provider, &set_name, base_version, base_digest, &timeout, this]() {
+        const auto timer = metrics_recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kProxyFetch);
+        return internal_config_provider.GetParameterSetChanges(set_name, base_version, base_digest, timeout);
+    }();
+    if (not(changes_result.has_value()))
+    {
+        if (changes_result.error() == ConfigProviderError::kMethodNotSupported)
+        {
+            are_parameter_set_changes_offered_ = false;
+        }
+        logger_.LogWarn() << __func__ << " [" << set_name
+                          << "]: Failed to get ParameterSet changes from InternalConfigProvider proxy: "
+                          << changes_result.error();
+        return Unexpected{changes_result.error()};
+    }
+    return ApplyParameterSetChanges(cached_set, std::move(changes_result).value(), memory_resource_);
+}
+
 ResultBlank ConfigProviderImpl::OnChangedInitialQualifierState(InitialQualifierStateNotifierCallbackType&& /*callback*/) noexcept
 {
     return MakeUnexpected(ConfigProviderError::kMethodNotSupported,
@@ -368,16 +482,74 @@ std::size_t ConfigProviderImpl::GetCachedParameterSetsCount() const noexcept
     return parameter_sets_.size();
 }
 
-void ConfigProviderImpl::LastUpdatedParameterSetReceiveHandler(const score::cpp::string_view set_name)
+NegativeResultCacheStatistics ConfigProviderImpl::GetNegativeResultCacheStatistics() const noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return negative_result_cache_.GetStatistics();
+}
+
+ConfigProviderMetrics ConfigProviderImpl::GetMetrics() const
 {
-    logger_.LogDebug() << __func__ << " [" << set_name << "]";
     std::lock_guard<std::mutex> lock{mutex_};
+    auto metrics = metrics_recorder_.GetMetrics(memory_resource_);
+    if (internal_config_provider_ != nullptr)
+    {
+        const auto polling_statistics = internal_config_provider_->GetPollingStatistics();
+        metrics.polling_cycles = polling_statistics.polling_cycles;
+        metrics.received_samples = polling_statistics.received_samples;
+        metrics.dropped_samples = polling_statistics.dropped_samples;
+    }
+    return metrics;
+}
+
+std::unique_lock<std::mutex> ConfigProviderImpl::LockMutex() noexcept
+{
+    const auto timer = metrics_recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kMutexWait);
+    return std::unique_lock<std::mutex>{mutex_};
+}
+
+void ConfigProviderImpl::CacheParameterSetInPersistency(const ParameterMap& cached_parameter_sets,
+                                                        const score::cpp::pmr::string& param_set_key,
+                                                        const std::shared_ptr<const ParameterSet>& parameter_set,
+                                                        const bool sync_to_storage) noexcept
+{
+    // NOTE: we assume here that `mutex_` got already acquired by the caller!
+    const auto timer = metrics_recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kPersistencyWrite);
+    persistency_->CacheParameterSet(cached_parameter_sets, param_set_key, parameter_set, sync_to_storage);
+}
+
+void ConfigProviderImpl::SyncPersistencyToStorage() noexcept
+{
+    const auto timer = metrics_recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kPersistencyWrite);
+    persistency_->SyncToStorage();
+}
+
+void ConfigProviderImpl::RememberUnknownParameterSet(const score::cpp::string_view set_name,
+                                                     const score::result::Error& error)
+{
+    // NOTE: we assume here that `mutex_` got already acquired by the caller!
+    if (IsUnknownParameterSetError(error))
+    {
+        logger_.LogDebug() << __func__ << " [" << set_name << "]: Remembering unknown parameter set";
+        negative_result_cache_.Insert(set_name, error, NegativeResultCache::Clock::now());
+    }
+}
 
-    const score::cpp::pmr::string set_name_amp{set_name.data(), set_name.size(), memory_resource_};
-    if (auto client_handler_it = client_handlers_.find(set_name_amp); client_handler_it == client_handlers_.end())
+void ConfigProviderImpl::LastUpdatedParameterSetReceiveHandler(const ParameterSetId set_id,
+                                                               const score::cpp::string_view set_name)
+{
+    logger_.LogDebug() << __func__ << " [" << set_name << "]";
+    const auto lock = LockMutex();
+
+    // The daemon announced this parameter set, so an earlier failed lookup is no longer valid.
+    negative_result_cache_.Invalidate(set_name);
+
+    auto& slot = GetNotificationSlot(set_id, set_name);
+    if (slot.client_handler == nullptr)
     {
         return;
     }
+    const score::cpp::pmr::string& set_name_amp = slot.client_handler->first;
 
     // LCOV_EXCL_BR_START (internal_config_provider_ cannot be nullptr in current implementation)
     if (internal_config_provider_ == nullptr)
@@ -388,32 +560,72 @@ void ConfigProviderImpl::LastUpdatedParameterSetReceiveHandler(const score::cpp:
         // LCOV_EXCL_STOP
     }
     // LCOV_EXCL_BR_STOP
-    const auto parameter_set =
-        GetParameterSetFromInternalConfigProvider(set_name, *internal_config_provider_, kDefaultResponseTimeout);
+    // only the changes since the cached version are transferred, the whole set is the fallback
+    Result<std::shared_ptr<const ParameterSet>> parameter_set{MakeUnexpected(ConfigProviderError::kMethodNotSupported)};
+    if (are_parameter_set_changes_offered_)
+    {
+        parameter_set = GetParameterSetChangesFromInternalConfigProvider(
+            set_name,
+            (slot.cached_set != nullptr) ? slot.cached_set->second : nullptr,
+            *internal_config_provider_,
+            kDefaultResponseTimeout);
+    }
+    if (not(parameter_set.has_value()))
+    {
+        parameter_set =
+            GetParameterSetFromInternalConfigProvider(set_name, *internal_config_provider_, kDefaultResponseTimeout);
+    }
 
     if (parameter_set.has_value())
     {
-        persistency_->CacheParameterSet(parameter_sets_, set_name_amp, parameter_set.value(), true);
-        const auto result = parameter_sets_.insert_or_assign(set_name_amp, parameter_set.value());
-
-        if (result.second)
+        CacheParameterSetInPersistency(parameter_sets_, set_name_amp, parameter_set.value(), true);
+        if (slot.cached_set == nullptr)
         {
+            slot.cached_set = &*parameter_sets_.insert_or_assign(set_name_amp, parameter_set.value()).first;
             logger_.LogDebug() << __func__ << " [" << set_name << "]: New parameter set inserted, value: "
-                               << GetParameterSetValue(logger_, *parameter_set.value());
+                               << ParameterSetValue{logger_, *parameter_set.value()};
         }
         else
         {
+            slot.cached_set->second = parameter_set.value();
             logger_.LogDebug() << __func__ << " [" << set_name << "]: Existing parameter set updated, value: "
-                               << GetParameterSetValue(logger_, *parameter_set.value());
+                               << ParameterSetValue{logger_, *parameter_set.value()};
         }
-        if (auto client_handler_it = client_handlers_.find(set_name_amp);
-            client_handler_it != client_handlers_.end() && not client_handler_it->second.empty())
+        if (not slot.client_handler->second.empty())
         {
-            client_handler_it->second(parameter_set.value());
+            const auto timer =
+                metrics_recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kCallbackExecution);
+            slot.client_handler->second(parameter_set.value());
         }
     }
 }
 
+ConfigProviderImpl::NotificationSlot& ConfigProviderImpl::GetNotificationSlot(const ParameterSetId set_id,
+                                                                             const score::cpp::string_view set_name)
+{
+    // NOTE: we assume here that `mutex_` got already acquired by the caller!
+    if (set_id >= notification_slots_.size())
+    {
+        notification_slots_.resize(static_cast<std::size_t>(set_id) + 1U, NotificationSlot{0U, nullptr, nullptr});
+    }
+    auto& slot = notification_slots_[set_id];
+    if (slot.generation != notification_slots_generation_)
+    {
+        const score::cpp::pmr::string set_name_obj{set_name.data(), set_name.size(), memory_resource_};
+        const auto client_handler = client_handlers_.find(set_name_obj);
+        slot.client_handler = (client_handler != client_handlers_.end()) ? &*client_handler : nullptr;
+        slot.cached_set = nullptr;
+        slot.generation = notification_slots_generation_;
+    }
+    // a parameter set which isn't cached yet can be cached by any request, so only found entries are kept
+    if ((slot.cached_set == nullptr) && (slot.client_handler != nullptr))
+    {
+        const auto cached_set = parameter_sets_.find(slot.client_handler->first);
+        slot.cached_set = (cached_set != parameter_sets_.end()) ? &*cached_set : nullptr;
+    }
+    return slot;
+}
+
 ResultBlank ConfigProviderImpl::OnChangedParameterSet(const std::string& set_name,
                                                       OnChangedParameterSetCallback&& callback) noexcept
 {
@@ -425,7 +637,7 @@ ResultBlank ConfigProviderImpl::OnChangedParameterSet(const std::string& set_nam
         logger_.LogError() << __func__ << " [" << set_name << "]: Empty callback provided.";
         return MakeUnexpected(ConfigProviderError::kEmptyCallbackProvided, "Empty callback provided.");
     }
-    std::lock_guard<std::mutex> lock{mutex_};
+    const auto lock = LockMutex();
     return RegisterUpdateHandlerForParameterSetName(set_name, std::move(on_changed_parameter_set_callback));
 }
 
@@ -448,6 +660,10 @@ ResultBlank ConfigProviderImpl::RegisterUpdateHandlerForParameterSetName(const s
         (found_handler->second.empty() && not on_changed_parameter_set_callback.empty()))
     {
         logger_.LogDebug() << __func__ << " [" << set_name << "]: set callback";
+        if (found_handler == client_handlers_.end())
+        {
+            ++notification_slots_generation_;
+        }
         score::cpp::ignore =
             client_handlers_.insert_or_assign(std::move(set_name_obj), std::move(on_changed_parameter_set_callback));
     }
@@ -474,52 +690,104 @@ ResultBlank ConfigProviderImpl::CheckParameterSetUpdates() noexcept
     return {};
 }
 
-ParameterMap ConfigProviderImpl::FetchInitialParameterSetValuesFrom(
+ParameterSetMap ConfigProviderImpl::FetchInitialParameterSetValuesFrom(
     const IInternalConfigProvider& internal_config_provider)
 {
-    score::cpp::pmr::vector<score::cpp::pmr::string> set_names{score::cpp::pmr::vector<score::cpp::pmr::string>::allocator_type{memory_resource_}};
-    std::lock_guard<std::mutex> lock{mutex_};
-    for (const auto& parameter_set : parameter_sets_)
+    // The sets are requested one by one, since the InternalConfigProvider interface has no batched request. The cache
+    // is only read under the lock, the round trips run without it. Nothing else modifies parameter_sets_ meanwhile,
+    // since the proxy is not published to internal_config_provider_ before the initial values got written.
+    ParameterMap base_parameter_sets{ParameterMap::allocator_type{memory_resource_}};
+    ParameterSetNameList set_names{ParameterSetNameList::allocator_type{memory_resource_}};
     {
-        set_names.push_back(parameter_set.first);
+        std::lock_guard<std::mutex> lock{mutex_};
+        base_parameter_sets = parameter_sets_;
+        for (const auto& parameter_set : parameter_sets_)
+        {
+            set_names.push_back(parameter_set.first);
+        }
+        // Parameter sets requested for prefetching are fetched in the same batch as the persisted ones, so that they
+        // are available as soon as the availability notification is sent.
+        for (const auto& prefetch_set_name : prefetch_parameter_set_names_)
+        {
+            if (std::find(set_names.begin(), set_names.end(), prefetch_set_name) == set_names.end())
+            {
+                set_names.push_back(prefetch_set_name);
+            }
+        }
     }
 
-    ParameterMap updated_parameter_sets{ParameterMap::allocator_type{memory_resource_}};
+    ParameterSetMap fetched_parameter_sets{ParameterSetMap::allocator_type{memory_resource_}};
     for (const auto& set_name : set_names)  // LCOV_EXCL_BR_LINE tooling issue
     {
-        const auto parameter_set =
-            GetParameterSetFromInternalConfigProvider(set_name, internal_config_provider, kDefaultResponseTimeout);
+        // a cached set is only transferred again if its content changed, e.g. while the ConfigDaemon restarted
+        Result<std::shared_ptr<const ParameterSet>> parameter_set{
+            MakeUnexpected(ConfigProviderError::kMethodNotSupported)};
+        const auto cached_set = base_parameter_sets.find(set_name);
+        if (are_parameter_set_changes_offered_ && (cached_set != base_parameter_sets.end()))
+        {
+            parameter_set = GetParameterSetChangesFromInternalConfigProvider(
+                set_name, cached_set->second, internal_config_provider, kDefaultResponseTimeout, true);
+        }
+        if (not(parameter_set.has_value()))
+        {
+            parameter_set =
+                GetParameterSetFromInternalConfigProvider(set_name, internal_config_provider, kDefaultResponseTimeout);
+        }
         if (parameter_set.has_value())
         {
             logger_.LogDebug() << __func__ << " [" << set_name << "]: Updated parameter set with value: "
-                               << GetParameterSetValue(logger_, *parameter_set.value());
-            score::cpp::ignore = updated_parameter_sets.try_emplace(set_name, parameter_set.value());
+                               << ParameterSetValue{logger_, *parameter_set.value()};
         }
         else
         {
             logger_.LogError() << __func__ << " [" << set_name << "]: Failed to get parameter set";
         }
+        score::cpp::ignore = fetched_parameter_sets.try_emplace(set_name, std::move(parameter_set));
     }
-    return updated_parameter_sets;
+    return fetched_parameter_sets;
 }
 
-void ConfigProviderImpl::WriteInitialParameterSetValuesToPersistentCache(ParameterMap updated_parameter_sets)
+void ConfigProviderImpl::WriteInitialParameterSetValuesToPersistentCache(const ParameterSetMap& fetched_parameter_sets)
 {
     logger_.LogDebug() << __func__;
 
     std::lock_guard<std::mutex> lock{mutex_};
     const auto current_parameter_set_copy = parameter_sets_;
-    for (const auto& [key, value] : updated_parameter_sets)
+    std::size_t updated_count{0U};
+    for (const auto& [key, value] : fetched_parameter_sets)
     {
-        logger_.LogDebug() << __func__ << ": Cache parameter set " << key;
-        persistency_->CacheParameterSet(current_parameter_set_copy, key, value, false);
+        if (value.has_value())
+        {
+            logger_.LogDebug() << __func__ << ": Cache parameter set " << key;
+            CacheParameterSetInPersistency(current_parameter_set_copy, key, value.value(), false);
+            ++updated_count;
+        }
+        else
+        {
+            RememberUnknownParameterSet(key, value.error());
+        }
     }
 
-    persistency_->SyncToStorage();
-    if (!updated_parameter_sets.empty())
+    SyncPersistencyToStorage();
+    // The fetched values are merged into the cache. A set the ConfigDaemon does not know is dropped, while a set that
+    // is not ready yet, e.g. since its plugin still runs, keeps its cached value until its update is notified.
+    bool is_cache_changed{updated_count != 0U};
+    for (const auto& [key, value] : fetched_parameter_sets)
+    {
+        if (value.has_value())
+        {
+            score::cpp::ignore = parameter_sets_.insert_or_assign(key, value.value());
+        }
+        else if (IsUnknownParameterSetError(value.error()) && (parameter_sets_.erase(key) != 0U))
+        {
+            logger_.LogInfo() << __func__ << " [" << key << "]: Dropped unknown parameter set from cache";
+            is_cache_changed = true;
+        }
+    }
+    if (is_cache_changed)
     {
-        parameter_sets_ = std::move(updated_parameter_sets);
-        logger_.LogInfo() << __func__ << ": " << parameter_sets_.size() << " parameter sets were updated";
+        ++notification_slots_generation_;
+        logger_.LogInfo() << __func__ << ": " << updated_count << " parameter sets were updated";
     }
 }
 
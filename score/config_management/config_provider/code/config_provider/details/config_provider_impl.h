@@ -15,6 +15,8 @@
 #define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_CONFIG_PROVIDER_IMPL_H
 
 #include "score/config_management/config_provider/code/config_provider/config_provider.h"
+#include "score/config_management/config_provider/code/config_provider/details/config_provider_metrics_recorder.h"
+#include "score/config_management/config_provider/code/config_provider/details/negative_result_cache.h"
 #include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
 #include "score/config_management/config_provider/code/persistency/persistency.h"
 #include "score/config_management/config_provider/code/proxies/internal_config_provider.h"
@@ -30,6 +32,9 @@
 #include <score/memory_resource.hpp>
 #include <score/optional.hpp>
 #include <score/unordered_map.hpp>
+#include <score/vector.hpp>
+
+#include <cstdint>
 
 namespace score
 {
@@ -87,6 +92,8 @@ class ConfigProviderImpl final : public ConfigProvider
                             const score::cpp::stop_token& stop_token) noexcept override;
 
     std::size_t GetCachedParameterSetsCount() const noexcept override;
+    NegativeResultCacheStatistics GetNegativeResultCacheStatistics() const noexcept override;
+    ConfigProviderMetrics GetMetrics() const override;
 
     bool IsAwaitingProxyConnection() const noexcept;
 
@@ -97,23 +104,52 @@ class ConfigProviderImpl final : public ConfigProvider
         score::cpp::optional<std::size_t> max_samples_limit,
         score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval,
         IsAvailableNotificationCallback callback,
-        score::cpp::pmr::unique_ptr<Persistency> persistency);
+        score::cpp::pmr::unique_ptr<Persistency> persistency,
+        ParameterSetNameList prefetch_parameter_set_names = ParameterSetNameList{});
 
   private:
     void SetupInternalConfigProvider(std::shared_ptr<IInternalConfigProvider> internal_config_provider,
                                      IsAvailableNotificationCallback is_available_notification_callback,
                                      const score::cpp::stop_token& stop_token);
     void CacheInitialQualifierState(const InitialQualifierState initial_qualifier_state) noexcept;
-    void LastUpdatedParameterSetReceiveHandler(const score::cpp::string_view set_name);
+    /// @brief Entries of client_handlers_ and parameter_sets_ cached for a parameter set identifier of the proxy
+    struct NotificationSlot
+    {
+        // the slot is outdated if it differs from notification_slots_generation_
+        std::uint64_t generation;
+        ClientHandlersMap::value_type* client_handler;
+        ParameterMap::value_type* cached_set;
+    };
+
+    void LastUpdatedParameterSetReceiveHandler(const ParameterSetId set_id, const score::cpp::string_view set_name);
+    NotificationSlot& GetNotificationSlot(const ParameterSetId set_id, const score::cpp::string_view set_name);
     Result<std::shared_ptr<const ParameterSet>> GetParameterSetFromInternalConfigProvider(
         const score::cpp::string_view set_name,
         const IInternalConfigProvider& internal_config_provider,
         const std::chrono::milliseconds timeout);
-    ParameterMap FetchInitialParameterSetValuesFrom(const IInternalConfigProvider& internal_config_provider);
+    /// @brief Fetches the changes since the version of cached_set and applies them copy-on-write
+    ///
+    /// With is_content_known the digest of cached_set is sent along, so it is not transferred again if its content
+    /// is unchanged, even if the ConfigDaemon restarted and doesn't know its version anymore.
+    ///
+    Result<std::shared_ptr<const ParameterSet>> GetParameterSetChangesFromInternalConfigProvider(
+        const score::cpp::string_view set_name,
+        const std::shared_ptr<const ParameterSet>& cached_set,
+        const IInternalConfigProvider& internal_config_provider,
+        const std::chrono::milliseconds timeout,
+        const bool is_content_known = false);
+    ParameterSetMap FetchInitialParameterSetValuesFrom(const IInternalConfigProvider& internal_config_provider);
     ResultBlank RegisterUpdateHandlerForParameterSetName(const score::cpp::string_view set_name,
                                                          OnChangedParameterSetCallback&& callback);
     void RegisterCallbacksForPersistedParameterSetNames();
-    void WriteInitialParameterSetValuesToPersistentCache(ParameterMap updated_parameter_sets);
+    void WriteInitialParameterSetValuesToPersistentCache(const ParameterSetMap& fetched_parameter_sets);
+    void RememberUnknownParameterSet(const score::cpp::string_view set_name, const score::result::Error& error);
+    std::unique_lock<std::mutex> LockMutex() noexcept;
+    void CacheParameterSetInPersistency(const ParameterMap& cached_parameter_sets,
+                                        const score::cpp::pmr::string& param_set_key,
+                                        const std::shared_ptr<const ParameterSet>& parameter_set,
+                                        const bool sync_to_storage) noexcept;
+    void SyncPersistencyToStorage() noexcept;
 
     mw::log::Logger& logger_;
     ParameterMap parameter_sets_;
@@ -124,6 +160,18 @@ class ConfigProviderImpl final : public ConfigProvider
     concurrency::InterruptibleConditionalVariable internal_config_provider_cv_;
     score::cpp::pmr::unique_ptr<Persistency> persistency_;
     ClientHandlersMap client_handlers_;
+    // indexed by parameter set identifier, so notifications don't hash the name of their parameter set. The entries
+    // of both maps are never erased, so the cached pointers stay valid until notification_slots_generation_ moves on
+    // with a new client handler or a replaced parameter_sets_
+    score::cpp::pmr::vector<NotificationSlot> notification_slots_;
+    std::uint64_t notification_slots_generation_;
+    NegativeResultCache negative_result_cache_;
+    // cleared once the ConfigDaemon does not offer parameter set changes, updates fetch whole sets from then on
+    bool are_parameter_set_changes_offered_;
+    // cleared once the ConfigDaemon does not offer the binary wire format, whole sets are fetched as JSON from then on
+    bool are_binary_parameter_sets_offered_;
+    ConfigProviderMetricsRecorder metrics_recorder_;
+    ParameterSetNameList prefetch_parameter_set_names_;
     score::cpp::optional<std::size_t> max_samples_limit_;
     score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval_;
     score::cpp::optional<score::cpp::jthread> proxy_available_thread_;
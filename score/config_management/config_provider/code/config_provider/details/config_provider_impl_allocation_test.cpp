@@ -0,0 +1,268 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/config_provider/details/config_provider_impl.h"
+#include "score/config_management/config_provider/code/memory/allocation_tracking.h"
+#include "score/config_management/config_provider/code/memory/tracking_memory_resource.h"
+#include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
+#include "score/config_management/config_provider/code/persistency/persistency.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include "platform/aas/lib/concurrency/future/interruptible_promise.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/detail/common/recorder_factory.h"
+#include "score/mw/log/runtime.h"
+
+#include <gtest/gtest.h>
+
+#include <score/utility.hpp>
+
+#include <memory>
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+namespace
+{
+
+constexpr std::size_t kParametersPerSet{64U};
+
+std::string GetSetName(const std::size_t index)
+{
+    return "set_name_" + std::to_string(index);
+}
+
+std::string GetParameterName(const std::size_t index)
+{
+    return "parameter_" + std::to_string(index);
+}
+
+json::Any CreateSetJson()
+{
+    std::string set{R"({"parameters": {)"};
+    for (std::size_t index = 0U; index < kParametersPerSet; ++index)
+    {
+        set += ((index == 0U) ? "\"" : ", \"") + GetParameterName(index) + "\": " + std::to_string(index) + ".5";
+    }
+    set += R"(}, "qualifier": 1})";
+    return json::JsonParser{}.FromBuffer(set).value();
+}
+
+// Persistency which provides set_count parameter sets, so that GetParameterSet is served from the cache of the
+// ConfigProvider without any connection to the ConfigDaemon
+class PreloadedPersistency final : public Persistency
+{
+  public:
+    PreloadedPersistency(const std::size_t set_count, const bool is_binary) noexcept
+        : Persistency{}, set_count_{set_count}, is_binary_{is_binary}
+    {
+    }
+
+    void ReadCachedParameterSets(ParameterMap& cached_parameter_sets,
+                                 score::cpp::pmr::memory_resource* memory_resource,
+                                 std::unique_ptr<score::filesystem::Filesystem>) noexcept override
+    {
+        for (std::size_t index = 0U; index < set_count_; ++index)
+        {
+            const auto set_name = GetSetName(index);
+            score::cpp::ignore = cached_parameter_sets.emplace(
+                score::cpp::pmr::string{set_name.data(), set_name.size(), memory_resource},
+                CreateParameterSet(memory_resource));
+        }
+    }
+
+    void CacheParameterSet(const ParameterMap&,
+                           const score::cpp::pmr::string,
+                           const std::shared_ptr<const ParameterSet>,
+                           bool) noexcept override
+    {
+    }
+
+    void SyncToStorage() noexcept override {}
+
+  private:
+    std::shared_ptr<const ParameterSet> CreateParameterSet(score::cpp::pmr::memory_resource* memory_resource) const
+    {
+        auto set_json = CreateSetJson();
+        if (!is_binary_)
+        {
+            return std::make_shared<const ParameterSet>(std::move(set_json), memory_resource);
+        }
+        const auto binary_set_storage = std::make_shared<const std::string>(
+            wire_format::EncodeBinarySet(set_json.As<json::Object>().value().get()).value());
+        return std::make_shared<const ParameterSet>(
+            wire_format::BinarySetView::Create(*binary_set_storage).value(), binary_set_storage, memory_resource);
+    }
+
+    const std::size_t set_count_;
+    const bool is_binary_;
+};
+
+}  // namespace
+
+///
+/// @brief Allocation budgets of the hot paths of ConfigProviderImpl and the memory it holds per cached parameter set
+///
+/// Debug records are disabled like on a deployed target, so that the budgets do not include the formatting of logs.
+///
+class ConfigProviderImplAllocationTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mw::log::detail::Configuration config{};
+        config.SetLogMode({mw::LogMode::kConsole});
+        config.SetDefaultConsoleLogLevel(mw::log::LogLevel::kInfo);
+        recorder_ = mw::log::detail::RecorderFactory().CreateRecorderFromLogMode(mw::LogMode::kConsole, config);
+        mw::log::detail::Runtime::SetRecorder(recorder_.get());
+    }
+
+    void TearDown() override
+    {
+        DestroyConfigProvider();
+        mw::log::detail::Runtime::SetRecorder(nullptr);
+    }
+
+    ConfigProviderImpl& CreateConfigProvider(const std::size_t set_count, const bool is_binary = false)
+    {
+        config_provider_ = std::make_unique<ConfigProviderImpl>(
+            promise_.GetInterruptibleFuture().value(),
+            stop_source_.get_token(),
+            &memory_resource_,
+            score::cpp::nullopt,
+            score::cpp::nullopt,
+            IsAvailableNotificationCallback{},
+            score::cpp::pmr::make_unique<PreloadedPersistency>(score::cpp::pmr::get_default_resource(),
+                                                               set_count,
+                                                               is_binary));
+        return *config_provider_;
+    }
+
+    void DestroyConfigProvider()
+    {
+        score::cpp::ignore = stop_source_.request_stop();
+        config_provider_.reset();
+    }
+
+    memory::TrackingMemoryResource memory_resource_{};
+
+  private:
+    std::unique_ptr<mw::log::detail::Recorder> recorder_;
+    concurrency::InterruptiblePromise<std::unique_ptr<IInternalConfigProvider>> promise_;
+    score::cpp::stop_source stop_source_;
+    std::unique_ptr<ConfigProviderImpl> config_provider_;
+};
+
+TEST_F(ConfigProviderImplAllocationTest, GetParameterSetCacheHitDoesNotAllocate)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ConfigProviderImpl::GetParameterSet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that serving a cached parameter set allocates neither from the heap nor from "
+                   "the memory resource of the ConfigProvider.");
+
+    auto& config_provider = CreateConfigProvider(1U);
+    const auto set_name = GetSetName(0U);
+
+    const memory::AllocationScope scope{memory_resource_};
+    const auto parameter_set = config_provider.GetParameterSet(set_name);
+
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_EQ(scope.GetHeapStatistics().allocations, 0U);
+    EXPECT_EQ(scope.GetResourceStatistics().allocations, 0U);
+}
+
+TEST_F(ConfigProviderImplAllocationTest, GetParameterAsFloatDoesNotAllocate)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSet::GetParameterAs()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that reading a float parameter of a parsed or binary parameter set does not "
+                   "allocate.");
+
+    for (const bool is_binary : {false, true})
+    {
+        auto& config_provider = CreateConfigProvider(1U, is_binary);
+        const auto parameter_set = config_provider.GetParameterSet(GetSetName(0U)).value();
+        const auto parameter_name = GetParameterName(kParametersPerSet / 2U);
+        // a parsed set is parsed on its first access
+        ASSERT_TRUE(parameter_set->GetParameterAs<float>(parameter_name).has_value());
+
+        const memory::AllocationScope scope{memory_resource_};
+        const auto value = parameter_set->GetParameterAs<float>(parameter_name);
+
+        ASSERT_TRUE(value.has_value());
+        EXPECT_FLOAT_EQ(value.value(), 32.5F);
+        EXPECT_EQ(scope.GetHeapStatistics().allocations, 0U) << "binary: " << is_binary;
+        EXPECT_EQ(scope.GetResourceStatistics().allocations, 0U) << "binary: " << is_binary;
+        DestroyConfigProvider();
+    }
+}
+
+TEST_F(ConfigProviderImplAllocationTest, ReportsMemoryFootprintPerCachedSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ConfigProviderImpl");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test reports the memory a ConfigProvider holds per cached parameter set of 64 parameters and "
+                   "verifies that the memory of its memory resource is released with it.");
+
+    constexpr std::size_t kSetCount{32U};
+    for (const bool is_binary : {false, true})
+    {
+        const auto measure_live_bytes = [this, is_binary](const std::size_t set_count, std::int64_t& resource_bytes) {
+            const memory::AllocationScope scope{memory_resource_};
+            score::cpp::ignore = CreateConfigProvider(set_count, is_binary);
+            const auto heap_bytes = scope.GetHeapStatistics().GetLiveBytes();
+            resource_bytes = scope.GetResourceStatistics().GetLiveBytes();
+            DestroyConfigProvider();
+            return heap_bytes;
+        };
+        std::int64_t resource_bytes_without_sets{0};
+        std::int64_t resource_bytes_with_sets{0};
+        const auto heap_bytes_without_sets = measure_live_bytes(0U, resource_bytes_without_sets);
+        const auto heap_bytes_with_sets = measure_live_bytes(kSetCount, resource_bytes_with_sets);
+        const auto heap_bytes_per_set =
+            (heap_bytes_with_sets - heap_bytes_without_sets) / static_cast<std::int64_t>(kSetCount);
+        const auto resource_bytes_per_set =
+            (resource_bytes_with_sets - resource_bytes_without_sets) / static_cast<std::int64_t>(kSetCount);
+
+        const std::string format{is_binary ? "Binary" : "Json"};
+        RecordProperty(format + "HeapBytesPerCachedSet", std::to_string(heap_bytes_per_set));
+        RecordProperty(format + "ResourceBytesPerCachedSet", std::to_string(resource_bytes_per_set));
+        EXPECT_GT(heap_bytes_per_set + resource_bytes_per_set, 0) << "binary: " << is_binary;
+        EXPECT_EQ(memory_resource_.GetStatistics().GetLiveBytes(), 0) << "binary: " << is_binary;
+    }
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
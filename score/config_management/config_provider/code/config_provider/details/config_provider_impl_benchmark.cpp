@@ -0,0 +1,174 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/details/config_provider_impl.h"
+#include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
+#include "score/config_management/config_provider/code/persistency/persistency.h"
+
+#include "platform/aas/lib/concurrency/future/interruptible_promise.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/detail/common/recorder_factory.h"
+#include "score/mw/log/runtime.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/utility.hpp>
+
+#include <memory>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+constexpr score::cpp::string_view kSetName{"set_name"};
+
+// Persistency which provides one parameter set, so that GetParameterSet is served from the in-memory cache without
+// any connection to the ConfigDaemon
+class PreloadedPersistency final : public Persistency
+{
+  public:
+    void ReadCachedParameterSets(ParameterMap& cached_parameter_sets,
+                                 score::cpp::pmr::memory_resource* memory_resource,
+                                 std::unique_ptr<score::filesystem::Filesystem>) noexcept override
+    {
+        auto parameter_set_json = json::JsonParser{}.FromBuffer(R"(
+        {
+            "parameters": {
+                "parameter_name": 55,
+                "array_parameter": [1, 2, 3, 4, 5, 6, 7, 8],
+                "string_parameter": "some string value"
+            },
+            "qualifier": 1
+        })");
+        score::cpp::ignore = cached_parameter_sets.emplace(
+            score::cpp::pmr::string{kSetName.data(), kSetName.size(), memory_resource},
+            std::make_shared<const ParameterSet>(std::move(parameter_set_json).value(), memory_resource));
+    }
+
+    void CacheParameterSet(const ParameterMap&,
+                           const score::cpp::pmr::string,
+                           const std::shared_ptr<const ParameterSet>,
+                           bool) noexcept override
+    {
+    }
+
+    void SyncToStorage() noexcept override {}
+};
+
+class ConfigProviderBenchmark
+{
+  public:
+    explicit ConfigProviderBenchmark(const mw::log::LogLevel log_level)
+    {
+        mw::log::detail::Configuration config{};
+        config.SetLogMode({mw::LogMode::kConsole});
+        config.SetDefaultConsoleLogLevel(log_level);
+        recorder_ = mw::log::detail::RecorderFactory().CreateRecorderFromLogMode(mw::LogMode::kConsole, config);
+        mw::log::detail::Runtime::SetRecorder(recorder_.get());
+
+        config_provider_ = std::make_unique<ConfigProviderImpl>(
+            promise_.GetInterruptibleFuture().value(),
+            stop_source_.get_token(),
+            score::cpp::pmr::get_default_resource(),
+            score::cpp::nullopt,
+            score::cpp::nullopt,
+            IsAvailableNotificationCallback{},
+            score::cpp::pmr::make_unique<PreloadedPersistency>(score::cpp::pmr::get_default_resource()));
+    }
+
+    ConfigProviderBenchmark(ConfigProviderBenchmark&&) = delete;
+    ConfigProviderBenchmark(const ConfigProviderBenchmark&) = delete;
+    ConfigProviderBenchmark& operator=(ConfigProviderBenchmark&&) = delete;
+    ConfigProviderBenchmark& operator=(const ConfigProviderBenchmark&) = delete;
+
+    ~ConfigProviderBenchmark()
+    {
+        score::cpp::ignore = stop_source_.request_stop();
+        config_provider_.reset();
+        mw::log::detail::Runtime::SetRecorder(nullptr);
+    }
+
+    ConfigProvider& Get() noexcept
+    {
+        return *config_provider_;
+    }
+
+  private:
+    std::unique_ptr<mw::log::detail::Recorder> recorder_;
+    concurrency::InterruptiblePromise<std::unique_ptr<IInternalConfigProvider>> promise_;
+    score::cpp::stop_source stop_source_;
+    std::unique_ptr<ConfigProviderImpl> config_provider_;
+};
+
+mw::log::LogLevel ToLogLevel(const benchmark::State& state)
+{
+    return (state.range(0) != 0) ? mw::log::LogLevel::kDebug : mw::log::LogLevel::kInfo;
+}
+
+// Cache hit in GetParameterSet, the most frequent call of clients
+void BM_GetParameterSetCacheHit(benchmark::State& state)
+{
+    ConfigProviderBenchmark fixture{ToLogLevel(state)};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.Get().GetParameterSet(kSetName));
+    }
+}
+BENCHMARK(BM_GetParameterSetCacheHit)->ArgName("debug")->Arg(0)->Arg(1);
+
+// Existing parameter read from a cached parameter set
+void BM_GetParameterAsFound(benchmark::State& state)
+{
+    ConfigProviderBenchmark fixture{ToLogLevel(state)};
+    const auto parameter_set = fixture.Get().GetParameterSet(kSetName).value();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parameter_set->GetParameterAs<std::uint32_t>("parameter_name"));
+    }
+}
+BENCHMARK(BM_GetParameterAsFound)->ArgName("debug")->Arg(0)->Arg(1);
+
+// Probe for an optional parameter which does not exist, i.e. the error path of GetParameterAs
+void BM_GetParameterAsNotFound(benchmark::State& state)
+{
+    ConfigProviderBenchmark fixture{ToLogLevel(state)};
+    const auto parameter_set = fixture.Get().GetParameterSet(kSetName).value();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parameter_set->GetParameterAs<std::uint32_t>("optional_parameter"));
+    }
+}
+BENCHMARK(BM_GetParameterAsNotFound)->ArgName("debug")->Arg(0)->Arg(1);
+
+// Conversion failure, which formats the requested C++ type into the error record
+void BM_GetParameterAsWrongType(benchmark::State& state)
+{
+    ConfigProviderBenchmark fixture{ToLogLevel(state)};
+    const auto parameter_set = fixture.Get().GetParameterSet(kSetName).value();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parameter_set->GetParameterAs<std::uint32_t>("string_parameter"));
+    }
+}
+BENCHMARK(BM_GetParameterAsWrongType)->ArgName("debug")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
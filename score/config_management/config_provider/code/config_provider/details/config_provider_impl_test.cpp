@@ -16,6 +16,7 @@
 #include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
 #include "score/config_management/config_provider/code/persistency/persistency_mock.h"
 #include "score/config_management/config_provider/code/proxies/internal_config_provider_mock.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
 
 #include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
 
@@ -31,6 +32,8 @@
 
 #include <future>
 #include <memory>
+#include <string>
+#include <thread>
 
 namespace score
 {
@@ -124,11 +127,25 @@ class ConfigProviderTest : public ::testing::Test
     {
         promise_.SetError(static_cast<score::result::Error>(ConfigProviderError::kProxyNotReady));
     }
+    void SetUpBinaryParameterSets()
+    {
+        EXPECT_CALL(*icp_mock_, GetParameterSetAsBinary(_, _))
+            .WillRepeatedly(Invoke([this](const score::cpp::string_view,
+                                          const std::chrono::milliseconds) -> Result<score::cpp::pmr::string> {
+                if (binary_parameter_set_from_proxy_.has_value())
+                {
+                    return score::cpp::pmr::string{binary_parameter_set_from_proxy_.value().data(),
+                                                   binary_parameter_set_from_proxy_.value().size()};
+                }
+                return Unexpected{binary_parameter_set_from_proxy_.error()};
+            }));
+    }
     void SetUpProxyButProxyCouldNotProvideInitialQualifierStateOnFirstRequest()
     {
         std::unique_ptr<InternalConfigProviderMock> internal_config_provider =
             std::make_unique<InternalConfigProviderMock>();
         icp_mock_ = internal_config_provider.get();
+        SetUpBinaryParameterSets();
         EXPECT_CALL(*icp_mock_, TrySubscribeToLastUpdatedParameterSetEvent(_, _)).WillOnce(Return(true));
 
         EXPECT_CALL(*icp_mock_, GetInitialQualifierState(ConfigProviderImpl::kDefaultResponseTimeout))
@@ -145,6 +162,7 @@ class ConfigProviderTest : public ::testing::Test
         std::unique_ptr<InternalConfigProviderMock> internal_config_provider =
             std::make_unique<InternalConfigProviderMock>();
         icp_mock_ = internal_config_provider.get();
+        SetUpBinaryParameterSets();
         EXPECT_CALL(*icp_mock_, TrySubscribeToLastUpdatedParameterSetEvent(_, _))
             .WillOnce(Invoke(
                 [this](const score::cpp::stop_token&, IInternalConfigProvider::OnChangedParameterSetCallback&& callback) {
@@ -171,6 +189,19 @@ class ConfigProviderTest : public ::testing::Test
             GetParameterSet(StringViewCompare("invalid_parameter_set"), ConfigProviderImpl::kDefaultResponseTimeout))
             .WillRepeatedly(Return(ByMove(Result<json::Any>{json::Any{}})));
 
+        EXPECT_CALL(*icp_mock_, GetParameterSetChanges(_, _, _, _))
+            .WillRepeatedly(Invoke([this](const score::cpp::string_view,
+                                          const std::uint64_t,
+                                          const std::uint64_t base_digest,
+                                          const std::chrono::milliseconds) -> Result<json::Any> {
+                requested_base_digest_ = base_digest;
+                if (parameter_set_changes_from_proxy_.has_value())
+                {
+                    return Result<json::Any>{parameter_set_changes_from_proxy_.value().CloneByValue()};
+                }
+                return Unexpected{parameter_set_changes_from_proxy_.error()};
+            }));
+
         EXPECT_CALL(*icp_mock_, GetInitialQualifierState(ConfigProviderImpl::kDefaultResponseTimeout))
             .WillRepeatedly(Return(final_initial_qualifier_state));
         EXPECT_CALL(*icp_mock_, StopParameterSetUpdatePollingRoutine()).Times(1);
@@ -187,8 +218,24 @@ class ConfigProviderTest : public ::testing::Test
                                                     std::move(persistency_));
     }
 
+    /// @brief Notifies a changed parameter set like the proxy, which passes the same identifier for the same name
+    void NotifyParameterSetChanged(const score::cpp::string_view set_name)
+    {
+        ParameterSetId set_id{0U};
+        {
+            const std::lock_guard<std::mutex> lock{notified_parameter_sets_mutex_};
+            set_id = notified_parameter_sets_.FindOrAssign(set_name);
+        }
+        registered_on_changed_parameter_set_callback_(set_id, set_name);
+    }
+
     score::Result<score::json::Any> correct_parameter_set_from_proxy_;
     score::Result<score::json::Any> updated_parameter_set_from_proxy_;
+    score::Result<score::json::Any> parameter_set_changes_from_proxy_{
+        MakeUnexpected(ConfigProviderError::kMethodNotSupported)};
+    score::Result<std::string> binary_parameter_set_from_proxy_{
+        MakeUnexpected(ConfigProviderError::kMethodNotSupported)};
+    std::atomic<std::uint64_t> requested_base_digest_{0U};
     const std::string parameter_set_name_ = "set_name";
     const std::string parameter_name_ = "parameter_name";
     const int updated_content_from_proxy_ = 56;
@@ -210,6 +257,8 @@ class ConfigProviderTest : public ::testing::Test
     PersistencyMock* persistency_mock_{nullptr};
     score::cpp::pmr::unique_ptr<PersistencyMock> persistency_;
     IInternalConfigProvider::OnChangedParameterSetCallback registered_on_changed_parameter_set_callback_{nullptr};
+    ParameterSetDictionary notified_parameter_sets_;
+    std::mutex notified_parameter_sets_mutex_;
 };
 
 TEST_F(ConfigProviderTest, ProxySearchingBlocked_ClientDoNotWait_EmptyPersistency)
@@ -572,6 +621,7 @@ TEST_F(ConfigProviderTest, SubscribeBeforeGettingDataFromProxy)
     std::unique_ptr<InternalConfigProviderMock> internal_config_provider =
         std::make_unique<InternalConfigProviderMock>();
     icp_mock_ = internal_config_provider.get();
+    SetUpBinaryParameterSets();
     promise_.SetValue(std::move(internal_config_provider));
     {
         InSequence s;
@@ -603,6 +653,7 @@ TEST_F(ConfigProviderTest, FailedToSubscribe)
     std::unique_ptr<InternalConfigProviderMock> internal_config_provider =
         std::make_unique<InternalConfigProviderMock>();
     icp_mock_ = internal_config_provider.get();  // Before the proxy is available
+    SetUpBinaryParameterSets();
     promise_.SetValue(std::move(internal_config_provider));
     EXPECT_CALL(*icp_mock_, TrySubscribeToLastUpdatedParameterSetEvent(_, _)).WillOnce(Return(false));
 
@@ -637,6 +688,7 @@ TEST_F(ConfigProviderTest, SubscribeWithEmptyCallback)
     std::unique_ptr<InternalConfigProviderMock> internal_config_provider =
         std::make_unique<InternalConfigProviderMock>();
     icp_mock_ = internal_config_provider.get();
+    SetUpBinaryParameterSets();
     promise_.SetValue(std::move(internal_config_provider));
     EXPECT_CALL(*icp_mock_, TrySubscribeToLastUpdatedParameterSetEvent(_, _)).WillOnce(Return(true));
     EXPECT_CALL(*icp_mock_,
@@ -737,7 +789,7 @@ TEST_F(ConfigProviderTest, Success_LastUpdatedParameterSetReceiveHandler)
 
     EXPECT_TRUE(parameter_set_result.has_value());
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
     EXPECT_TRUE(check_flag);
 }
 
@@ -773,12 +825,49 @@ TEST_F(ConfigProviderTest, Success_UserCallbackOverridesEmptyCallback)
 
     // trigger the callback through the LastUpdatedParameterSetReceiveHandler
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
 
     // verify that the user provided callback was called
     EXPECT_TRUE(check_flag);
 }
 
+TEST_F(ConfigProviderTest, LastUpdatedParameterSetReceiveHandlerCallsHandlerRegisteredAfterNotification)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Verification of the control flow and data flow");
+    RecordProperty("Verifies",
+                   "::score::platform::config_provider::ConfigProviderImpl::LastUpdatedParameterSetReceiveHandler()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a parameter set notified without a registered callback is still "
+                   "delivered to a callback registered afterwards, so the entries cached per identifier of the "
+                   "parameter set are refreshed on registration.");
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+
+    BlockUntilProxyIsReady(stop_source_.get_token());
+    ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
+    NotifyParameterSetChanged(parameter_set_name_);
+
+    std::size_t callback_calls{0U};
+    const auto parameter_set_result = config_provider->OnChangedParameterSet(
+        parameter_set_name_, [&callback_calls](std::shared_ptr<const ParameterSet>) noexcept {
+            ++callback_calls;
+        });
+    ASSERT_TRUE(parameter_set_result.has_value());
+
+    NotifyParameterSetChanged(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
+    EXPECT_EQ(callback_calls, 2U);
+    const auto parameter_set = config_provider->GetParameterSet(parameter_set_name_);
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<std::uint32_t>(parameter_name_).value(),
+              parameter_content_from_proxy_);
+}
+
 TEST_F(ConfigProviderTest, Success_LastUpdatedParameterSetReceiveHandlerCalledForParameterSetWithNoCallback)
 {
     RecordProperty("Priority", "3");
@@ -827,7 +916,7 @@ TEST_F(ConfigProviderTest, Success_LastUpdatedParameterSetReceiveHandlerCalledFo
                   .value(),
               parameter_content_from_proxy_);
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
 }
 
 TEST_F(ConfigProviderTest, Success_LastUpdatedParameterSetReceiveHandlerCalledTwiceWithSameParameterSet)
@@ -883,9 +972,9 @@ TEST_F(ConfigProviderTest, Success_LastUpdatedParameterSetReceiveHandlerCalledTw
                                             })
                     .has_value());
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
     EXPECT_EQ(callback_number, 1);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
     EXPECT_EQ(callback_number, 2);
 }
 
@@ -942,7 +1031,7 @@ TEST_F(ConfigProviderTest, Success_LastUpdatedParameterSetReceiveHandlerCalledTw
         });
     EXPECT_TRUE(parameter_set_result_1.has_value());
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(set_name_1);
+    NotifyParameterSetChanged(set_name_1);
     EXPECT_EQ(callback_number, 1);
 
     const auto parameter_set_result_2 = config_provider->OnChangedParameterSet(
@@ -953,7 +1042,7 @@ TEST_F(ConfigProviderTest, Success_LastUpdatedParameterSetReceiveHandlerCalledTw
             EXPECT_EQ(parameter_set_value.value(), 66);
         });
     EXPECT_TRUE(parameter_set_result_2.has_value());
-    registered_on_changed_parameter_set_callback_(set_name_2);
+    NotifyParameterSetChanged(set_name_2);
     EXPECT_EQ(callback_number, 2);
 }
 
@@ -988,7 +1077,7 @@ TEST_F(ConfigProviderTest, LastUpdatedParameterSetReceiveHandlerFailedToGetParam
 
     EXPECT_TRUE(parameter_set_result.has_value());
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_("wrong_set_name");
+    NotifyParameterSetChanged("wrong_set_name");
     EXPECT_FALSE(check_flag);
 }
 
@@ -1092,6 +1181,283 @@ TEST_F(ConfigProviderTest, ProxySearchingSuccess_ClientWait_EmptyPersistency_Wro
     EXPECT_TRUE(config_provider->GetParameterSet("invalid_parameter_set", std::nullopt).has_value());
 }
 
+TEST_F(ConfigProviderTest, UnknownParameterSetIsRememberedUntilAnnounced)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::GetParameterSet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that a ParameterSet unknown to the daemon is requested from the proxy only once. "
+                   "Repeated requests are answered from the negative result cache with the same error until the "
+                   "daemon announces an update for that ParameterSet.");
+
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    EXPECT_CALL(*icp_mock_,
+                GetParameterSet(StringViewCompare("unknown_set_name"), ConfigProviderImpl::kDefaultResponseTimeout))
+        .Times(2)
+        .WillRepeatedly(Invoke([](const score::cpp::string_view, const std::chrono::milliseconds) -> Result<json::Any> {
+            return MakeUnexpected(ConfigProviderError::kProxyReturnedNoResult);
+        }));
+    EXPECT_CALL(
+        *icp_mock_,
+        GetParameterSet(StringViewCompare("unknown_listed_set_name"), ConfigProviderImpl::kDefaultResponseTimeout))
+        .WillOnce(Return(ByMove(MakeUnexpected(ConfigProviderError::kProxyReturnedNoResult))));
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_EQ(config_provider->GetParameterSet("unknown_set_name", std::nullopt).error(),
+              ConfigProviderError::kProxyReturnedNoResult);
+    EXPECT_EQ(config_provider->GetParameterSet("unknown_set_name", std::nullopt).error(),
+              ConfigProviderError::kProxyReturnedNoResult);
+
+    score::cpp::pmr::vector<score::cpp::string_view> set_names{"unknown_set_name"};
+    const auto parameter_set_map = config_provider->GetParameterSetsByNameList(set_names, std::nullopt);
+    EXPECT_EQ(parameter_set_map.at(score::cpp::pmr::string{"unknown_set_name"}).error(),
+              ConfigProviderError::kProxyReturnedNoResult);
+
+    // the first request by name list reports the error of the proxy, like the remembered repeat does
+    score::cpp::pmr::vector<score::cpp::string_view> listed_set_names{"unknown_listed_set_name"};
+    for (std::size_t request = 0U; request < 2U; ++request)
+    {
+        const auto listed_parameter_set_map =
+            config_provider->GetParameterSetsByNameList(listed_set_names, std::nullopt);
+        EXPECT_EQ(listed_parameter_set_map.at(score::cpp::pmr::string{"unknown_listed_set_name"}).error(),
+                  ConfigProviderError::kProxyReturnedNoResult);
+    }
+
+    ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
+    NotifyParameterSetChanged("unknown_set_name");
+    EXPECT_EQ(config_provider->GetParameterSet("unknown_set_name", std::nullopt).error(),
+              ConfigProviderError::kProxyReturnedNoResult);
+
+    const auto statistics = config_provider->GetNegativeResultCacheStatistics();
+    EXPECT_EQ(statistics.hits, 3U);
+    EXPECT_EQ(statistics.misses, 3U);
+    EXPECT_EQ(statistics.size, 2U);
+}
+
+TEST_F(ConfigProviderTest, TransientProxyErrorIsNotRemembered)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::GetParameterSet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that a failed request which does not indicate an unknown ParameterSet, e.g. a "
+                   "proxy timeout, is not stored in the negative result cache.");
+
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    EXPECT_CALL(*icp_mock_,
+                GetParameterSet(StringViewCompare("slow_set_name"), ConfigProviderImpl::kDefaultResponseTimeout))
+        .Times(2)
+        .WillRepeatedly(Invoke([](const score::cpp::string_view, const std::chrono::milliseconds) -> Result<json::Any> {
+            return MakeUnexpected(ConfigProviderError::kProxyAccessTimeout);
+        }));
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_EQ(config_provider->GetParameterSet("slow_set_name", std::nullopt).error(),
+              ConfigProviderError::kProxyAccessTimeout);
+    EXPECT_EQ(config_provider->GetParameterSet("slow_set_name", std::nullopt).error(),
+              ConfigProviderError::kProxyAccessTimeout);
+
+    const auto statistics = config_provider->GetNegativeResultCacheStatistics();
+    EXPECT_EQ(statistics.hits, 0U);
+    EXPECT_EQ(statistics.misses, 2U);
+    EXPECT_EQ(statistics.size, 0U);
+}
+
+TEST_F(ConfigProviderTest, BinaryParameterSetIsFetchedInsteadOfJson)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::GetParameterSet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that a ParameterSet is built from the binary wire format if the proxy offers it, "
+                   "without fetching its JSON representation.");
+
+    binary_parameter_set_from_proxy_ = wire_format::EncodeBinarySet(
+        updated_parameter_set_from_proxy_.value().As<json::Object>().value().get());
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    EXPECT_CALL(*icp_mock_, GetParameterSet(StringViewCompare(parameter_set_name_), _)).Times(0);
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    const auto parameter_set = config_provider->GetParameterSet(parameter_set_name_);
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<std::uint32_t>(parameter_name_).value(),
+              updated_content_from_proxy_);
+    EXPECT_EQ(parameter_set.value()->GetQualifier().value(), updated_qualifier_from_proxy_);
+}
+
+TEST_F(ConfigProviderTest, InvalidBinaryParameterSetIsReportedAsParsingFailure)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::GetParameterSet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that a received buffer which is not a valid binary ParameterSet is rejected.");
+
+    binary_parameter_set_from_proxy_ = std::string{"invalid"};
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_EQ(config_provider->GetParameterSet(parameter_set_name_).error(), ConfigProviderError::kParsingFailed);
+}
+
+TEST_F(ConfigProviderTest, BinaryParameterSetsAreNotRequestedAgainOnceNotOffered)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::GetParameterSet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that the ConfigProvider falls back to the JSON representation once the proxy does "
+                   "not offer binary ParameterSets and does not request them again.");
+
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    EXPECT_CALL(*icp_mock_, GetParameterSetAsBinary(_, _))
+        .WillOnce(Return(ByMove(MakeUnexpected(ConfigProviderError::kMethodNotSupported))));
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_EQ(config_provider->GetParameterSet("wrong_set_name", std::nullopt).error(),
+              ConfigProviderError::kProxyReturnedNoResult);
+    EXPECT_EQ(config_provider->GetParameterSet(parameter_set_name_)
+                  .value()
+                  ->GetParameterAs<std::uint32_t>(parameter_name_)
+                  .value(),
+              parameter_content_from_proxy_);
+}
+
+TEST_F(ConfigProviderTest, PrefetchedParameterSetsAreCachedBeforeAvailabilityNotification)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::SetupInternalConfigProvider()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that the ParameterSets given in the prefetch list are fetched once the proxy is "
+                   "connected and before the availability notification is sent, so that the first GetParameterSet "
+                   "call is served from the cache. Unknown prefetched ParameterSets are remembered as unavailable.");
+
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    EXPECT_CALL(*icp_mock_,
+                GetParameterSet(StringViewCompare(parameter_set_name_), ConfigProviderImpl::kDefaultResponseTimeout))
+        .WillOnce(Invoke([this](const score::cpp::string_view, const std::chrono::milliseconds) -> Result<json::Any> {
+            return correct_parameter_set_from_proxy_.value().CloneByValue();
+        }));
+    EXPECT_CALL(*icp_mock_,
+                GetParameterSet(StringViewCompare("unknown_set_name"), ConfigProviderImpl::kDefaultResponseTimeout))
+        .WillOnce(Invoke([](const score::cpp::string_view, const std::chrono::milliseconds) -> Result<json::Any> {
+            return MakeUnexpected(ConfigProviderError::kProxyReturnedNoResult);
+        }));
+    EXPECT_CALL(*persistency_, SyncToStorage()).Times(1);
+
+    std::atomic<std::size_t> cached_count_on_notification{0U};
+    ConfigProviderImpl* config_provider_ptr{nullptr};
+    std::mutex config_provider_ptr_mutex;
+    ParameterSetNameList prefetch_parameter_set_names{"set_name", "unknown_set_name", "set_name"};
+    std::unique_lock<std::mutex> config_provider_ptr_lock{config_provider_ptr_mutex};
+    auto config_provider = std::make_unique<ConfigProviderImpl>(
+        promise_.GetInterruptibleFuture().value(),
+        stop_source_.get_token(),
+        score::cpp::pmr::get_default_resource(),
+        score::cpp::nullopt,
+        score::cpp::nullopt,
+        [&]() noexcept {
+            std::lock_guard<std::mutex> lock{config_provider_ptr_mutex};
+            cached_count_on_notification = config_provider_ptr->GetCachedParameterSetsCount();
+            UnblockMakeProxyAvailable();
+        },
+        std::move(persistency_),
+        std::move(prefetch_parameter_set_names));
+    config_provider_ptr = config_provider.get();
+    config_provider_ptr_lock.unlock();
+
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_EQ(cached_count_on_notification, 1U);
+    const auto parameter_set_result = config_provider->GetParameterSet(parameter_set_name_, std::nullopt);
+    ASSERT_TRUE(parameter_set_result.has_value());
+    EXPECT_EQ(parameter_set_result.value()->GetParameterAs<std::uint32_t>(parameter_name_).value(),
+              parameter_content_from_proxy_);
+    EXPECT_EQ(config_provider->GetParameterSet("unknown_set_name", std::nullopt).error(),
+              ConfigProviderError::kProxyReturnedNoResult);
+}
+
+TEST_F(ConfigProviderTest, InitialParameterSetsAreFetchedWithoutHoldingTheLock)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::SetupInternalConfigProvider()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that the ConfigProvider stays accessible while the initial values of the "
+                   "prefetched ParameterSets are requested from the proxy.");
+
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    ConfigProviderImpl* config_provider_ptr{nullptr};
+    std::mutex config_provider_ptr_mutex;
+    // the accessing thread is joined after the fetch, so a fetch holding the lock fails the test instead of hanging
+    std::thread accessing_thread{};
+    std::promise<std::size_t> cached_count_during_fetch{};
+    auto cached_count_during_fetch_future = cached_count_during_fetch.get_future();
+    EXPECT_CALL(*icp_mock_,
+                GetParameterSet(StringViewCompare(parameter_set_name_), ConfigProviderImpl::kDefaultResponseTimeout))
+        .WillOnce(Invoke([&](const score::cpp::string_view, const std::chrono::milliseconds) -> Result<json::Any> {
+            std::lock_guard<std::mutex> lock{config_provider_ptr_mutex};
+            accessing_thread = std::thread{[&cached_count_during_fetch, config_provider = config_provider_ptr]() {
+                cached_count_during_fetch.set_value(config_provider->GetCachedParameterSetsCount());
+            }};
+            EXPECT_EQ(cached_count_during_fetch_future.wait_for(std::chrono::seconds{1}), std::future_status::ready);
+            return correct_parameter_set_from_proxy_.value().CloneByValue();
+        }));
+    EXPECT_CALL(*persistency_, SyncToStorage()).Times(1);
+
+    std::unique_lock<std::mutex> config_provider_ptr_lock{config_provider_ptr_mutex};
+    auto config_provider = std::make_unique<ConfigProviderImpl>(
+        promise_.GetInterruptibleFuture().value(),
+        stop_source_.get_token(),
+        score::cpp::pmr::get_default_resource(),
+        score::cpp::nullopt,
+        score::cpp::nullopt,
+        [&]() noexcept {
+            UnblockMakeProxyAvailable();
+        },
+        std::move(persistency_),
+        ParameterSetNameList{"set_name"});
+    config_provider_ptr = config_provider.get();
+    config_provider_ptr_lock.unlock();
+
+    BlockUntilProxyIsReady(stop_source_.get_token());
+    accessing_thread.join();
+
+    EXPECT_EQ(cached_count_during_fetch_future.get(), 0U);
+    EXPECT_EQ(config_provider->GetCachedParameterSetsCount(), 1U);
+}
+
 TEST_F(ConfigProviderTest, SuccessLastUpdatedParameterSetPersistedInCache)
 {
     RecordProperty("Priority", "3");
@@ -1124,7 +1490,7 @@ TEST_F(ConfigProviderTest, SuccessLastUpdatedParameterSetPersistedInCache)
 
     EXPECT_TRUE(parameter_set_result.has_value());
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
 
     const auto provider_parameter_set_result = config_provider->GetParameterSet(parameter_set_name_);
     EXPECT_EQ(provider_parameter_set_result.value()->GetParameterAs<std::uint32_t>(parameter_name_).value(),
@@ -1240,6 +1606,102 @@ TEST_F(ConfigProviderTest, Test_FailedFetchInitialParameterSetValuesFrom)
     BlockUntilProxyIsReady(stop_source_.get_token());
 }
 
+TEST_F(ConfigProviderTest, FetchInitialParameterSetValuesFromKeepsUnmodifiedCachedParameterSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::platform::config_provider::ConfigProviderImpl::FetchInitialParameterSetValuesFrom()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a persisted parameter set is requested with its digest when the proxy "
+                   "connects and is kept with the served version if the daemon reports it as not modified.");
+    SetUpPersistency();
+    parameter_set_changes_from_proxy_ = json::JsonParser{}.FromBuffer(R"({"version": 20, "is_modified": false})");
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    const auto persisted_set_json = json::JsonParser{}.FromBuffer(R"(
+        {"parameters": {"parameter_name": 54}, "qualifier": 0})");
+    const auto persisted_set_digest = ParameterSet{persisted_set_json.value().CloneByValue()}.GetDigest();
+    ASSERT_TRUE(persisted_set_digest.has_value());
+    EXPECT_EQ(requested_base_digest_, persisted_set_digest.value());
+
+    const auto parameter_set = config_provider->GetParameterSet(parameter_set_name_);
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_EQ(parameter_set.value()->GetVersion(), score::cpp::optional<std::uint64_t>{20U});
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<std::int32_t>(parameter_name_).value(),
+              parameter_content_from_persistency_);
+    EXPECT_EQ(parameter_set.value()->GetQualifier().value(), parameter_qualifier_from_persistency_);
+}
+
+TEST_F(ConfigProviderTest, FetchInitialParameterSetValuesFromKeepsCachedParameterSetThatIsNotReady)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::platform::config_provider::ConfigProviderImpl::FetchInitialParameterSetValuesFrom()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a persisted parameter set stays cached if the daemon has not loaded it yet "
+                   "when the proxy connects, while the other fetched parameter sets are merged into the cache.");
+    SetUpPersistency();
+    const Result<json::Any> not_ready_parameter_set{MakeUnexpected(ConfigProviderError::kProxyNotReady)};
+    SetUpProxy(parameter_set_name_, not_ready_parameter_set);
+    EXPECT_CALL(*icp_mock_,
+                GetParameterSet(StringViewCompare("prefetched_set_name"), ConfigProviderImpl::kDefaultResponseTimeout))
+        .WillOnce(Invoke([this](const score::cpp::string_view, const std::chrono::milliseconds) -> Result<json::Any> {
+            return correct_parameter_set_from_proxy_.value().CloneByValue();
+        }));
+    auto config_provider = std::make_unique<ConfigProviderImpl>(
+        promise_.GetInterruptibleFuture().value(),
+        stop_source_.get_token(),
+        score::cpp::pmr::get_default_resource(),
+        score::cpp::nullopt,
+        score::cpp::nullopt,
+        [this]() noexcept {
+            UnblockMakeProxyAvailable();
+        },
+        std::move(persistency_),
+        ParameterSetNameList{"prefetched_set_name"});
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_EQ(config_provider->GetCachedParameterSetsCount(), 2U);
+    const auto parameter_set = config_provider->GetParameterSet(parameter_set_name_);
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<std::int32_t>(parameter_name_).value(),
+              parameter_content_from_persistency_);
+}
+
+TEST_F(ConfigProviderTest, FetchInitialParameterSetValuesFromDropsCachedParameterSetThatIsUnknown)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::platform::config_provider::ConfigProviderImpl::FetchInitialParameterSetValuesFrom()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a persisted parameter set is dropped from the cache if the daemon does not "
+                   "know it anymore when the proxy connects.");
+    SetUpPersistency();
+    const Result<json::Any> unknown_parameter_set{MakeUnexpected(ConfigProviderError::kProxyReturnedNoResult)};
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    SetUpProxy(parameter_set_name_, unknown_parameter_set);
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_EQ(config_provider->GetCachedParameterSetsCount(), 0U);
+    EXPECT_EQ(config_provider->GetParameterSet(parameter_set_name_).error(),
+              ConfigProviderError::kProxyReturnedNoResult);
+}
+
 TEST_F(ConfigProviderTest, Test_FailLastUpdatedParameterSetReceiveHandler)
 {
     RecordProperty("Priority", "3");
@@ -1262,7 +1724,7 @@ TEST_F(ConfigProviderTest, Test_FailLastUpdatedParameterSetReceiveHandler)
 
     EXPECT_TRUE(parameter_set_result.has_value());
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
 }
 TEST_F(ConfigProviderTest, LastUpdatedParameterSetFailedGetParameterSet)
 {
@@ -1290,7 +1752,58 @@ TEST_F(ConfigProviderTest, LastUpdatedParameterSetFailedGetParameterSet)
 
     EXPECT_TRUE(parameter_set_result.has_value());
     ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
-    registered_on_changed_parameter_set_callback_(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
+}
+
+TEST_F(ConfigProviderTest, LastUpdatedParameterSetReceiveHandlerAppliesChangesToCachedParameterSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::platform::config_provider::ConfigProviderImpl::LastUpdatedParameterSetReceiveHandler()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that an update first fetches the complete set with its version and afterwards "
+                   "only the changes since that version, which are applied to the cached parameter set.");
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    EXPECT_CALL(*icp_mock_, GetParameterSet(StringViewCompare(parameter_set_name_), _)).Times(0);
+    EXPECT_CALL(*icp_mock_, GetParameterSetChanges(StringViewCompare(parameter_set_name_), 0U, 0U, _))
+        .WillOnce(Return(ByMove(json::JsonParser{}.FromBuffer(R"(
+            {"version": 10, "is_complete": true, "parameters": {"parameter_name": 55, "other": 1}, "qualifier": 1}
+        )"))));
+    EXPECT_CALL(*icp_mock_, GetParameterSetChanges(StringViewCompare(parameter_set_name_), 10U, 0U, _))
+        .WillOnce(Return(ByMove(json::JsonParser{}.FromBuffer(R"(
+            {"version": 11, "is_complete": false, "parameters": {"parameter_name": 56},
+             "removed_parameters": ["other"], "qualifier": 3}
+        )"))));
+
+    std::vector<std::shared_ptr<const ParameterSet>> received_parameter_sets{};
+    ASSERT_TRUE(config_provider
+                    ->OnChangedParameterSet(parameter_set_name_,
+                                            [&](std::shared_ptr<const ParameterSet> parameter_set) noexcept {
+                                                received_parameter_sets.push_back(std::move(parameter_set));
+                                            })
+                    .has_value());
+    ASSERT_NE(registered_on_changed_parameter_set_callback_, nullptr);
+    NotifyParameterSetChanged(parameter_set_name_);
+    NotifyParameterSetChanged(parameter_set_name_);
+
+    ASSERT_EQ(received_parameter_sets.size(), 2U);
+    EXPECT_EQ(received_parameter_sets[0]->GetVersion(), score::cpp::optional<std::uint64_t>{10U});
+    EXPECT_EQ(received_parameter_sets[0]->GetParameterAs<std::uint32_t>("other").value(), 1U);
+    EXPECT_EQ(received_parameter_sets[1]->GetVersion(), score::cpp::optional<std::uint64_t>{11U});
+    EXPECT_EQ(received_parameter_sets[1]->GetParameterAs<std::uint32_t>(parameter_name_).value(),
+              updated_content_from_proxy_);
+    EXPECT_EQ(received_parameter_sets[1]->GetParameterAs<std::uint32_t>("other").error(),
+              ConfigProviderError::kParameterNotFound);
+    EXPECT_EQ(received_parameter_sets[1]->GetQualifier().value(), updated_qualifier_from_proxy_);
+    EXPECT_EQ(config_provider->GetParameterSet(parameter_set_name_).value(), received_parameter_sets[1]);
 }
 
 TEST_F(ConfigProviderTest, GetParameterSetsByNameList_ProxyNotReady)
@@ -1464,7 +1977,7 @@ TEST_P(RepeatableConfigProviderTest, TestSharedInternalConfigProvider2)
     auto callback_done = std::async(std::launch::async, [&]() {
         callback_ready.set_value();
         ready.wait();
-        registered_on_changed_parameter_set_callback_(parameter_set_name_);
+        NotifyParameterSetChanged(parameter_set_name_);
     });
 
     auto get_parameter_set_done = std::async(std::launch::async, [&]() {
@@ -1521,7 +2034,7 @@ TEST_P(RepeatableConfigProviderTest, TestSharedParameterSet)
                                                [](std::shared_ptr<const ParameterSet>) noexcept {});
         callback_ready.set_value();
         ready.wait();
-        registered_on_changed_parameter_set_callback_(parameter_set_name_);
+        NotifyParameterSetChanged(parameter_set_name_);
         callback_finished = true;
     });
 
@@ -1582,7 +2095,7 @@ TEST_P(RepeatableConfigProviderTest, TestSharedClientHandlers)
                                                [](std::shared_ptr<const ParameterSet>) noexcept {});
         callback_ready.set_value();
         ready.wait();
-        registered_on_changed_parameter_set_callback_(parameter_set_name_);
+        NotifyParameterSetChanged(parameter_set_name_);
         callback_finished = true;
     });
 
@@ -1610,6 +2123,45 @@ TEST_P(RepeatableConfigProviderTest, TestSharedClientHandlers)
 
 INSTANTIATE_TEST_SUITE_P(RepeatTenTimes, RepeatableConfigProviderTest, ::testing::Range(0, 10));
 
+TEST_F(ConfigProviderTest, GetMetricsReportsCacheAccessesAndLatencies)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderImpl::GetMetrics()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test checks that cache hits and misses are reported per ParameterSet, that the polling "
+                   "statistics of the proxy are included and that per set counts and latencies are only recorded "
+                   "after the metrics got read for the first time.");
+
+    SetUpProxy(parameter_set_name_, correct_parameter_set_from_proxy_);
+    EXPECT_CALL(*icp_mock_, GetPollingStatistics()).WillRepeatedly(Return(PollingStatistics{3U, 2U, 1U}));
+    auto config_provider = CreateConfigProviderWithAvailableCallback([this]() noexcept {
+        UnblockMakeProxyAvailable();
+    });
+    BlockUntilProxyIsReady(stop_source_.get_token());
+
+    ASSERT_TRUE(config_provider->GetParameterSet(parameter_set_name_, std::nullopt).has_value());
+    EXPECT_EQ(config_provider->GetMetrics().proxy_fetch_latency.count, 0U);
+
+    ASSERT_TRUE(config_provider->GetParameterSet(parameter_set_name_, std::nullopt).has_value());
+    EXPECT_FALSE(config_provider->GetParameterSet("wrong_set_name", std::nullopt).has_value());
+
+    const auto metrics = config_provider->GetMetrics();
+    EXPECT_EQ(metrics.cache_hits, 1U);
+    EXPECT_EQ(metrics.cache_misses, 2U);
+    EXPECT_EQ(metrics.access_counts.at(score::cpp::pmr::string{parameter_set_name_}).hits, 1U);
+    // The initial miss happened before the metrics got read, so it is only counted in total
+    EXPECT_EQ(metrics.access_counts.at(score::cpp::pmr::string{parameter_set_name_}).misses, 0U);
+    EXPECT_EQ(metrics.access_counts.at(score::cpp::pmr::string{"wrong_set_name"}).misses, 1U);
+    EXPECT_EQ(metrics.polling_cycles, 3U);
+    EXPECT_EQ(metrics.received_samples, 2U);
+    EXPECT_EQ(metrics.dropped_samples, 1U);
+    EXPECT_EQ(metrics.proxy_fetch_latency.count, 1U);
+    EXPECT_EQ(metrics.mutex_wait_time.count, 2U);
+}
+
 }  // namespace test
 }  // namespace config_provider
 }  // namespace config_management
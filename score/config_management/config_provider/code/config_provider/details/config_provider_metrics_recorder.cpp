@@ -0,0 +1,105 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/details/config_provider_metrics_recorder.h"
+
+#include <score/utility.hpp>
+
+#include <string_view>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+ConfigProviderMetricsRecorder::ConfigProviderMetricsRecorder(score::cpp::pmr::memory_resource* const memory_resource)
+    : cache_hits_{},
+      cache_misses_{},
+      latencies_{},
+      recording_armed_{false},
+      access_counts_{AccessCountsMap::allocator_type{memory_resource}}
+{
+}
+
+void ConfigProviderMetricsRecorder::RecordCacheAccess(const score::cpp::string_view set_name, const bool hit)
+{
+    if (hit)
+    {
+        cache_hits_.Increment();
+    }
+    else
+    {
+        cache_misses_.Increment();
+    }
+
+    if (not recording_armed_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    auto it = access_counts_.find(std::string_view{set_name.data(), set_name.size()});
+    if (it == access_counts_.end())
+    {
+        if (access_counts_.size() >= kMaxTrackedParameterSets)
+        {
+            return;
+        }
+        it = access_counts_
+                 .emplace(score::cpp::pmr::string{set_name.data(), set_name.size(), access_counts_.get_allocator()},
+                          ParameterSetAccessCounts{0U, 0U})
+                 .first;
+    }
+    if (hit)
+    {
+        ++it->second.hits;
+    }
+    else
+    {
+        ++it->second.misses;
+    }
+}
+
+metrics::ScopedLatencyTimer ConfigProviderMetricsRecorder::MeasureLatency(const Latency latency) noexcept
+{
+    return metrics::ScopedLatencyTimer{latencies_[score::cpp::to_underlying(latency)],
+                                       recording_armed_.load(std::memory_order_relaxed)};
+}
+
+ConfigProviderMetrics ConfigProviderMetricsRecorder::GetMetrics(score::cpp::pmr::memory_resource* const memory_resource) const
+{
+    recording_armed_.store(true, std::memory_order_relaxed);
+
+    ConfigProviderMetrics metrics{
+        ConfigProviderMetrics::AccessCountsMap{ConfigProviderMetrics::AccessCountsMap::allocator_type{memory_resource}},
+        cache_hits_.Get(),
+        cache_misses_.Get(),
+        0U,
+        0U,
+        0U,
+        latencies_[score::cpp::to_underlying(Latency::kProxyFetch)].GetSnapshot(),
+        latencies_[score::cpp::to_underlying(Latency::kMutexWait)].GetSnapshot(),
+        latencies_[score::cpp::to_underlying(Latency::kCallbackExecution)].GetSnapshot(),
+        latencies_[score::cpp::to_underlying(Latency::kPersistencyWrite)].GetSnapshot()};
+    metrics.access_counts.reserve(access_counts_.size());
+    for (const auto& access_count : access_counts_)
+    {
+        score::cpp::ignore = metrics.access_counts.emplace(access_count.first, access_count.second);
+    }
+    return metrics;
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
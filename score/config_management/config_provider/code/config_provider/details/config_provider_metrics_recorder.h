@@ -0,0 +1,101 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_CONFIG_PROVIDER_METRICS_RECORDER_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_CONFIG_PROVIDER_METRICS_RECORDER_H
+
+#include "score/config_management/config_provider/code/config_provider/config_provider.h"
+#include "score/config_management/config_provider/code/metrics/counter.h"
+#include "score/config_management/config_provider/code/metrics/latency_histogram.h"
+
+#include <score/memory_resource.hpp>
+#include <score/string.hpp>
+#include <score/string_view.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Collects the metrics of ConfigProviderImpl
+///
+/// The total counters are lock-free and always running. The per parameter set access counts and the latency histograms
+/// are only recorded after GetMetrics() got called for the first time, so an unobserved recorder neither looks up nor
+/// allocates anything on the cache access path. The per parameter set access counts are not thread-safe, the owner has
+/// to serialize RecordCacheAccess() and GetMetrics() calls.
+///
+class ConfigProviderMetricsRecorder final
+{
+  public:
+    enum class Latency : std::uint8_t
+    {
+        kProxyFetch = 0U,
+        kMutexWait,
+        kCallbackExecution,
+        kPersistencyWrite,
+    };
+
+    /// Access counts are tracked for this many distinct parameter set names, further names are only counted in total
+    static constexpr std::size_t kMaxTrackedParameterSets{256U};
+
+    explicit ConfigProviderMetricsRecorder(score::cpp::pmr::memory_resource* const memory_resource);
+
+    /// @brief Counts a cache access of the given parameter set
+    ///
+    /// The access is counted per parameter set only once the metrics got read for the first time.
+    ///
+    /// @param set_name parameter set name
+    /// @param hit true if the parameter set was served from the in-memory cache
+    ///
+    void RecordCacheAccess(const score::cpp::string_view set_name, const bool hit);
+
+    /// @brief Starts measuring the given latency until the returned timer goes out of scope
+    ///
+    /// The clock is not read until the metrics got read for the first time.
+    ///
+    metrics::ScopedLatencyTimer MeasureLatency(const Latency latency) noexcept;
+
+    /// @brief Returns a point-in-time view of the metrics and arms the per set counts and the latency histograms
+    ///
+    /// @param memory_resource memory resource used for memory allocation of the returned metrics
+    ///
+    ConfigProviderMetrics GetMetrics(score::cpp::pmr::memory_resource* const memory_resource) const;
+
+  private:
+    using AccessCountsMap =
+        std::map<score::cpp::pmr::string,
+                 ParameterSetAccessCounts,
+                 std::less<>,
+                 score::cpp::pmr::polymorphic_allocator<std::pair<const score::cpp::pmr::string, ParameterSetAccessCounts>>>;
+
+    metrics::Counter cache_hits_;
+    metrics::Counter cache_misses_;
+    std::array<metrics::LatencyHistogram, 4U> latencies_;
+    mutable std::atomic<bool> recording_armed_;
+    AccessCountsMap access_counts_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_CONFIG_PROVIDER_METRICS_RECORDER_H
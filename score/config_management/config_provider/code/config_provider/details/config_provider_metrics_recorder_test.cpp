@@ -0,0 +1,144 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/details/config_provider_metrics_recorder.h"
+
+#include <score/utility.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+
+class ConfigProviderMetricsRecorderTest : public ::testing::Test
+{
+  protected:
+    ConfigProviderMetricsRecorder recorder_{score::cpp::pmr::get_default_resource()};
+};
+
+TEST_F(ConfigProviderMetricsRecorderTest, CacheAccessesAreCountedPerParameterSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::ConfigProviderMetricsRecorder::RecordCacheAccess()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that cache hits and misses are counted in total and per set.");
+
+    score::cpp::ignore = recorder_.GetMetrics(score::cpp::pmr::get_default_resource());
+    recorder_.RecordCacheAccess("set_name_1", false);
+    recorder_.RecordCacheAccess("set_name_1", true);
+    recorder_.RecordCacheAccess("set_name_1", true);
+    recorder_.RecordCacheAccess("set_name_2", false);
+
+    const auto metrics = recorder_.GetMetrics(score::cpp::pmr::get_default_resource());
+    EXPECT_EQ(metrics.cache_hits, 2U);
+    EXPECT_EQ(metrics.cache_misses, 2U);
+    ASSERT_EQ(metrics.access_counts.size(), 2U);
+    EXPECT_EQ(metrics.access_counts.at("set_name_1").hits, 2U);
+    EXPECT_EQ(metrics.access_counts.at("set_name_1").misses, 1U);
+    EXPECT_EQ(metrics.access_counts.at("set_name_2").hits, 0U);
+    EXPECT_EQ(metrics.access_counts.at("set_name_2").misses, 1U);
+}
+
+TEST_F(ConfigProviderMetricsRecorderTest, NumberOfTrackedParameterSetsIsLimited)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::ConfigProviderMetricsRecorder::RecordCacheAccess()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that only a limited number of names is tracked per set, while all accesses are "
+                   "counted in total.");
+
+    score::cpp::ignore = recorder_.GetMetrics(score::cpp::pmr::get_default_resource());
+    for (std::size_t index{0U}; index <= ConfigProviderMetricsRecorder::kMaxTrackedParameterSets; ++index)
+    {
+        recorder_.RecordCacheAccess(std::string{"set_name_"} + std::to_string(index), false);
+    }
+
+    const auto metrics = recorder_.GetMetrics(score::cpp::pmr::get_default_resource());
+    EXPECT_EQ(metrics.cache_misses, ConfigProviderMetricsRecorder::kMaxTrackedParameterSets + 1U);
+    EXPECT_EQ(metrics.access_counts.size(), ConfigProviderMetricsRecorder::kMaxTrackedParameterSets);
+}
+
+TEST_F(ConfigProviderMetricsRecorderTest, CacheAccessesAreCountedPerSetOnceMetricsGotRead)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::ConfigProviderMetricsRecorder::RecordCacheAccess()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that cache accesses are only counted in total until the metrics got read for the "
+                   "first time.");
+
+    recorder_.RecordCacheAccess("set_name_1", true);
+    recorder_.RecordCacheAccess("set_name_2", false);
+    const auto unarmed_metrics = recorder_.GetMetrics(score::cpp::pmr::get_default_resource());
+    EXPECT_EQ(unarmed_metrics.cache_hits, 1U);
+    EXPECT_EQ(unarmed_metrics.cache_misses, 1U);
+    EXPECT_TRUE(unarmed_metrics.access_counts.empty());
+
+    recorder_.RecordCacheAccess("set_name_1", true);
+    const auto metrics = recorder_.GetMetrics(score::cpp::pmr::get_default_resource());
+    EXPECT_EQ(metrics.cache_hits, 2U);
+    ASSERT_EQ(metrics.access_counts.size(), 1U);
+    EXPECT_EQ(metrics.access_counts.at("set_name_1").hits, 1U);
+}
+
+TEST_F(ConfigProviderMetricsRecorderTest, LatenciesAreRecordedOnceMetricsGotRead)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::ConfigProviderMetricsRecorder::MeasureLatency()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that latencies are not measured until the metrics got read for the first time.");
+
+    {
+        const auto timer = recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kProxyFetch);
+    }
+    EXPECT_EQ(recorder_.GetMetrics(score::cpp::pmr::get_default_resource()).proxy_fetch_latency.count, 0U);
+
+    {
+        const auto timer = recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kProxyFetch);
+    }
+    {
+        const auto timer = recorder_.MeasureLatency(ConfigProviderMetricsRecorder::Latency::kPersistencyWrite);
+    }
+    const auto metrics = recorder_.GetMetrics(score::cpp::pmr::get_default_resource());
+    EXPECT_EQ(metrics.proxy_fetch_latency.count, 1U);
+    EXPECT_EQ(metrics.persistency_write_latency.count, 1U);
+    EXPECT_EQ(metrics.mutex_wait_time.count, 0U);
+    EXPECT_EQ(metrics.callback_execution_time.count, 0U);
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,113 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/details/negative_result_cache.h"
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+NegativeResultCache::NegativeResultCache(score::cpp::pmr::memory_resource* const memory_resource,
+                                         const std::size_t capacity,
+                                         const std::chrono::milliseconds time_to_live)
+    : memory_resource_{memory_resource},
+      capacity_{capacity},
+      time_to_live_{time_to_live},
+      expiry_times_{ExpiryMap::allocator_type{memory_resource}},  // LCOV_EXCL_LINE optimized by compiler
+      hits_{0U},
+      misses_{0U}
+{
+}
+
+score::cpp::optional<score::result::Error> NegativeResultCache::Find(const score::cpp::string_view set_name,
+                                                                   const Clock::time_point now)
+{
+    const score::cpp::pmr::string key{set_name.data(), set_name.size(), memory_resource_};
+    const auto it = expiry_times_.find(key);
+    if ((it != expiry_times_.end()) && (now < it->second.expiry_time))
+    {
+        ++hits_;
+        return it->second.error;
+    }
+    if (it != expiry_times_.end())
+    {
+        score::cpp::ignore = expiry_times_.erase(it);
+    }
+    ++misses_;
+    return score::cpp::nullopt;
+}
+
+void NegativeResultCache::Insert(const score::cpp::string_view set_name,
+                                 const score::result::Error& error,
+                                 const Clock::time_point now)
+{
+    if (capacity_ == 0U)
+    {
+        return;
+    }
+    score::cpp::pmr::string key{set_name.data(), set_name.size(), memory_resource_};
+    if ((expiry_times_.find(key) == expiry_times_.end()) && (expiry_times_.size() >= capacity_))
+    {
+        EvictOne(now);
+    }
+    score::cpp::ignore = expiry_times_.insert_or_assign(std::move(key), Entry{now + time_to_live_, error});
+}
+
+void NegativeResultCache::Invalidate(const score::cpp::string_view set_name)
+{
+    // called for every notified parameter set, mostly while nothing is remembered
+    if (expiry_times_.empty())
+    {
+        return;
+    }
+    const score::cpp::pmr::string key{set_name.data(), set_name.size(), memory_resource_};
+    score::cpp::ignore = expiry_times_.erase(key);
+}
+
+NegativeResultCacheStatistics NegativeResultCache::GetStatistics() const noexcept
+{
+    return NegativeResultCacheStatistics{hits_, misses_, expiry_times_.size()};
+}
+
+void NegativeResultCache::EvictOne(const Clock::time_point now) noexcept
+{
+    // Expired entries are dropped first, otherwise the entry closest to its expiry makes room.
+    const auto size_before = expiry_times_.size();
+    for (auto it = expiry_times_.begin(); it != expiry_times_.end();)
+    {
+        it = (it->second.expiry_time <= now) ? expiry_times_.erase(it) : std::next(it);
+    }
+    if (expiry_times_.size() < size_before)
+    {
+        return;
+    }
+    const auto oldest = std::min_element(
+        expiry_times_.begin(), expiry_times_.end(), [](const auto& lhs, const auto& rhs) noexcept {
+            return lhs.second.expiry_time < rhs.second.expiry_time;
+        });
+    if (oldest != expiry_times_.end())  // LCOV_EXCL_BR_LINE cache is never empty when called
+    {
+        score::cpp::ignore = expiry_times_.erase(oldest);
+    }
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,114 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_NEGATIVE_RESULT_CACHE_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_NEGATIVE_RESULT_CACHE_H
+
+#include "score/config_management/config_provider/code/config_provider/config_provider.h"
+
+#include "score/result/error.h"
+
+#include <score/memory_resource.hpp>
+#include <score/optional.hpp>
+#include <score/string_view.hpp>
+#include <score/unordered_map.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Bounded cache of parameter set names the daemon did not know about
+///
+/// Remembers failed lookups for a limited time, so that repeated requests for an unknown parameter set
+/// are answered locally instead of waiting for the proxy every time. An entry expires after the configured
+/// time to live or when it is invalidated explicitly, e.g. because the daemon announced an update for that name.
+/// When the cache is full, the entry closest to expiry is evicted.
+///
+/// @note The class is not thread-safe, the owner is responsible for serializing the access.
+///
+class NegativeResultCache final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    constexpr static std::size_t kDefaultCapacity{64U};
+    constexpr static std::chrono::milliseconds kDefaultTimeToLive{5000};
+
+    explicit NegativeResultCache(score::cpp::pmr::memory_resource* const memory_resource,
+                                 const std::size_t capacity = kDefaultCapacity,
+                                 const std::chrono::milliseconds time_to_live = kDefaultTimeToLive);
+
+    ~NegativeResultCache() = default;
+    NegativeResultCache(NegativeResultCache&&) noexcept = delete;
+    NegativeResultCache(const NegativeResultCache&) noexcept = delete;
+    NegativeResultCache& operator=(NegativeResultCache&&) & noexcept = delete;
+    NegativeResultCache& operator=(const NegativeResultCache&) & noexcept = delete;
+
+    /// @brief Looks up a non-expired negative result for the given name
+    ///
+    /// Updates the hit/miss counters and drops the entry if it has already expired.
+    ///
+    /// @param set_name parameter set name
+    /// @param now current point in time
+    /// @return error of the remembered failed lookup, nothing if the lookup for the parameter set is not known to fail
+    ///
+    score::cpp::optional<score::result::Error> Find(const score::cpp::string_view set_name,
+                                                  const Clock::time_point now);
+
+    /// @brief Remembers a failed lookup for the given name
+    ///
+    /// @param set_name parameter set name
+    /// @param error error of the failed lookup, it is returned by Find() for the remembered name
+    /// @param now current point in time, the entry expires at now + time to live
+    ///
+    void Insert(const score::cpp::string_view set_name, const score::result::Error& error, const Clock::time_point now);
+
+    /// @brief Forgets a remembered failed lookup for the given name, if any
+    ///
+    /// @param set_name parameter set name
+    ///
+    void Invalidate(const score::cpp::string_view set_name);
+
+    NegativeResultCacheStatistics GetStatistics() const noexcept;
+
+  private:
+    struct Entry
+    {
+        Clock::time_point expiry_time;
+        score::result::Error error;
+    };
+    using ExpiryMap = score::cpp::pmr::unordered_map<score::cpp::pmr::string, Entry>;
+
+    void EvictOne(const Clock::time_point now) noexcept;
+
+    score::cpp::pmr::memory_resource* const memory_resource_;
+    const std::size_t capacity_;
+    const std::chrono::milliseconds time_to_live_;
+    ExpiryMap expiry_times_;
+    std::uint64_t hits_;
+    std::uint64_t misses_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_NEGATIVE_RESULT_CACHE_H
@@ -0,0 +1,187 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/details/negative_result_cache.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include <gtest/gtest.h>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+
+using namespace std::chrono_literals;
+
+class NegativeResultCacheTest : public ::testing::Test
+{
+  protected:
+    const NegativeResultCache::Clock::time_point now_{NegativeResultCache::Clock::now()};
+    const std::chrono::milliseconds time_to_live_{100ms};
+    const score::result::Error error_{MakeUnexpected(ConfigProviderError::kProxyReturnedNoResult).error()};
+    NegativeResultCache cache_{score::cpp::pmr::get_default_resource(), 2U, time_to_live_};
+};
+
+TEST_F(NegativeResultCacheTest, UnknownNameIsAMiss)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Find()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a name which was never inserted is reported as a miss.");
+
+    EXPECT_FALSE(cache_.Find("set_name", now_));
+
+    const auto statistics = cache_.GetStatistics();
+    EXPECT_EQ(statistics.hits, 0U);
+    EXPECT_EQ(statistics.misses, 1U);
+    EXPECT_EQ(statistics.size, 0U);
+}
+
+TEST_F(NegativeResultCacheTest, InsertedNameIsAHitUntilExpired)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Find()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that an inserted name is reported as a hit within the time to live and is "
+                   "dropped once the time to live has elapsed.");
+
+    cache_.Insert("set_name", error_, now_);
+
+    EXPECT_TRUE(cache_.Find("set_name", now_));
+    EXPECT_TRUE(cache_.Find("set_name", now_ + time_to_live_ - 1ms));
+    EXPECT_FALSE(cache_.Find("set_name", now_ + time_to_live_));
+
+    const auto statistics = cache_.GetStatistics();
+    EXPECT_EQ(statistics.hits, 2U);
+    EXPECT_EQ(statistics.misses, 1U);
+    EXPECT_EQ(statistics.size, 0U);
+}
+
+TEST_F(NegativeResultCacheTest, HitReturnsTheRememberedError)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Find()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a hit returns the error of the remembered lookup, so that repeated "
+                   "lookups fail with the same error as the first one.");
+
+    cache_.Insert("no_result", error_, now_);
+    cache_.Insert("not_found", MakeUnexpected(ConfigProviderError::kParameterSetNotFound).error(), now_);
+
+    EXPECT_EQ(cache_.Find("no_result", now_), error_);
+    EXPECT_EQ(cache_.Find("not_found", now_), ConfigProviderError::kParameterSetNotFound);
+}
+
+TEST_F(NegativeResultCacheTest, InvalidatedNameIsAMiss)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Invalidate()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that an invalidated name is no longer reported as a hit.");
+
+    cache_.Insert("set_name", error_, now_);
+    cache_.Invalidate("set_name");
+    cache_.Invalidate("unknown_set_name");
+
+    EXPECT_FALSE(cache_.Find("set_name", now_));
+    EXPECT_EQ(cache_.GetStatistics().size, 0U);
+}
+
+TEST_F(NegativeResultCacheTest, ReinsertRefreshesExpiry)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Insert()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that inserting a known name again extends its time to live.");
+
+    cache_.Insert("set_name", error_, now_);
+    cache_.Insert("set_name", error_, now_ + 50ms);
+
+    EXPECT_TRUE(cache_.Find("set_name", now_ + time_to_live_));
+    EXPECT_EQ(cache_.GetStatistics().size, 1U);
+}
+
+TEST_F(NegativeResultCacheTest, FullCacheEvictsEntryClosestToExpiry)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Insert()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the cache never exceeds its capacity and evicts the entry which would "
+                   "expire first.");
+
+    cache_.Insert("first", error_, now_);
+    cache_.Insert("second", error_, now_ + 10ms);
+    cache_.Insert("third", error_, now_ + 20ms);
+
+    EXPECT_EQ(cache_.GetStatistics().size, 2U);
+    EXPECT_FALSE(cache_.Find("first", now_ + 20ms));
+    EXPECT_TRUE(cache_.Find("second", now_ + 20ms));
+    EXPECT_TRUE(cache_.Find("third", now_ + 20ms));
+}
+
+TEST_F(NegativeResultCacheTest, FullCacheEvictsExpiredEntriesFirst)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Insert()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that already expired entries are dropped to make room.");
+
+    cache_.Insert("first", error_, now_);
+    cache_.Insert("second", error_, now_);
+    cache_.Insert("third", error_, now_ + time_to_live_);
+
+    EXPECT_EQ(cache_.GetStatistics().size, 1U);
+    EXPECT_TRUE(cache_.Find("third", now_ + time_to_live_));
+}
+
+TEST_F(NegativeResultCacheTest, ZeroCapacityDisablesCache)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::NegativeResultCache::Insert()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a cache with zero capacity never remembers a name.");
+
+    NegativeResultCache disabled_cache{score::cpp::pmr::get_default_resource(), 0U, time_to_live_};
+    disabled_cache.Insert("set_name", error_, now_);
+
+    EXPECT_FALSE(disabled_cache.Find("set_name", now_));
+    EXPECT_EQ(disabled_cache.GetStatistics().size, 0U);
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
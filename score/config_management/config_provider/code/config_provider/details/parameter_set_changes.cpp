@@ -0,0 +1,151 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/details/parameter_set_changes.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/utility.hpp>
+
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+/// @brief Moves the member out of the object, it is a null value if the object has no such member
+score::json::Any ExtractMember(score::json::Object& object, const std::string_view name)
+{
+    const auto member = object.find(name);
+    if (member == object.end())
+    {
+        return score::json::Any{};
+    }
+    return std::move(object.extract(member).mapped());
+}
+
+/// @brief Returns the cached set as the unmodified set of the given version, sharing all its parameters
+Result<std::shared_ptr<const ParameterSet>> RebaseUnmodifiedSet(const std::shared_ptr<const ParameterSet>& cached_set,
+                                                                const std::uint64_t version,
+                                                                score::cpp::pmr::memory_resource* const memory_resource)
+{
+    if (cached_set == nullptr)
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Unmodified parameter set without a cached set";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Unmodified parameter set has no base set");
+    }
+    const auto cached_version = cached_set->GetVersion();
+    if (cached_version.has_value() && (cached_version.value() == version))
+    {
+        return {cached_set};
+    }
+    const auto qualifier = cached_set->GetQualifier();
+    if (!qualifier.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to get qualifier of the cached set";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Cached parameter set has no qualifier");
+    }
+    score::json::Any qualifier_json{score::cpp::to_underlying(qualifier.value())};
+    return {score::cpp::pmr::make_shared<const ParameterSet>(memory_resource,
+                                                           cached_set,
+                                                           score::json::Object{},
+                                                           std::vector<std::string>{},
+                                                           std::move(qualifier_json),
+                                                           version,
+                                                           memory_resource)};
+}
+
+}  // namespace
+
+Result<std::shared_ptr<const ParameterSet>> ApplyParameterSetChanges(
+    const std::shared_ptr<const ParameterSet>& cached_set,
+    score::json::Any changes,
+    score::cpp::pmr::memory_resource* const memory_resource)
+{
+    auto changes_object = changes.As<score::json::Object>();
+    if (!changes_object.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to cast parameter set changes to object instance";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Parameter set changes are not an object");
+    }
+    auto& changes_obj = changes_object.value().get();
+    const auto version = ExtractMember(changes_obj, "version").As<std::uint64_t>();
+    const auto is_modified = ExtractMember(changes_obj, "is_modified").As<bool>();
+    if (version.has_value() && is_modified.has_value() && (!is_modified.value()))
+    {
+        return RebaseUnmodifiedSet(cached_set, version.value(), memory_resource);
+    }
+    const auto is_complete = ExtractMember(changes_obj, "is_complete").As<bool>();
+    auto parameters = ExtractMember(changes_obj, "parameters");
+    auto qualifier = ExtractMember(changes_obj, "qualifier");
+    if ((!version.has_value()) || (!is_complete.has_value()) || (!parameters.As<score::json::Object>().has_value()))
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Malformed parameter set changes";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Malformed parameter set changes");
+    }
+
+    if (is_complete.value())
+    {
+        score::json::Object set_object{};
+        score::cpp::ignore = set_object.emplace(std::string{"parameters"}, std::move(parameters));
+        score::cpp::ignore = set_object.emplace(std::string{"qualifier"}, std::move(qualifier));
+        return {score::cpp::pmr::make_shared<const ParameterSet>(
+            memory_resource, score::json::Any{std::move(set_object)}, version.value(), memory_resource)};
+    }
+
+    if ((cached_set == nullptr) || (!cached_set->GetVersion().has_value()))
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Parameter set changes without a versioned base set";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Parameter set changes have no base set");
+    }
+    const auto removed_parameters_json = ExtractMember(changes_obj, "removed_parameters");
+    const auto removed_parameters_list = removed_parameters_json.As<score::json::List>();
+    if (!removed_parameters_list.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to cast removed parameters to JSON list";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Malformed parameter set changes");
+    }
+    std::vector<std::string> removed_parameters{};
+    removed_parameters.reserve(removed_parameters_list.value().get().size());
+    for (const auto& removed_parameter : removed_parameters_list.value().get())
+    {
+        const auto name = removed_parameter.As<std::string>();
+        if (!name.has_value())
+        {
+            mw::log::LogError("CfgP") << __func__ << ": Failed to cast removed parameter name to string";
+            return MakeUnexpected(ConfigProviderError::kParsingFailed, "Malformed parameter set changes");
+        }
+        const std::string& name_str = name.value();
+        removed_parameters.push_back(name_str);
+    }
+
+    auto& changed_parameters = parameters.As<score::json::Object>().value().get();
+    return {score::cpp::pmr::make_shared<const ParameterSet>(memory_resource,
+                                                           cached_set,
+                                                           std::move(changed_parameters),
+                                                           removed_parameters,
+                                                           std::move(qualifier),
+                                                           version.value(),
+                                                           memory_resource)};
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
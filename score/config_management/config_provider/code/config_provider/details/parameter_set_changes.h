@@ -0,0 +1,53 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_PARAMETER_SET_CHANGES_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_PARAMETER_SET_CHANGES_H
+
+#include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
+
+#include "score/json/internal/model/any.h"
+#include "score/result/result.h"
+
+#include <score/memory_resource.hpp>
+
+#include <memory>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+/// @brief Creates the parameter set resulting from the changes the ConfigDaemon served for a cached parameter set
+///
+/// A complete delta creates a new parameter set, a partial one is applied copy-on-write to cached_set, which stays
+/// unchanged and shares all unchanged parameters with the new set. If the set is not modified, cached_set is returned
+/// with the version of the ConfigDaemon, so later changes are requested relative to it.
+///
+/// @param cached_set cached parameter set the changes were requested for, nullptr if none is cached
+/// @param changes delta as returned by IInternalConfigProvider::GetParameterSetChanges()
+/// @param memory_resource memory resource used for memory allocation
+/// @return new immutable parameter set or kParsingFailed if the delta is malformed or does not apply to cached_set
+///
+Result<std::shared_ptr<const ParameterSet>> ApplyParameterSetChanges(
+    const std::shared_ptr<const ParameterSet>& cached_set,
+    score::json::Any changes,
+    score::cpp::pmr::memory_resource* const memory_resource);
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_PARAMETER_SET_CHANGES_H
@@ -0,0 +1,207 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/details/parameter_set_changes.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+
+class ParameterSetChangesTest : public ::testing::Test
+{
+  protected:
+    Result<std::shared_ptr<const ParameterSet>> Apply(const std::shared_ptr<const ParameterSet>& cached_set,
+                                                      const std::string& changes) const
+    {
+        auto changes_json = json::JsonParser{}.FromBuffer(changes);
+        EXPECT_TRUE(changes_json.has_value());
+        return ApplyParameterSetChanges(cached_set, std::move(changes_json).value(), memory_resource_);
+    }
+
+    std::shared_ptr<const ParameterSet> CreateCachedSet() const
+    {
+        const auto cached_set = Apply(nullptr, R"({"version": 7, "is_complete": true, "qualifier": 1,
+            "parameters": {"unchanged": 1, "changed": 2, "removed": [3, 4]}})");
+        EXPECT_TRUE(cached_set.has_value());
+        return cached_set.value();
+    }
+
+    score::cpp::pmr::memory_resource* const memory_resource_{score::cpp::pmr::get_default_resource()};
+};
+
+TEST_F(ParameterSetChangesTest, CompleteChangesCreateVersionedParameterSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ApplyParameterSetChanges()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that complete changes create a parameter set with the served version.");
+
+    const auto parameter_set = CreateCachedSet();
+
+    EXPECT_EQ(parameter_set->GetVersion(), score::cpp::optional<std::uint64_t>{7U});
+    EXPECT_EQ(parameter_set->GetParameterAs<std::int32_t>("changed").value(), 2);
+    EXPECT_EQ(parameter_set->GetParameterAs<ParameterSet::Array<std::int32_t>>("removed").value().size(), 2U);
+    EXPECT_EQ(parameter_set->GetQualifier().value(), score::platform::config_daemon::ParameterSetQualifier::kQualified);
+}
+
+TEST_F(ParameterSetChangesTest, PartialChangesAreAppliedCopyOnWrite)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ApplyParameterSetChanges()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that partial changes create a new parameter set which reads the unchanged "
+                   "parameters from the cached set, while the cached set stays unchanged.");
+
+    const auto cached_set = CreateCachedSet();
+    const auto changed_set = Apply(cached_set, R"({"version": 8, "is_complete": false, "qualifier": 3,
+        "parameters": {"changed": 20, "added": 5}, "removed_parameters": ["removed"]})");
+    ASSERT_TRUE(changed_set.has_value());
+    const auto again_changed_set = Apply(changed_set.value(), R"({"version": 9, "is_complete": false, "qualifier": 3,
+        "parameters": {"removed": [30]}, "removed_parameters": ["added"]})");
+    ASSERT_TRUE(again_changed_set.has_value());
+
+    EXPECT_EQ(cached_set->GetParameterAs<std::int32_t>("changed").value(), 2);
+    EXPECT_EQ(cached_set->GetQualifier().value(), score::platform::config_daemon::ParameterSetQualifier::kQualified);
+
+    const auto& parameter_set = changed_set.value();
+    EXPECT_EQ(parameter_set->GetVersion(), score::cpp::optional<std::uint64_t>{8U});
+    EXPECT_EQ(parameter_set->GetParameterAs<std::int32_t>("unchanged").value(), 1);
+    EXPECT_EQ(parameter_set->GetParameterAs<std::int32_t>("changed").value(), 20);
+    EXPECT_EQ(parameter_set->GetParameterAs<std::int32_t>("added").value(), 5);
+    EXPECT_EQ(parameter_set->GetParameterAs<ParameterSet::Array<std::int32_t>>("removed").error(),
+              ConfigProviderError::kParameterNotFound);
+    EXPECT_EQ(parameter_set->GetQualifier().value(), score::platform::config_daemon::ParameterSetQualifier::kModified);
+
+    const auto& combined_set = again_changed_set.value();
+    EXPECT_EQ(combined_set->GetParameterAs<std::int32_t>("unchanged").value(), 1);
+    EXPECT_EQ(combined_set->GetParameterAs<std::int32_t>("changed").value(), 20);
+    EXPECT_EQ(combined_set->GetParameterAs<std::int32_t>("added").error(), ConfigProviderError::kParameterNotFound);
+    EXPECT_EQ(combined_set->GetParameterAs<ParameterSet::Array<std::int32_t>>("removed").value().size(), 1U);
+
+    const auto expected_set = Apply(nullptr, R"({"version": 9, "is_complete": true, "qualifier": 3,
+        "parameters": {"unchanged": 1, "changed": 20, "removed": [30]}})");
+    ASSERT_TRUE(expected_set.has_value());
+    EXPECT_TRUE(combined_set->ContainsSameContent(*expected_set.value()));
+    EXPECT_EQ(combined_set->GetSetAsString().value(), expected_set.value()->GetSetAsString().value());
+}
+
+TEST_F(ParameterSetChangesTest, ManyChangesStopSharingTheCachedSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ApplyParameterSetChanges()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that more than kMaxSharedChanges combined changes yield a parameter set with "
+                   "the same content as applying them one by one.");
+
+    std::shared_ptr<const ParameterSet> parameter_set = CreateCachedSet();
+    for (std::size_t change = 0U; change <= ParameterSet::kMaxSharedChanges; ++change)
+    {
+        const auto changes = R"({"version": )" + std::to_string(8U + change) +
+                             R"(, "is_complete": false, "qualifier": 1, "parameters": {"added_)" +
+                             std::to_string(change) + R"(": 1}, "removed_parameters": []})";
+        auto changed_set = Apply(parameter_set, changes);
+        ASSERT_TRUE(changed_set.has_value());
+        parameter_set = std::move(changed_set).value();
+    }
+
+    EXPECT_EQ(parameter_set->GetParameterAs<std::int32_t>("unchanged").value(), 1);
+    EXPECT_EQ(parameter_set->GetParameterAs<std::int32_t>("added_0").value(), 1);
+    EXPECT_EQ(parameter_set->GetParameterAs<std::int32_t>("added_" + std::to_string(ParameterSet::kMaxSharedChanges))
+                  .value(),
+              1);
+    EXPECT_EQ(parameter_set->GetVersion(),
+              score::cpp::optional<std::uint64_t>{8U + ParameterSet::kMaxSharedChanges});
+}
+
+TEST_F(ParameterSetChangesTest, UnmodifiedSetIsRebasedOnServedVersion)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ApplyParameterSetChanges()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a not modified answer keeps the content of the cached set, also of an "
+                   "unversioned one, and assigns it the served version.");
+
+    const auto cached_set = CreateCachedSet();
+    const auto unversioned_set = std::make_shared<const ParameterSet>(
+        json::JsonParser{}.FromBuffer(R"({"parameters": {"unchanged": 1}, "qualifier": 3})").value());
+
+    const auto same_version_set = Apply(cached_set, R"({"version": 7, "is_modified": false})");
+    ASSERT_TRUE(same_version_set.has_value());
+    EXPECT_EQ(same_version_set.value(), cached_set);
+
+    const auto rebased_set = Apply(unversioned_set, R"({"version": 42, "is_modified": false})");
+    ASSERT_TRUE(rebased_set.has_value());
+    EXPECT_EQ(rebased_set.value()->GetVersion(), score::cpp::optional<std::uint64_t>{42U});
+    EXPECT_EQ(rebased_set.value()->GetParameterAs<std::int32_t>("unchanged").value(), 1);
+    EXPECT_EQ(rebased_set.value()->GetQualifier().value(),
+              score::platform::config_daemon::ParameterSetQualifier::kModified);
+    EXPECT_TRUE(rebased_set.value()->ContainsSameContent(*unversioned_set));
+
+    EXPECT_EQ(Apply(nullptr, R"({"version": 42, "is_modified": false})").error(), ConfigProviderError::kParsingFailed);
+}
+
+TEST_F(ParameterSetChangesTest, MalformedChangesAreRejected)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ApplyParameterSetChanges()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that malformed changes and partial changes without a versioned cached set are "
+                   "rejected with kParsingFailed.");
+
+    const auto cached_set = CreateCachedSet();
+    const auto unversioned_set = std::make_shared<const ParameterSet>(
+        json::JsonParser{}.FromBuffer(R"({"parameters": {}, "qualifier": 1})").value());
+    const std::string partial_changes{
+        R"({"version": 8, "is_complete": false, "qualifier": 1, "parameters": {}, "removed_parameters": []})"};
+
+    EXPECT_EQ(Apply(cached_set, R"([1, 2])").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Apply(cached_set, R"({"is_complete": true, "parameters": {}})").error(),
+              ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Apply(cached_set, R"({"version": 8, "is_complete": false, "parameters": {}, "qualifier": 1})").error(),
+              ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Apply(nullptr, partial_changes).error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Apply(unversioned_set, partial_changes).error(), ConfigProviderError::kParsingFailed);
+    EXPECT_TRUE(Apply(cached_set, partial_changes).has_value());
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,73 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/config_provider/details/received_binary_set.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include "score/mw/log/logging.h"
+
+#include <string_view>
+#include <utility>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+/// @brief Received buffer holding the binary encoding of one parameter set
+class ReceivedBinarySet final
+{
+  public:
+    explicit ReceivedBinarySet(score::cpp::pmr::string encoded_set) noexcept : encoded_set_{std::move(encoded_set)} {}
+
+    ~ReceivedBinarySet() noexcept = default;
+
+    ReceivedBinarySet(ReceivedBinarySet&&) noexcept = delete;
+    ReceivedBinarySet(const ReceivedBinarySet&) noexcept = delete;
+    ReceivedBinarySet& operator=(ReceivedBinarySet&&) & noexcept = delete;
+    ReceivedBinarySet& operator=(const ReceivedBinarySet&) & noexcept = delete;
+
+    std::string_view GetEncodedSet() const noexcept
+    {
+        return {encoded_set_.data(), encoded_set_.size()};
+    }
+
+  private:
+    const score::cpp::pmr::string encoded_set_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<const ParameterSet>> CreateParameterSetFromBuffer(
+    score::cpp::pmr::string encoded_set,
+    score::cpp::pmr::memory_resource* const memory_resource)
+{
+    auto received_set = score::cpp::pmr::make_shared<const ReceivedBinarySet>(memory_resource, std::move(encoded_set));
+    const auto binary_set = wire_format::BinarySetView::Create(received_set->GetEncodedSet());
+    if (!binary_set.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Received binary set is invalid: " << binary_set.error();
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Received binary parameter set is invalid");
+    }
+    return {score::cpp::pmr::make_shared<const ParameterSet>(
+        memory_resource, binary_set.value(), std::move(received_set), memory_resource)};
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,52 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_RECEIVED_BINARY_SET_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_RECEIVED_BINARY_SET_H
+
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+#include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
+
+#include <score/memory_resource.hpp>
+#include <score/string.hpp>
+
+#include <memory>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+/// @brief Creates the parameter set for a set received in the binary wire format, held by the received buffer
+///
+/// A parsed set is a tree of many small JSON nodes, which would stay allocated as long as the set is cached and be
+/// interleaved with the short-lived allocations of later fetches and updates. Instead, the received buffer is kept as
+/// the single block the parameter set reads in place. It is validated once and neither copied nor decoded, and it is
+/// released in one shot together with the last reference to the set.
+///
+/// @param encoded_set received buffer, its ownership is taken over by the parameter set
+/// @param memory_resource memory resource the parameter set is allocated from
+/// @return new immutable parameter set or kParsingFailed if the buffer is not a valid binary parameter set
+///
+Result<std::shared_ptr<const ParameterSet>> CreateParameterSetFromBuffer(
+    score::cpp::pmr::string encoded_set,
+    score::cpp::pmr::memory_resource* const memory_resource);
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_DETAILS_RECEIVED_BINARY_SET_H
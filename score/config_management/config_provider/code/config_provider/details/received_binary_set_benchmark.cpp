@@ -0,0 +1,210 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/config_provider/details/received_binary_set.h"
+#include "score/config_management/config_provider/code/memory/allocation_tracking.h"
+#include "score/config_management/config_provider/code/memory/tracking_memory_resource.h"
+#include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include "score/json/json_parser.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/memory_resource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+// Number of parameter sets a client keeps in its cache while they are replaced by updates
+constexpr std::size_t kCachedSets{256U};
+// Fetched sets differ in size, so that released memory does not simply fit the next set
+constexpr std::size_t kPayloadSizes{4U};
+
+std::string CreatePayload(const std::size_t parameter_count)
+{
+    std::string payload{R"({"parameters": {)"};
+    for (std::size_t index = 0U; index < parameter_count; ++index)
+    {
+        const auto name = "\"parameter_" + std::to_string(index) + "\": ";
+        payload += (index == 0U) ? name : (", " + name);
+        switch (index % 4U)
+        {
+            case 0U:
+                payload += std::to_string(index) + ".5";
+                break;
+            case 1U:
+                payload += std::to_string(index);
+                break;
+            case 2U:
+                payload += "\"value_" + std::to_string(index) + "\"";
+                break;
+            default:
+                payload += "[1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5, 8.5]";
+                break;
+        }
+    }
+    payload += R"(}, "qualifier": 1})";
+    return payload;
+}
+
+// Memory resource of the ConfigProvider, which allocates from the same heap as the JSON library but is not counted by
+// the replaced global allocation functions, so that each allocation is counted once
+class MallocMemoryResource final : public score::cpp::pmr::memory_resource
+{
+  private:
+    void* do_allocate(const std::size_t bytes, const std::size_t) override
+    {
+        void* const memory = std::malloc(bytes);
+        if (memory == nullptr)
+        {
+            throw std::bad_alloc{};
+        }
+        return memory;
+    }
+
+    void do_deallocate(void* const memory, const std::size_t, const std::size_t) override
+    {
+        std::free(memory);
+    }
+
+    bool do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+enum class Representation : std::uint8_t
+{
+    kJsonTree,
+    kBinaryBuffer,
+};
+
+// Payload as it is received, i.e. the JSON text or the binary encoding of the set
+std::string CreateReceivedPayload(const Representation representation, const std::size_t parameter_count)
+{
+    auto payload = CreatePayload(parameter_count);
+    if (representation == Representation::kJsonTree)
+    {
+        return payload;
+    }
+    const auto set_json = json::JsonParser{}.FromBuffer(payload);
+    return wire_format::EncodeBinarySet(set_json.value().As<json::Object>().value().get()).value();
+}
+
+// Creates the parameter set from a received payload like the ConfigProvider does, the binary buffer is received into
+// the memory resource of the ConfigProvider
+std::shared_ptr<const ParameterSet> CreateParameterSet(const Representation representation,
+                                                       const std::string& payload,
+                                                       score::cpp::pmr::memory_resource* const memory_resource)
+{
+    if (representation == Representation::kBinaryBuffer)
+    {
+        return CreateParameterSetFromBuffer(score::cpp::pmr::string{payload.data(), payload.size(), memory_resource},
+                                            memory_resource)
+            .value();
+    }
+    auto set_json = json::JsonParser{}.FromBuffer(payload);
+    return score::cpp::pmr::make_shared<const ParameterSet>(
+        memory_resource, std::move(set_json).value(), memory_resource);
+}
+
+// Returns the memory the allocator keeps for the heap to the system, so that each benchmark starts from a compact heap
+void TrimHeap() noexcept
+{
+#if defined(__GLIBC__)
+    score::cpp::ignore = malloc_trim(0U);
+#endif
+}
+
+// Bytes of the heap which are free but can't be returned to the system, as they are holes between allocated blocks
+double GetFreeHeapBytes() noexcept
+{
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 33))
+    TrimHeap();
+    return static_cast<double>(mallinfo2().fordblks);
+#else
+    return 0.0;
+#endif
+}
+
+// Soak test of fetching parameter sets as a whole: each iteration receives the payload of a fetched set, creates the
+// parameter set from the JSON text or the binary buffer, reads a parameter from it and replaces a random set in the
+// cache, like an update storm does. The time per iteration is the fetch latency, the counters show the heap memory held
+// per cached set and the free heap memory the allocator can't return to the system at the end of the run, i.e. the
+// fragmentation of the heap. As the heap is shared by all benchmarks, the latter is only meaningful if one benchmark
+// is run per process.
+template <Representation representation>
+void BM_FetchSoak(benchmark::State& state)
+{
+    const auto parameter_count = static_cast<std::size_t>(state.range(0));
+    std::vector<std::string> payloads{};
+    for (std::size_t size = 1U; size <= kPayloadSizes; ++size)
+    {
+        payloads.push_back(CreateReceivedPayload(representation, (parameter_count * size) / 2U));
+    }
+    MallocMemoryResource malloc_memory_resource{};
+    memory::TrackingMemoryResource memory_resource{&malloc_memory_resource};
+    std::vector<std::shared_ptr<const ParameterSet>> cached_sets(kCachedSets);
+    std::mt19937 random{42U};
+    std::uniform_int_distribution<std::size_t> payload_distribution{0U, kPayloadSizes - 1U};
+    std::uniform_int_distribution<std::size_t> set_distribution{0U, kCachedSets - 1U};
+
+    TrimHeap();
+    const auto live_bytes_before = memory::GetLiveHeapBytes();
+    for (auto _ : state)
+    {
+        const auto& payload = payloads[payload_distribution(random)];
+        auto parameter_set = CreateParameterSet(representation, payload, &memory_resource);
+        benchmark::DoNotOptimize(parameter_set->GetParameterAs<float>("parameter_0"));
+        cached_sets[set_distribution(random)] = std::move(parameter_set);
+    }
+
+    std::size_t set_count{0U};
+    for (const auto& cached_set : cached_sets)
+    {
+        set_count += (cached_set != nullptr) ? 1U : 0U;
+    }
+    const auto live_bytes =
+        (memory::GetLiveHeapBytes() - live_bytes_before) + memory_resource.GetStatistics().GetLiveBytes();
+    state.counters["bytes_per_set"] = static_cast<double>(live_bytes) / static_cast<double>(set_count);
+    state.counters["free_heap_bytes_per_set"] = GetFreeHeapBytes() / static_cast<double>(set_count);
+    cached_sets.clear();
+}
+BENCHMARK_TEMPLATE(BM_FetchSoak, Representation::kJsonTree)->ArgName("parameters")->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK_TEMPLATE(BM_FetchSoak, Representation::kBinaryBuffer)->ArgName("parameters")->Arg(16)->Arg(128)->Arg(512);
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,140 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/config_provider/details/received_binary_set.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+#include "score/config_management/config_provider/code/memory/tracking_memory_resource.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+namespace
+{
+
+constexpr std::string_view kSet{R"({"parameters": {"number": 42, "factor": 0.5, "name": "value",
+    "list": [1, 2, 3], "nested": {"member": true}}, "qualifier": 1})"};
+
+json::Any Parse(const std::string_view set)
+{
+    auto set_json = json::JsonParser{}.FromBuffer(set);
+    EXPECT_TRUE(set_json.has_value());
+    return std::move(set_json).value();
+}
+
+// Encodes the set like the ConfigDaemon does, the buffer is allocated from the given memory resource like a response
+score::cpp::pmr::string Encode(const std::string_view set, score::cpp::pmr::memory_resource* const memory_resource)
+{
+    const auto set_json = Parse(set);
+    const auto encoded_set = wire_format::EncodeBinarySet(set_json.As<json::Object>().value().get());
+    EXPECT_TRUE(encoded_set.has_value());
+    return score::cpp::pmr::string{encoded_set.value().data(), encoded_set.value().size(), memory_resource};
+}
+
+}  // namespace
+
+class ReceivedBinarySetTest : public ::testing::Test
+{
+  protected:
+    memory::TrackingMemoryResource memory_resource_{};
+};
+
+TEST_F(ReceivedBinarySetTest, ParametersAreReadFromTheReceivedBuffer)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::CreateParameterSetFromBuffer()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a set held by its received buffer provides the same content as the parsed "
+                   "set.");
+
+    const ParameterSet parsed_set{Parse(kSet)};
+    const auto parameter_set = CreateParameterSetFromBuffer(Encode(kSet, &memory_resource_), &memory_resource_);
+
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<std::int32_t>("number").value(), 42);
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<float>("factor").value(), 0.5F);
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<std::string>("name").value(), "value");
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<ParameterSet::Array<std::uint8_t>>("list").value().size(), 3U);
+    EXPECT_EQ(parameter_set.value()->GetQualifier().value(),
+              score::platform::config_daemon::ParameterSetQualifier::kQualified);
+    EXPECT_EQ(parameter_set.value()->GetDigest(), parsed_set.GetDigest());
+    EXPECT_TRUE(parameter_set.value()->ContainsSameContent(parsed_set));
+}
+
+TEST_F(ReceivedBinarySetTest, ReceivedBufferIsHeldUntilTheLastReference)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::CreateParameterSetFromBuffer()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the received buffer is taken over by the set instead of being copied and "
+                   "is released as soon as the last reference to the set is gone.");
+
+    memory::TrackingMemoryResource response_memory_resource{};
+    auto encoded_set = Encode(kSet, &response_memory_resource);
+    const auto response_statistics = response_memory_resource.GetStatistics();
+
+    auto parameter_set = CreateParameterSetFromBuffer(std::move(encoded_set), &memory_resource_).value();
+    auto other_reference = parameter_set;
+    EXPECT_EQ(response_memory_resource.GetStatistics().allocations, response_statistics.allocations);
+    EXPECT_EQ(response_memory_resource.GetStatistics().GetLiveBytes(), response_statistics.GetLiveBytes());
+
+    parameter_set.reset();
+    EXPECT_EQ(memory_resource_.GetStatistics().deallocations, 0U);
+    EXPECT_EQ(response_memory_resource.GetStatistics().GetLiveBytes(), response_statistics.GetLiveBytes());
+
+    other_reference.reset();
+    EXPECT_EQ(memory_resource_.GetStatistics().GetLiveBytes(), 0);
+    EXPECT_EQ(response_memory_resource.GetStatistics().GetLiveBytes(), 0);
+}
+
+TEST_F(ReceivedBinarySetTest, InvalidBufferIsRejected)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::CreateParameterSetFromBuffer()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a buffer which is not a valid binary parameter set is rejected and "
+                   "released.");
+
+    const auto parameter_set = CreateParameterSetFromBuffer(score::cpp::pmr::string{"invalid", &memory_resource_},
+                                                            &memory_resource_);
+
+    ASSERT_FALSE(parameter_set.has_value());
+    EXPECT_EQ(parameter_set.error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(memory_resource_.GetStatistics().GetLiveBytes(), 0);
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
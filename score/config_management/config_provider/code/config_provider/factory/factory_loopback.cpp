@@ -0,0 +1,66 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/factory/factory_loopback.h"
+#include "score/config_management/config_provider/code/config_provider/details/config_provider_impl.h"
+#include "score/config_management/config_provider/code/proxies/details/loopback/internal_config_provider_impl.h"
+
+#include "platform/aas/lib/concurrency/future/interruptible_promise.h"
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+LoopbackConfigProviderFactory::LoopbackConfigProviderFactory()
+    : logger_{mw::log::CreateLogger(std::string_view("CfgP"))}
+{
+}
+
+score::cpp::pmr::unique_ptr<ConfigProvider> LoopbackConfigProviderFactory::Create(
+    std::shared_ptr<loopback::LoopbackChannel> channel,
+    score::cpp::stop_token token,
+    std::chrono::milliseconds timeout,
+    score::cpp::pmr::unique_ptr<Persistency> persistency,
+    score::cpp::optional<std::size_t> max_samples_limit,
+    score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval,
+    ParameterSetNameList prefetch_parameter_set_names,
+    score::cpp::pmr::memory_resource* const memory_resource,
+    IsAvailableNotificationCallback&& callback) const
+{
+    logger_.LogDebug() << "LoopbackConfigProviderFactory::" << __func__;
+
+    // there is no service discovery, the proxy is available as soon as it is created
+    concurrency::InterruptiblePromise<std::unique_ptr<IInternalConfigProvider>> proxy_promise{};
+    score::cpp::ignore = proxy_promise.SetValue(std::make_unique<LoopbackInternalConfigProvider>(std::move(channel)));
+
+    auto config_provider =
+        score::cpp::pmr::make_unique<ConfigProviderImpl>(memory_resource,
+                                                         proxy_promise.GetInterruptibleFuture().value(),
+                                                         token,
+                                                         memory_resource,
+                                                         max_samples_limit,
+                                                         polling_cycle_interval,
+                                                         std::move(callback),
+                                                         std::move(persistency),
+                                                         std::move(prefetch_parameter_set_names));
+
+    score::cpp::ignore = config_provider->WaitUntilConnected(timeout, token);
+    return config_provider;
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,76 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_FACTORY_FACTORY_LOOPBACK_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_FACTORY_FACTORY_LOOPBACK_H
+
+#include "score/config_management/config_provider/code/config_provider/config_provider.h"
+#include "score/config_management/config_provider/code/config_provider/factory/prefetch_manifest.h"
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+#include "score/config_management/config_provider/code/persistency/persistency.h"
+#include "score/config_management/config_provider/code/proxies/internal_config_provider.h"
+
+#include "score/mw/log/logger.h"
+
+#include <score/memory.hpp>
+#include <score/memory_resource.hpp>
+#include <score/optional.hpp>
+#include <score/stop_token.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Creates ConfigProviders connected through a loopback::LoopbackChannel instead of mw::com
+///
+/// The ConfigDaemon offers its service on the same channel, so both run in one process, e.g. in end-to-end tests and
+/// benchmarks. The ConfigProvider connects at once, its requests fail with kProxyNotReady until the service is offered.
+///
+class LoopbackConfigProviderFactory final
+{
+  public:
+    LoopbackConfigProviderFactory();
+    ~LoopbackConfigProviderFactory() = default;
+    LoopbackConfigProviderFactory(LoopbackConfigProviderFactory&&) = delete;
+    LoopbackConfigProviderFactory(const LoopbackConfigProviderFactory&) = delete;
+
+    LoopbackConfigProviderFactory& operator=(LoopbackConfigProviderFactory&&) & = delete;
+    LoopbackConfigProviderFactory& operator=(const LoopbackConfigProviderFactory&) & = delete;
+
+    score::cpp::pmr::unique_ptr<ConfigProvider> Create(
+        std::shared_ptr<loopback::LoopbackChannel> channel,
+        score::cpp::stop_token token,
+        std::chrono::milliseconds timeout,
+        score::cpp::pmr::unique_ptr<Persistency> persistency,
+        score::cpp::optional<std::size_t> max_samples_limit = score::cpp::nullopt,
+        score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval = score::cpp::nullopt,
+        ParameterSetNameList prefetch_parameter_set_names = ParameterSetNameList{},
+        score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource(),
+        IsAvailableNotificationCallback&& callback = []() noexcept {}) const;  // LCOV_EXCL_LINE tooling issue
+
+  private:
+    mw::log::Logger& logger_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_FACTORY_FACTORY_LOOPBACK_H
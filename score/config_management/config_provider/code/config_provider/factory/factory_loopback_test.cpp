@@ -0,0 +1,94 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/factory/factory_loopback.h"
+#include "score/config_management/config_provider/code/persistency/persistency_mock.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+
+constexpr auto kSetJson = R"({"parameters": {"parameter_name": 55}, "qualifier": 1})";
+
+class LoopbackServerStub final : public loopback::ILoopbackServer
+{
+  public:
+    Result<score::cpp::pmr::string> GetParameterSet(const score::cpp::string_view) override
+    {
+        return score::cpp::pmr::string{kSetJson};
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view) override
+    {
+        const auto set_json = json::JsonParser{}.FromBuffer(kSetJson);
+        const auto encoded_set = wire_format::EncodeBinarySet(set_json.value().As<json::Object>().value().get());
+        return score::cpp::pmr::string{encoded_set.value().data(), encoded_set.value().size()};
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetChanges(const score::cpp::string_view,
+                                                           const std::uint64_t,
+                                                           const std::uint64_t) override
+    {
+        return GetParameterSet("");
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetDictionary() override
+    {
+        return score::cpp::pmr::string{R"({"parameter_sets": ["set_name"]})"};
+    }
+};
+
+TEST(LoopbackConfigProviderFactoryTest, CreatedConfigProviderIsServedThroughChannel)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::LoopbackConfigProviderFactory::Create()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the created ConfigProvider is connected at once and fetches parameter sets "
+                   "from the server offered on the channel.");
+
+    LoopbackServerStub server{};
+    const auto channel = std::make_shared<loopback::LoopbackChannel>();
+    channel->Offer(server);
+
+    auto config_provider = LoopbackConfigProviderFactory{}.Create(
+        channel,
+        score::cpp::stop_token{},
+        std::chrono::milliseconds{1000},
+        score::cpp::pmr::make_unique<::testing::NiceMock<PersistencyMock>>(score::cpp::pmr::get_default_resource()));
+
+    ASSERT_NE(config_provider, nullptr);
+    const auto parameter_set = config_provider->GetParameterSet("set_name");
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_EQ(parameter_set.value()->GetParameterAs<std::int32_t>("parameter_name").value(), 55);
+    EXPECT_GE(channel->GetStatistics().served_requests, 1U);
+
+    config_provider.reset();
+    channel->StopOffer();
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
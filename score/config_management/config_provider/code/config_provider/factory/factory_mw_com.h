@@ -15,6 +15,7 @@
 #define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_FACTORY_FACTORY_MW_COM_H
 
 #include "score/config_management/config_provider/code/config_provider/details/config_provider_impl.h"
+#include "score/config_management/config_provider/code/config_provider/factory/prefetch_manifest.h"
 #include "score/config_management/config_provider/code/persistency/details/persistency_empty.h"
 #include "score/config_management/config_provider/code/proxies/details/mw_com/internal_config_provider_impl.h"
 
@@ -115,15 +116,58 @@ class ConfigProviderFactory final
                                                           std::move(persistency));
     }
 
+    /// @brief Creates a ConfigProvider which fetches the given parameter sets as one batch once connected
+    ///
+    /// The prefetched parameter sets are available before the IsAvailableNotificationCallback is called.
+    /// The list can be read from a manifest file via ReadPrefetchManifest().
+    ///
+    template <typename InternalConfigProviderPort>
+    score::cpp::pmr::unique_ptr<ConfigProvider> Create(
+        score::cpp::stop_token token,
+        std::chrono::milliseconds timeout,
+        ParameterSetNameList prefetch_parameter_set_names,
+        score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource(),
+        IsAvailableNotificationCallback&& callback = []() noexcept {}) const  // LCOV_EXCL_LINE tooling issue
+    {
+        return CreateInternal<InternalConfigProviderPort>(token,
+                                                          timeout,
+                                                          score::cpp::nullopt,
+                                                          score::cpp::nullopt,
+                                                          memory_resource,
+                                                          std::move(callback),
+                                                          score::cpp::pmr::make_unique<PersistencyImpl>(memory_resource),
+                                                          std::move(prefetch_parameter_set_names));
+    }
+
+    template <typename InternalConfigProviderPort>
+    score::cpp::pmr::unique_ptr<ConfigProvider> Create(
+        score::cpp::stop_token token,
+        score::cpp::pmr::unique_ptr<Persistency> persistency,
+        ParameterSetNameList prefetch_parameter_set_names,
+        score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource(),
+        IsAvailableNotificationCallback&& callback = []() noexcept {}) const  // LCOV_EXCL_LINE tooling issue
+    {
+        return CreateInternal<InternalConfigProviderPort>(token,
+                                                          std::chrono::milliseconds(0U),
+                                                          score::cpp::nullopt,
+                                                          score::cpp::nullopt,
+                                                          memory_resource,
+                                                          std::move(callback),
+                                                          std::move(persistency),
+                                                          std::move(prefetch_parameter_set_names));
+    }
+
   private:
     template <typename InternalConfigProviderPort>
-    score::cpp::pmr::unique_ptr<ConfigProvider> CreateInternal(score::cpp::stop_token token,
-                                                        std::chrono::milliseconds timeout,
-                                                        score::cpp::optional<std::size_t> max_samples_limit,
-                                                        score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval,
-                                                        score::cpp::pmr::memory_resource* const memory_resource,
-                                                        IsAvailableNotificationCallback&& callback,
-                                                        score::cpp::pmr::unique_ptr<Persistency> persistency) const
+    score::cpp::pmr::unique_ptr<ConfigProvider> CreateInternal(
+        score::cpp::stop_token token,
+        std::chrono::milliseconds timeout,
+        score::cpp::optional<std::size_t> max_samples_limit,
+        score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval,
+        score::cpp::pmr::memory_resource* const memory_resource,
+        IsAvailableNotificationCallback&& callback,
+        score::cpp::pmr::unique_ptr<Persistency> persistency,
+        ParameterSetNameList prefetch_parameter_set_names = ParameterSetNameList{}) const
     {
         using InternalConfigProviderStrategy =
             mw::service::backend::mw_com::SingleInstantiationStrategy<IInternalConfigProvider,
@@ -146,7 +190,8 @@ class ConfigProviderFactory final
             max_samples_limit,
             polling_cycle_interval,
             std::move(callback),
-            std::move(persistency));
+            std::move(persistency),
+            std::move(prefetch_parameter_set_names));
 
         score::cpp::ignore = config_provider->WaitUntilConnected(timeout, token);
         return config_provider;
@@ -163,6 +163,51 @@ TEST_F(ConfigProviderFactoryTest, CreateConfigProvider_CustomPolling_Persistency
     ASSERT_NE(nullptr, config_provider) << "Factory did not return a valid ConfigProvider object";
 }
 
+TEST_F(ConfigProviderFactoryTest, CreateConfigProvider_PrefetchList_NoPersistency)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Generation and analysis of equivalence classes");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderFactory::Create()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies successful creation with a prefetch list without persistency via config "
+                   "provider factory.");
+    score::platform::config_provider::ConfigProviderFactory config_provider_factory;
+    ParameterSetNameList prefetch_parameter_set_names{"set_name_1", "set_name_2"};
+    auto config_provider =
+        config_provider_factory.Create<DummyPort>({},                                // default stop_token
+                                                  std::chrono::milliseconds(0U),     // zero timeout
+                                                  std::move(prefetch_parameter_set_names),  // prefetch list
+                                                  score::cpp::pmr::get_default_resource(),  // default memory resource
+                                                  []() noexcept {}                   // empty callback
+        );
+    ASSERT_NE(nullptr, config_provider) << "Factory did not return a valid ConfigProvider object";
+}
+
+TEST_F(ConfigProviderFactoryTest, CreateConfigProvider_PrefetchList_Persistency)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Generation and analysis of equivalence classes");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::platform::config_provider::ConfigProviderFactory::Create()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies successful creation with a prefetch list and valid persistency via config "
+                   "provider factory.");
+    score::platform::config_provider::ConfigProviderFactory config_provider_factory;
+    auto persistency_mock = score::cpp::pmr::make_unique<PersistencyMock>(score::cpp::pmr::get_default_resource());
+    ParameterSetNameList prefetch_parameter_set_names{"set_name_1", "set_name_2"};
+    auto config_provider =
+        config_provider_factory.Create<DummyPort>({},                                // default stop_token
+                                                  std::move(persistency_mock),       // persistency provided
+                                                  std::move(prefetch_parameter_set_names),  // prefetch list
+                                                  score::cpp::pmr::get_default_resource(),  // default memory resource
+                                                  []() noexcept {}                   // empty callback
+        );
+    ASSERT_NE(nullptr, config_provider) << "Factory did not return a valid ConfigProvider object";
+}
+
 TEST_F(ConfigProviderFactoryTest, FoundServiceDuringCreation)
 {
     RecordProperty("Priority", "3");
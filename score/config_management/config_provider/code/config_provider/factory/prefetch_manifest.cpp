@@ -0,0 +1,84 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/factory/prefetch_manifest.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/logging.h"
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+Result<ParameterSetNameList> ParsePrefetchManifest(const score::json::Any& manifest,
+                                                   score::cpp::pmr::memory_resource* const memory_resource)
+{
+    const auto manifest_object = manifest.As<score::json::Object>();
+    if (!manifest_object.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to cast manifest to object instance";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Prefetch manifest is not an object");
+    }
+
+    const auto& manifest_obj = manifest_object.value().get();
+    const auto parameter_sets_it = manifest_obj.find("parameter_sets");
+    if (parameter_sets_it == manifest_obj.end())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to find parameter_sets";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Prefetch manifest has no parameter_sets");
+    }
+
+    const auto parameter_sets_list = parameter_sets_it->second.As<score::json::List>();
+    if (!parameter_sets_list.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to cast parameter_sets to JSON list";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Prefetch manifest parameter_sets is not a list");
+    }
+
+    ParameterSetNameList set_names{ParameterSetNameList::allocator_type{memory_resource}};
+    set_names.reserve(parameter_sets_list.value().get().size());
+    for (const auto& set_name_json : parameter_sets_list.value().get())
+    {
+        const auto set_name = set_name_json.As<std::string>();
+        if (!set_name.has_value())
+        {
+            mw::log::LogError("CfgP") << __func__ << ": Failed to cast parameter set name to string";
+            return MakeUnexpected(ConfigProviderError::kParsingFailed, "Prefetch manifest contains invalid name");
+        }
+        const std::string& set_name_str = set_name.value();
+        score::cpp::ignore = set_names.emplace_back(set_name_str.data(), set_name_str.size());
+    }
+    return set_names;
+}
+
+Result<ParameterSetNameList> ReadPrefetchManifest(const score::cpp::string_view manifest_path,
+                                                  score::cpp::pmr::memory_resource* const memory_resource)
+{
+    const score::json::JsonParser json_parser{};
+    const auto manifest = json_parser.FromFile(std::string_view{manifest_path.data(), manifest_path.size()});
+    if (!manifest.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to read prefetch manifest " << manifest_path << ": "
+                                  << manifest.error();
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Failed to read prefetch manifest");
+    }
+    return ParsePrefetchManifest(manifest.value(), memory_resource);
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,65 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_FACTORY_PREFETCH_MANIFEST_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_FACTORY_PREFETCH_MANIFEST_H
+
+#include "score/config_management/config_provider/code/config_provider/config_provider.h"
+
+#include "score/json/internal/model/any.h"
+#include "score/result/result.h"
+
+#include <score/memory_resource.hpp>
+#include <score/string_view.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Prefetch manifest
+///
+/// Lists the parameter sets which shall be fetched as one batch as soon as the ConfigDaemon is connected.
+/// The manifest is a JSON file of the following format:
+///
+/// {
+///     "parameter_sets": ["set_name_1", "set_name_2"]
+/// }
+///
+
+/// @brief Extracts the parameter set names from an already parsed prefetch manifest
+///
+/// @param manifest parsed manifest content
+/// @param memory_resource memory resource used for memory allocation
+/// @return list of parameter set names or kParsingFailed if the manifest is malformed
+///
+Result<ParameterSetNameList> ParsePrefetchManifest(const score::json::Any& manifest,
+                                                   score::cpp::pmr::memory_resource* const memory_resource);
+
+/// @brief Reads the parameter set names from a prefetch manifest file
+///
+/// @param manifest_path path to the manifest file
+/// @param memory_resource memory resource used for memory allocation
+/// @return list of parameter set names or kParsingFailed if the file can not be read or is malformed
+///
+Result<ParameterSetNameList> ReadPrefetchManifest(const score::cpp::string_view manifest_path,
+                                                  score::cpp::pmr::memory_resource* const memory_resource);
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_CONFIG_PROVIDER_FACTORY_PREFETCH_MANIFEST_H
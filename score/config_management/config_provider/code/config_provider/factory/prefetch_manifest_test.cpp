@@ -0,0 +1,126 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/config_provider/factory/prefetch_manifest.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+
+class PrefetchManifestTest : public ::testing::Test
+{
+  protected:
+    Result<ParameterSetNameList> Parse(const std::string& manifest) const
+    {
+        const auto manifest_json = json::JsonParser{}.FromBuffer(manifest);
+        EXPECT_TRUE(manifest_json.has_value());
+        return ParsePrefetchManifest(manifest_json.value(), score::cpp::pmr::get_default_resource());
+    }
+};
+
+TEST_F(PrefetchManifestTest, ParseValidManifest)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParsePrefetchManifest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that all parameter set names of the manifest are returned.");
+
+    const auto result = Parse(R"({"parameter_sets": ["set_name_1", "set_name_2"]})");
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value().size(), 2U);
+    EXPECT_EQ(result.value()[0], "set_name_1");
+    EXPECT_EQ(result.value()[1], "set_name_2");
+}
+
+TEST_F(PrefetchManifestTest, ParseEmptyManifest)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParsePrefetchManifest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that an empty list of parameter set names is accepted.");
+
+    const auto result = Parse(R"({"parameter_sets": []})");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result.value().empty());
+}
+
+TEST_F(PrefetchManifestTest, ParseMalformedManifest)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParsePrefetchManifest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that malformed manifests are rejected with kParsingFailed.");
+
+    EXPECT_EQ(Parse(R"(["set_name_1"])").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Parse(R"({"sets": ["set_name_1"]})").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Parse(R"({"parameter_sets": "set_name_1"})").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Parse(R"({"parameter_sets": ["set_name_1", 2]})").error(), ConfigProviderError::kParsingFailed);
+}
+
+TEST_F(PrefetchManifestTest, ReadManifestFromFile)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ReadPrefetchManifest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the manifest is read from a file.");
+
+    const std::string manifest_path = ::testing::TempDir() + "prefetch_manifest.json";
+    std::ofstream{manifest_path} << R"({"parameter_sets": ["set_name_1"]})";
+
+    const auto result = ReadPrefetchManifest(manifest_path, score::cpp::pmr::get_default_resource());
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value().size(), 1U);
+    EXPECT_EQ(result.value()[0], "set_name_1");
+}
+
+TEST_F(PrefetchManifestTest, ReadMissingManifestFile)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ReadPrefetchManifest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a missing manifest file is reported as kParsingFailed.");
+
+    const auto result = ReadPrefetchManifest("/non/existing/prefetch_manifest.json", score::cpp::pmr::get_default_resource());
+
+    EXPECT_EQ(result.error(), ConfigProviderError::kParsingFailed);
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
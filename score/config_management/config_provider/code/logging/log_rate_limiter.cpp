@@ -0,0 +1,73 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/logging/log_rate_limiter.h"
+
+#include <score/utility.hpp>
+
+#include <limits>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace logging
+{
+namespace
+{
+// Marks that no interval has been started yet
+constexpr LogRateLimiter::Clock::rep kNoIntervalStarted{std::numeric_limits<LogRateLimiter::Clock::rep>::min()};
+}  // namespace
+
+LogRateLimiter::LogRateLimiter(const std::uint64_t records_per_interval,
+                               const std::chrono::milliseconds interval) noexcept
+    : records_per_interval_{records_per_interval},
+      interval_{std::chrono::duration_cast<Clock::duration>(interval).count()},
+      interval_start_{kNoIntervalStarted},
+      records_in_interval_{0U},
+      suppressed_count_{0U}
+{
+}
+
+bool LogRateLimiter::ShouldLog(const Clock::time_point now) noexcept
+{
+    const auto now_ticks = now.time_since_epoch().count();
+    auto interval_start = interval_start_.load(std::memory_order_relaxed);
+    if ((interval_start == kNoIntervalStarted) || ((now_ticks - interval_start) >= interval_))
+    {
+        // Only the thread which wins the race starts the new interval, the others just account their record in it
+        if (interval_start_.compare_exchange_strong(interval_start, now_ticks, std::memory_order_relaxed))
+        {
+            records_in_interval_.store(0U, std::memory_order_relaxed);
+        }
+    }
+
+    if (records_in_interval_.fetch_add(1U, std::memory_order_relaxed) < records_per_interval_)
+    {
+        return true;
+    }
+    score::cpp::ignore = suppressed_count_.fetch_add(1U, std::memory_order_relaxed);
+    return false;
+}
+
+std::uint64_t LogRateLimiter::TakeSuppressedCount() noexcept
+{
+    return suppressed_count_.exchange(0U, std::memory_order_relaxed);
+}
+
+}  // namespace logging
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,80 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_LOGGING_LOG_RATE_LIMITER_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_LOGGING_LOG_RATE_LIMITER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace logging
+{
+
+#if defined(SCORE_CONFIG_PROVIDER_STRIP_VERBOSE_LOGGING)
+/// @brief Verbose diagnostics of the parameter access path got removed at compile time
+constexpr bool kVerboseLoggingEnabled{false};
+#else
+/// @brief Verbose diagnostics of the parameter access path are compiled in
+constexpr bool kVerboseLoggingEnabled{true};
+#endif
+
+///
+/// @brief Per call site rate limit for log records
+///
+/// Allows at most `records_per_interval` records within each interval and counts the suppressed ones. Meant to be
+/// used as function-local static at the call site, so that every call site gets its own budget. All methods are
+/// lock-free and may be called concurrently; the budget is approximate when an interval rolls over concurrently.
+///
+class LogRateLimiter final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint64_t kDefaultRecordsPerInterval{10U};
+    static constexpr std::chrono::milliseconds kDefaultInterval{1000};
+
+    explicit LogRateLimiter(const std::uint64_t records_per_interval = kDefaultRecordsPerInterval,
+                            const std::chrono::milliseconds interval = kDefaultInterval) noexcept;
+
+    /// @brief Decides whether a record may be emitted
+    ///
+    /// @param now point in time of the record
+    /// @return true if the record is within the budget of the current interval, false if it shall be dropped
+    ///
+    bool ShouldLog(const Clock::time_point now = Clock::now()) noexcept;
+
+    /// @brief Returns the number of suppressed records since the last call and resets it
+    ///
+    std::uint64_t TakeSuppressedCount() noexcept;
+
+  private:
+    const std::uint64_t records_per_interval_;
+    const Clock::rep interval_;
+    std::atomic<Clock::rep> interval_start_;
+    std::atomic<std::uint64_t> records_in_interval_;
+    std::atomic<std::uint64_t> suppressed_count_;
+};
+
+}  // namespace logging
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_LOGGING_LOG_RATE_LIMITER_H
@@ -0,0 +1,114 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/logging/log_rate_limiter.h"
+
+#include <gtest/gtest.h>
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace logging
+{
+namespace test
+{
+
+using namespace std::chrono_literals;
+
+class LogRateLimiterTest : public ::testing::Test
+{
+  protected:
+    const LogRateLimiter::Clock::time_point now_{LogRateLimiter::Clock::now()};
+    const std::chrono::milliseconds interval_{100ms};
+    LogRateLimiter rate_limiter_{2U, interval_};
+};
+
+TEST_F(LogRateLimiterTest, RecordsWithinBudgetAreLogged)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::logging::LogRateLimiter::ShouldLog()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that only the configured number of records is allowed within one interval.");
+
+    EXPECT_TRUE(rate_limiter_.ShouldLog(now_));
+    EXPECT_TRUE(rate_limiter_.ShouldLog(now_ + 1ms));
+    EXPECT_FALSE(rate_limiter_.ShouldLog(now_ + 2ms));
+    EXPECT_FALSE(rate_limiter_.ShouldLog(now_ + interval_ - 1ms));
+}
+
+TEST_F(LogRateLimiterTest, NewIntervalRestoresBudget)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::logging::LogRateLimiter::ShouldLog()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the budget is restored once the interval has elapsed.");
+
+    EXPECT_TRUE(rate_limiter_.ShouldLog(now_));
+    EXPECT_TRUE(rate_limiter_.ShouldLog(now_));
+    EXPECT_FALSE(rate_limiter_.ShouldLog(now_));
+
+    EXPECT_TRUE(rate_limiter_.ShouldLog(now_ + interval_));
+    EXPECT_TRUE(rate_limiter_.ShouldLog(now_ + interval_));
+    EXPECT_FALSE(rate_limiter_.ShouldLog(now_ + interval_));
+}
+
+TEST_F(LogRateLimiterTest, SuppressedRecordsAreCounted)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::logging::LogRateLimiter::TakeSuppressedCount()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that dropped records are counted and the counter is reset.");
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        score::cpp::ignore = rate_limiter_.ShouldLog(now_);
+    }
+
+    EXPECT_EQ(rate_limiter_.TakeSuppressedCount(), 3U);
+    EXPECT_EQ(rate_limiter_.TakeSuppressedCount(), 0U);
+}
+
+TEST_F(LogRateLimiterTest, ZeroBudgetSuppressesEverything)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::logging::LogRateLimiter::ShouldLog()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a rate limit of zero records drops every record.");
+
+    LogRateLimiter muted_rate_limiter{0U, interval_};
+
+    EXPECT_FALSE(muted_rate_limiter.ShouldLog(now_));
+    EXPECT_FALSE(muted_rate_limiter.ShouldLog(now_ + interval_));
+    EXPECT_EQ(muted_rate_limiter.TakeSuppressedCount(), 2U);
+}
+
+}  // namespace test
+}  // namespace logging
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
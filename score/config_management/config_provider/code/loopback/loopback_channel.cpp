@@ -0,0 +1,168 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include <algorithm>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace loopback
+{
+
+LoopbackChannel::LoopbackChannel() noexcept
+    : server_mutex_{},
+      server_{nullptr},
+      subscribers_mutex_{},
+      subscribers_{},
+      next_subscription_id_{0U},
+      initial_qualifier_state_{InitialQualifierState::kUndefined},
+      served_requests_{},
+      failed_requests_{},
+      published_events_{},
+      delivered_events_{},
+      request_latency_{}
+{
+}
+
+void LoopbackChannel::Offer(ILoopbackServer& server) noexcept
+{
+    const std::unique_lock<std::shared_mutex> lock{server_mutex_};
+    server_ = &server;
+}
+
+void LoopbackChannel::StopOffer() noexcept
+{
+    const std::unique_lock<std::shared_mutex> lock{server_mutex_};
+    server_ = nullptr;
+}
+
+bool LoopbackChannel::IsOffered() const noexcept
+{
+    const std::shared_lock<std::shared_mutex> lock{server_mutex_};
+    return server_ != nullptr;
+}
+
+template <typename Request>
+Result<score::cpp::pmr::string> LoopbackChannel::Serve(const Request& request) const
+{
+    // requests share the lock, so they are only serialized by the server itself
+    const std::shared_lock<std::shared_mutex> lock{server_mutex_};
+    if (server_ == nullptr)
+    {
+        failed_requests_.Increment();
+        return MakeUnexpected(ConfigProviderError::kProxyNotReady, "No server is offered on the loopback channel");
+    }
+    auto response = [this, &request]() {
+        const metrics::ScopedLatencyTimer timer{request_latency_, true};
+        return request(*server_);
+    }();
+    served_requests_.Increment();
+    if (not response.has_value())
+    {
+        failed_requests_.Increment();
+    }
+    return response;
+}
+
+Result<score::cpp::pmr::string> LoopbackChannel::GetParameterSet(const score::cpp::string_view set_name) const
+{
+    return Serve([set_name](ILoopbackServer& server) {
+        return server.GetParameterSet(set_name);
+    });
+}
+
+Result<score::cpp::pmr::string> LoopbackChannel::GetParameterSetAsBinary(const score::cpp::string_view set_name) const
+{
+    return Serve([set_name](ILoopbackServer& server) {
+        return server.GetParameterSetAsBinary(set_name);
+    });
+}
+
+Result<score::cpp::pmr::string> LoopbackChannel::GetParameterSetChanges(const score::cpp::string_view set_name,
+                                                                        const std::uint64_t base_version,
+                                                                        const std::uint64_t base_digest) const
+{
+    return Serve([set_name, base_version, base_digest](ILoopbackServer& server) {
+        return server.GetParameterSetChanges(set_name, base_version, base_digest);
+    });
+}
+
+Result<score::cpp::pmr::string> LoopbackChannel::GetParameterSetDictionary() const
+{
+    return Serve([](ILoopbackServer& server) {
+        return server.GetParameterSetDictionary();
+    });
+}
+
+LoopbackChannel::SubscriptionId LoopbackChannel::Subscribe(EventHandler&& handler)
+{
+    const std::lock_guard<std::mutex> lock{subscribers_mutex_};
+    const auto subscription_id = next_subscription_id_;
+    ++next_subscription_id_;
+    subscribers_.emplace_back(subscription_id, std::move(handler));
+    return subscription_id;
+}
+
+void LoopbackChannel::Unsubscribe(const SubscriptionId subscription_id) noexcept
+{
+    const std::lock_guard<std::mutex> lock{subscribers_mutex_};
+    score::cpp::ignore = subscribers_.erase(std::remove_if(subscribers_.begin(),
+                                                           subscribers_.end(),
+                                                           [subscription_id](const auto& subscriber) noexcept {
+                                                               return subscriber.first == subscription_id;
+                                                           }),
+                                            subscribers_.end());
+}
+
+bool LoopbackChannel::Publish(const score::cpp::string_view set_name) noexcept
+{
+    published_events_.Increment();
+    // the handlers run under the lock, so an unsubscribed handler never runs afterwards
+    const std::lock_guard<std::mutex> lock{subscribers_mutex_};
+    for (auto& subscriber : subscribers_)
+    {
+        subscriber.second(set_name);
+    }
+    delivered_events_.Increment(subscribers_.size());
+    return not subscribers_.empty();
+}
+
+void LoopbackChannel::SetInitialQualifierState(const InitialQualifierState initial_qualifier_state) noexcept
+{
+    initial_qualifier_state_.store(initial_qualifier_state);
+}
+
+InitialQualifierState LoopbackChannel::GetInitialQualifierState() const noexcept
+{
+    return initial_qualifier_state_.load();
+}
+
+LoopbackChannelStatistics LoopbackChannel::GetStatistics() const noexcept
+{
+    return LoopbackChannelStatistics{served_requests_.Get(),
+                                     failed_requests_.Get(),
+                                     published_events_.Get(),
+                                     delivered_events_.Get(),
+                                     request_latency_.GetSnapshot()};
+}
+
+}  // namespace loopback
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
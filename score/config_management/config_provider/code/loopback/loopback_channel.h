@@ -0,0 +1,150 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_LOOPBACK_LOOPBACK_CHANNEL_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_LOOPBACK_LOOPBACK_CHANNEL_H
+
+#include "score/config_management/config_provider/code/config_provider/initial_qualifier_state_types.h"
+#include "score/config_management/config_provider/code/metrics/counter.h"
+#include "score/config_management/config_provider/code/metrics/latency_histogram.h"
+
+#include "score/result/result.h"
+
+#include <score/callback.hpp>
+#include <score/string.hpp>
+#include <score/string_view.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace loopback
+{
+
+/// @brief Serves the requests sent through a LoopbackChannel, implemented by the service side
+class ILoopbackServer
+{
+  public:
+    ILoopbackServer() noexcept = default;
+    virtual ~ILoopbackServer() noexcept = default;
+    ILoopbackServer(ILoopbackServer&&) noexcept = delete;
+    ILoopbackServer(const ILoopbackServer&) noexcept = delete;
+    ILoopbackServer& operator=(ILoopbackServer&&) & noexcept = delete;
+    ILoopbackServer& operator=(const ILoopbackServer&) & noexcept = delete;
+
+    /// @brief Returns the parameter set as JSON text
+    virtual Result<score::cpp::pmr::string> GetParameterSet(const score::cpp::string_view set_name) = 0;
+    /// @brief Returns the parameter set in the binary wire format, see wire_format::BinarySetView
+    virtual Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view set_name) = 0;
+    /// @brief Returns the changes of the parameter set since base_version as JSON delta
+    virtual Result<score::cpp::pmr::string> GetParameterSetChanges(const score::cpp::string_view set_name,
+                                                                   const std::uint64_t base_version,
+                                                                   const std::uint64_t base_digest) = 0;
+    /// @brief Returns the dictionary of the parameter set identifiers as JSON text
+    virtual Result<score::cpp::pmr::string> GetParameterSetDictionary() = 0;
+};
+
+/// @brief Counters of a LoopbackChannel
+struct LoopbackChannelStatistics
+{
+    /// Requests answered by the server, including the failed ones
+    std::uint64_t served_requests;
+    /// Requests answered with an error, also the ones sent while no server was offered
+    std::uint64_t failed_requests;
+    /// LastUpdatedParameterSet events published by the service side
+    std::uint64_t published_events;
+    /// Events handed to subscribers, i.e. published events times the subscribers at that time
+    std::uint64_t delivered_events;
+    /// Time the server took to answer the requests
+    metrics::LatencyHistogramSnapshot request_latency;
+};
+
+///
+/// @brief In-process stand-in for the mw::com connection between the ConfigDaemon and its ConfigProviders
+///
+/// The service side offers an ILoopbackServer, publishes LastUpdatedParameterSet events and sets the
+/// InitialQualifierState. Any number of proxies send requests and subscribe to the events. Requests are served on the
+/// calling thread and run concurrently, events are handed to all subscribers on the publishing thread. So the
+/// ConfigDaemon and its clients run in one process without the middleware, e.g. in end-to-end tests and benchmarks.
+///
+class LoopbackChannel final
+{
+  public:
+    using EventHandler = score::cpp::callback<void(const score::cpp::string_view set_name), 64U>;
+    using SubscriptionId = std::uint64_t;
+
+    LoopbackChannel() noexcept;
+    ~LoopbackChannel() noexcept = default;
+    LoopbackChannel(LoopbackChannel&&) noexcept = delete;
+    LoopbackChannel(const LoopbackChannel&) noexcept = delete;
+    LoopbackChannel& operator=(LoopbackChannel&&) & noexcept = delete;
+    LoopbackChannel& operator=(const LoopbackChannel&) & noexcept = delete;
+
+    /// @brief Serves all following requests with server, which has to outlive the offer
+    void Offer(ILoopbackServer& server) noexcept;
+    /// @brief Withdraws the offer, returns once no request is served anymore
+    void StopOffer() noexcept;
+    bool IsOffered() const noexcept;
+
+    /// @brief Requests fail with ConfigProviderError::kProxyNotReady while no server is offered
+    Result<score::cpp::pmr::string> GetParameterSet(const score::cpp::string_view set_name) const;
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view set_name) const;
+    Result<score::cpp::pmr::string> GetParameterSetChanges(const score::cpp::string_view set_name,
+                                                           const std::uint64_t base_version,
+                                                           const std::uint64_t base_digest) const;
+    Result<score::cpp::pmr::string> GetParameterSetDictionary() const;
+
+    /// @brief Hands every following event to handler, which shouldn't block as it runs on the publishing thread
+    SubscriptionId Subscribe(EventHandler&& handler);
+    /// @brief Removes the subscription, returns once its handler doesn't run anymore
+    void Unsubscribe(const SubscriptionId subscription_id) noexcept;
+    /// @brief Hands the event to all subscribers, returns false if there is none
+    bool Publish(const score::cpp::string_view set_name) noexcept;
+
+    void SetInitialQualifierState(const InitialQualifierState initial_qualifier_state) noexcept;
+    InitialQualifierState GetInitialQualifierState() const noexcept;
+
+    LoopbackChannelStatistics GetStatistics() const noexcept;
+
+  private:
+    template <typename Request>
+    Result<score::cpp::pmr::string> Serve(const Request& request) const;
+
+    mutable std::shared_mutex server_mutex_;
+    ILoopbackServer* server_;
+    mutable std::mutex subscribers_mutex_;
+    std::vector<std::pair<SubscriptionId, EventHandler>> subscribers_;
+    SubscriptionId next_subscription_id_;
+    std::atomic<InitialQualifierState> initial_qualifier_state_;
+    mutable metrics::Counter served_requests_;
+    mutable metrics::Counter failed_requests_;
+    metrics::Counter published_events_;
+    metrics::Counter delivered_events_;
+    mutable metrics::LatencyHistogram request_latency_;
+};
+
+}  // namespace loopback
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_LOOPBACK_LOOPBACK_CHANNEL_H
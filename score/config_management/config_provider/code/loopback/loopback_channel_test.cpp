@@ -0,0 +1,172 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace loopback
+{
+namespace test
+{
+
+class LoopbackServerStub final : public ILoopbackServer
+{
+  public:
+    Result<score::cpp::pmr::string> GetParameterSet(const score::cpp::string_view set_name) override
+    {
+        if (set_name == "unknown_set")
+        {
+            return MakeUnexpected(ConfigProviderError::kParameterSetNotFound);
+        }
+        return score::cpp::pmr::string{R"({"parameters": {}, "qualifier": 0})"};
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view) override
+    {
+        return score::cpp::pmr::string{"binary_set"};
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetChanges(const score::cpp::string_view,
+                                                           const std::uint64_t base_version,
+                                                           const std::uint64_t) override
+    {
+        return score::cpp::pmr::string{std::to_string(base_version).c_str()};
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetDictionary() override
+    {
+        return score::cpp::pmr::string{R"({"parameter_sets": ["set_name"]})"};
+    }
+};
+
+class LoopbackChannelTest : public ::testing::Test
+{
+  protected:
+    LoopbackChannel channel_{};
+    LoopbackServerStub server_{};
+};
+
+TEST_F(LoopbackChannelTest, RequestsFailWhileNoServerIsOffered)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::loopback::LoopbackChannel");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that requests fail with kProxyNotReady before the offer and after StopOffer().");
+
+    EXPECT_FALSE(channel_.IsOffered());
+    EXPECT_EQ(channel_.GetParameterSet("set_name").error(), ConfigProviderError::kProxyNotReady);
+
+    channel_.Offer(server_);
+    channel_.StopOffer();
+
+    EXPECT_FALSE(channel_.IsOffered());
+    EXPECT_EQ(channel_.GetParameterSetDictionary().error(), ConfigProviderError::kProxyNotReady);
+    const auto statistics = channel_.GetStatistics();
+    EXPECT_EQ(statistics.served_requests, 0U);
+    EXPECT_EQ(statistics.failed_requests, 2U);
+}
+
+TEST_F(LoopbackChannelTest, OfferedServerAnswersRequests)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::loopback::LoopbackChannel");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the requests and their arguments are passed to the offered server and that "
+                   "its answers and errors are returned and counted.");
+
+    channel_.Offer(server_);
+
+    EXPECT_TRUE(channel_.IsOffered());
+    EXPECT_EQ(channel_.GetParameterSet("set_name").value(), R"({"parameters": {}, "qualifier": 0})");
+    EXPECT_EQ(channel_.GetParameterSet("unknown_set").error(), ConfigProviderError::kParameterSetNotFound);
+    EXPECT_EQ(channel_.GetParameterSetAsBinary("set_name").value(), "binary_set");
+    EXPECT_EQ(channel_.GetParameterSetChanges("set_name", 42U, 7U).value(), "42");
+    EXPECT_EQ(channel_.GetParameterSetDictionary().value(), R"({"parameter_sets": ["set_name"]})");
+
+    const auto statistics = channel_.GetStatistics();
+    EXPECT_EQ(statistics.served_requests, 5U);
+    EXPECT_EQ(statistics.failed_requests, 1U);
+    EXPECT_EQ(statistics.request_latency.count, 5U);
+}
+
+TEST_F(LoopbackChannelTest, PublishedEventsAreHandedToSubscribers)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::loopback::LoopbackChannel");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that events are handed to all current subscribers and no more to the "
+                   "unsubscribed ones.");
+
+    std::vector<std::string> first_events{};
+    std::vector<std::string> second_events{};
+
+    EXPECT_FALSE(channel_.Publish("set_name_0"));
+
+    const auto first_id = channel_.Subscribe([&first_events](const score::cpp::string_view set_name) {
+        first_events.emplace_back(set_name.data(), set_name.size());
+    });
+    score::cpp::ignore = channel_.Subscribe([&second_events](const score::cpp::string_view set_name) {
+        second_events.emplace_back(set_name.data(), set_name.size());
+    });
+    EXPECT_TRUE(channel_.Publish("set_name_1"));
+    channel_.Unsubscribe(first_id);
+    EXPECT_TRUE(channel_.Publish("set_name_2"));
+
+    EXPECT_EQ(first_events, (std::vector<std::string>{"set_name_1"}));
+    EXPECT_EQ(second_events, (std::vector<std::string>{"set_name_1", "set_name_2"}));
+    const auto statistics = channel_.GetStatistics();
+    EXPECT_EQ(statistics.published_events, 3U);
+    EXPECT_EQ(statistics.delivered_events, 3U);
+}
+
+TEST_F(LoopbackChannelTest, InitialQualifierStateIsSharedWithProxies)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::loopback::LoopbackChannel");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the last set InitialQualifierState is returned.");
+
+    EXPECT_EQ(channel_.GetInitialQualifierState(), InitialQualifierState::kUndefined);
+
+    channel_.SetInitialQualifierState(InitialQualifierState::kQualified);
+
+    EXPECT_EQ(channel_.GetInitialQualifierState(), InitialQualifierState::kQualified);
+}
+
+}  // namespace test
+}  // namespace loopback
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
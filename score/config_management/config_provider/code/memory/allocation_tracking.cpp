@@ -0,0 +1,181 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/memory/allocation_tracking.h"
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+// Every block carries its size in a header in front of the returned memory, so the deallocation can be counted
+constexpr std::size_t kAllocationHeaderSize{alignof(std::max_align_t)};
+
+std::atomic<std::int64_t> live_heap_bytes{0};
+
+// Heap allocations of the current thread, zero-initialized without a guard, so that they can be used while the thread
+// is started or torn down
+struct ThreadAllocations
+{
+    std::uint64_t allocations;
+    std::uint64_t deallocations;
+    std::uint64_t allocated_bytes;
+    std::uint64_t deallocated_bytes;
+    std::int64_t live_bytes;
+    std::int64_t peak_bytes;
+};
+
+thread_local ThreadAllocations thread_allocations{};
+
+score::config_management::config_provider::memory::AllocationStatistics GetThreadStatistics() noexcept
+{
+    return {thread_allocations.allocations,
+            thread_allocations.deallocations,
+            thread_allocations.allocated_bytes,
+            thread_allocations.deallocated_bytes,
+            0U};
+}
+
+void* AllocateTracked(const std::size_t size) noexcept
+{
+    void* const block = std::malloc(size + kAllocationHeaderSize);
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    *static_cast<std::size_t*>(block) = size;
+    score::cpp::ignore = live_heap_bytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    ++thread_allocations.allocations;
+    thread_allocations.allocated_bytes += size;
+    thread_allocations.live_bytes += static_cast<std::int64_t>(size);
+    thread_allocations.peak_bytes = std::max(thread_allocations.peak_bytes, thread_allocations.live_bytes);
+    return static_cast<char*>(block) + kAllocationHeaderSize;
+}
+
+void DeallocateTracked(void* const memory) noexcept
+{
+    if (memory == nullptr)
+    {
+        return;
+    }
+    void* const block = static_cast<char*>(memory) - kAllocationHeaderSize;
+    const auto size = *static_cast<std::size_t*>(block);
+    score::cpp::ignore = live_heap_bytes.fetch_sub(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    ++thread_allocations.deallocations;
+    thread_allocations.deallocated_bytes += size;
+    thread_allocations.live_bytes -= static_cast<std::int64_t>(size);
+    std::free(block);
+}
+
+}  // namespace
+
+// The array and nothrow variants of the global allocation functions forward to these ones
+void* operator new(std::size_t size)
+{
+    void* const memory = AllocateTracked(size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    DeallocateTracked(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    DeallocateTracked(memory);
+}
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace memory
+{
+
+std::int64_t GetLiveHeapBytes() noexcept
+{
+    return live_heap_bytes.load(std::memory_order_relaxed);
+}
+
+AllocationScope::AllocationScope() noexcept
+    : heap_start_{GetThreadStatistics()},
+      heap_start_live_bytes_{thread_allocations.live_bytes},
+      enclosing_heap_peak_bytes_{thread_allocations.peak_bytes},
+      memory_resource_{nullptr},
+      resource_start_{}
+{
+    thread_allocations.peak_bytes = thread_allocations.live_bytes;
+}
+
+AllocationScope::AllocationScope(TrackingMemoryResource& memory_resource) noexcept
+    : heap_start_{GetThreadStatistics()},
+      heap_start_live_bytes_{thread_allocations.live_bytes},
+      enclosing_heap_peak_bytes_{thread_allocations.peak_bytes},
+      memory_resource_{&memory_resource},
+      resource_start_{}
+{
+    memory_resource.ResetPeak();
+    resource_start_ = memory_resource.GetStatistics();
+    thread_allocations.peak_bytes = thread_allocations.live_bytes;
+}
+
+AllocationScope::~AllocationScope() noexcept
+{
+    // an enclosing scope sees the peak of this one as well
+    thread_allocations.peak_bytes = std::max(thread_allocations.peak_bytes, enclosing_heap_peak_bytes_);
+}
+
+AllocationStatistics AllocationScope::GetHeapStatistics() const noexcept
+{
+    const auto current = GetThreadStatistics();
+    const auto peak_bytes = std::max(thread_allocations.peak_bytes - heap_start_live_bytes_, std::int64_t{0});
+    return {current.allocations - heap_start_.allocations,
+            current.deallocations - heap_start_.deallocations,
+            current.allocated_bytes - heap_start_.allocated_bytes,
+            current.deallocated_bytes - heap_start_.deallocated_bytes,
+            static_cast<std::uint64_t>(peak_bytes)};
+}
+
+AllocationStatistics AllocationScope::GetResourceStatistics() const noexcept
+{
+    if (memory_resource_ == nullptr)
+    {
+        return {};
+    }
+    const auto current = memory_resource_->GetStatistics();
+    const auto start_live_bytes = static_cast<std::uint64_t>(std::max(resource_start_.GetLiveBytes(), std::int64_t{0}));
+    return {current.allocations - resource_start_.allocations,
+            current.deallocations - resource_start_.deallocations,
+            current.allocated_bytes - resource_start_.allocated_bytes,
+            current.deallocated_bytes - resource_start_.deallocated_bytes,
+            (current.peak_bytes > start_live_bytes) ? (current.peak_bytes - start_live_bytes) : 0U};
+}
+
+}  // namespace memory
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
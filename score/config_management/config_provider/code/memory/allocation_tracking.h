@@ -0,0 +1,82 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_MEMORY_ALLOCATION_TRACKING_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_MEMORY_ALLOCATION_TRACKING_H
+
+#include "score/config_management/config_provider/code/memory/tracking_memory_resource.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace memory
+{
+
+/// @brief Bytes the whole process allocated through the global allocation functions and did not release yet
+std::int64_t GetLiveHeapBytes() noexcept;
+
+///
+/// @brief Counts the heap allocations of the current thread from its construction on
+///
+/// Linking this library replaces the global allocation functions of the binary, so it is meant for tests and
+/// benchmarks only. Allocations of other threads, e.g. of the polling routine of a ConfigProvider, are not counted and
+/// over-aligned allocations are not tracked at all. If a TrackingMemoryResource is given, its allocations during the
+/// scope are reported as well; these include the allocations of all threads.
+///
+class AllocationScope final
+{
+  public:
+    AllocationScope() noexcept;
+    explicit AllocationScope(TrackingMemoryResource& memory_resource) noexcept;
+    ~AllocationScope() noexcept;
+
+    AllocationScope(AllocationScope&&) noexcept = delete;
+    AllocationScope(const AllocationScope&) noexcept = delete;
+    AllocationScope& operator=(AllocationScope&&) & noexcept = delete;
+    AllocationScope& operator=(const AllocationScope&) & noexcept = delete;
+
+    /// @brief Heap allocations of this thread, the peak is counted from the bytes allocated at the start of the scope
+    AllocationStatistics GetHeapStatistics() const noexcept;
+    /// @brief Allocations of the given TrackingMemoryResource, all zero if there is none
+    AllocationStatistics GetResourceStatistics() const noexcept;
+
+  private:
+    AllocationStatistics heap_start_;
+    std::int64_t heap_start_live_bytes_;
+    std::int64_t enclosing_heap_peak_bytes_;
+    TrackingMemoryResource* const memory_resource_;
+    AllocationStatistics resource_start_;
+};
+
+/// @brief Heap allocations made by call on the current thread
+template <typename Call>
+AllocationStatistics MeasureHeapAllocations(Call&& call)
+{
+    const AllocationScope scope{};
+    std::forward<Call>(call)();
+    return scope.GetHeapStatistics();
+}
+
+}  // namespace memory
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_MEMORY_ALLOCATION_TRACKING_H
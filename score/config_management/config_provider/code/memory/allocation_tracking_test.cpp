@@ -0,0 +1,180 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/memory/allocation_tracking.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <thread>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace memory
+{
+namespace test
+{
+namespace
+{
+
+// keeps the compiler from eliding the allocations of the tests
+void* volatile allocation_sink{nullptr};
+
+template <std::size_t Size>
+void AllocateAndRelease()
+{
+    auto block = std::make_unique<std::array<char, Size>>();
+    allocation_sink = block.get();
+}
+
+}  // namespace
+
+TEST(AllocationScopeTest, CountsHeapAllocationsOfCall)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::memory::MeasureHeapAllocations()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the allocations, bytes and peak of a call on the heap are counted.");
+
+    const auto statistics = MeasureHeapAllocations([]() {
+        AllocateAndRelease<256U>();
+        AllocateAndRelease<128U>();
+    });
+
+    EXPECT_EQ(statistics.allocations, 2U);
+    EXPECT_EQ(statistics.deallocations, 2U);
+    EXPECT_EQ(statistics.allocated_bytes, 384U);
+    EXPECT_EQ(statistics.GetLiveBytes(), 0);
+    EXPECT_EQ(statistics.peak_bytes, 256U);
+}
+
+TEST(AllocationScopeTest, CallWithoutAllocationReportsZero)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::memory::MeasureHeapAllocations()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a call without heap allocation is reported as such.");
+
+    std::array<int, 16U> values{};
+    const auto statistics = MeasureHeapAllocations([&values]() {
+        values.fill(1);
+    });
+
+    EXPECT_EQ(statistics.allocations, 0U);
+    EXPECT_EQ(statistics.allocated_bytes, 0U);
+    EXPECT_EQ(statistics.peak_bytes, 0U);
+}
+
+TEST(AllocationScopeTest, AllocationsOfOtherThreadsAreNotCounted)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::memory::AllocationScope");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that only the allocations of the current thread are counted.");
+
+    constexpr std::size_t kThreadAllocationSize{1024U * 1024U};
+    const AllocationScope scope{};
+    std::thread other_thread{[]() {
+        AllocateAndRelease<kThreadAllocationSize>();
+    }};
+    other_thread.join();
+
+    EXPECT_LT(scope.GetHeapStatistics().allocated_bytes, kThreadAllocationSize);
+}
+
+TEST(AllocationScopeTest, NestedScopeCountsItsOwnPeak)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::memory::AllocationScope");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that a nested scope has its own peak, which is seen by the enclosing scope.");
+
+    const AllocationScope outer_scope{};
+    const auto held_block = std::make_unique<std::array<char, 64U>>();
+    allocation_sink = held_block.get();
+    {
+        const AllocationScope inner_scope{};
+        AllocateAndRelease<512U>();
+        EXPECT_EQ(inner_scope.GetHeapStatistics().peak_bytes, 512U);
+    }
+
+    EXPECT_EQ(outer_scope.GetHeapStatistics().peak_bytes, 576U);
+    EXPECT_EQ(outer_scope.GetHeapStatistics().GetLiveBytes(), 64);
+}
+
+TEST(AllocationScopeTest, CountsAllocationsOfTrackingMemoryResource)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::memory::AllocationScope::GetResourceStatistics()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the allocations of the memory resource during the scope are reported.");
+
+    TrackingMemoryResource memory_resource{};
+    void* const earlier_block = memory_resource.allocate(1000U, 8U);
+
+    const AllocationScope scope{memory_resource};
+    void* const block = memory_resource.allocate(100U, 8U);
+    const auto statistics = scope.GetResourceStatistics();
+    memory_resource.deallocate(block, 100U, 8U);
+    memory_resource.deallocate(earlier_block, 1000U, 8U);
+
+    EXPECT_EQ(statistics.allocations, 1U);
+    EXPECT_EQ(statistics.allocated_bytes, 100U);
+    EXPECT_EQ(statistics.peak_bytes, 100U);
+    EXPECT_EQ(AllocationScope{}.GetResourceStatistics().allocations, 0U);
+}
+
+TEST(AllocationScopeTest, LiveHeapBytesFollowAllocations)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::memory::GetLiveHeapBytes()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the live heap bytes of the process follow the allocations.");
+
+    const auto live_bytes_before = GetLiveHeapBytes();
+    auto block = std::make_unique<std::array<char, 4096U>>();
+    allocation_sink = block.get();
+    const auto live_bytes_with_block = GetLiveHeapBytes();
+    block.reset();
+
+    EXPECT_GE(live_bytes_with_block - live_bytes_before, 4096);
+    EXPECT_LT(GetLiveHeapBytes(), live_bytes_with_block);
+}
+
+}  // namespace test
+}  // namespace memory
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
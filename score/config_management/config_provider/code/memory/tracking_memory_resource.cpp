@@ -0,0 +1,85 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/memory/tracking_memory_resource.h"
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace memory
+{
+
+TrackingMemoryResource::TrackingMemoryResource(score::cpp::pmr::memory_resource* const upstream) noexcept
+    : score::cpp::pmr::memory_resource{},
+      upstream_{upstream},
+      allocations_{0U},
+      deallocations_{0U},
+      allocated_bytes_{0U},
+      deallocated_bytes_{0U},
+      live_bytes_{0U},
+      peak_bytes_{0U}
+{
+}
+
+AllocationStatistics TrackingMemoryResource::GetStatistics() const noexcept
+{
+    return AllocationStatistics{allocations_.load(std::memory_order_relaxed),
+                                deallocations_.load(std::memory_order_relaxed),
+                                allocated_bytes_.load(std::memory_order_relaxed),
+                                deallocated_bytes_.load(std::memory_order_relaxed),
+                                peak_bytes_.load(std::memory_order_relaxed)};
+}
+
+void TrackingMemoryResource::ResetPeak() noexcept
+{
+    peak_bytes_.store(live_bytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void* TrackingMemoryResource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    // the upstream resource throws if it is exhausted, in which case nothing is counted
+    void* const memory = upstream_->allocate(bytes, alignment);
+    score::cpp::ignore = allocations_.fetch_add(1U, std::memory_order_relaxed);
+    score::cpp::ignore = allocated_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    const auto live_bytes = live_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    auto peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+    while ((live_bytes > peak_bytes) &&
+           (!peak_bytes_.compare_exchange_weak(peak_bytes, live_bytes, std::memory_order_relaxed)))
+    {
+    }
+    return memory;
+}
+
+void TrackingMemoryResource::do_deallocate(void* const memory, const std::size_t bytes, const std::size_t alignment)
+{
+    upstream_->deallocate(memory, bytes, alignment);
+    score::cpp::ignore = deallocations_.fetch_add(1U, std::memory_order_relaxed);
+    score::cpp::ignore = deallocated_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    score::cpp::ignore = live_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool TrackingMemoryResource::do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+}  // namespace memory
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,97 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_MEMORY_TRACKING_MEMORY_RESOURCE_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_MEMORY_TRACKING_MEMORY_RESOURCE_H
+
+#include <score/memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace memory
+{
+
+/// @brief Allocations counted by a TrackingMemoryResource or during an AllocationScope
+struct AllocationStatistics
+{
+    std::uint64_t allocations;
+    std::uint64_t deallocations;
+    std::uint64_t allocated_bytes;
+    std::uint64_t deallocated_bytes;
+    /// Highest number of bytes which were allocated and not yet deallocated at the same time
+    std::uint64_t peak_bytes;
+
+    /// @brief Bytes which are allocated and not yet deallocated, negative if more was released than allocated
+    std::int64_t GetLiveBytes() const noexcept
+    {
+        return static_cast<std::int64_t>(allocated_bytes) - static_cast<std::int64_t>(deallocated_bytes);
+    }
+};
+
+///
+/// @brief Memory resource counting the allocations it forwards to its upstream resource
+///
+/// Handed to the ConfigProvider or to ParameterSets instead of their memory resource, it shows how many allocations
+/// and bytes an API call costs and how much memory cached parameter sets hold. Counting is lock-free and safe to be
+/// done concurrently, the statistics of concurrent calls are not separated though.
+///
+class TrackingMemoryResource final : public score::cpp::pmr::memory_resource
+{
+  public:
+    explicit TrackingMemoryResource(
+        score::cpp::pmr::memory_resource* const upstream = score::cpp::pmr::get_default_resource()) noexcept;
+    ~TrackingMemoryResource() noexcept override = default;
+
+    TrackingMemoryResource(TrackingMemoryResource&&) noexcept = delete;
+    TrackingMemoryResource(const TrackingMemoryResource&) noexcept = delete;
+    TrackingMemoryResource& operator=(TrackingMemoryResource&&) & noexcept = delete;
+    TrackingMemoryResource& operator=(const TrackingMemoryResource&) & noexcept = delete;
+
+    AllocationStatistics GetStatistics() const noexcept;
+    /// @brief Restarts the peak from the bytes allocated right now, e.g. to measure the peak of a single call
+    void ResetPeak() noexcept;
+
+    score::cpp::pmr::memory_resource* GetUpstream() const noexcept
+    {
+        return upstream_;
+    }
+
+  private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+    void do_deallocate(void* const memory, const std::size_t bytes, const std::size_t alignment) override;
+    bool do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept override;
+
+    score::cpp::pmr::memory_resource* const upstream_;
+    std::atomic<std::uint64_t> allocations_;
+    std::atomic<std::uint64_t> deallocations_;
+    std::atomic<std::uint64_t> allocated_bytes_;
+    std::atomic<std::uint64_t> deallocated_bytes_;
+    std::atomic<std::uint64_t> live_bytes_;
+    std::atomic<std::uint64_t> peak_bytes_;
+};
+
+}  // namespace memory
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_MEMORY_TRACKING_MEMORY_RESOURCE_H
@@ -0,0 +1,131 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/memory/tracking_memory_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace memory
+{
+namespace test
+{
+
+TEST(TrackingMemoryResourceTest, CountsAllocationsAndBytes)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::memory::TrackingMemoryResource::GetStatistics()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that allocations, deallocations, their bytes and the peak are counted.");
+
+    TrackingMemoryResource memory_resource{};
+
+    void* const first = memory_resource.allocate(100U, 8U);
+    void* const second = memory_resource.allocate(28U, 4U);
+    memory_resource.deallocate(first, 100U, 8U);
+    const auto statistics = memory_resource.GetStatistics();
+    memory_resource.deallocate(second, 28U, 4U);
+
+    EXPECT_EQ(statistics.allocations, 2U);
+    EXPECT_EQ(statistics.deallocations, 1U);
+    EXPECT_EQ(statistics.allocated_bytes, 128U);
+    EXPECT_EQ(statistics.deallocated_bytes, 100U);
+    EXPECT_EQ(statistics.GetLiveBytes(), 28);
+    EXPECT_EQ(statistics.peak_bytes, 128U);
+    EXPECT_EQ(memory_resource.GetStatistics().GetLiveBytes(), 0);
+}
+
+TEST(TrackingMemoryResourceTest, ResetPeakRestartsFromLiveBytes)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::memory::TrackingMemoryResource::ResetPeak()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the peak restarts from the bytes allocated right now.");
+
+    TrackingMemoryResource memory_resource{};
+    void* const large = memory_resource.allocate(1024U, 8U);
+    void* const small = memory_resource.allocate(16U, 8U);
+    memory_resource.deallocate(large, 1024U, 8U);
+
+    memory_resource.ResetPeak();
+    EXPECT_EQ(memory_resource.GetStatistics().peak_bytes, 16U);
+
+    void* const medium = memory_resource.allocate(64U, 8U);
+    EXPECT_EQ(memory_resource.GetStatistics().peak_bytes, 80U);
+
+    memory_resource.deallocate(medium, 64U, 8U);
+    memory_resource.deallocate(small, 16U, 8U);
+}
+
+TEST(TrackingMemoryResourceTest, ForwardsToUpstreamResource)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::memory::TrackingMemoryResource");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that allocations of containers are forwarded to the upstream resource.");
+
+    TrackingMemoryResource upstream{};
+    TrackingMemoryResource memory_resource{&upstream};
+    {
+        const score::cpp::pmr::string value{"a string value which does not fit into the small string buffer",
+                                            &memory_resource};
+        EXPECT_EQ(memory_resource.GetStatistics().allocations, 1U);
+        EXPECT_EQ(upstream.GetStatistics().allocations, 1U);
+        EXPECT_EQ(upstream.GetStatistics().allocated_bytes, memory_resource.GetStatistics().allocated_bytes);
+    }
+    EXPECT_EQ(memory_resource.GetStatistics().GetLiveBytes(), 0);
+    EXPECT_EQ(upstream.GetStatistics().GetLiveBytes(), 0);
+    EXPECT_EQ(memory_resource.GetUpstream(), &upstream);
+}
+
+TEST(TrackingMemoryResourceTest, IsEqualOnlyToItself)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::memory::TrackingMemoryResource");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that memory of a resource is never released through another resource.");
+
+    TrackingMemoryResource memory_resource{};
+    TrackingMemoryResource other_memory_resource{};
+
+    EXPECT_TRUE(memory_resource.is_equal(memory_resource));
+    EXPECT_FALSE(memory_resource.is_equal(other_memory_resource));
+    EXPECT_FALSE(memory_resource.is_equal(*score::cpp::pmr::get_default_resource()));
+}
+
+}  // namespace test
+}  // namespace memory
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,65 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_METRICS_COUNTER_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_METRICS_COUNTER_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace metrics
+{
+
+///
+/// @brief Monotonic event counter
+///
+/// Lock-free and safe to be incremented and read concurrently. Increments use relaxed ordering, so a read is not
+/// synchronized with other counters.
+///
+class Counter final
+{
+  public:
+    Counter() noexcept = default;
+    ~Counter() noexcept = default;
+
+    Counter(Counter&&) noexcept = delete;
+    Counter(const Counter&) noexcept = delete;
+    Counter& operator=(Counter&&) & noexcept = delete;
+    Counter& operator=(const Counter&) & noexcept = delete;
+
+    void Increment(const std::uint64_t value = 1U) noexcept
+    {
+        static_cast<void>(value_.fetch_add(value, std::memory_order_relaxed));
+    }
+
+    std::uint64_t Get() const noexcept
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<std::uint64_t> value_{0U};
+};
+
+}  // namespace metrics
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_METRICS_COUNTER_H
@@ -0,0 +1,132 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/metrics/latency_histogram.h"
+
+#include <algorithm>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace metrics
+{
+namespace
+{
+
+constexpr std::uint64_t kMaxValueUs{(std::uint64_t{1U} << (LatencyHistogram::kMaxExponent + 1U)) - 1U};
+
+// Smallest recorded value which reaches the given percentile, reported as upper bound of its bucket
+std::uint64_t GetValueAtPercentile(const std::array<std::uint64_t, LatencyHistogram::kBucketCount>& bucket_counts,
+                                   const std::uint64_t count,
+                                   const std::uint64_t percentile,
+                                   const std::uint64_t max_us) noexcept
+{
+    if (count == 0U)
+    {
+        return 0U;
+    }
+    const std::uint64_t rank{((count * percentile) + 99U) / 100U};
+    std::uint64_t cumulative_count{0U};
+    for (std::size_t index{0U}; index < bucket_counts.size(); ++index)
+    {
+        cumulative_count += bucket_counts[index];
+        if (cumulative_count >= rank)
+        {
+            return std::min(LatencyHistogram::GetBucketUpperBound(index), max_us);
+        }
+    }
+    return max_us;  // LCOV_EXCL_LINE only reachable if buckets were recorded concurrently to the snapshot
+}
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() noexcept : buckets_{}, sum_us_{0U}, max_us_{0U}
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::Record(const std::chrono::microseconds latency) noexcept
+{
+    const std::uint64_t value_us{(latency.count() > 0) ? static_cast<std::uint64_t>(latency.count()) : 0U};
+    static_cast<void>(buckets_[GetBucketIndex(value_us)].fetch_add(1U, std::memory_order_relaxed));
+    static_cast<void>(sum_us_.fetch_add(value_us, std::memory_order_relaxed));
+
+    auto max_us = max_us_.load(std::memory_order_relaxed);
+    while ((value_us > max_us) &&
+           (not max_us_.compare_exchange_weak(max_us, value_us, std::memory_order_relaxed)))
+    {
+    }
+}
+
+void LatencyHistogram::Record(const Clock::duration latency) noexcept
+{
+    Record(std::chrono::duration_cast<std::chrono::microseconds>(latency));
+}
+
+LatencyHistogramSnapshot LatencyHistogram::GetSnapshot() const noexcept
+{
+    std::array<std::uint64_t, kBucketCount> bucket_counts{};
+    std::uint64_t count{0U};
+    for (std::size_t index{0U}; index < kBucketCount; ++index)
+    {
+        bucket_counts[index] = buckets_[index].load(std::memory_order_relaxed);
+        count += bucket_counts[index];
+    }
+    const auto max_us = max_us_.load(std::memory_order_relaxed);
+
+    return LatencyHistogramSnapshot{count,
+                                    sum_us_.load(std::memory_order_relaxed),
+                                    max_us,
+                                    GetValueAtPercentile(bucket_counts, count, 50U, max_us),
+                                    GetValueAtPercentile(bucket_counts, count, 90U, max_us),
+                                    GetValueAtPercentile(bucket_counts, count, 99U, max_us)};
+}
+
+std::size_t LatencyHistogram::GetBucketIndex(const std::uint64_t value_us) noexcept
+{
+    const std::uint64_t value{std::min(value_us, kMaxValueUs)};
+    if (value < kSubBucketCount)
+    {
+        return static_cast<std::size_t>(value);
+    }
+
+    std::size_t most_significant_bit{kSubBucketBits};
+    while ((value >> (most_significant_bit + 1U)) != 0U)
+    {
+        ++most_significant_bit;
+    }
+    const std::size_t shift{most_significant_bit - kSubBucketBits};
+    return ((shift + 1U) * kSubBucketCount) + (static_cast<std::size_t>(value >> shift) - kSubBucketCount);
+}
+
+std::uint64_t LatencyHistogram::GetBucketUpperBound(const std::size_t index) noexcept
+{
+    if (index < kSubBucketCount)
+    {
+        return index;
+    }
+    const std::size_t shift{(index / kSubBucketCount) - 1U};
+    const std::uint64_t sub_bucket{(index % kSubBucketCount) + kSubBucketCount};
+    return ((sub_bucket + 1U) << shift) - 1U;
+}
+
+}  // namespace metrics
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
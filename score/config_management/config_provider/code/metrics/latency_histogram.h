@@ -0,0 +1,125 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_METRICS_LATENCY_HISTOGRAM_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_METRICS_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace metrics
+{
+
+/// @brief Point-in-time view of a LatencyHistogram, all durations in microseconds
+///
+/// Percentiles are reported as upper bound of the bucket they fall into, i.e. with a relative error of at most 12.5%.
+///
+struct LatencyHistogramSnapshot
+{
+    std::uint64_t count;
+    std::uint64_t sum_us;
+    std::uint64_t max_us;
+    std::uint64_t p50_us;
+    std::uint64_t p90_us;
+    std::uint64_t p99_us;
+};
+
+///
+/// @brief Lock-free log-linear latency histogram
+///
+/// Every power of two is split into kSubBucketCount linear buckets, so the bucket width grows with the value and the
+/// relative resolution stays constant. Values below kSubBucketCount microseconds are recorded exactly, values beyond
+/// the covered range are clamped into the last bucket. Recording is wait-free except for updating the maximum.
+///
+class LatencyHistogram final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t kSubBucketBits{3U};
+    static constexpr std::size_t kSubBucketCount{std::size_t{1U} << kSubBucketBits};
+    /// Highest resolved power of two, i.e. values up to 2^36us (about 19 hours)
+    static constexpr std::size_t kMaxExponent{35U};
+    static constexpr std::size_t kBucketCount{((kMaxExponent - kSubBucketBits) + 2U) * kSubBucketCount};
+
+    LatencyHistogram() noexcept;
+    ~LatencyHistogram() noexcept = default;
+
+    LatencyHistogram(LatencyHistogram&&) noexcept = delete;
+    LatencyHistogram(const LatencyHistogram&) noexcept = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) & noexcept = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) & noexcept = delete;
+
+    void Record(const std::chrono::microseconds latency) noexcept;
+    void Record(const Clock::duration latency) noexcept;
+
+    LatencyHistogramSnapshot GetSnapshot() const noexcept;
+
+    /// @brief Index of the bucket a value in microseconds is recorded in
+    static std::size_t GetBucketIndex(const std::uint64_t value_us) noexcept;
+    /// @brief Highest value in microseconds recorded in the bucket with the given index
+    static std::uint64_t GetBucketUpperBound(const std::size_t index) noexcept;
+
+  private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_;
+    std::atomic<std::uint64_t> sum_us_;
+    std::atomic<std::uint64_t> max_us_;
+};
+
+///
+/// @brief Records the lifetime of a scope into a histogram
+///
+/// A timer which is not armed does not read the clock at all, which keeps the cost of unread metrics close to zero.
+///
+class ScopedLatencyTimer final
+{
+  public:
+    ScopedLatencyTimer(LatencyHistogram& histogram, const bool armed) noexcept
+        : histogram_{armed ? &histogram : nullptr},
+          start_{armed ? LatencyHistogram::Clock::now() : LatencyHistogram::Clock::time_point{}}
+    {
+    }
+
+    ~ScopedLatencyTimer() noexcept
+    {
+        if (histogram_ != nullptr)
+        {
+            histogram_->Record(LatencyHistogram::Clock::now() - start_);
+        }
+    }
+
+    ScopedLatencyTimer(ScopedLatencyTimer&&) noexcept = delete;
+    ScopedLatencyTimer(const ScopedLatencyTimer&) noexcept = delete;
+    ScopedLatencyTimer& operator=(ScopedLatencyTimer&&) & noexcept = delete;
+    ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) & noexcept = delete;
+
+  private:
+    LatencyHistogram* const histogram_;
+    const LatencyHistogram::Clock::time_point start_;
+};
+
+}  // namespace metrics
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_METRICS_LATENCY_HISTOGRAM_H
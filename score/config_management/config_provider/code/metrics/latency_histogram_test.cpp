@@ -0,0 +1,164 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/metrics/counter.h"
+#include "score/config_management/config_provider/code/metrics/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace metrics
+{
+namespace test
+{
+
+using namespace std::chrono_literals;
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::metrics::LatencyHistogram::GetSnapshot()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a histogram without samples reports all values as zero.");
+
+    const LatencyHistogram histogram{};
+    const auto snapshot = histogram.GetSnapshot();
+
+    EXPECT_EQ(snapshot.count, 0U);
+    EXPECT_EQ(snapshot.sum_us, 0U);
+    EXPECT_EQ(snapshot.max_us, 0U);
+    EXPECT_EQ(snapshot.p50_us, 0U);
+    EXPECT_EQ(snapshot.p99_us, 0U);
+}
+
+TEST(LatencyHistogramTest, BucketsAreLogLinear)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::metrics::LatencyHistogram::GetBucketIndex()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that small values are bucketed exactly, larger values with constant relative "
+                   "resolution and values beyond the covered range are clamped.");
+
+    for (std::uint64_t value{0U}; value < LatencyHistogram::kSubBucketCount; ++value)
+    {
+        EXPECT_EQ(LatencyHistogram::GetBucketUpperBound(LatencyHistogram::GetBucketIndex(value)), value);
+    }
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(8U), 8U);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(15U), 15U);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(16U), 16U);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(17U), 16U);
+    EXPECT_EQ(LatencyHistogram::GetBucketUpperBound(16U), 17U);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(1000U), LatencyHistogram::GetBucketIndex(1023U));
+    EXPECT_EQ(LatencyHistogram::GetBucketUpperBound(LatencyHistogram::GetBucketIndex(1000U)), 1023U);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(std::numeric_limits<std::uint64_t>::max()),
+              LatencyHistogram::kBucketCount - 1U);
+}
+
+TEST(LatencyHistogramTest, SnapshotReportsPercentiles)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::metrics::LatencyHistogram::GetSnapshot()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies count, sum, maximum and percentiles of recorded latencies.");
+
+    LatencyHistogram histogram{};
+    for (std::int64_t value{1}; value <= 100; ++value)
+    {
+        histogram.Record(std::chrono::microseconds{value});
+    }
+    histogram.Record(-5us);
+
+    const auto snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(snapshot.count, 101U);
+    EXPECT_EQ(snapshot.sum_us, 5050U);
+    EXPECT_EQ(snapshot.max_us, 100U);
+    EXPECT_EQ(snapshot.p50_us, 51U);
+    EXPECT_EQ(snapshot.p90_us, 95U);
+    EXPECT_EQ(snapshot.p99_us, 100U);
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecordingIsNotLost)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::metrics::LatencyHistogram::Record()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that samples recorded from several threads are all counted.");
+
+    LatencyHistogram histogram{};
+    Counter counter{};
+    std::vector<std::thread> threads{};
+    for (std::int64_t thread_index{0}; thread_index < 4; ++thread_index)
+    {
+        threads.emplace_back([&histogram, &counter, thread_index]() {
+            for (std::int64_t i{0}; i < 1000; ++i)
+            {
+                histogram.Record(std::chrono::microseconds{thread_index * 1000 + i});
+                counter.Increment();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(snapshot.count, 4000U);
+    EXPECT_EQ(snapshot.max_us, 3999U);
+    EXPECT_EQ(counter.Get(), 4000U);
+}
+
+TEST(ScopedLatencyTimerTest, OnlyArmedTimerRecords)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::metrics::ScopedLatencyTimer");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a scope is only recorded if the timer is armed.");
+
+    LatencyHistogram histogram{};
+    {
+        const ScopedLatencyTimer timer{histogram, false};
+    }
+    EXPECT_EQ(histogram.GetSnapshot().count, 0U);
+    {
+        const ScopedLatencyTimer timer{histogram, true};
+    }
+    EXPECT_EQ(histogram.GetSnapshot().count, 1U);
+}
+
+}  // namespace test
+}  // namespace metrics
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -13,6 +13,7 @@
 
 #include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
 
+#include "score/json/json_parser.h"
 #include "score/json/json_writer.h"
 
 namespace score
@@ -25,13 +26,307 @@ namespace config_provider
 ParameterSet::ParameterSet(score::json::Any set_json, score::cpp::pmr::memory_resource* const memory_resource)
     : logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
       set_json_(std::move(set_json)),
+      set_json_parsed_{},
+      serialized_set_{},
+      serialized_set_storage_{},
+      read_serialized_set_{},
+      binary_set_{},
+      base_set_{},
+      changed_parameters_{},
+      removed_parameters_{},
+      changed_qualifier_{},
+      version_{},
+      digest_{},
+      digest_computed_{},
       memory_resource_{memory_resource}
 {
+    // The set is already parsed, so GetSetJson() shall never try to parse it
+    std::call_once(set_json_parsed_, []() noexcept {});
+}
+
+ParameterSet::ParameterSet(const std::string_view serialized_set,
+                           std::shared_ptr<const void> serialized_set_storage,
+                           score::cpp::pmr::memory_resource* const memory_resource)
+    : logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
+      set_json_{},
+      set_json_parsed_{},
+      serialized_set_{serialized_set},
+      serialized_set_storage_{std::move(serialized_set_storage)},
+      read_serialized_set_{},
+      binary_set_{},
+      base_set_{},
+      changed_parameters_{},
+      removed_parameters_{},
+      changed_qualifier_{},
+      version_{},
+      digest_{},
+      digest_computed_{},
+      memory_resource_{memory_resource}
+{
+}
+
+ParameterSet::ParameterSet(SerializedSetReader read_serialized_set,
+                           score::cpp::pmr::memory_resource* const memory_resource)
+    : logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
+      set_json_{},
+      set_json_parsed_{},
+      serialized_set_{},
+      serialized_set_storage_{},
+      read_serialized_set_{std::move(read_serialized_set)},
+      binary_set_{},
+      base_set_{},
+      changed_parameters_{},
+      removed_parameters_{},
+      changed_qualifier_{},
+      version_{},
+      digest_{},
+      digest_computed_{},
+      memory_resource_{memory_resource}
+{
+}
+
+ParameterSet::ParameterSet(const wire_format::BinarySetView binary_set,
+                           std::shared_ptr<const void> binary_set_storage,
+                           score::cpp::pmr::memory_resource* const memory_resource)
+    : logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
+      set_json_{},
+      set_json_parsed_{},
+      serialized_set_{},
+      serialized_set_storage_{std::move(binary_set_storage)},
+      read_serialized_set_{},
+      binary_set_{binary_set},
+      base_set_{},
+      changed_parameters_{},
+      removed_parameters_{},
+      changed_qualifier_{},
+      version_{},
+      digest_{},
+      digest_computed_{},
+      memory_resource_{memory_resource}
+{
+}
+
+ParameterSet::ParameterSet(score::json::Any set_json,
+                           const std::uint64_t version,
+                           score::cpp::pmr::memory_resource* const memory_resource)
+    : logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
+      set_json_(std::move(set_json)),
+      set_json_parsed_{},
+      serialized_set_{},
+      serialized_set_storage_{},
+      read_serialized_set_{},
+      binary_set_{},
+      base_set_{},
+      changed_parameters_{},
+      removed_parameters_{},
+      changed_qualifier_{},
+      version_{version},
+      digest_{},
+      digest_computed_{},
+      memory_resource_{memory_resource}
+{
+    std::call_once(set_json_parsed_, []() noexcept {});
+}
+
+ParameterSet::ParameterSet(std::shared_ptr<const ParameterSet> base_set,
+                           score::json::Object changed_parameters,
+                           const std::vector<std::string>& removed_parameters,
+                           score::json::Any qualifier,
+                           const std::uint64_t version,
+                           score::cpp::pmr::memory_resource* const memory_resource)
+    : logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
+      set_json_{},
+      set_json_parsed_{},
+      serialized_set_{},
+      serialized_set_storage_{},
+      read_serialized_set_{},
+      binary_set_{},
+      base_set_{std::move(base_set)},
+      changed_parameters_{},
+      removed_parameters_{},
+      changed_qualifier_{std::move(qualifier)},
+      version_{version},
+      digest_{},
+      digest_computed_{},
+      memory_resource_{memory_resource}
+{
+    if (base_set_->base_set_ != nullptr)
+    {
+        for (const auto& parameter : base_set_->changed_parameters_)
+        {
+            score::cpp::ignore = changed_parameters_.emplace(std::string{parameter.first.GetAsStringView()},
+                                                             parameter.second.CloneByValue());
+        }
+        removed_parameters_ = base_set_->removed_parameters_;
+        base_set_ = base_set_->base_set_;
+    }
+    for (const auto& removed_parameter : removed_parameters)
+    {
+        const auto changed_parameter = changed_parameters_.find(std::string_view{removed_parameter});
+        if (changed_parameter != changed_parameters_.end())
+        {
+            score::cpp::ignore = changed_parameters_.erase(changed_parameter);
+        }
+        score::cpp::ignore = removed_parameters_.insert(removed_parameter);
+    }
+    while (!changed_parameters.empty())
+    {
+        auto changed_parameter = changed_parameters.extract(changed_parameters.begin());
+        const auto removed_parameter = removed_parameters_.find(changed_parameter.key().GetAsStringView());
+        if (removed_parameter != removed_parameters_.end())
+        {
+            score::cpp::ignore = removed_parameters_.erase(removed_parameter);
+        }
+        const auto previous_change = changed_parameters_.find(changed_parameter.key().GetAsStringView());
+        if (previous_change != changed_parameters_.end())
+        {
+            score::cpp::ignore = changed_parameters_.erase(previous_change);
+        }
+        score::cpp::ignore = changed_parameters_.insert(std::move(changed_parameter));
+    }
+
+    if ((changed_parameters_.size() + removed_parameters_.size()) > kMaxSharedChanges)
+    {
+        // combining ever more changes would cost more than copying the set once
+        score::json::Object set_object{};
+        score::cpp::ignore = set_object.emplace(std::string{"parameters"}, MergeChangesWithBaseSet());
+        score::cpp::ignore = set_object.emplace(std::string{"qualifier"}, std::move(changed_qualifier_));
+        set_json_ = std::move(set_object);
+        std::call_once(set_json_parsed_, []() noexcept {});
+        base_set_.reset();
+        changed_parameters_.clear();
+        removed_parameters_.clear();
+        changed_qualifier_ = score::json::Any{};
+    }
+}
+
+bool ParameterSet::IsReadFromBaseSet(const score::cpp::string_view& parameter_name) const
+{
+    if (base_set_ == nullptr)
+    {
+        return false;
+    }
+    const std::string_view name{parameter_name.data(), parameter_name.size()};
+    return (changed_parameters_.count(name) == 0U) && (removed_parameters_.count(name) == 0U);
+}
+
+score::json::Object ParameterSet::MergeChangesWithBaseSet() const
+{
+    score::json::Object parameters{};
+    const auto base_parameters = base_set_->GetParameters();
+    if (base_parameters.has_value())
+    {
+        const auto base_parameters_object = base_parameters.value().get().As<score::json::Object>();
+        if (base_parameters_object.has_value())
+        {
+            for (const auto& parameter : base_parameters_object.value().get())
+            {
+                const auto name = parameter.first.GetAsStringView();
+                if ((changed_parameters_.count(name) == 0U) && (removed_parameters_.count(name) == 0U))
+                {
+                    score::cpp::ignore = parameters.emplace(std::string{name}, parameter.second.CloneByValue());
+                }
+            }
+        }
+    }
+    for (const auto& parameter : changed_parameters_)
+    {
+        score::cpp::ignore =
+            parameters.emplace(std::string{parameter.first.GetAsStringView()}, parameter.second.CloneByValue());
+    }
+    return parameters;
+}
+
+score::cpp::optional<std::uint64_t> ParameterSet::GetVersion() const noexcept
+{
+    return version_;
+}
+
+score::cpp::optional<std::uint64_t> ParameterSet::GetDigest() const
+{
+    // the content of a set never changes, so its digest is only computed once
+    std::call_once(digest_computed_, [this]() { digest_ = ComputeDigest(); });
+    return digest_;
+}
+
+score::cpp::optional<std::uint64_t> ParameterSet::ComputeDigest() const
+{
+    if (binary_set_.has_value())
+    {
+        return wire_format::ComputeBinarySetDigest(binary_set_->GetBuffer());
+    }
+    const auto set_object = GetSetJson().As<score::json::Object>();
+    if (!set_object.has_value())
+    {
+        return score::cpp::nullopt;
+    }
+    const auto binary_set = wire_format::EncodeBinarySet(set_object.value().get());
+    if (!binary_set.has_value())
+    {
+        logger_.LogWarn() << "ParameterSet::" << __func__ << ": Failed to encode set: " << binary_set.error();
+        return score::cpp::nullopt;
+    }
+    return wire_format::ComputeBinarySetDigest(binary_set.value());
+}
+
+const score::json::Any& ParameterSet::GetSetJson() const
+{
+    std::call_once(set_json_parsed_, [this]() {
+        // A set resulting from changes only merges them with its base set if a caller needs the whole set
+        if (base_set_ != nullptr)
+        {
+            score::json::Object set_object{};
+            score::cpp::ignore = set_object.emplace(std::string{"parameters"}, MergeChangesWithBaseSet());
+            score::cpp::ignore = set_object.emplace(std::string{"qualifier"}, changed_qualifier_.CloneByValue());
+            set_json_ = std::move(set_object);
+            return;
+        }
+        // A binary set is only decoded if a caller needs its JSON representation
+        if (binary_set_.has_value())
+        {
+            auto decoding_result = binary_set_->ToJson();
+            if (decoding_result.has_value())
+            {
+                set_json_ = std::move(decoding_result).value();
+            }
+            else
+            {
+                logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to decode binary set: "
+                                   << decoding_result.error();
+            }
+            return;
+        }
+        // A read set is only kept until it is parsed
+        std::string read_set{};
+        if (!read_serialized_set_.empty())
+        {
+            auto read_result = read_serialized_set_();
+            if (!read_result.has_value())
+            {
+                logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to read serialized set: "
+                                   << read_result.error();
+                return;
+            }
+            read_set = std::move(read_result).value();
+        }
+        const std::string_view serialized_set = read_serialized_set_.empty() ? serialized_set_ : read_set;
+        auto parsing_result = score::json::JsonParser{}.FromBuffer(serialized_set);
+        if (parsing_result.has_value())
+        {
+            set_json_ = std::move(parsing_result).value();
+        }
+        else
+        {
+            logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to parse serialized set: "
+                               << parsing_result.error();
+        }
+    });
+    return set_json_;
 }
 
 Result<std::reference_wrapper<const score::json::Any>> ParameterSet::GetParameters() const
 {
-    const auto& set_result = set_json_.As<score::json::Object>();
+    const auto& set_result = GetSetJson().As<score::json::Object>();
     if (!set_result.has_value())
     {
         logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to cast JSON set to object instance";
@@ -74,12 +369,28 @@ bool ParameterSet::ContainsSameContent(const ParameterSet& target_parameter_set)
 Result<std::reference_wrapper<const score::json::Any>> ParameterSet::GetParameterAsJsonAny(
     const score::cpp::string_view& parameter_name) const
 {
+    if (base_set_ != nullptr)
+    {
+        const std::string_view name{parameter_name.data(), parameter_name.size()};
+        const auto changed_parameter = changed_parameters_.find(name);
+        if (changed_parameter != changed_parameters_.end())
+        {
+            return std::cref(changed_parameter->second);
+        }
+        if (removed_parameters_.count(name) != 0U)
+        {
+            return MakeUnexpected(ConfigProviderError::kParameterNotFound);
+        }
+        return base_set_->GetParameterAsJsonAny(parameter_name);
+    }
+
     // Acquiring set Object
-    const auto& set_result = set_json_.As<score::json::Object>();
+    const auto& set_result = GetSetJson().As<score::json::Object>();
     if (!set_result.has_value())
     {
-        logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name << "]: "
-                           << "Failed to cast JSON set to object instance";
+        SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [",
+                                                         parameter_name,
+                                                         "]: Failed to cast JSON set to object instance");
         return MakeUnexpected(ConfigProviderError::kObjectCastingError);
     }
     const auto& set_obj = set_result.value().get();  // Got Set Object!
@@ -88,8 +399,7 @@ Result<std::reference_wrapper<const score::json::Any>> ParameterSet::GetParamete
     const auto parameters_it = set_obj.find("parameters");
     if (parameters_it == set_obj.end())
     {
-        logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name << "]: "
-                           << "Failed to find parameters";
+        SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [", parameter_name, "]: Failed to find parameters");
         return MakeUnexpected(ConfigProviderError::kParsingFailed);
     }
     const auto& parameters_json = parameters_it->second;  // Got Parameters Json!
@@ -98,8 +408,9 @@ Result<std::reference_wrapper<const score::json::Any>> ParameterSet::GetParamete
     const auto& parameters_result = parameters_json.As<json::Object>();
     if (!parameters_result.has_value())
     {
-        logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name << "]: "
-                           << "Failed to cast JSON parameters to object instance";
+        SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [",
+                                                         parameter_name,
+                                                         "]: Failed to cast JSON parameters to object instance");
         return MakeUnexpected(ConfigProviderError::kObjectCastingError);
     }
     const auto& parameters_obj = parameters_result.value().get();  // Got Parameters Object!
@@ -108,13 +419,23 @@ Result<std::reference_wrapper<const score::json::Any>> ParameterSet::GetParamete
     const auto set_it = parameters_obj.find(parameter_name);
     if (set_it == parameters_obj.end())
     {
-        logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name << "]: "
-                           << "Failed to find parameter in set";
+        SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [", parameter_name, "]: Failed to find parameter in set");
         return MakeUnexpected(ConfigProviderError::kParameterNotFound);
     }
     return std::cref(set_it->second);
 }
 
+Result<wire_format::BinaryValue> ParameterSet::FindBinaryParameter(const score::cpp::string_view& parameter_name) const
+{
+    auto value = binary_set_->FindParameter({parameter_name.data(), parameter_name.size()});
+    if (!value.has_value())
+    {
+        SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [", parameter_name, "]: Failed to find parameter in set");
+        return MakeUnexpected(ConfigProviderError::kParameterNotFound);
+    }
+    return value;
+}
+
 score::Result<std::string> ParameterSet::FormatAsKeyValuePairs() const
 {
     return GetParametersAsString();
@@ -123,7 +444,7 @@ score::Result<std::string> ParameterSet::FormatAsKeyValuePairs() const
 score::Result<std::string> ParameterSet::GetParametersAsString() const
 {
     // Acquiring set Object
-    const auto& set_result = set_json_.As<score::json::Object>();
+    const auto& set_result = GetSetJson().As<score::json::Object>();
     if (!set_result.has_value())
     {
         logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to cast JSON set to object instance";
@@ -144,6 +465,31 @@ score::Result<std::string> ParameterSet::GetParametersAsString() const
     return ConvertJsonToString(parameters_json);
 }
 
+score::Result<std::string> ParameterSet::GetSetAsString() const
+{
+    // A binary set is decoded for each call, so that the set does not keep a JSON tree besides its buffer
+    if (binary_set_.has_value())
+    {
+        const auto decoding_result = binary_set_->ToJson();
+        if (!decoding_result.has_value())
+        {
+            logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to decode binary set: "
+                               << decoding_result.error();
+            return MakeUnexpected(ConfigProviderError::kParsingFailed);
+        }
+        return ConvertJsonToString(decoding_result.value());
+    }
+    if (serialized_set_storage_ != nullptr)
+    {
+        return std::string{serialized_set_};
+    }
+    if (!read_serialized_set_.empty())
+    {
+        return read_serialized_set_();
+    }
+    return ConvertJsonToString(GetSetJson());
+}
+
 score::Result<std::string> ParameterSet::ConvertJsonToString(const score::json::Any& json) const
 {
     // Acquiring json object
@@ -170,8 +516,29 @@ score::Result<std::string> ParameterSet::ConvertJsonToString(const score::json::
 
 score::Result<score::platform::config_daemon::ParameterSetQualifier> ParameterSet::GetQualifier() const
 {
+    if (binary_set_.has_value())
+    {
+        const auto qualifier = binary_set_->GetQualifier();
+        if (!qualifier.has_value())
+        {
+            logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to find qualifier";
+            return MakeUnexpected(ConfigProviderError::kParsingFailed);
+        }
+        using score::platform::config_daemon::ParameterSetQualifier;
+        if (qualifier.value() <= score::cpp::to_underlying(ParameterSetQualifier::kModified))
+        {
+            return static_cast<ParameterSetQualifier>(qualifier.value());
+        }
+        return MakeUnexpected(ConfigProviderError::kValueCastingError);
+    }
+
+    if (base_set_ != nullptr)
+    {
+        return ConvertJsonToQualifier(changed_qualifier_);
+    }
+
     // Acquiring set Object
-    const auto& set_result = set_json_.As<score::json::Object>();
+    const auto& set_result = GetSetJson().As<score::json::Object>();
     if (!set_result.has_value())
     {
         logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to cast JSON set to object instance";
@@ -186,7 +553,13 @@ score::Result<score::platform::config_daemon::ParameterSetQualifier> ParameterSe
         logger_.LogError() << "ParameterSet::" << __func__ << ": Failed to find qualifier";
         return MakeUnexpected(ConfigProviderError::kParsingFailed);
     }
-    const auto value_result = qualifier_it->second.As<std::uint8_t>();
+    return ConvertJsonToQualifier(qualifier_it->second);
+}
+
+score::Result<score::platform::config_daemon::ParameterSetQualifier> ParameterSet::ConvertJsonToQualifier(
+    const score::json::Any& qualifier_json) const
+{
+    const auto value_result = qualifier_json.As<std::uint8_t>();
     if (value_result.has_value() == true)
     {
         const std::uint8_t qualifier = value_result.value();
@@ -16,15 +16,40 @@
 
 #include "config_management/ConfigDaemon/code/data_model/parameter_set_qualifier.h"
 #include "score/config_management/config_provider/code/config_provider/error/error.h"
+#include "score/config_management/config_provider/code/logging/log_rate_limiter.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
 
 #include "score/json/internal/model/any.h"
 #include "score/result/result.h"
 #include "score/mw/log/logger.h"
 
+#include <score/callback.hpp>
 #include <score/memory_resource.hpp>
+#include <score/optional.hpp>
 #include <score/vector.hpp>
 #include <score/zip_iterator.hpp>
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Emits a rate-limited error record from a ParameterSet member, prefixed with "ParameterSet::" and the
+/// enclosing function name. Every use site owns its function-local rate limiter, so one noisy accessor cannot
+/// silence the others. Compiles to nothing if verbose logging is stripped.
+#define SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(...)                                                      \
+    do                                                                                                            \
+    {                                                                                                             \
+        if constexpr (::score::config_management::config_provider::logging::kVerboseLoggingEnabled)              \
+        {                                                                                                         \
+            static ::score::config_management::config_provider::logging::LogRateLimiter rate_limiter{};           \
+            LogParameterAccessError(rate_limiter, "ParameterSet::", __func__, __VA_ARGS__);                       \
+        }                                                                                                         \
+    } while (false)
+
 namespace score
 {
 namespace config_management
@@ -39,6 +64,8 @@ class ParameterSet final
     using Array = score::cpp::pmr::vector<PrimitiveType>;
     template <typename PrimitiveType>
     using TwoDimensionalArray = Array<Array<PrimitiveType>>;
+    /// @brief Reads the serialized JSON representation of a parameter set, e.g. by decompressing it from a file
+    using SerializedSetReader = score::cpp::callback<score::Result<std::string>()>;
 
     template <typename>
     struct IsArray : std::false_type
@@ -53,6 +80,66 @@ class ParameterSet final
     explicit ParameterSet(score::json::Any set_json,
                           score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource());
 
+    /// @brief Creates a parameter set from its serialized JSON representation, which is parsed on first access
+    ///
+    /// @param serialized_set serialized parameter set, has to stay valid as long as serialized_set_storage is alive
+    /// @param serialized_set_storage owner of the memory serialized_set refers to, e.g. a memory-mapped file
+    /// @param memory_resource memory resource used for memory allocation
+    ///
+    ParameterSet(const std::string_view serialized_set,
+                 std::shared_ptr<const void> serialized_set_storage,
+                 score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource());
+
+    /// @brief Creates a parameter set whose serialized JSON representation is read and parsed on first access
+    ///
+    /// @param read_serialized_set reads the serialized set, it is called again by every GetSetAsString() and has to
+    ///        be safe to be called concurrently
+    /// @param memory_resource memory resource used for memory allocation
+    ///
+    explicit ParameterSet(SerializedSetReader read_serialized_set,
+                          score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource());
+
+    /// @brief Creates a parameter set from its binary wire format, numbers and strings are read in place
+    ///
+    /// @param binary_set view of the encoded set, has to stay valid as long as binary_set_storage is alive
+    /// @param binary_set_storage owner of the memory binary_set refers to, e.g. the received buffer
+    /// @param memory_resource memory resource used for memory allocation
+    ///
+    ParameterSet(const wire_format::BinarySetView binary_set,
+                 std::shared_ptr<const void> binary_set_storage,
+                 score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource());
+
+    /// @brief Creates a parameter set the ConfigDaemon served completely as version of its change history
+    ///
+    /// @param set_json parsed parameter set including its qualifier
+    /// @param version version of the set at the ConfigDaemon, changes are requested relative to it
+    /// @param memory_resource memory resource used for memory allocation
+    ///
+    ParameterSet(score::json::Any set_json,
+                 const std::uint64_t version,
+                 score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource());
+
+    /// @brief Creates the parameter set resulting from changes of base_set, copy-on-write
+    ///
+    /// Only the changed parameters are held, all other parameters are read from base_set, so a change is applied in
+    /// time proportional to its size. Changes of a set which results from changes itself are combined with these, so
+    /// a read never passes more than one base set. Once the combined changes exceed kMaxSharedChanges parameters, the
+    /// set is copied as a whole and stops sharing parameters with base_set.
+    ///
+    /// @param base_set set the changes apply to, it is kept alive by the resulting set
+    /// @param changed_parameters changed and added parameters
+    /// @param removed_parameters names of the removed parameters
+    /// @param qualifier qualifier of the resulting set
+    /// @param version version of the resulting set at the ConfigDaemon
+    /// @param memory_resource memory resource used for memory allocation
+    ///
+    ParameterSet(std::shared_ptr<const ParameterSet> base_set,
+                 score::json::Object changed_parameters,
+                 const std::vector<std::string>& removed_parameters,
+                 score::json::Any qualifier,
+                 const std::uint64_t version,
+                 score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource());
+
     ParameterSet() = delete;
     ~ParameterSet() = default;
 
@@ -62,14 +149,41 @@ class ParameterSet final
     ParameterSet& operator=(ParameterSet&&) & noexcept = delete;
     ParameterSet& operator=(const ParameterSet&) & noexcept = delete;
 
+    static constexpr std::size_t kMaxSharedChanges{128U};
+
     bool ContainsSameContent(const ParameterSet& target_parameter_set) const;
     score::Result<score::platform::config_daemon::ParameterSetQualifier> GetQualifier() const;
+    /// @brief Version of the set at the ConfigDaemon, only known for sets received as changes
+    score::cpp::optional<std::uint64_t> GetVersion() const noexcept;
+    /// @brief Digest of the content as the ConfigDaemon computes it, nothing if the set can't be encoded
+    ///
+    /// Unlike the version, the digest stays valid across restarts of the ConfigDaemon, so it lets a reconnecting
+    /// client skip the transfer of unchanged sets. It is computed on the first call, from the received buffer for a
+    /// binary set and from the encoded content otherwise.
+    ///
+    score::cpp::optional<std::uint64_t> GetDigest() const;
     /**
      * Gets the parameter from the set by the parameter's name
      */
     template <typename T, typename = std::enable_if_t<!IsArray<T>::value, bool>>
     score::Result<T> GetParameterAs(const score::cpp::string_view& parameter_name) const
     {
+        if (IsReadFromBaseSet(parameter_name))
+        {
+            return base_set_->GetParameterAs<T>(parameter_name);
+        }
+        if constexpr (kIsReadableInPlace<T>)
+        {
+            if (binary_set_.has_value())
+            {
+                const auto value = FindBinaryParameter(parameter_name);
+                if (!value.has_value())
+                {
+                    return MakeUnexpected<T>(value.error());
+                }
+                return ReadBinaryValue<T>(value.value());
+            }
+        }
         const auto value_json = GetParameterAsJsonAny(parameter_name);
         if (value_json.has_value() == true)
         {
@@ -94,10 +208,106 @@ class ParameterSet final
     }
     score::Result<std::string> FormatAsKeyValuePairs() const;
     score::Result<std::string> GetParametersAsString() const;
+    /// @brief Serializes the whole set including its qualifier, a lazily parsed set is returned without parsing it
+    ///
+    /// A binary set is decoded into a temporary JSON representation, which is not kept by the set.
+    ///
+    score::Result<std::string> GetSetAsString() const;
     Result<std::reference_wrapper<const json::Any>> GetParameterAsJsonAny(const score::cpp::string_view& parameter_name) const;
 
   private:
+    // bools, numbers and strings are read from a binary set without decoding it into JSON
+    template <typename T>
+    static constexpr bool kIsReadableInPlace = std::is_arithmetic<T>::value || std::is_same<T, std::string>::value;
+
     Result<std::reference_wrapper<const score::json::Any>> GetParameters() const;
+    // an unchanged parameter of a set resulting from changes is read from its base set, which may read it in place
+    bool IsReadFromBaseSet(const score::cpp::string_view& parameter_name) const;
+    score::json::Object MergeChangesWithBaseSet() const;
+    score::Result<score::platform::config_daemon::ParameterSetQualifier> ConvertJsonToQualifier(
+        const score::json::Any& qualifier_json) const;
+    Result<wire_format::BinaryValue> FindBinaryParameter(const score::cpp::string_view& parameter_name) const;
+
+    template <typename T>
+    score::Result<T> ReadBinaryValue(const wire_format::BinaryValue& value) const
+    {
+        if constexpr (std::is_same<T, std::string>::value)
+        {
+            const auto string_result = value.AsString();
+            if (string_result.has_value())
+            {
+                return std::string{string_result.value()};
+            }
+        }
+        else
+        {
+            const auto value_result = value.As<T>();
+            if (value_result.has_value())
+            {
+                return value_result.value();
+            }
+        }
+        return MakeUnexpected(ConfigProviderError::kValueCastingError);
+    }
+
+    template <typename PrimitiveType>
+    score::Result<Array<PrimitiveType>> ReadBinaryArray(const wire_format::BinaryValue& list) const
+    {
+        if (!list.IsList())
+        {
+            return MakeUnexpected(ConfigProviderError::kValueCastingError);
+        }
+        Array<PrimitiveType> result(list.GetElementCount(), memory_resource_);
+        for (std::size_t index = 0U; index < result.size(); ++index)
+        {
+            score::Result<PrimitiveType> element_result{MakeUnexpected(ConfigProviderError::kValueCastingError)};
+            if constexpr (std::is_same<PrimitiveType, std::string>::value)
+            {
+                const auto element = list.GetElement(index);
+                if (element.has_value())
+                {
+                    element_result = ReadBinaryValue<PrimitiveType>(element.value());
+                }
+            }
+            else
+            {
+                const auto element = list.GetElementAs<PrimitiveType>(index);
+                if (element.has_value())
+                {
+                    element_result = element.value();
+                }
+            }
+            if (!element_result.has_value())
+            {
+                return MakeUnexpected(ConfigProviderError::kValueCastingError);
+            }
+            result[index] = std::move(element_result).value();
+        }
+        return result;
+    }
+
+    template <typename PrimitiveType>
+    score::Result<TwoDimensionalArray<PrimitiveType>> ReadBinaryTwoDimensionalArray(
+        const wire_format::BinaryValue& list) const
+    {
+        if (list.GetType() != wire_format::ValueType::kList)
+        {
+            return MakeUnexpected(ConfigProviderError::kValueCastingError);
+        }
+        TwoDimensionalArray<PrimitiveType> result(list.GetElementCount(), memory_resource_);
+        for (std::size_t index = 0U; index < result.size(); ++index)
+        {
+            auto row = ReadBinaryArray<PrimitiveType>(list.GetElement(index).value());
+            if (!row.has_value())
+            {
+                return MakeUnexpected(ConfigProviderError::kValueCastingError);
+            }
+            result[index] = std::move(row).value();
+        }
+        return result;
+    }
+
+    const score::json::Any& GetSetJson() const;
 
     template <typename PrimitiveType>
     score::Result<Array<PrimitiveType>> ConvertJsonListToAmpVector(const score::json::List& list_result,
@@ -115,8 +325,9 @@ class ParameterSet final
             }
             else
             {
-                logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name
-                                   << "]: Failed to cast object instance to given C++ type";
+                SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [",
+                                                                 parameter_name,
+                                                                 "]: Failed to cast object instance to given C++ type");
                 return MakeUnexpected(ConfigProviderError::kValueCastingError);
             }
         }
@@ -126,6 +337,22 @@ class ParameterSet final
     template <typename PrimitiveType>
     score::Result<Array<PrimitiveType>> GetParameterAsArray(const score::cpp::string_view& parameter_name) const
     {
+        if (IsReadFromBaseSet(parameter_name))
+        {
+            return base_set_->GetParameterAsArray<PrimitiveType>(parameter_name);
+        }
+        if constexpr (kIsReadableInPlace<PrimitiveType>)
+        {
+            if (binary_set_.has_value())
+            {
+                const auto value = FindBinaryParameter(parameter_name);
+                if (!value.has_value())
+                {
+                    return MakeUnexpected<Array<PrimitiveType>>(value.error());
+                }
+                return ReadBinaryArray<PrimitiveType>(value.value());
+            }
+        }
         const auto value_json = GetParameterAsJsonAny(parameter_name);
         if (value_json.has_value() == true)
         {
@@ -134,8 +361,9 @@ class ParameterSet final
             {
                 return ConvertJsonListToAmpVector<PrimitiveType>(list_result.value().get(), parameter_name);
             }
-            logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name
-                               << "]: Failed to cast object instance to JSON list";
+            SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [",
+                                                             parameter_name,
+                                                             "]: Failed to cast object instance to JSON list");
             return MakeUnexpected(ConfigProviderError::kValueCastingError);
         }
         const auto error_code = static_cast<ConfigProviderError>(*value_json.error());
@@ -146,6 +374,22 @@ class ParameterSet final
     score::Result<TwoDimensionalArray<PrimitiveType>> GetParameterAsTwoDimensionalArray(
         const score::cpp::string_view& parameter_name) const
     {
+        if (IsReadFromBaseSet(parameter_name))
+        {
+            return base_set_->GetParameterAsTwoDimensionalArray<PrimitiveType>(parameter_name);
+        }
+        if constexpr (kIsReadableInPlace<PrimitiveType>)
+        {
+            if (binary_set_.has_value())
+            {
+                const auto value = FindBinaryParameter(parameter_name);
+                if (!value.has_value())
+                {
+                    return MakeUnexpected<TwoDimensionalArray<PrimitiveType>>(value.error());
+                }
+                return ReadBinaryTwoDimensionalArray<PrimitiveType>(value.value());
+            }
+        }
         const auto value_json = GetParameterAsJsonAny(parameter_name);
 
         if (value_json.has_value() == true)
@@ -178,15 +422,16 @@ class ParameterSet final
                     }
                     else
                     {
-                        logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name
-                                           << "]: Failed to cast object instance to JSON list";
+                        SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(
+                            " [", parameter_name, "]: Failed to cast object instance to JSON list");
                         return MakeUnexpected(ConfigProviderError::kValueCastingError);
                     }
                 }
                 return result_outer;
             }
-            logger_.LogError() << "ParameterSet::" << __func__ << " [" << parameter_name
-                               << "]: Failed to cast object instance to JSON list";
+            SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(" [",
+                                                             parameter_name,
+                                                             "]: Failed to cast object instance to JSON list");
             return MakeUnexpected(ConfigProviderError::kValueCastingError);
         }
         const auto error_code = static_cast<ConfigProviderError>(*value_json.error());
@@ -229,16 +474,48 @@ class ParameterSet final
         }
         else
         {
-            logger_.LogError() << "ParameterSet::" << __func__ << ": Conversion to type "
-                               << std::string_view(typeid(T).name()) << " failed";
+            SCORE_CONFIG_PROVIDER_LOG_PARAMETER_ACCESS_ERROR(": Conversion to type ",
+                                                             std::string_view(typeid(T).name()),
+                                                             " failed");
         }
         return MakeUnexpected(ConfigProviderError::kValueCastingError);
     }
 
     score::Result<std::string> ConvertJsonToString(const score::json::Any& json) const;
+    score::cpp::optional<std::uint64_t> ComputeDigest() const;
+
+    // Emits an error record of the parameter access path. Callers probing for optional parameters may hit these
+    // errors at high rates, so the records are limited per call site and the arguments are only formatted if the
+    // record is actually emitted.
+    template <typename... Args>
+    void LogParameterAccessError(logging::LogRateLimiter& rate_limiter, const Args&... args) const
+    {
+        if (rate_limiter.ShouldLog())
+        {
+            auto log_stream = logger_.LogError();
+            (log_stream << ... << args);
+            const auto suppressed_count = rate_limiter.TakeSuppressedCount();
+            if (suppressed_count > 0U)
+            {
+                log_stream << " (" << suppressed_count << " similar records suppressed)";
+            }
+        }
+    }
 
     mw::log::Logger& logger_;
-    score::json::Any set_json_;
+    mutable score::json::Any set_json_;
+    mutable std::once_flag set_json_parsed_;
+    const std::string_view serialized_set_;
+    const std::shared_ptr<const void> serialized_set_storage_;
+    const SerializedSetReader read_serialized_set_;
+    const score::cpp::optional<wire_format::BinarySetView> binary_set_;
+    std::shared_ptr<const ParameterSet> base_set_;
+    score::json::Object changed_parameters_;
+    std::set<std::string, std::less<>> removed_parameters_;
+    score::json::Any changed_qualifier_;
+    const score::cpp::optional<std::uint64_t> version_;
+    mutable score::cpp::optional<std::uint64_t> digest_;
+    mutable std::once_flag digest_computed_;
     score::cpp::pmr::memory_resource* const memory_resource_;
 };
 
@@ -0,0 +1,252 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/parameter_set/parameter_set.h"
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/detail/common/recorder_factory.h"
+#include "score/mw/log/runtime.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+// Kinds of the parameters of a benchmarked set, parameter i is of kind kParameterKinds[i % kParameterKinds.size()]
+constexpr std::array<const char*, 6U> kParameterKinds{"integer", "float", "bool", "string", "array", "matrix"};
+constexpr std::size_t kIntegerKind{0U};
+constexpr std::size_t kFloatKind{1U};
+constexpr std::size_t kBoolKind{2U};
+constexpr std::size_t kStringKind{3U};
+constexpr std::size_t kArrayKind{4U};
+constexpr std::size_t kMatrixKind{5U};
+// Number of names looked up in turn, so that hits and misses interleave and the same name isn't read twice in a row
+constexpr std::size_t kLookupCount{64U};
+
+std::string GetParameterName(const std::size_t index)
+{
+    return std::string{kParameterKinds[index % kParameterKinds.size()]} + "_" + std::to_string(index);
+}
+
+std::string CreateParameterValue(const std::size_t index)
+{
+    switch (index % kParameterKinds.size())
+    {
+        case kIntegerKind:
+            return std::to_string(index);
+        case kFloatKind:
+            return std::to_string(index) + ".5";
+        case kBoolKind:
+            return ((index % 2U) == 0U) ? "true" : "false";
+        case kStringKind:
+            return "\"value of parameter " + std::to_string(index) + "\"";
+        case kArrayKind:
+            return "[0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5]";
+        default:
+            return "[[1, 2, 3, 4], [5, 6, 7, 8], [9, 10, 11, 12], [13, 14, 15, 16]]";
+    }
+}
+
+json::Any CreateSetJson(const std::size_t parameter_count)
+{
+    std::string set{R"({"parameters": {)"};
+    for (std::size_t index = 0U; index < parameter_count; ++index)
+    {
+        set += (index == 0U) ? "\"" : ", \"";
+        set += GetParameterName(index) + "\": " + CreateParameterValue(index);
+    }
+    set += R"(}, "qualifier": 1})";
+    return json::JsonParser{}.FromBuffer(set).value();
+}
+
+// Creates the benchmarked set from its parsed JSON, or from its binary wire format which is read in place
+std::shared_ptr<const ParameterSet> CreateParameterSet(const std::size_t parameter_count, const bool is_binary)
+{
+    auto set_json = CreateSetJson(parameter_count);
+    if (!is_binary)
+    {
+        return std::make_shared<const ParameterSet>(std::move(set_json));
+    }
+    const auto binary_set_storage = std::make_shared<const std::string>(
+        wire_format::EncodeBinarySet(set_json.As<json::Object>().value().get()).value());
+    return std::make_shared<const ParameterSet>(wire_format::BinarySetView::Create(*binary_set_storage).value(),
+                                                binary_set_storage);
+}
+
+class ParameterSetBenchmark
+{
+  public:
+    // state.range(0) is the number of parameters of the set and state.range(1) whether it is in binary wire format
+    explicit ParameterSetBenchmark(const benchmark::State& state)
+        : parameter_set_{CreateParameterSet(static_cast<std::size_t>(state.range(0)), state.range(1) != 0)}
+    {
+        mw::log::detail::Configuration config{};
+        config.SetLogMode({mw::LogMode::kConsole});
+        config.SetDefaultConsoleLogLevel(mw::log::LogLevel::kWarn);
+        recorder_ = mw::log::detail::RecorderFactory().CreateRecorderFromLogMode(mw::LogMode::kConsole, config);
+        mw::log::detail::Runtime::SetRecorder(recorder_.get());
+    }
+
+    ParameterSetBenchmark(ParameterSetBenchmark&&) = delete;
+    ParameterSetBenchmark(const ParameterSetBenchmark&) = delete;
+    ParameterSetBenchmark& operator=(ParameterSetBenchmark&&) = delete;
+    ParameterSetBenchmark& operator=(const ParameterSetBenchmark&) = delete;
+
+    ~ParameterSetBenchmark()
+    {
+        mw::log::detail::Runtime::SetRecorder(nullptr);
+    }
+
+    const ParameterSet& Get() const noexcept
+    {
+        return *parameter_set_;
+    }
+
+  private:
+    std::unique_ptr<mw::log::detail::Recorder> recorder_;
+    const std::shared_ptr<const ParameterSet> parameter_set_;
+};
+
+// Names of parameters of the given kind to look up, state.range(2) percent of them exist in the set
+std::vector<std::string> GetLookupNames(const benchmark::State& state, const std::size_t kind)
+{
+    const auto parameter_count = static_cast<std::size_t>(state.range(0));
+    const auto hit_percent = static_cast<std::size_t>(state.range(2));
+    std::vector<std::string> names{};
+    std::size_t hit_index{kind};
+    for (std::size_t lookup = 0U; lookup < kLookupCount; ++lookup)
+    {
+        if (((lookup % 4U) * 25U) < hit_percent)
+        {
+            names.push_back(GetParameterName(hit_index));
+            hit_index += kParameterKinds.size();
+            hit_index = (hit_index < parameter_count) ? hit_index : kind;
+        }
+        else
+        {
+            names.push_back(std::string{kParameterKinds[kind]} + "_missing_" + std::to_string(lookup));
+        }
+    }
+    return names;
+}
+
+template <typename T>
+void RunGetParameterAs(benchmark::State& state, const std::size_t kind)
+{
+    const ParameterSetBenchmark fixture{state};
+    const auto names = GetLookupNames(state, kind);
+    std::size_t lookup{0U};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.Get().GetParameterAs<T>(names[lookup]));
+        lookup = (lookup + 1U) % kLookupCount;
+    }
+}
+
+void GetParameterAsArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"parameters", "binary", "hit_percent"})->ArgsProduct({{8, 64, 512}, {0, 1}, {100, 50, 0}});
+}
+
+void SetArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"parameters", "binary"})->ArgsProduct({{8, 64, 512}, {0, 1}});
+}
+
+void BM_GetParameterAsInteger(benchmark::State& state)
+{
+    RunGetParameterAs<std::int32_t>(state, kIntegerKind);
+}
+BENCHMARK(BM_GetParameterAsInteger)->Apply(GetParameterAsArguments);
+
+void BM_GetParameterAsFloat(benchmark::State& state)
+{
+    RunGetParameterAs<float>(state, kFloatKind);
+}
+BENCHMARK(BM_GetParameterAsFloat)->Apply(GetParameterAsArguments);
+
+void BM_GetParameterAsBool(benchmark::State& state)
+{
+    RunGetParameterAs<bool>(state, kBoolKind);
+}
+BENCHMARK(BM_GetParameterAsBool)->Apply(GetParameterAsArguments);
+
+void BM_GetParameterAsString(benchmark::State& state)
+{
+    RunGetParameterAs<std::string>(state, kStringKind);
+}
+BENCHMARK(BM_GetParameterAsString)->Apply(GetParameterAsArguments);
+
+void BM_GetParameterAsArray(benchmark::State& state)
+{
+    RunGetParameterAs<ParameterSet::Array<float>>(state, kArrayKind);
+}
+BENCHMARK(BM_GetParameterAsArray)->Apply(GetParameterAsArguments);
+
+void BM_GetParameterAsTwoDimensionalArray(benchmark::State& state)
+{
+    RunGetParameterAs<ParameterSet::TwoDimensionalArray<std::int32_t>>(state, kMatrixKind);
+}
+BENCHMARK(BM_GetParameterAsTwoDimensionalArray)->Apply(GetParameterAsArguments);
+
+// Serialization of all parameters, e.g. for diagnostics
+void BM_GetParametersAsString(benchmark::State& state)
+{
+    const ParameterSetBenchmark fixture{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.Get().GetParametersAsString());
+    }
+}
+BENCHMARK(BM_GetParametersAsString)->Apply(SetArguments);
+
+// Comparison of two sets with the same content, i.e. the worst case which compares all parameters
+void BM_ContainsSameContent(benchmark::State& state)
+{
+    const ParameterSetBenchmark fixture{state};
+    const auto same_parameter_set = CreateParameterSet(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.Get().ContainsSameContent(*same_parameter_set));
+    }
+}
+BENCHMARK(BM_ContainsSameContent)->Apply(SetArguments);
+
+void BM_GetQualifier(benchmark::State& state)
+{
+    const ParameterSetBenchmark fixture{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.Get().GetQualifier());
+    }
+}
+BENCHMARK(BM_GetQualifier)->Apply(SetArguments);
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -1227,6 +1227,178 @@ TEST(SimpleParameterSetTest, GetParameterAs_ParametersNotAnObject)
     EXPECT_EQ(result, ConfigProviderError::kObjectCastingError);
 }
 
+TEST(LazyParameterSetTest, ParsedOnFirstAccess)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSet::ParameterSet()");
+    RecordProperty("Description",
+                   "This test verifies that a set created from its serialized form is accessible like a parsed one "
+                   "and is serialized again without modification.");
+
+    const auto serialized_set = std::make_shared<const std::string>(GenerateDummySimpleParameterSetJsonString());
+    const ParameterSet parameter_set{*serialized_set, serialized_set};
+
+    const auto set_as_string = parameter_set.GetSetAsString();
+    ASSERT_TRUE(set_as_string.has_value());
+    EXPECT_EQ(set_as_string.value(), *serialized_set);
+
+    const auto parameter = parameter_set.GetParameterAs<int>("parameter");
+    ASSERT_TRUE(parameter.has_value());
+    EXPECT_EQ(parameter.value(), 1);
+    const auto qualifier = parameter_set.GetQualifier();
+    ASSERT_TRUE(qualifier.has_value());
+    EXPECT_EQ(qualifier.value(), score::platform::config_daemon::ParameterSetQualifier::kUnqualified);
+}
+
+TEST(LazyParameterSetTest, MalformedSerializedSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSet::ParameterSet()");
+    RecordProperty("Description", "This test verifies that a malformed serialized set is reported on access.");
+
+    const auto serialized_set = std::make_shared<const std::string>(R"({"parameters": )");
+    const ParameterSet parameter_set{*serialized_set, serialized_set};
+
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("parameter").error(), ConfigProviderError::kObjectCastingError);
+    EXPECT_EQ(parameter_set.GetQualifier().error(), ConfigProviderError::kObjectCastingError);
+}
+
+TEST(LazyParameterSetTest, ReadOnFirstAccess)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSet::ParameterSet()");
+    RecordProperty("Description",
+                   "This test verifies that a set created from a reader is read once on access and again for every "
+                   "serialization.");
+
+    const auto read_count = std::make_shared<std::size_t>(0U);
+    const ParameterSet parameter_set{ParameterSet::SerializedSetReader{[read_count]() -> score::Result<std::string> {
+        ++(*read_count);
+        return GenerateDummySimpleParameterSetJsonString();
+    }}};
+    EXPECT_EQ(*read_count, 0U);
+
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("parameter").value(), 1);
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("parameter").value(), 1);
+    EXPECT_EQ(*read_count, 1U);
+
+    const auto set_as_string = parameter_set.GetSetAsString();
+    ASSERT_TRUE(set_as_string.has_value());
+    EXPECT_EQ(set_as_string.value(), GenerateDummySimpleParameterSetJsonString());
+    EXPECT_EQ(*read_count, 2U);
+}
+
+TEST(LazyParameterSetTest, FailingReader)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSet::ParameterSet()");
+    RecordProperty("Description", "This test verifies that a set which can not be read is reported on access.");
+
+    const ParameterSet parameter_set{ParameterSet::SerializedSetReader{[]() -> score::Result<std::string> {
+        return MakeUnexpected(ConfigProviderError::kParsingFailed);
+    }}};
+
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("parameter").error(), ConfigProviderError::kObjectCastingError);
+    EXPECT_EQ(parameter_set.GetSetAsString().error(), ConfigProviderError::kParsingFailed);
+}
+
+TEST(BinaryParameterSetTest, ReadInPlaceLikeParsedSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSet::GetParameterAs()");
+    RecordProperty("Description",
+                   "This test verifies that the parameters of a set created from its binary wire format are read "
+                   "with the same results as the parameters of the parsed JSON set.");
+
+    auto set_json = score::json::JsonParser{}.FromBuffer(GenerateDummyJsonString());
+    ASSERT_TRUE(set_json.has_value());
+    const auto encoded_set = wire_format::EncodeBinarySet(set_json.value().As<score::json::Object>().value().get());
+    ASSERT_TRUE(encoded_set.has_value());
+    const auto binary_set_storage = std::make_shared<const std::string>(encoded_set.value());
+    const auto binary_set = wire_format::BinarySetView::Create(*binary_set_storage);
+    ASSERT_TRUE(binary_set.has_value());
+
+    const ParameterSet parameter_set{binary_set.value(), binary_set_storage};
+    const ParameterSet parsed_parameter_set{std::move(set_json).value()};
+
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("integer").value(), 55);
+    EXPECT_EQ(parameter_set.GetParameterAs<float>("float_as_integer").value(), 42.0F);
+    EXPECT_EQ(parameter_set.GetParameterAs<double>("float_big_num").value(), 123456789123456789.0);
+    EXPECT_EQ(parameter_set.GetParameterAs<std::string>("string").value(), "foo");
+    EXPECT_EQ(parameter_set.GetParameterAs<ParameterSet::Array<std::uint8_t>>("array").value(),
+              parsed_parameter_set.GetParameterAs<ParameterSet::Array<std::uint8_t>>("array").value());
+    EXPECT_EQ(parameter_set.GetParameterAs<ParameterSet::Array<float>>("array_float_mixed_integer_and_decimal").value(),
+              parsed_parameter_set.GetParameterAs<ParameterSet::Array<float>>("array_float_mixed_integer_and_decimal")
+                  .value());
+    EXPECT_EQ(parameter_set.GetParameterAs<ParameterSet::Array<std::string>>("array_string").value(),
+              parsed_parameter_set.GetParameterAs<ParameterSet::Array<std::string>>("array_string").value());
+    EXPECT_EQ(parameter_set.GetParameterAs<ParameterSet::TwoDimensionalArray<int>>("array2d").value(),
+              parsed_parameter_set.GetParameterAs<ParameterSet::TwoDimensionalArray<int>>("array2d").value());
+    using DoubleTable = ParameterSet::TwoDimensionalArray<double>;
+    const std::string mixed_array2d_name{"array2d_float_mixed_integer_and_decimal"};
+    EXPECT_EQ(parameter_set.GetParameterAs<DoubleTable>(mixed_array2d_name).value(),
+              parsed_parameter_set.GetParameterAs<DoubleTable>(mixed_array2d_name).value());
+    EXPECT_EQ(parameter_set.GetParameterAs<ParameterSet::TwoDimensionalArray<std::string>>("array2d_string").value(),
+              parsed_parameter_set.GetParameterAs<ParameterSet::TwoDimensionalArray<std::string>>("array2d_string")
+                  .value());
+    EXPECT_EQ(parameter_set.GetParameterAs<ParameterSet::TwoDimensionalArray<bool>>("array2d_bool").value(),
+              parsed_parameter_set.GetParameterAs<ParameterSet::TwoDimensionalArray<bool>>("array2d_bool").value());
+    EXPECT_EQ(parameter_set.GetQualifier().value(),
+              score::platform::config_daemon::ParameterSetQualifier::kUnqualified);
+
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("string").error(), ConfigProviderError::kValueCastingError);
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("float_as_decimal").error(), ConfigProviderError::kValueCastingError);
+    EXPECT_EQ(parameter_set.GetParameterAs<ParameterSet::Array<int>>("integer").error(),
+              ConfigProviderError::kValueCastingError);
+    EXPECT_EQ(parameter_set.GetParameterAs<int>("unknown").error(), ConfigProviderError::kParameterNotFound);
+
+    // access paths without an in-place read decode the set into JSON once
+    EXPECT_EQ(parameter_set.GetParameterAsJsonAny("integer").value().get().As<int>().value(), 55);
+    EXPECT_TRUE(parameter_set.ContainsSameContent(parsed_parameter_set));
+}
+
+TEST(ParameterSetDigestTest, DigestIsIndependentOfRepresentation)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSet::GetDigest()");
+    RecordProperty("Description",
+                   "This test verifies that parsed, serialized and binary sets of the same content have the digest "
+                   "the ConfigDaemon computes from the binary encoding, also on repeated calls, while other content "
+                   "has a different one.");
+
+    auto set_json = score::json::JsonParser{}.FromBuffer(GenerateDummyJsonString());
+    ASSERT_TRUE(set_json.has_value());
+    const auto encoded_set = wire_format::EncodeBinarySet(set_json.value().As<score::json::Object>().value().get());
+    ASSERT_TRUE(encoded_set.has_value());
+    const auto digest = wire_format::ComputeBinarySetDigest(encoded_set.value());
+    const auto binary_set_storage = std::make_shared<const std::string>(encoded_set.value());
+    const auto binary_set = wire_format::BinarySetView::Create(*binary_set_storage);
+    ASSERT_TRUE(binary_set.has_value());
+    const auto serialized_set = std::make_shared<const std::string>(GenerateDummyJsonString());
+
+    const ParameterSet parsed_set{std::move(set_json).value()};
+    EXPECT_EQ(parsed_set.GetDigest(), digest);
+    EXPECT_EQ(parsed_set.GetDigest(), digest);
+    EXPECT_EQ((ParameterSet{binary_set.value(), binary_set_storage}.GetDigest()), digest);
+    EXPECT_EQ((ParameterSet{*serialized_set, serialized_set}.GetDigest()), digest);
+
+    auto other_set_json = score::json::JsonParser{}.FromBuffer(R"({"parameters": {"integer": 56}, "qualifier": 1})");
+    ASSERT_TRUE(other_set_json.has_value());
+    EXPECT_NE(ParameterSet{std::move(other_set_json).value()}.GetDigest(), digest);
+}
+
 }  // namespace test
 }  // namespace config_provider
 }  // namespace config_management
@@ -0,0 +1,459 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/file_persistency.h"
+#include "score/config_management/config_provider/code/persistency/details/parameter_set_delta.h"
+#include "score/config_management/config_provider/code/persistency/details/record_compression.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include "score/json/json_parser.h"
+
+#include <score/utility.hpp>
+
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+/// @brief A delta is only written if it saves at least half of the size of the whole set
+constexpr std::size_t kMaximumDeltaSizeDivisor{2U};
+/// @brief Limits the number of deltas which have to be applied on start-up until the log gets compacted
+constexpr std::size_t kMaximumDeltaCount{8U};
+
+bool IsQualified(const ParameterSet& parameter_set) noexcept
+{
+    const auto qualifier = parameter_set.GetQualifier();
+    return qualifier.has_value() &&
+           (qualifier.value() == score::platform::config_daemon::ParameterSetQualifier::kQualified);
+}
+
+/// @brief 64-bit FNV-1a digest
+std::uint64_t CalculateDigest(const std::string_view data) noexcept
+{
+    std::uint64_t digest{0xCBF29CE484222325U};
+    for (const char character : data)
+    {
+        digest ^= static_cast<std::uint8_t>(character);
+        digest *= 0x100000001B3U;
+    }
+    return digest;
+}
+
+/// @brief Non-delta record of a parameter set, which is decoded on first access of the set
+struct EncodedParameterSet
+{
+    /// @brief Owner of the memory the record refers to
+    std::shared_ptr<const void> storage;
+    LogRecord record;
+    std::shared_ptr<const SharedSetStore> shared_set_store;
+};
+
+Result<std::string> DecodeParameterSet(const LogRecord& record, const SharedSetStore* const shared_set_store)
+{
+    switch (record.encoding)
+    {
+        case RecordEncoding::kFull:
+            return std::string{record.serialized_set};
+        case RecordEncoding::kCompressed:
+            return DecompressParameterSet(record.serialized_set);
+        case RecordEncoding::kShared:
+            if (shared_set_store == nullptr)
+            {
+                return MakeUnexpected(PersistencyError::kDataNotFound, "No shared directory is configured");
+            }
+            return shared_set_store->Read(record.serialized_set);
+        case RecordEncoding::kDelta:
+        default:
+            return MakeUnexpected(PersistencyError::kDataCorrupted, "Delta without parameter set");
+    }
+}
+
+}  // namespace
+
+FilePersistency::FilePersistency(std::string log_file_path,
+                                 const LogCompactionPolicy compaction_policy,
+                                 const CacheLoadingMode loading_mode,
+                                 RecordCompressionPolicy compression_policy)
+    : Persistency{},
+      logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
+      compaction_policy_{compaction_policy},
+      loading_mode_{loading_mode},
+      minimum_compressed_set_size_{compression_policy.minimum_set_size},
+      shared_set_store_{compression_policy.shared_directory.empty()
+                            ? nullptr
+                            : std::make_shared<const SharedSetStore>(std::move(compression_policy.shared_directory),
+                                                                     log_file_path + ".sets")},
+      mutex_{},
+      log_{std::move(log_file_path)},
+      log_opened_{false},
+      persisted_sets_{},
+      unsynced_set_names_{},
+      statistics_{}
+{
+}
+
+void FilePersistency::ReadCachedParameterSets(ParameterMap& cached_parameter_sets,
+                                              score::cpp::pmr::memory_resource* memory_resource,
+                                              std::unique_ptr<score::filesystem::Filesystem>) noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!OpenLog(memory_resource))
+    {
+        return;
+    }
+    for (const auto& [name, persisted_set] : persisted_sets_)
+    {
+        score::cpp::ignore = cached_parameter_sets.emplace(
+            score::cpp::pmr::string{name.data(), name.size(), memory_resource}, persisted_set.parameter_set);
+    }
+    logger_.LogDebug() << "FilePersistency::" << __func__ << ": Read " << persisted_sets_.size()
+                       << " cached parameter sets";
+}
+
+void FilePersistency::CacheParameterSet(const ParameterMap& cached_parameter_sets,
+                                        const score::cpp::pmr::string param_set_key,
+                                        const std::shared_ptr<const ParameterSet> parameter_set,
+                                        bool sync_to_storage) noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    // Only qualified sets are persisted. Sets which are persisted already are not checked again, so that sets read
+    // from the log are not parsed here.
+    for (const auto& [key, value] : cached_parameter_sets)
+    {
+        std::string name{key.data(), key.size()};
+        if ((value != nullptr) && (persisted_sets_.count(name) == 0U) && IsQualified(*value))
+        {
+            score::cpp::ignore = unsynced_set_names_.insert(name);
+            PersistedParameterSet persisted_set{value, nullptr, score::cpp::nullopt, 0U};
+            score::cpp::ignore = persisted_sets_.emplace(std::move(name), std::move(persisted_set));
+        }
+    }
+    if ((parameter_set == nullptr) || (!IsQualified(*parameter_set)))
+    {
+        logger_.LogDebug() << "FilePersistency::" << __func__ << " [" << param_set_key
+                           << "]: Parameter set is not qualified, it is not persisted";
+    }
+    else
+    {
+        std::string name{param_set_key.data(), param_set_key.size()};
+        score::cpp::ignore = unsynced_set_names_.insert(name);
+        persisted_sets_[std::move(name)].parameter_set = parameter_set;
+    }
+
+    if (sync_to_storage)
+    {
+        SyncToStorageLocked();
+    }
+}
+
+void FilePersistency::SyncToStorage() noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    SyncToStorageLocked();
+}
+
+FilePersistencyStatistics FilePersistency::GetStatistics() const noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    FilePersistencyStatistics statistics{statistics_};
+    statistics.written_bytes = log_.GetWrittenSize();
+    return statistics;
+}
+
+bool FilePersistency::OpenLog(score::cpp::pmr::memory_resource* const memory_resource) noexcept
+{
+    if (log_opened_)
+    {
+        return true;
+    }
+    const auto replay = log_.Open();
+    if (!replay.has_value())
+    {
+        logger_.LogError() << "FilePersistency::" << __func__ << ": " << replay.error();
+        return false;
+    }
+    log_opened_ = true;
+    if (replay.value().discarded_size > 0U)
+    {
+        logger_.LogWarn() << "FilePersistency::" << __func__ << ": Discarded " << replay.value().discarded_size
+                          << " bytes of torn or corrupted log records";
+    }
+
+    const auto& records = replay.value().records;
+    for (auto record = records.begin(); record != records.end();)
+    {
+        // Every full record is followed by the deltas which have to be applied to it
+        std::vector<std::string_view> deltas{};
+        auto next_record = std::next(record);
+        for (; (next_record != records.end()) && (next_record->encoding == RecordEncoding::kDelta); ++next_record)
+        {
+            deltas.push_back(next_record->serialized_set);
+        }
+
+        std::shared_ptr<const ParameterSet> parameter_set{};
+        if (deltas.empty() && (loading_mode_ == CacheLoadingMode::kOnDemand) &&
+            (record->encoding == RecordEncoding::kFull))
+        {
+            // Every set keeps the mapping alive and parses its part of it only once it is accessed
+            parameter_set =
+                std::make_shared<const ParameterSet>(record->serialized_set, replay.value().mapping, memory_resource);
+        }
+        else if (deltas.empty() && (loading_mode_ == CacheLoadingMode::kOnDemand))
+        {
+            // Compressed sets are also only decompressed once they are accessed
+            const auto encoded_set = std::make_shared<const EncodedParameterSet>(
+                EncodedParameterSet{replay.value().mapping, *record, shared_set_store_});
+            parameter_set = std::make_shared<const ParameterSet>(
+                ParameterSet::SerializedSetReader{[encoded_set]() {
+                    return DecodeParameterSet(encoded_set->record, encoded_set->shared_set_store.get());
+                }},
+                memory_resource);
+        }
+        else
+        {
+            auto serialized_set = DecodeParameterSet(*record, shared_set_store_.get());
+            if (serialized_set.has_value() && (!deltas.empty()))
+            {
+                serialized_set = ApplyParameterSetDeltas(serialized_set.value(), deltas);
+            }
+            if (!serialized_set.has_value())
+            {
+                logger_.LogError() << "FilePersistency::" << __func__ << " [" << record->name
+                                   << "]: Failed to read parameter set: " << serialized_set.error();
+                record = next_record;
+                continue;
+            }
+
+            if (loading_mode_ == CacheLoadingMode::kOnStartup)
+            {
+                auto set_json = json::JsonParser{}.FromBuffer(serialized_set.value());
+                if (!set_json.has_value())
+                {
+                    logger_.LogError() << "FilePersistency::" << __func__ << " [" << record->name
+                                       << "]: Failed to parse parameter set: " << set_json.error();
+                    record = next_record;
+                    continue;
+                }
+                parameter_set = std::make_shared<const ParameterSet>(std::move(set_json).value(), memory_resource);
+            }
+            else
+            {
+                const auto storage = std::make_shared<const std::string>(std::move(serialized_set).value());
+                parameter_set = std::make_shared<const ParameterSet>(*storage, storage, memory_resource);
+            }
+        }
+
+        // Sets cached before the log got opened are newer than the persisted ones
+        const auto inserted = persisted_sets_.emplace(
+            std::string{record->name}, PersistedParameterSet{parameter_set, nullptr, score::cpp::nullopt, 0U});
+        inserted.first->second.synced_parameter_set = std::move(parameter_set);
+        inserted.first->second.synced_digest = score::cpp::nullopt;
+        inserted.first->second.delta_count = deltas.size();
+        record = next_record;
+    }
+    return true;
+}
+
+void FilePersistency::SyncToStorageLocked() noexcept
+{
+    if (unsynced_set_names_.empty() || (!OpenLog(score::cpp::pmr::get_default_resource())))
+    {
+        return;
+    }
+
+    // The strings are kept alive here because the records only refer to them, the storage is reserved upfront so
+    // that the referred strings are never moved.
+    std::vector<std::string> serialized_sets{};
+    serialized_sets.reserve(unsynced_set_names_.size());
+    std::vector<LogRecord> records{};
+    records.reserve(unsynced_set_names_.size());
+    std::vector<std::uint64_t> digests{};
+    digests.reserve(unsynced_set_names_.size());
+    std::uint64_t unchanged_parameter_sets{0U};
+    for (const auto& name : unsynced_set_names_)
+    {
+        auto& persisted_set = persisted_sets_.at(name);
+        // Sets read from the log are returned as they are, so they do not need to be parsed for writing them
+        auto serialized_set = persisted_set.parameter_set->GetSetAsString();
+        if (!serialized_set.has_value())
+        {
+            logger_.LogError() << "FilePersistency::" << __func__ << " [" << name
+                               << "]: Failed to serialize parameter set, it is not persisted";
+            continue;
+        }
+        const std::uint64_t digest = CalculateDigest(serialized_set.value());
+
+        score::cpp::optional<std::string> serialized_synced_set{};
+        if (persisted_set.synced_parameter_set != nullptr)
+        {
+            auto synced_set = persisted_set.synced_parameter_set->GetSetAsString();
+            if (synced_set.has_value())
+            {
+                serialized_synced_set = std::move(synced_set).value();
+            }
+            if ((!persisted_set.synced_digest.has_value()) && serialized_synced_set.has_value())
+            {
+                persisted_set.synced_digest = CalculateDigest(serialized_synced_set.value());
+            }
+        }
+        if (persisted_set.synced_digest.has_value() && (persisted_set.synced_digest.value() == digest))
+        {
+            ++unchanged_parameter_sets;
+            continue;
+        }
+
+        auto encoding = RecordEncoding::kFull;
+        if (serialized_synced_set.has_value() && (persisted_set.delta_count < kMaximumDeltaCount))
+        {
+            auto delta = CreateParameterSetDelta(serialized_synced_set.value(), serialized_set.value());
+            if (delta.has_value() &&
+                (delta.value().size() < (serialized_set.value().size() / kMaximumDeltaSizeDivisor)))
+            {
+                serialized_set = std::move(delta);
+                encoding = RecordEncoding::kDelta;
+            }
+        }
+        if (encoding != RecordEncoding::kDelta)
+        {
+            encoding = EncodeParameterSet(serialized_set.value(), digest);
+        }
+        serialized_sets.push_back(std::move(serialized_set).value());
+        records.push_back(LogRecord{name, serialized_sets.back(), encoding});
+        digests.push_back(digest);
+    }
+
+    const auto result = records.empty() ? ResultBlank{} : log_.Append(records);
+    if (!result.has_value())
+    {
+        logger_.LogError() << "FilePersistency::" << __func__ << ": " << result.error();
+        // The log is replayed again on the next sync, which also cuts off what remained of the failed write
+        log_opened_ = false;
+        return;
+    }
+    for (std::size_t index = 0U; index < records.size(); ++index)
+    {
+        auto& persisted_set = persisted_sets_.find(records[index].name)->second;
+        persisted_set.synced_parameter_set = persisted_set.parameter_set;
+        persisted_set.synced_digest = digests[index];
+        if (records[index].encoding == RecordEncoding::kDelta)
+        {
+            ++persisted_set.delta_count;
+            ++statistics_.written_parameter_set_deltas;
+        }
+        else
+        {
+            persisted_set.delta_count = 0U;
+            ++statistics_.written_parameter_sets;
+            if (records[index].encoding != RecordEncoding::kFull)
+            {
+                ++statistics_.written_compressed_parameter_sets;
+            }
+        }
+    }
+    statistics_.unchanged_parameter_sets += unchanged_parameter_sets;
+    unsynced_set_names_.clear();
+
+    const auto log_size = static_cast<double>(log_.GetSize());
+    const auto garbage_size = static_cast<double>(log_.GetGarbageSize());
+    if ((log_.GetSize() >= compaction_policy_.minimum_log_size) &&
+        (garbage_size > (log_size * compaction_policy_.garbage_ratio)))
+    {
+        CompactLog();
+    }
+}
+
+RecordEncoding FilePersistency::EncodeParameterSet(std::string& serialized_set,
+                                                   const std::uint64_t digest) const noexcept
+{
+    if (serialized_set.size() < minimum_compressed_set_size_)
+    {
+        return RecordEncoding::kFull;
+    }
+    auto compressed_set = CompressParameterSet(serialized_set);
+    if ((!compressed_set.has_value()) || (compressed_set.value().size() >= serialized_set.size()))
+    {
+        return RecordEncoding::kFull;
+    }
+    if (shared_set_store_ != nullptr)
+    {
+        auto shared_set_name = shared_set_store_->Store(compressed_set.value(), digest);
+        if (shared_set_name.has_value())
+        {
+            serialized_set = std::move(shared_set_name).value();
+            return RecordEncoding::kShared;
+        }
+        // The set is kept in the log instead
+        logger_.LogWarn() << "FilePersistency::" << __func__ << ": " << shared_set_name.error();
+    }
+    serialized_set = std::move(compressed_set).value();
+    return RecordEncoding::kCompressed;
+}
+
+void FilePersistency::CompactLog() noexcept
+{
+    std::vector<std::string> serialized_sets{};
+    serialized_sets.reserve(persisted_sets_.size());
+    std::vector<LogRecord> records{};
+    records.reserve(persisted_sets_.size());
+    for (const auto& [name, persisted_set] : persisted_sets_)
+    {
+        if (persisted_set.synced_parameter_set == nullptr)
+        {
+            continue;
+        }
+        auto serialized_set = persisted_set.synced_parameter_set->GetSetAsString();
+        if (serialized_set.has_value())
+        {
+            const auto digest = persisted_set.synced_digest.has_value() ? persisted_set.synced_digest.value()
+                                                                         : CalculateDigest(serialized_set.value());
+            const auto encoding = EncodeParameterSet(serialized_set.value(), digest);
+            serialized_sets.push_back(std::move(serialized_set).value());
+            records.push_back(LogRecord{name, serialized_sets.back(), encoding});
+        }
+    }
+
+    const auto log_size = log_.GetSize();
+    const auto result = log_.Compact(records);
+    if (!result.has_value())
+    {
+        logger_.LogError() << "FilePersistency::" << __func__ << ": " << result.error();
+        return;
+    }
+    std::set<std::string, std::less<>> shared_set_names{};
+    for (const auto& record : records)
+    {
+        persisted_sets_.find(record.name)->second.delta_count = 0U;
+        if (record.encoding == RecordEncoding::kShared)
+        {
+            score::cpp::ignore = shared_set_names.emplace(record.serialized_set);
+        }
+    }
+    // Only now no record refers to the other shared sets of this process anymore
+    if (shared_set_store_ != nullptr)
+    {
+        shared_set_store_->Release(shared_set_names);
+    }
+    logger_.LogInfo() << "FilePersistency::" << __func__ << ": Compacted log from " << log_size << " to "
+                      << log_.GetSize() << " bytes";
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
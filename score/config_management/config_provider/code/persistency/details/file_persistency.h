@@ -0,0 +1,152 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_FILE_PERSISTENCY_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_FILE_PERSISTENCY_H
+
+#include "score/config_management/config_provider/code/persistency/details/record_log.h"
+#include "score/config_management/config_provider/code/persistency/details/shared_set_store.h"
+#include "score/config_management/config_provider/code/persistency/persistency.h"
+
+#include "score/mw/log/logger.h"
+
+#include <score/optional.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+struct FilePersistencyStatistics
+{
+    /// @brief Number of bytes written to the storage since construction
+    std::size_t written_bytes;
+    /// @brief Number of parameter sets written as a whole
+    std::uint64_t written_parameter_sets;
+    /// @brief Number of the parameter sets written as a whole which were compressed
+    std::uint64_t written_compressed_parameter_sets;
+    /// @brief Number of parameter sets written as a delta to their previously written content
+    std::uint64_t written_parameter_set_deltas;
+    /// @brief Number of synced parameter sets which were not written, since their content did not change
+    std::uint64_t unchanged_parameter_sets;
+};
+
+enum class CacheLoadingMode : std::uint8_t
+{
+    /// @brief Only the names of the persisted sets are indexed on start-up, a set is parsed on its first access
+    kOnDemand,
+    /// @brief All persisted sets are parsed on start-up, sets which can not be parsed are dropped
+    kOnStartup,
+};
+
+struct LogCompactionPolicy
+{
+    /// @brief The log is compacted once the share of garbage exceeds this ratio
+    double garbage_ratio{0.5};
+    /// @brief The log is not compacted below this size
+    std::size_t minimum_log_size{64U * 1024U};
+};
+
+struct RecordCompressionPolicy
+{
+    /// @brief Parameter sets are compressed from this serialized size on, SIZE_MAX disables the compression
+    std::size_t minimum_set_size{16U * 1024U};
+    /// @brief Directory in which compressed sets are shared with other processes (see SharedSetStore), it has to be
+    ///        on the same file system as the log. An empty path disables the sharing.
+    std::string shared_directory{};
+};
+
+///
+/// @brief Persistency storing the cached parameter sets in a local append-only log
+///
+/// On start-up the log is replayed in a single sequential pass over its memory mapping. By default every persisted
+/// set is handed out as a ParameterSet which only refers to its serialized content and parses it on first access,
+/// so a process pays only for the sets it actually uses (see CacheLoadingMode).
+///
+/// A sync only appends the parameter sets changed since the previous sync. Once the log consists mostly of superseded
+/// records, it is compacted as part of the sync.
+///
+/// To save flash writes, the digest of the persisted content of every set is kept. A set whose content did not change
+/// is not written again, a set of which only a few parameters changed is written as a delta record. Large sets are
+/// written compressed, optionally into a directory shared with other processes, so that identical sets of several
+/// processes are stored only once. Compressed sets are decompressed on first access as well.
+/// See record_log.h for the file layout.
+///
+
+class FilePersistency final : public Persistency
+{
+  public:
+    explicit FilePersistency(std::string log_file_path,
+                             const LogCompactionPolicy compaction_policy = {},
+                             const CacheLoadingMode loading_mode = CacheLoadingMode::kOnDemand,
+                             RecordCompressionPolicy compression_policy = {});
+    void ReadCachedParameterSets(ParameterMap& cached_parameter_sets,
+                                 score::cpp::pmr::memory_resource* memory_resource,
+                                 std::unique_ptr<score::filesystem::Filesystem> filesystem) noexcept override;
+    void CacheParameterSet(const ParameterMap& cached_parameter_sets,
+                           const score::cpp::pmr::string param_set_key,
+                           const std::shared_ptr<const ParameterSet> parameter_set,
+                           bool sync_to_storage) noexcept override;
+    void SyncToStorage() noexcept override;
+
+    FilePersistencyStatistics GetStatistics() const noexcept;
+
+  private:
+    struct PersistedParameterSet
+    {
+        /// @brief Latest cached content
+        std::shared_ptr<const ParameterSet> parameter_set;
+        /// @brief Content stored in the log
+        std::shared_ptr<const ParameterSet> synced_parameter_set;
+        /// @brief Digest of the serialized synced_parameter_set, calculated once it is needed
+        score::cpp::optional<std::uint64_t> synced_digest;
+        /// @brief Number of delta records following the latest full record in the log
+        std::size_t delta_count{0U};
+    };
+
+    bool OpenLog(score::cpp::pmr::memory_resource* const memory_resource) noexcept;
+    /// @brief Replaces the serialized set by its compressed form or shared name if that saves space
+    RecordEncoding EncodeParameterSet(std::string& serialized_set, const std::uint64_t digest) const noexcept;
+    void SyncToStorageLocked() noexcept;
+    void CompactLog() noexcept;
+
+    mw::log::Logger& logger_;
+    const LogCompactionPolicy compaction_policy_;
+    const CacheLoadingMode loading_mode_;
+    const std::size_t minimum_compressed_set_size_;
+    /// @brief Shared with the parameter sets read from it, which may outlive the persistency
+    const std::shared_ptr<const SharedSetStore> shared_set_store_;
+    mutable std::mutex mutex_;
+    RecordLog log_;
+    bool log_opened_;
+    std::map<std::string, PersistedParameterSet, std::less<>> persisted_sets_;
+    std::set<std::string, std::less<>> unsynced_set_names_;
+    FilePersistencyStatistics statistics_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_FILE_PERSISTENCY_H
@@ -0,0 +1,163 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/file_persistency.h"
+
+#include "score/json/json_parser.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+constexpr std::size_t kParametersPerSet{50U};
+constexpr std::size_t kAccessedParameterSetCount{3U};
+
+score::cpp::pmr::string GetSetName(const std::size_t index)
+{
+    const std::string set_name = "parameter_set_" + std::to_string(index);
+    return score::cpp::pmr::string{set_name.data(), set_name.size()};
+}
+
+/// @brief Persists the given number of parameter sets with kParametersPerSet integer parameters each
+std::string WriteCache(const std::size_t set_count)
+{
+    const std::string log_path = "/tmp/file_persistency_benchmark_" + std::to_string(set_count) + ".log";
+    score::cpp::ignore = std::remove(log_path.c_str());
+
+    std::string serialized_set{R"({"qualifier": 1, "parameters": {)"};
+    for (std::size_t index = 0U; index < kParametersPerSet; ++index)
+    {
+        serialized_set += (index == 0U ? "" : ", ");
+        serialized_set += "\"parameter_" + std::to_string(index) + "\": " + std::to_string(index);
+    }
+    serialized_set += "}}";
+
+    FilePersistency persistency{log_path};
+    ParameterMap cached_parameter_sets{};
+    for (std::size_t index = 0U; index < set_count; ++index)
+    {
+        auto set_json = json::JsonParser{}.FromBuffer(serialized_set);
+        cached_parameter_sets.emplace(GetSetName(index),
+                                      std::make_shared<const ParameterSet>(std::move(set_json).value()));
+    }
+    const auto first_set = cached_parameter_sets.at(GetSetName(0U));
+    persistency.CacheParameterSet(cached_parameter_sets, GetSetName(0U), first_set, true);
+    return log_path;
+}
+
+/// @brief Measures what a ConfigProvider spends on the persisted sets until its first kAccessedParameterSetCount
+///        parameter sets are available, i.e. reading the cache and accessing one parameter of each accessed set
+void BM_StartUp(benchmark::State& state, const CacheLoadingMode loading_mode)
+{
+    const auto set_count = static_cast<std::size_t>(state.range(0));
+    const std::string log_path = WriteCache(set_count);
+
+    for (auto _ : state)
+    {
+        FilePersistency persistency{log_path, LogCompactionPolicy{}, loading_mode};
+        ParameterMap cached_parameter_sets{};
+        persistency.ReadCachedParameterSets(cached_parameter_sets, score::cpp::pmr::get_default_resource(), nullptr);
+        for (std::size_t index = 0U; index < std::min(set_count, kAccessedParameterSetCount); ++index)
+        {
+            auto parameter = cached_parameter_sets.at(GetSetName(index))->GetParameterAs<int>("parameter_1");
+            benchmark::DoNotOptimize(parameter);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(set_count));
+    score::cpp::ignore = std::remove(log_path.c_str());
+}
+
+BENCHMARK_CAPTURE(BM_StartUp, OnDemand, CacheLoadingMode::kOnDemand)
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_StartUp, OnStartup, CacheLoadingMode::kOnStartup)
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+
+/// @brief Calibration-like set holding a table of the given number of repetitive numbers
+std::string CreateLargeParameterSet(const std::size_t value_count)
+{
+    std::string serialized_set{R"({"qualifier": 1, "parameters": {"table": [)"};
+    for (std::size_t index = 0U; index < value_count; ++index)
+    {
+        serialized_set += (index == 0U ? "" : ", ");
+        serialized_set += std::to_string(static_cast<double>(index % 64U) * 0.25);
+    }
+    serialized_set += "]}}";
+    return serialized_set;
+}
+
+/// @brief Measures reading one large persisted set, stored plain or compressed, until its table is accessed
+void BM_ReadLargeParameterSet(benchmark::State& state, const std::size_t minimum_compressed_set_size)
+{
+    const auto value_count = static_cast<std::size_t>(state.range(0));
+    const std::string log_path = "/tmp/file_persistency_benchmark_large_" + std::to_string(value_count) + ".log";
+    score::cpp::ignore = std::remove(log_path.c_str());
+    RecordCompressionPolicy compression_policy{};
+    compression_policy.minimum_set_size = minimum_compressed_set_size;
+
+    const std::string serialized_set = CreateLargeParameterSet(value_count);
+    {
+        FilePersistency persistency{log_path, LogCompactionPolicy{}, CacheLoadingMode::kOnDemand, compression_policy};
+        auto set_json = json::JsonParser{}.FromBuffer(serialized_set);
+        persistency.CacheParameterSet(
+            {}, GetSetName(0U), std::make_shared<const ParameterSet>(std::move(set_json).value()), true);
+    }
+
+    for (auto _ : state)
+    {
+        FilePersistency persistency{log_path, LogCompactionPolicy{}, CacheLoadingMode::kOnDemand, compression_policy};
+        ParameterMap cached_parameter_sets{};
+        persistency.ReadCachedParameterSets(cached_parameter_sets, score::cpp::pmr::get_default_resource(), nullptr);
+        auto table = cached_parameter_sets.at(GetSetName(0U))->GetParameterAs<ParameterSet::Array<double>>("table");
+        benchmark::DoNotOptimize(table);
+    }
+
+    std::ifstream log_file{log_path, std::ios::binary | std::ios::ate};
+    state.counters["log_bytes"] = static_cast<double>(log_file.tellg());
+    state.counters["set_bytes"] = static_cast<double>(serialized_set.size());
+    score::cpp::ignore = std::remove(log_path.c_str());
+}
+
+BENCHMARK_CAPTURE(BM_ReadLargeParameterSet, Plain, std::numeric_limits<std::size_t>::max())
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ReadLargeParameterSet, Compressed, 0U)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
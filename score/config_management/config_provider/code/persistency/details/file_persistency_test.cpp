@@ -0,0 +1,386 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/file_persistency.h"
+#include "score/config_management/config_provider/code/persistency/details/record_log.h"
+
+#include "score/json/json_parser.h"
+
+#include <score/utility.hpp>
+
+#include <gtest/gtest.h>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <fstream>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+/// @brief Serialized set with a table of 10000 numbers, large enough to be compressed
+std::string CreateLargeParameterSet()
+{
+    std::string serialized_set{R"({"qualifier": 1, "parameters": {"table": [)"};
+    for (std::size_t index = 0U; index < 10000U; ++index)
+    {
+        serialized_set += ((index == 0U) ? "" : ", ") + std::to_string(index % 100U);
+    }
+    return serialized_set + "]}}";
+}
+
+std::shared_ptr<const ParameterSet> CreateParameterSet(const std::string& set_json)
+{
+    auto parsed_set = json::JsonParser{}.FromBuffer(set_json);
+    EXPECT_TRUE(parsed_set.has_value());
+    return std::make_shared<const ParameterSet>(std::move(parsed_set).value());
+}
+
+class FilePersistencyTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        log_path_ = ::testing::TempDir() + "file_persistency_test.log";
+        score::cpp::ignore = std::remove(log_path_.c_str());
+    }
+
+    ParameterMap ReadBack(const CacheLoadingMode loading_mode = CacheLoadingMode::kOnDemand) const
+    {
+        FilePersistency persistency{log_path_, LogCompactionPolicy{}, loading_mode};
+        ParameterMap cached_parameter_sets{};
+        persistency.ReadCachedParameterSets(cached_parameter_sets, score::cpp::pmr::get_default_resource(), nullptr);
+        return cached_parameter_sets;
+    }
+
+    std::string log_path_;
+};
+
+TEST_F(FilePersistencyTest, CachedParameterSetsAreReadBack)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::FilePersistency::ReadCachedParameterSets()");
+    RecordProperty("Description",
+                   "This test verifies that synced parameter sets are available again for the next ConfigProvider "
+                   "instance.");
+
+    {
+        FilePersistency persistency{log_path_};
+        ParameterMap cached_parameter_sets{};
+        cached_parameter_sets.emplace("set_name_1",
+                                      CreateParameterSet(R"({"parameters": {"parameter": 1}, "qualifier": 1})"));
+        persistency.CacheParameterSet(cached_parameter_sets,
+                                      "set_name_2",
+                                      CreateParameterSet(R"({"parameters": {"parameter": [1, 2]}, "qualifier": 1})"),
+                                      false);
+        persistency.SyncToStorage();
+    }
+
+    const auto cached_parameter_sets = ReadBack();
+
+    ASSERT_EQ(cached_parameter_sets.size(), 2U);
+    EXPECT_EQ(cached_parameter_sets.at("set_name_1")->GetParameterAs<int>("parameter").value(), 1);
+    const auto array = cached_parameter_sets.at("set_name_2")->GetParameterAs<ParameterSet::Array<int>>("parameter");
+    ASSERT_TRUE(array.has_value());
+    EXPECT_EQ(array.value().size(), 2U);
+    EXPECT_EQ(cached_parameter_sets.at("set_name_2")->GetQualifier().value(),
+              score::platform::config_daemon::ParameterSetQualifier::kQualified);
+}
+
+TEST_F(FilePersistencyTest, ReadSetsArePersistedAgain)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::FilePersistency::CacheParameterSet()");
+    RecordProperty("Description",
+                   "This test verifies that parameter sets read from the log are kept when another set is "
+                   "cached and synced.");
+
+    {
+        FilePersistency persistency{log_path_};
+        persistency.CacheParameterSet(
+            {}, "set_name_1", CreateParameterSet(R"({"parameters": {"parameter": 1}, "qualifier": 1})"), true);
+    }
+    {
+        FilePersistency persistency{log_path_};
+        ParameterMap cached_parameter_sets{};
+        persistency.ReadCachedParameterSets(cached_parameter_sets, score::cpp::pmr::get_default_resource(), nullptr);
+        persistency.CacheParameterSet(cached_parameter_sets,
+                                      "set_name_2",
+                                      CreateParameterSet(R"({"parameters": {"parameter": 2}, "qualifier": 1})"),
+                                      true);
+    }
+
+    const auto cached_parameter_sets = ReadBack();
+
+    ASSERT_EQ(cached_parameter_sets.size(), 2U);
+    EXPECT_EQ(cached_parameter_sets.at("set_name_1")->GetParameterAs<int>("parameter").value(), 1);
+    EXPECT_EQ(cached_parameter_sets.at("set_name_2")->GetParameterAs<int>("parameter").value(), 2);
+}
+
+TEST_F(FilePersistencyTest, UnqualifiedParameterSetsAreNotPersisted)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::FilePersistency::CacheParameterSet()");
+    RecordProperty("Description", "This test verifies that only parameter sets qualified as kQualified are persisted.");
+
+    {
+        FilePersistency persistency{log_path_};
+        ParameterMap cached_parameter_sets{};
+        cached_parameter_sets.emplace("set_name_1", CreateParameterSet(R"({"parameters": {}, "qualifier": 0})"));
+        persistency.CacheParameterSet(
+            cached_parameter_sets, "set_name_2", CreateParameterSet(R"({"parameters": {}, "qualifier": 1})"), false);
+        persistency.CacheParameterSet(
+            cached_parameter_sets, "set_name_3", CreateParameterSet(R"({"parameters": {}, "qualifier": 3})"), true);
+    }
+
+    const auto cached_parameter_sets = ReadBack();
+
+    ASSERT_EQ(cached_parameter_sets.size(), 1U);
+    EXPECT_EQ(cached_parameter_sets.count("set_name_2"), 1U);
+}
+
+TEST_F(FilePersistencyTest, UnchangedParameterSetIsNotWrittenAgain)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::FilePersistency::SyncToStorage()");
+    RecordProperty("Description",
+                   "This test verifies that a parameter set whose content is already persisted is not written again, "
+                   "also after a restart.");
+
+    const std::string set_json{R"({"parameters": {"parameter": 1}, "qualifier": 1})"};
+    {
+        FilePersistency persistency{log_path_};
+        persistency.CacheParameterSet({}, "set_name_1", CreateParameterSet(set_json), true);
+        const auto written_bytes = persistency.GetStatistics().written_bytes;
+        persistency.CacheParameterSet({}, "set_name_1", CreateParameterSet(set_json), true);
+
+        const auto statistics = persistency.GetStatistics();
+        EXPECT_EQ(statistics.written_bytes, written_bytes);
+        EXPECT_EQ(statistics.written_parameter_sets, 1U);
+        EXPECT_EQ(statistics.unchanged_parameter_sets, 1U);
+    }
+
+    FilePersistency persistency{log_path_};
+    ParameterMap cached_parameter_sets{};
+    persistency.ReadCachedParameterSets(cached_parameter_sets, score::cpp::pmr::get_default_resource(), nullptr);
+    persistency.CacheParameterSet(cached_parameter_sets, "set_name_1", CreateParameterSet(set_json), true);
+
+    const auto statistics = persistency.GetStatistics();
+    EXPECT_EQ(statistics.written_bytes, 0U);
+    EXPECT_EQ(statistics.unchanged_parameter_sets, 1U);
+}
+
+TEST_F(FilePersistencyTest, ChangedParametersAreWrittenAsDelta)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::FilePersistency::SyncToStorage()");
+    RecordProperty("Description",
+                   "This test verifies that a change of a single parameter of a large set is written as delta and "
+                   "that the delta is applied when the set is read back.");
+
+    const auto create_set = [](const int changed_value) {
+        std::string set_json{R"({"parameters": {"changed": )" + std::to_string(changed_value)};
+        for (int index = 0; index < 100; ++index)
+        {
+            set_json += R"(, "parameter_)" + std::to_string(index) + R"(": )" + std::to_string(index);
+        }
+        return CreateParameterSet(set_json + R"(}, "qualifier": 1})");
+    };
+    {
+        FilePersistency persistency{log_path_};
+        persistency.CacheParameterSet({}, "set_name_1", create_set(1), true);
+        const auto full_written_bytes = persistency.GetStatistics().written_bytes;
+        persistency.CacheParameterSet({}, "set_name_1", create_set(2), true);
+
+        const auto statistics = persistency.GetStatistics();
+        EXPECT_EQ(statistics.written_parameter_sets, 1U);
+        EXPECT_EQ(statistics.written_parameter_set_deltas, 1U);
+        EXPECT_LT(statistics.written_bytes - full_written_bytes, full_written_bytes / 4U);
+    }
+
+    const auto cached_parameter_sets = ReadBack();
+
+    ASSERT_EQ(cached_parameter_sets.size(), 1U);
+    EXPECT_EQ(cached_parameter_sets.at("set_name_1")->GetParameterAs<int>("changed").value(), 2);
+    EXPECT_EQ(cached_parameter_sets.at("set_name_1")->GetParameterAs<int>("parameter_99").value(), 99);
+}
+
+TEST_F(FilePersistencyTest, LogIsCompacted)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::FilePersistency::SyncToStorage()");
+    RecordProperty("Description",
+                   "This test verifies that the log does not grow with the number of updates of the same set.");
+
+    {
+        FilePersistency persistency{log_path_, LogCompactionPolicy{0.5, 0U}};
+        for (int value = 0; value < 100; ++value)
+        {
+            const std::string set_json{R"({"parameters": {"parameter": )" + std::to_string(value) +
+                                       R"(}, "qualifier": 1})"};
+            persistency.CacheParameterSet({}, "set_name_1", CreateParameterSet(set_json), true);
+        }
+    }
+
+    std::ifstream log_file{log_path_, std::ios::binary | std::ios::ate};
+    EXPECT_LT(log_file.tellg(), 300);
+    const auto cached_parameter_sets = ReadBack();
+    ASSERT_EQ(cached_parameter_sets.size(), 1U);
+    EXPECT_EQ(cached_parameter_sets.at("set_name_1")->GetParameterAs<int>("parameter").value(), 99);
+}
+
+TEST_F(FilePersistencyTest, CorruptedLogIsIgnored)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::FilePersistency::ReadCachedParameterSets()");
+    RecordProperty("Description",
+                   "This test verifies that a corrupted or missing log results in an empty cache.");
+
+    EXPECT_TRUE(ReadBack().empty());
+
+    std::ofstream{log_path_, std::ios::binary} << "CPLG garbage";
+    EXPECT_TRUE(ReadBack().empty());
+}
+
+TEST_F(FilePersistencyTest, LargeParameterSetIsCompressed)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::FilePersistency::SyncToStorage()");
+    RecordProperty("Description",
+                   "This test verifies that a set above the compression threshold is written compressed and read "
+                   "back in both loading modes.");
+
+    const std::string serialized_set = CreateLargeParameterSet();
+    {
+        FilePersistency persistency{log_path_};
+        persistency.CacheParameterSet({}, "set_name_1", CreateParameterSet(serialized_set), true);
+        EXPECT_EQ(persistency.GetStatistics().written_compressed_parameter_sets, 1U);
+    }
+
+    std::ifstream log_file{log_path_, std::ios::binary | std::ios::ate};
+    EXPECT_LT(static_cast<std::size_t>(log_file.tellg()), serialized_set.size() / 4U);
+    for (const auto loading_mode : {CacheLoadingMode::kOnDemand, CacheLoadingMode::kOnStartup})
+    {
+        const auto cached_parameter_sets = ReadBack(loading_mode);
+        ASSERT_EQ(cached_parameter_sets.size(), 1U);
+        const auto table = cached_parameter_sets.at("set_name_1")->GetParameterAs<ParameterSet::Array<int>>("table");
+        ASSERT_TRUE(table.has_value());
+        EXPECT_EQ(table.value().size(), 10000U);
+        EXPECT_EQ(table.value()[199U], 99);
+    }
+}
+
+TEST_F(FilePersistencyTest, IdenticalLargeParameterSetIsSharedBetweenProcesses)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::FilePersistency::SyncToStorage()");
+    RecordProperty("Description",
+                   "This test verifies that a large set persisted by two processes is stored once in the shared "
+                   "directory and read back by both.");
+
+    const std::string shared_directory = ::testing::TempDir() + "file_persistency_test_shared";
+    score::cpp::ignore = ::mkdir(shared_directory.c_str(), 0755);
+    const std::string other_log_path = ::testing::TempDir() + "file_persistency_test_other.log";
+    score::cpp::ignore = std::remove(other_log_path.c_str());
+    RecordCompressionPolicy compression_policy{};
+    compression_policy.shared_directory = shared_directory;
+
+    for (const auto& log_path : {log_path_, other_log_path})
+    {
+        FilePersistency persistency{log_path, LogCompactionPolicy{}, CacheLoadingMode::kOnDemand, compression_policy};
+        persistency.CacheParameterSet({}, "set_name_1", CreateParameterSet(CreateLargeParameterSet()), true);
+    }
+
+    std::size_t shared_set_count{0U};
+    DIR* const directory = ::opendir(shared_directory.c_str());
+    ASSERT_NE(directory, nullptr);
+    for (const dirent* entry = ::readdir(directory); entry != nullptr; entry = ::readdir(directory))
+    {
+        shared_set_count += (entry->d_name[0] == '.') ? 0U : 1U;
+    }
+    score::cpp::ignore = ::closedir(directory);
+    EXPECT_EQ(shared_set_count, 1U);
+
+    for (const auto& log_path : {log_path_, other_log_path})
+    {
+        FilePersistency persistency{log_path, LogCompactionPolicy{}, CacheLoadingMode::kOnDemand, compression_policy};
+        ParameterMap cached_parameter_sets{};
+        persistency.ReadCachedParameterSets(cached_parameter_sets, score::cpp::pmr::get_default_resource(), nullptr);
+        ASSERT_EQ(cached_parameter_sets.size(), 1U);
+        const auto table = cached_parameter_sets.at("set_name_1")->GetParameterAs<ParameterSet::Array<int>>("table");
+        ASSERT_TRUE(table.has_value());
+        EXPECT_EQ(table.value().size(), 10000U);
+    }
+}
+
+TEST_F(FilePersistencyTest, MalformedParameterSetIsDroppedWhenLoadedOnStartup)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::FilePersistency::ReadCachedParameterSets()");
+    RecordProperty("Description",
+                   "This test verifies that malformed sets are only parsed on access when loaded on demand and are "
+                   "dropped when loaded on start-up.");
+
+    {
+        RecordLog log{log_path_};
+        ASSERT_TRUE(log.Open().has_value());
+        ASSERT_TRUE(log.Append({LogRecord{"set_name_1", R"({"parameters": {"parameter": 1}, "qualifier": 1})"},
+                                LogRecord{"set_name_2", R"({"parameters": )"}})
+                        .has_value());
+    }
+
+    const auto on_demand_sets = ReadBack(CacheLoadingMode::kOnDemand);
+    ASSERT_EQ(on_demand_sets.size(), 2U);
+    EXPECT_EQ(on_demand_sets.at("set_name_1")->GetParameterAs<int>("parameter").value(), 1);
+    EXPECT_FALSE(on_demand_sets.at("set_name_2")->GetParameterAs<int>("parameter").has_value());
+
+    const auto on_startup_sets = ReadBack(CacheLoadingMode::kOnStartup);
+    ASSERT_EQ(on_startup_sets.size(), 1U);
+    EXPECT_EQ(on_startup_sets.at("set_name_1")->GetParameterAs<int>("parameter").value(), 1);
+}
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
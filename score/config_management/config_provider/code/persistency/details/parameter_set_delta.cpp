@@ -0,0 +1,193 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/parameter_set_delta.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include "score/json/json_parser.h"
+#include "score/json/json_writer.h"
+
+#include <score/utility.hpp>
+
+#include <iterator>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+constexpr std::string_view kParameters{"parameters"};
+constexpr std::string_view kRemovedParameters{"removed_parameters"};
+
+Result<json::Object> ParseObject(const std::string_view serialized_object)
+{
+    auto parsed = json::JsonParser{}.FromBuffer(serialized_object);
+    if (!parsed.has_value())
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Failed to parse parameter set");
+    }
+    auto object = parsed.value().As<json::Object>();
+    if (!object.has_value())
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Parameter set is no JSON object");
+    }
+    return std::move(object.value().get());
+}
+
+/// @brief Moves the member out of the object, it is a null value if the object has no such member
+json::Any ExtractMember(json::Object& object, const std::string_view name)
+{
+    const auto member = object.find(name);
+    if (member == object.end())
+    {
+        return json::Any{};
+    }
+    return std::move(object.extract(member).mapped());
+}
+
+Result<json::Object> ExtractParameters(json::Object& set)
+{
+    auto parameters = ExtractMember(set, kParameters);
+    auto parameters_object = parameters.As<json::Object>();
+    if (!parameters_object.has_value())
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Parameter set has no parameters");
+    }
+    return std::move(parameters_object.value().get());
+}
+
+Result<std::string> Serialize(const json::Object& object)
+{
+    auto serialized = json::JsonWriter{}.ToBuffer(object);
+    if (!serialized.has_value())
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Failed to serialize parameter set");
+    }
+    return std::move(serialized).value();
+}
+
+}  // namespace
+
+Result<std::string> CreateParameterSetDelta(const std::string_view serialized_base_set,
+                                            const std::string_view serialized_target_set)
+{
+    auto base_set = ParseObject(serialized_base_set);
+    auto target_set = ParseObject(serialized_target_set);
+    if ((!base_set.has_value()) || (!target_set.has_value()))
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Failed to parse parameter set");
+    }
+    const auto base_parameters = ExtractParameters(base_set.value());
+    auto target_parameters = ExtractParameters(target_set.value());
+    if ((!base_parameters.has_value()) || (!target_parameters.has_value()))
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Parameter set has no parameters");
+    }
+
+    // Changed parameters are moved from the target into the delta, the remaining ones are unchanged
+    json::Object changed_parameters{};
+    for (auto parameter = target_parameters.value().begin(); parameter != target_parameters.value().end();)
+    {
+        const auto base_parameter = base_parameters.value().find(parameter->first.GetAsStringView());
+        if ((base_parameter != base_parameters.value().end()) && (base_parameter->second == parameter->second))
+        {
+            ++parameter;
+            continue;
+        }
+        const auto next_parameter = std::next(parameter);
+        score::cpp::ignore = changed_parameters.insert(target_parameters.value().extract(parameter));
+        parameter = next_parameter;
+    }
+
+    json::List removed_parameters{};
+    for (const auto& base_parameter : base_parameters.value())
+    {
+        const auto name = base_parameter.first.GetAsStringView();
+        if ((target_parameters.value().count(name) == 0U) && (changed_parameters.count(name) == 0U))
+        {
+            removed_parameters.emplace_back(std::string{name});
+        }
+    }
+
+    // All other members of the target set, e.g. its qualifier, are taken over as they are
+    json::Object delta{std::move(target_set).value()};
+    score::cpp::ignore = delta.emplace(std::string{kParameters}, std::move(changed_parameters));
+    score::cpp::ignore = delta.emplace(std::string{kRemovedParameters}, std::move(removed_parameters));
+    return Serialize(delta);
+}
+
+Result<std::string> ApplyParameterSetDeltas(const std::string_view serialized_base_set,
+                                            const std::vector<std::string_view>& serialized_deltas)
+{
+    auto set = ParseObject(serialized_base_set);
+    if (!set.has_value())
+    {
+        return MakeUnexpected<std::string>(set.error());
+    }
+    auto parameters = ExtractParameters(set.value());
+    if (!parameters.has_value())
+    {
+        return MakeUnexpected<std::string>(parameters.error());
+    }
+
+    for (const auto& serialized_delta : serialized_deltas)
+    {
+        auto delta = ParseObject(serialized_delta);
+        if (!delta.has_value())
+        {
+            return MakeUnexpected<std::string>(delta.error());
+        }
+        auto changed_parameters = ExtractParameters(delta.value());
+        const auto removed_parameters_member = ExtractMember(delta.value(), kRemovedParameters);
+        const auto removed_parameters = removed_parameters_member.As<json::List>();
+        if ((!changed_parameters.has_value()) || (!removed_parameters.has_value()))
+        {
+            return MakeUnexpected(PersistencyError::kDataCorrupted, "Malformed parameter set delta");
+        }
+
+        for (const auto& removed_parameter : removed_parameters.value().get())
+        {
+            const auto name = removed_parameter.As<std::string_view>();
+            if (name.has_value())
+            {
+                score::cpp::ignore = ExtractMember(parameters.value(), name.value());
+            }
+        }
+        auto& changed = changed_parameters.value();
+        while (!changed.empty())
+        {
+            auto changed_parameter = changed.extract(changed.begin());
+            score::cpp::ignore = ExtractMember(parameters.value(), changed_parameter.key().GetAsStringView());
+            score::cpp::ignore = parameters.value().insert(std::move(changed_parameter));
+        }
+        auto& other_members = delta.value();
+        while (!other_members.empty())
+        {
+            auto member = other_members.extract(other_members.begin());
+            score::cpp::ignore = ExtractMember(set.value(), member.key().GetAsStringView());
+            score::cpp::ignore = set.value().insert(std::move(member));
+        }
+    }
+
+    score::cpp::ignore = set.value().emplace(std::string{kParameters}, std::move(parameters).value());
+    return Serialize(set.value());
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
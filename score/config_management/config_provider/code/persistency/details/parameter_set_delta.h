@@ -0,0 +1,62 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_PARAMETER_SET_DELTA_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_PARAMETER_SET_DELTA_H
+
+#include "score/result/result.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Delta between two serialized parameter sets
+///
+/// The delta holds the changed and added parameters, the names of the removed parameters and all other members of
+/// the target set, e.g. its qualifier:
+///
+/// {
+///     "parameters": {"changed_parameter": 2},
+///     "removed_parameters": ["removed_parameter"],
+///     "qualifier": 1
+/// }
+///
+
+/// @brief Creates the delta which turns the base set into the target set
+///
+/// @return serialized delta or kDataCorrupted if one of the sets is malformed
+///
+Result<std::string> CreateParameterSetDelta(const std::string_view serialized_base_set,
+                                            const std::string_view serialized_target_set);
+
+/// @brief Applies the deltas in the given order to the base set
+///
+/// @return serialized resulting set or kDataCorrupted if the set or one of the deltas is malformed
+///
+Result<std::string> ApplyParameterSetDeltas(const std::string_view serialized_base_set,
+                                            const std::vector<std::string_view>& serialized_deltas);
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_PARAMETER_SET_DELTA_H
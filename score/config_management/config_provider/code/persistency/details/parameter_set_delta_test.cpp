@@ -0,0 +1,104 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/parameter_set_delta.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+void ExpectSameJson(const std::string& actual, const std::string& expected)
+{
+    const auto actual_json = json::JsonParser{}.FromBuffer(actual);
+    const auto expected_json = json::JsonParser{}.FromBuffer(expected);
+    ASSERT_TRUE(actual_json.has_value());
+    ASSERT_TRUE(expected_json.has_value());
+    EXPECT_TRUE(actual_json.value() == expected_json.value()) << actual;
+}
+
+TEST(ParameterSetDeltaTest, DeltaTurnsBaseIntoTarget)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::CreateParameterSetDelta()");
+    RecordProperty("Description",
+                   "This test verifies that the delta only holds changed, added and removed parameters and that "
+                   "applying it to the base set results in the target set.");
+
+    const std::string base_set{R"({"parameters": {"a": 1, "b": [1, 2, 3], "c": "x"}, "qualifier": 0})"};
+    const std::string target_set{R"({"parameters": {"a": 1, "b": [1, 2, 4], "d": true}, "qualifier": 1})"};
+
+    const auto delta = CreateParameterSetDelta(base_set, target_set);
+
+    ASSERT_TRUE(delta.has_value());
+    ExpectSameJson(delta.value(),
+                   R"({"parameters": {"b": [1, 2, 4], "d": true}, "removed_parameters": ["c"], "qualifier": 1})");
+    const auto result = ApplyParameterSetDeltas(base_set, {delta.value()});
+    ASSERT_TRUE(result.has_value());
+    ExpectSameJson(result.value(), target_set);
+}
+
+TEST(ParameterSetDeltaTest, DeltasAreAppliedInOrder)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ApplyParameterSetDeltas()");
+    RecordProperty("Description", "This test verifies that a chain of deltas is applied in the given order.");
+
+    const std::string set_1{R"({"parameters": {"a": 1, "b": 2}, "qualifier": 1})"};
+    const std::string set_2{R"({"parameters": {"a": 2}, "qualifier": 1})"};
+    const std::string set_3{R"({"parameters": {"a": 2, "b": 3}, "qualifier": 1})"};
+    const auto delta_1 = CreateParameterSetDelta(set_1, set_2);
+    const auto delta_2 = CreateParameterSetDelta(set_2, set_3);
+    ASSERT_TRUE(delta_1.has_value());
+    ASSERT_TRUE(delta_2.has_value());
+
+    const auto result = ApplyParameterSetDeltas(set_1, {delta_1.value(), delta_2.value()});
+
+    ASSERT_TRUE(result.has_value());
+    ExpectSameJson(result.value(), set_3);
+}
+
+TEST(ParameterSetDeltaTest, MalformedSet)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::CreateParameterSetDelta()");
+    RecordProperty("Description", "This test verifies that malformed sets and deltas are reported as kDataCorrupted.");
+
+    const std::string set{R"({"parameters": {"a": 1}})"};
+
+    EXPECT_EQ(CreateParameterSetDelta(set, "[]").error(), PersistencyError::kDataCorrupted);
+    EXPECT_EQ(CreateParameterSetDelta(R"({"qualifier": 1})", set).error(), PersistencyError::kDataCorrupted);
+    EXPECT_EQ(ApplyParameterSetDeltas(set, {R"({"parameters": {)"}).error(), PersistencyError::kDataCorrupted);
+    EXPECT_EQ(ApplyParameterSetDeltas(set, {R"({"parameters": {}})"}).error(), PersistencyError::kDataCorrupted);
+}
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
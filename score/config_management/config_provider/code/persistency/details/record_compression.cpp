@@ -0,0 +1,109 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/record_compression.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include <score/utility.hpp>
+
+#include <zlib.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+constexpr std::size_t kSizeFieldSize{sizeof(std::uint32_t)};
+
+/// @brief zlib counts the sizes of its input and output buffers in 32 bits
+constexpr std::size_t kMaximumSetSize{std::numeric_limits<std::uint32_t>::max()};
+
+/// @brief Deflate emits at least 2 bits per 258 bytes, so no stream inflates to more than 1032 times its size
+constexpr std::uint64_t kMaximumCompressionRatio{1032U};
+
+}  // namespace
+
+Result<std::string> CompressParameterSet(const std::string_view serialized_set)
+{
+    if (serialized_set.size() > kMaximumSetSize)
+    {
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Parameter set is too large");
+    }
+    const auto set_size = static_cast<std::uint32_t>(serialized_set.size());
+    auto compressed_size = ::compressBound(static_cast<uLong>(set_size));
+
+    std::string compressed_set(kSizeFieldSize + compressed_size, '\0');
+    score::cpp::ignore = std::memcpy(&compressed_set[0], &set_size, kSizeFieldSize);
+    // zlib does not modify the input, it is only declared as non-const for historical reasons
+    const auto result = ::compress2(reinterpret_cast<Bytef*>(&compressed_set[kSizeFieldSize]),
+                                    &compressed_size,
+                                    reinterpret_cast<const Bytef*>(serialized_set.data()),
+                                    static_cast<uLong>(set_size),
+                                    Z_BEST_SPEED);
+    if (result != Z_OK)
+    {
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Failed to compress parameter set");
+    }
+    compressed_set.resize(kSizeFieldSize + compressed_size);
+    return compressed_set;
+}
+
+Result<std::string> DecompressParameterSet(const std::string_view compressed_set)
+{
+    if ((compressed_set.size() < kSizeFieldSize) || (compressed_set.size() > kMaximumSetSize))
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Compressed parameter set has an invalid size");
+    }
+    std::uint32_t set_size{};
+    score::cpp::ignore = std::memcpy(&set_size, compressed_set.data(), kSizeFieldSize);
+    // The size is checked before the set is allocated, as shared set files are not protected by a checksum
+    const auto compressed_size = static_cast<std::uint64_t>(compressed_set.size() - kSizeFieldSize);
+    if (static_cast<std::uint64_t>(set_size) > (compressed_size * kMaximumCompressionRatio))
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Compressed parameter set has an implausible size");
+    }
+
+    ::z_stream stream{};
+    if (::inflateInit(&stream) != Z_OK)
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Failed to initialize decompression");
+    }
+    std::string serialized_set(set_size, '\0');
+    // zlib does not modify the input, it is only declared as non-const for historical reasons
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed_set.data() + kSizeFieldSize));
+    stream.avail_in = static_cast<uInt>(compressed_set.size() - kSizeFieldSize);
+    stream.next_out = reinterpret_cast<Bytef*>(&serialized_set[0]);
+    stream.avail_out = static_cast<uInt>(set_size);
+    // Neither the input nor the output buffer ends before the stream does, so a single call decompresses everything
+    const auto result = ::inflate(&stream, Z_FINISH);
+    const bool is_complete = (result == Z_STREAM_END) && (stream.avail_out == 0U);
+    score::cpp::ignore = ::inflateEnd(&stream);
+    if (!is_complete)
+    {
+        return MakeUnexpected(PersistencyError::kDataCorrupted, "Compressed parameter set is corrupted");
+    }
+    return serialized_set;
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,57 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_RECORD_COMPRESSION_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_RECORD_COMPRESSION_H
+
+#include "score/result/result.h"
+
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Compressed serialized parameter set
+///
+/// The size of the serialized set is stored in front of a zlib stream, so that the set can be decompressed into
+/// a buffer which is allocated exactly once. The Adler-32 checksum of the zlib stream detects corrupted content:
+///
+///   | serialized set size (uint32) | zlib stream |
+///
+
+/// @brief Compresses the serialized set with the fastest zlib compression level
+///
+/// @return compressed set or kUnableToSaveToPersistency if the set is too large or can not be compressed
+///
+Result<std::string> CompressParameterSet(const std::string_view serialized_set);
+
+/// @brief Decompresses the set straight from the given memory, e.g. a memory-mapped file, into the returned string
+///
+/// Besides the returned string, only the fixed-size state of the decompressor is allocated.
+///
+/// @return serialized set or kDataCorrupted if the compressed set is malformed
+///
+Result<std::string> DecompressParameterSet(const std::string_view compressed_set);
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_RECORD_COMPRESSION_H
@@ -0,0 +1,115 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/record_compression.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+std::string CreateNumericTable()
+{
+    std::string serialized_set{R"({"qualifier": 1, "parameters": {"table": [)"};
+    for (std::size_t index = 0U; index < 10000U; ++index)
+    {
+        serialized_set += ((index == 0U) ? "" : ", ") + std::to_string(index % 100U);
+    }
+    return serialized_set + "]}}";
+}
+
+TEST(RecordCompressionTest, CompressedSetIsDecompressed)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::DecompressParameterSet()");
+    RecordProperty("Description",
+                   "This test verifies that a repetitive set is compressed and decompressed without modification.");
+
+    const std::string serialized_set = CreateNumericTable();
+
+    const auto compressed_set = CompressParameterSet(serialized_set);
+    ASSERT_TRUE(compressed_set.has_value());
+    EXPECT_LT(compressed_set.value().size(), serialized_set.size() / 4U);
+
+    const auto decompressed_set = DecompressParameterSet(compressed_set.value());
+    ASSERT_TRUE(decompressed_set.has_value());
+    EXPECT_EQ(decompressed_set.value(), serialized_set);
+
+    const auto empty_set = DecompressParameterSet(CompressParameterSet("").value());
+    ASSERT_TRUE(empty_set.has_value());
+    EXPECT_TRUE(empty_set.value().empty());
+}
+
+TEST(RecordCompressionTest, CorruptedSetIsDetected)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::DecompressParameterSet()");
+    RecordProperty("Description",
+                   "This test verifies that truncated, modified or wrongly sized compressed sets are rejected.");
+
+    const std::string compressed_set = CompressParameterSet(CreateNumericTable()).value();
+
+    EXPECT_EQ(DecompressParameterSet("abc").error(), PersistencyError::kDataCorrupted);
+    EXPECT_EQ(DecompressParameterSet(compressed_set.substr(0U, compressed_set.size() - 1U)).error(),
+              PersistencyError::kDataCorrupted);
+
+    std::string modified_set{compressed_set};
+    modified_set[modified_set.size() / 2U] = static_cast<char>(~modified_set[modified_set.size() / 2U]);
+    EXPECT_EQ(DecompressParameterSet(modified_set).error(), PersistencyError::kDataCorrupted);
+
+    std::string resized_set{compressed_set};
+    resized_set[0U] = static_cast<char>(resized_set[0U] + 1);
+    EXPECT_EQ(DecompressParameterSet(resized_set).error(), PersistencyError::kDataCorrupted);
+}
+
+TEST(RecordCompressionTest, ImplausibleSizeIsRejected)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::DecompressParameterSet()");
+    RecordProperty("Description",
+                   "This test verifies that a size beyond the maximum compression ratio of zlib is rejected before "
+                   "the set is allocated, while a set compressed at that ratio is decompressed.");
+
+    std::string compressed_set = CompressParameterSet(CreateNumericTable()).value();
+    compressed_set[0U] = '\xFF';
+    compressed_set[1U] = '\xFF';
+    compressed_set[2U] = '\xFF';
+    compressed_set[3U] = '\xFF';
+    EXPECT_EQ(DecompressParameterSet(compressed_set).error(), PersistencyError::kDataCorrupted);
+
+    const std::string zeros(std::size_t{16U} * 1024U * 1024U, '\0');
+    const auto decompressed_zeros = DecompressParameterSet(CompressParameterSet(zeros).value());
+    ASSERT_TRUE(decompressed_zeros.has_value());
+    EXPECT_EQ(decompressed_zeros.value(), zeros);
+}
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
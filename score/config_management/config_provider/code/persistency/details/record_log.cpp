@@ -0,0 +1,509 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/record_log.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+/// @brief Read-only mapping of the log, it stays valid even if the log gets truncated or replaced afterwards
+class LogMapping final
+{
+  public:
+    LogMapping(const void* const address, const std::size_t size) noexcept : address_{address}, size_{size} {}
+    LogMapping(const LogMapping&) = delete;
+    LogMapping(LogMapping&&) = delete;
+    LogMapping& operator=(const LogMapping&) = delete;
+    LogMapping& operator=(LogMapping&&) = delete;
+    ~LogMapping() noexcept
+    {
+        // munmap() is specified on a non-const pointer, the mapping is never written through it
+        score::cpp::ignore = ::munmap(const_cast<void*>(address_), size_);
+    }
+
+    const char* GetData() const noexcept
+    {
+        return static_cast<const char*>(address_);
+    }
+
+  private:
+    const void* address_;
+    std::size_t size_;
+};
+
+namespace
+{
+
+constexpr std::array<char, 4U> kMagic{'C', 'P', 'L', 'G'};
+constexpr std::uint32_t kVersion{1U};
+constexpr std::size_t kFileHeaderSize{2U * sizeof(std::uint32_t)};
+constexpr std::size_t kRecordHeaderSize{4U * sizeof(std::uint32_t)};
+
+enum class RecordType : std::uint32_t
+{
+    kParameterSet = 1U,
+    kCommit = 2U,
+    kParameterSetDelta = 3U,
+    kCompressedParameterSet = 4U,
+    kSharedParameterSet = 5U,
+};
+
+RecordType GetRecordType(const RecordEncoding encoding) noexcept
+{
+    switch (encoding)
+    {
+        case RecordEncoding::kDelta:
+            return RecordType::kParameterSetDelta;
+        case RecordEncoding::kCompressed:
+            return RecordType::kCompressedParameterSet;
+        case RecordEncoding::kShared:
+            return RecordType::kSharedParameterSet;
+        case RecordEncoding::kFull:
+        default:
+            return RecordType::kParameterSet;
+    }
+}
+
+/// @brief Returns false for commit records and unknown record types
+bool GetRecordEncoding(const std::uint32_t type, RecordEncoding& encoding) noexcept
+{
+    switch (static_cast<RecordType>(type))
+    {
+        case RecordType::kParameterSet:
+            encoding = RecordEncoding::kFull;
+            return true;
+        case RecordType::kParameterSetDelta:
+            encoding = RecordEncoding::kDelta;
+            return true;
+        case RecordType::kCompressedParameterSet:
+            encoding = RecordEncoding::kCompressed;
+            return true;
+        case RecordType::kSharedParameterSet:
+            encoding = RecordEncoding::kShared;
+            return true;
+        case RecordType::kCommit:
+        default:
+            return false;
+    }
+}
+
+constexpr std::array<std::uint32_t, 256U> CreateCrcTable() noexcept
+{
+    std::array<std::uint32_t, 256U> table{};
+    for (std::uint32_t index = 0U; index < table.size(); ++index)
+    {
+        std::uint32_t value = index;
+        for (std::uint32_t bit = 0U; bit < 8U; ++bit)
+        {
+            value = ((value & 1U) != 0U) ? (0xEDB88320U ^ (value >> 1U)) : (value >> 1U);
+        }
+        table[index] = value;
+    }
+    return table;
+}
+
+constexpr std::array<std::uint32_t, 256U> kCrcTable{CreateCrcTable()};
+
+std::uint32_t UpdateCrc(std::uint32_t crc, const char* const data, const std::size_t size) noexcept
+{
+    for (std::size_t index = 0U; index < size; ++index)
+    {
+        crc = kCrcTable[(crc ^ static_cast<std::uint8_t>(data[index])) & 0xFFU] ^ (crc >> 8U);
+    }
+    return crc;
+}
+
+std::uint32_t ReadUint32(const char* const data) noexcept
+{
+    std::uint32_t value{};
+    score::cpp::ignore = std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+void AppendUint32(std::string& buffer, const std::uint32_t value)
+{
+    std::array<char, sizeof(value)> bytes{};
+    score::cpp::ignore = std::memcpy(bytes.data(), &value, sizeof(value));
+    score::cpp::ignore = buffer.append(bytes.data(), bytes.size());
+}
+
+std::size_t GetRecordSize(const LogRecord& record) noexcept
+{
+    return kRecordHeaderSize + record.name.size() + record.serialized_set.size();
+}
+
+void AppendRecord(std::string& buffer, const RecordType type, const LogRecord& record)
+{
+    const std::size_t record_offset = buffer.size();
+    AppendUint32(buffer, 0U);
+    AppendUint32(buffer, static_cast<std::uint32_t>(type));
+    AppendUint32(buffer, static_cast<std::uint32_t>(record.name.size()));
+    AppendUint32(buffer, static_cast<std::uint32_t>(record.serialized_set.size()));
+    score::cpp::ignore = buffer.append(record.name.data(), record.name.size());
+    score::cpp::ignore = buffer.append(record.serialized_set.data(), record.serialized_set.size());
+
+    const std::size_t checked_offset = record_offset + sizeof(std::uint32_t);
+    const std::uint32_t crc =
+        ~UpdateCrc(0xFFFFFFFFU, buffer.data() + checked_offset, buffer.size() - checked_offset);
+    score::cpp::ignore = std::memcpy(&buffer[record_offset], &crc, sizeof(crc));
+}
+
+Result<std::string> SerializeRecords(const std::vector<LogRecord>& records) noexcept
+{
+    std::size_t size{kRecordHeaderSize};
+    for (const auto& record : records)
+    {
+        if ((record.name.size() > std::numeric_limits<std::uint32_t>::max()) ||
+            (record.serialized_set.size() > std::numeric_limits<std::uint32_t>::max()))
+        {
+            return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Parameter set is too large");
+        }
+        size += GetRecordSize(record);
+    }
+
+    std::string buffer{};
+    buffer.reserve(size);
+    for (const auto& record : records)
+    {
+        AppendRecord(buffer, GetRecordType(record.encoding), record);
+    }
+    AppendRecord(buffer, RecordType::kCommit, LogRecord{});
+    return buffer;
+}
+
+std::string CreateFileHeader()
+{
+    std::string buffer{kMagic.data(), kMagic.size()};
+    AppendUint32(buffer, kVersion);
+    return buffer;
+}
+
+bool WriteAll(const int file_descriptor, const std::string& buffer) noexcept
+{
+    std::size_t written{0U};
+    while (written < buffer.size())
+    {
+        const auto result = ::write(file_descriptor, buffer.data() + written, buffer.size() - written);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+bool SyncParentDirectory(const std::string& path) noexcept
+{
+    const auto separator = path.find_last_of('/');
+    const std::string directory = (separator == std::string::npos) ? "." : path.substr(0U, separator + 1U);
+    const int directory_descriptor = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (directory_descriptor < 0)
+    {
+        return false;
+    }
+    const bool synced = (::fsync(directory_descriptor) == 0);
+    score::cpp::ignore = ::close(directory_descriptor);
+    return synced;
+}
+
+/// @brief Returns the size of the valid part of the log and collects its committed records
+std::size_t ReplayRecords(const char* const data, const std::size_t size, std::vector<LogRecord>& records)
+{
+    std::unordered_map<std::string_view, std::size_t> record_group_indices{};
+    std::vector<std::vector<LogRecord>> record_groups{};
+    std::vector<LogRecord> uncommitted_records{};
+    std::size_t valid_size{kFileHeaderSize};
+    std::size_t offset{kFileHeaderSize};
+    while ((size - offset) >= kRecordHeaderSize)
+    {
+        const char* const record_data = data + offset;
+        const std::uint32_t crc = ReadUint32(record_data);
+        const std::uint32_t type = ReadUint32(record_data + 4U);
+        const std::size_t name_size = ReadUint32(record_data + 8U);
+        const std::size_t set_size = ReadUint32(record_data + 12U);
+        const std::size_t available_size = size - offset - kRecordHeaderSize;
+        if ((name_size > available_size) || (set_size > (available_size - name_size)))
+        {
+            break;
+        }
+        const std::size_t record_size = kRecordHeaderSize + name_size + set_size;
+        const std::size_t checked_size = record_size - sizeof(std::uint32_t);
+        if (crc != ~UpdateCrc(0xFFFFFFFFU, record_data + sizeof(std::uint32_t), checked_size))
+        {
+            break;
+        }
+        offset += record_size;
+
+        const char* const name = record_data + kRecordHeaderSize;
+        LogRecord record{std::string_view{name, name_size}, std::string_view{name + name_size, set_size}};
+        if (GetRecordEncoding(type, record.encoding))
+        {
+            uncommitted_records.push_back(record);
+        }
+        else if (type == static_cast<std::uint32_t>(RecordType::kCommit))
+        {
+            for (const auto& uncommitted_record : uncommitted_records)
+            {
+                const auto inserted = record_group_indices.emplace(uncommitted_record.name, record_groups.size());
+                if (inserted.second)
+                {
+                    record_groups.emplace_back();
+                }
+                auto& record_group = record_groups[inserted.first->second];
+                const bool is_delta = (uncommitted_record.encoding == RecordEncoding::kDelta);
+                if (!is_delta)
+                {
+                    record_group.clear();
+                }
+                // A delta without preceding full record can not be applied to anything
+                if ((!is_delta) || (!record_group.empty()))
+                {
+                    record_group.push_back(uncommitted_record);
+                }
+            }
+            uncommitted_records.clear();
+            valid_size = offset;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    for (const auto& record_group : record_groups)
+    {
+        score::cpp::ignore = records.insert(records.end(), record_group.begin(), record_group.end());
+    }
+    return valid_size;
+}
+
+}  // namespace
+
+RecordLog::RecordLog(std::string path) noexcept
+    : path_{std::move(path)},
+      file_descriptor_{-1},
+      size_{0U},
+      live_size_{0U},
+      written_size_{0U},
+      live_record_sizes_{}
+{
+}
+
+RecordLog::~RecordLog() noexcept
+{
+    Close();
+}
+
+Result<LogReplay> RecordLog::Open() noexcept
+{
+    Close();
+    file_descriptor_ = ::open(path_.c_str(), O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    if (file_descriptor_ < 0)
+    {
+        return MakeUnexpected(PersistencyError::kDataNotFound, "Unable to open log");
+    }
+    struct stat file_status
+    {
+    };
+    if (::fstat(file_descriptor_, &file_status) != 0)
+    {
+        Close();
+        return MakeUnexpected(PersistencyError::kDataNotFound, "Unable to read log size");
+    }
+
+    LogReplay replay{nullptr, {}, 0U};
+    const auto file_size = static_cast<std::size_t>(file_status.st_size);
+    std::size_t valid_size{0U};
+    if (file_size >= kFileHeaderSize)
+    {
+        void* const address = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor_, 0);
+        if (address == MAP_FAILED)
+        {
+            Close();
+            return MakeUnexpected(PersistencyError::kDataNotFound, "Unable to map log");
+        }
+        replay.mapping = std::make_shared<const LogMapping>(address, file_size);
+        const char* const data = replay.mapping->GetData();
+        if ((std::memcmp(data, kMagic.data(), kMagic.size()) == 0) && (ReadUint32(data + kMagic.size()) == kVersion))
+        {
+            valid_size = ReplayRecords(data, file_size, replay.records);
+        }
+    }
+
+    if (valid_size == 0U)
+    {
+        // Missing, foreign or unknown log version, start over with an empty log
+        replay.discarded_size = file_size;
+        replay.mapping.reset();
+        if ((::ftruncate(file_descriptor_, 0) != 0) || (!WriteAll(file_descriptor_, CreateFileHeader())) ||
+            (::fsync(file_descriptor_) != 0))
+        {
+            Close();
+            return MakeUnexpected(PersistencyError::kDataNotFound, "Unable to initialize log");
+        }
+        valid_size = kFileHeaderSize;
+        written_size_ += kFileHeaderSize;
+    }
+    else if (valid_size < file_size)
+    {
+        replay.discarded_size = file_size - valid_size;
+        if ((::ftruncate(file_descriptor_, static_cast<off_t>(valid_size)) != 0) || (::fsync(file_descriptor_) != 0))
+        {
+            Close();
+            return MakeUnexpected(PersistencyError::kDataNotFound, "Unable to cut off torn log records");
+        }
+    }
+
+    size_ = valid_size;
+    AccountCommittedRecords(replay.records);
+    return replay;
+}
+
+ResultBlank RecordLog::Append(const std::vector<LogRecord>& records) noexcept
+{
+    if (file_descriptor_ < 0)
+    {
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Log is not open");
+    }
+    const auto buffer = SerializeRecords(records);
+    if (!buffer.has_value())
+    {
+        return MakeUnexpected<Blank>(buffer.error());
+    }
+
+    if ((!WriteAll(file_descriptor_, buffer.value())) || (::fdatasync(file_descriptor_) != 0))
+    {
+        // Remove the torn records, otherwise later commits would be hidden behind them
+        if (::ftruncate(file_descriptor_, static_cast<off_t>(size_)) != 0)
+        {
+            Close();
+        }
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Unable to append to log");
+    }
+    size_ += buffer.value().size();
+    written_size_ += buffer.value().size();
+    AccountCommittedRecords(records);
+    return {};
+}
+
+ResultBlank RecordLog::Compact(const std::vector<LogRecord>& records) noexcept
+{
+    const auto buffer = SerializeRecords(records);
+    if (!buffer.has_value())
+    {
+        return MakeUnexpected<Blank>(buffer.error());
+    }
+
+    const std::string temporary_path = path_ + ".tmp";
+    const int file_descriptor =
+        ::open(temporary_path.c_str(), O_RDWR | O_APPEND | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file_descriptor < 0)
+    {
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Unable to create compacted log");
+    }
+    if ((!WriteAll(file_descriptor, CreateFileHeader())) || (!WriteAll(file_descriptor, buffer.value())) ||
+        (::fsync(file_descriptor) != 0) || (std::rename(temporary_path.c_str(), path_.c_str()) != 0))
+    {
+        score::cpp::ignore = ::close(file_descriptor);
+        score::cpp::ignore = std::remove(temporary_path.c_str());
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Unable to write compacted log");
+    }
+    // Without syncing the directory the old log could show up again after a power loss, which is still consistent
+    score::cpp::ignore = SyncParentDirectory(path_);
+
+    Close();
+    file_descriptor_ = file_descriptor;
+    size_ = kFileHeaderSize + buffer.value().size();
+    written_size_ += size_;
+    AccountCommittedRecords(records);
+    return {};
+}
+
+std::size_t RecordLog::GetSize() const noexcept
+{
+    return size_;
+}
+
+std::size_t RecordLog::GetGarbageSize() const noexcept
+{
+    return size_ - kFileHeaderSize - live_size_;
+}
+
+std::size_t RecordLog::GetWrittenSize() const noexcept
+{
+    return written_size_;
+}
+
+void RecordLog::AccountCommittedRecords(const std::vector<LogRecord>& records) noexcept
+{
+    for (const auto& record : records)
+    {
+        const std::size_t record_size = GetRecordSize(record);
+        const auto live_record = live_record_sizes_.find(record.name);
+        if (live_record == live_record_sizes_.end())
+        {
+            score::cpp::ignore = live_record_sizes_.emplace(std::string{record.name}, record_size);
+        }
+        else if (record.encoding == RecordEncoding::kDelta)
+        {
+            live_record->second += record_size;
+        }
+        else
+        {
+            live_size_ -= live_record->second;
+            live_record->second = record_size;
+        }
+        live_size_ += record_size;
+    }
+}
+
+void RecordLog::Close() noexcept
+{
+    if (file_descriptor_ >= 0)
+    {
+        score::cpp::ignore = ::close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+    size_ = 0U;
+    live_size_ = 0U;
+    live_record_sizes_.clear();
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,140 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_RECORD_LOG_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_RECORD_LOG_H
+
+#include "score/result/result.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Append-only log of persisted parameter sets
+///
+/// The log starts with a file header followed by records. Every record is protected by a CRC-32 over its type,
+/// sizes and content. A sync appends one record per changed parameter set followed by a commit record, records
+/// which are not followed by a commit record are ignored. A record holds either the whole parameter set, plain,
+/// compressed or as reference to a shared copy, or a delta to the preceding records of the same parameter set (see
+/// RecordEncoding). All numbers are stored as unsigned 32-bit integers in host byte order, since the file never leaves
+/// the ECU it was written on:
+///
+///   header: | magic "CPLG" | version |
+///   record: | crc | type | name size | set size | name | serialized parameter set |
+///
+/// The log is replayed by mapping it into memory and reading it sequentially once. The serialized parameter sets
+/// are neither copied nor parsed during the replay. If the log ends with a torn or corrupted record, e.g. because
+/// of a power loss during a write, everything after the last valid commit record is cut off.
+///
+/// Superseded records, i.e. all records of a parameter set before its latest non-delta record, and commit records are
+/// garbage. Compact() replaces the log by one holding only the given
+/// records, it is written to a temporary file first, which then replaces the log.
+///
+
+enum class RecordEncoding : std::uint8_t
+{
+    /// @brief serialized_set holds the whole serialized parameter set
+    kFull,
+    /// @brief serialized_set holds a delta to the preceding records of the parameter set
+    kDelta,
+    /// @brief serialized_set holds the whole parameter set compressed by CompressParameterSet()
+    kCompressed,
+    /// @brief serialized_set holds the name under which the compressed parameter set is kept in a SharedSetStore
+    kShared,
+};
+
+struct LogRecord
+{
+    std::string_view name;
+    std::string_view serialized_set;
+    RecordEncoding encoding{RecordEncoding::kFull};
+};
+
+class LogMapping;
+
+struct LogReplay
+{
+    /// @brief Owner of the memory the records refer to
+    std::shared_ptr<const LogMapping> mapping;
+    /// @brief Latest committed non-delta record of every parameter set, each followed by its later delta records
+    std::vector<LogRecord> records;
+    /// @brief Number of bytes cut off at the end of the log
+    std::size_t discarded_size;
+};
+
+class RecordLog final
+{
+  public:
+    explicit RecordLog(std::string path) noexcept;
+    RecordLog(const RecordLog&) = delete;
+    RecordLog(RecordLog&&) = delete;
+    RecordLog& operator=(const RecordLog&) = delete;
+    RecordLog& operator=(RecordLog&&) = delete;
+    ~RecordLog() noexcept;
+
+    /// @brief Replays the log and opens it for appending, a missing log is created
+    ///
+    /// @return committed records or kDataNotFound if the log can not be opened
+    ///
+    Result<LogReplay> Open() noexcept;
+
+    /// @brief Appends the records followed by a commit record and syncs the log
+    ///
+    /// On failure the log is restored to its previous size, so that the records of later calls are not hidden
+    /// behind a torn record.
+    ///
+    /// @return kUnableToSaveToPersistency on failure
+    ///
+    ResultBlank Append(const std::vector<LogRecord>& records) noexcept;
+
+    /// @brief Replaces the log by one holding only the given records
+    ///
+    /// @return kUnableToSaveToPersistency on failure
+    ///
+    ResultBlank Compact(const std::vector<LogRecord>& records) noexcept;
+
+    std::size_t GetSize() const noexcept;
+    std::size_t GetGarbageSize() const noexcept;
+    /// @brief Number of bytes written to the storage since construction
+    std::size_t GetWrittenSize() const noexcept;
+
+  private:
+    void AccountCommittedRecords(const std::vector<LogRecord>& records) noexcept;
+    void Close() noexcept;
+
+    const std::string path_;
+    int file_descriptor_;
+    std::size_t size_;
+    std::size_t live_size_;
+    std::size_t written_size_;
+    std::map<std::string, std::size_t, std::less<>> live_record_sizes_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_RECORD_LOG_H
@@ -0,0 +1,90 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/record_log.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/utility.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+constexpr std::size_t kParameterSetCount{100U};
+constexpr std::size_t kSerializedSetSize{512U};
+
+/// @brief Writes a log of the given number of records, which are updates of kParameterSetCount parameter sets
+std::string WriteLog(const std::size_t record_count)
+{
+    const std::string log_path = "/tmp/record_log_benchmark_" + std::to_string(record_count) + ".log";
+    score::cpp::ignore = std::remove(log_path.c_str());
+
+    std::vector<std::string> names{};
+    for (std::size_t index = 0U; index < kParameterSetCount; ++index)
+    {
+        names.push_back("parameter_set_" + std::to_string(index));
+    }
+    const std::string serialized_set(kSerializedSetSize, 'x');
+
+    RecordLog log{log_path};
+    score::cpp::ignore = log.Open();
+    // One commit per ten records, similar to a sync of a batch of updated parameter sets
+    std::vector<LogRecord> records{};
+    for (std::size_t index = 0U; index < record_count; ++index)
+    {
+        records.push_back(LogRecord{names[index % kParameterSetCount], serialized_set});
+        if ((records.size() == 10U) || ((index + 1U) == record_count))
+        {
+            score::cpp::ignore = log.Append(records);
+            records.clear();
+        }
+    }
+    return log_path;
+}
+
+void BM_ReplayLog(benchmark::State& state)
+{
+    const auto record_count = static_cast<std::size_t>(state.range(0));
+    const std::string log_path = WriteLog(record_count);
+
+    std::size_t log_size{0U};
+    for (auto _ : state)
+    {
+        RecordLog log{log_path};
+        auto replay = log.Open();
+        benchmark::DoNotOptimize(replay);
+        log_size = log.GetSize();
+    }
+
+    state.counters["log_bytes"] = static_cast<double>(log_size);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(log_size));
+    score::cpp::ignore = std::remove(log_path.c_str());
+}
+
+BENCHMARK(BM_ReplayLog)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,270 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/record_log.h"
+
+#include <score/utility.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+class RecordLogTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        log_path_ = ::testing::TempDir() + "record_log_test.log";
+        score::cpp::ignore = std::remove(log_path_.c_str());
+    }
+
+    std::string ReadFile() const
+    {
+        std::ifstream file{log_path_, std::ios::binary};
+        return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    void WriteFile(const std::string& content) const
+    {
+        std::ofstream{log_path_, std::ios::binary | std::ios::trunc} << content;
+    }
+
+    /// @brief Writes a log holding one commit of set_name_1 and set_name_2, followed by one commit of set_name_1
+    std::size_t WriteTwoCommits() const
+    {
+        RecordLog log{log_path_};
+        EXPECT_TRUE(log.Open().has_value());
+        EXPECT_TRUE(log.Append({{"set_name_1", "value_1"}, {"set_name_2", "value_2"}}).has_value());
+        const std::size_t first_commit_size = log.GetSize();
+        EXPECT_TRUE(log.Append({{"set_name_1", "value_3"}}).has_value());
+        return first_commit_size;
+    }
+
+    std::string log_path_;
+};
+
+TEST_F(RecordLogTest, CommittedRecordsAreReplayed)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::RecordLog::Open()");
+    RecordProperty("Description", "This test verifies that the latest committed record of every set is replayed.");
+
+    score::cpp::ignore = WriteTwoCommits();
+
+    RecordLog log{log_path_};
+    const auto replay = log.Open();
+
+    ASSERT_TRUE(replay.has_value());
+    EXPECT_EQ(replay.value().discarded_size, 0U);
+    ASSERT_EQ(replay.value().records.size(), 2U);
+    EXPECT_EQ(replay.value().records[0].name, "set_name_1");
+    EXPECT_EQ(replay.value().records[0].serialized_set, "value_3");
+    EXPECT_EQ(replay.value().records[1].name, "set_name_2");
+    EXPECT_EQ(replay.value().records[1].serialized_set, "value_2");
+    EXPECT_EQ(log.GetSize(), ReadFile().size());
+    EXPECT_GT(log.GetGarbageSize(), 0U);
+}
+
+TEST_F(RecordLogTest, DeltaRecordsFollowTheirFullRecord)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::RecordLog::Open()");
+    RecordProperty("Description",
+                   "This test verifies that the latest full record of a set is replayed together with its later "
+                   "delta records and that the written bytes are counted.");
+
+    {
+        RecordLog log{log_path_};
+        ASSERT_TRUE(log.Open().has_value());
+        constexpr auto kDelta = RecordEncoding::kDelta;
+        ASSERT_TRUE(log.Append({{"set_name_1", "delta_0", kDelta}, {"set_name_1", "value_1"}}).has_value());
+        ASSERT_TRUE(log.Append({{"set_name_1", "delta_1", kDelta}, {"set_name_2", "value_2"}}).has_value());
+        ASSERT_TRUE(log.Append({{"set_name_1", "delta_2", kDelta}}).has_value());
+        EXPECT_EQ(log.GetWrittenSize(), ReadFile().size());
+    }
+
+    RecordLog log{log_path_};
+    const auto replay = log.Open();
+
+    ASSERT_TRUE(replay.has_value());
+    const auto& records = replay.value().records;
+    ASSERT_EQ(records.size(), 4U);
+    EXPECT_EQ(records[0].serialized_set, "value_1");
+    EXPECT_EQ(records[0].encoding, RecordEncoding::kFull);
+    EXPECT_EQ(records[1].serialized_set, "delta_1");
+    EXPECT_EQ(records[1].encoding, RecordEncoding::kDelta);
+    EXPECT_EQ(records[2].serialized_set, "delta_2");
+    EXPECT_EQ(records[3].serialized_set, "value_2");
+    EXPECT_EQ(log.GetWrittenSize(), 0U);
+}
+
+TEST_F(RecordLogTest, RecordEncodingIsReplayed)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::RecordLog::Open()");
+    RecordProperty("Description",
+                   "This test verifies that compressed and shared records replace the preceding records of a set.");
+
+    {
+        RecordLog log{log_path_};
+        ASSERT_TRUE(log.Open().has_value());
+        ASSERT_TRUE(log.Append({{"set_name_1", "value_1"}, {"set_name_2", "value_2"}}).has_value());
+        ASSERT_TRUE(log.Append({{"set_name_1", "compressed_1", RecordEncoding::kCompressed},
+                                {"set_name_2", "shared_2", RecordEncoding::kShared}})
+                        .has_value());
+    }
+
+    RecordLog log{log_path_};
+    const auto replay = log.Open();
+
+    ASSERT_TRUE(replay.has_value());
+    const auto& records = replay.value().records;
+    ASSERT_EQ(records.size(), 2U);
+    EXPECT_EQ(records[0].serialized_set, "compressed_1");
+    EXPECT_EQ(records[0].encoding, RecordEncoding::kCompressed);
+    EXPECT_EQ(records[1].serialized_set, "shared_2");
+    EXPECT_EQ(records[1].encoding, RecordEncoding::kShared);
+    // Everything but the file header and the two latest records is garbage
+    EXPECT_EQ(log.GetGarbageSize(), log.GetSize() - 8U - (16U + 22U) - (16U + 18U));
+}
+
+TEST_F(RecordLogTest, TornWriteIsCutOff)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::RecordLog::Open()");
+    RecordProperty("Description",
+                   "This test verifies that a write interrupted at any byte keeps the previous commit, and that the "
+                   "log can be appended to afterwards.");
+
+    const std::size_t first_commit_size = WriteTwoCommits();
+    const std::string content = ReadFile();
+
+    for (std::size_t torn_size = first_commit_size; torn_size < content.size(); ++torn_size)
+    {
+        WriteFile(content.substr(0U, torn_size));
+        {
+            RecordLog log{log_path_};
+            const auto replay = log.Open();
+
+            ASSERT_TRUE(replay.has_value());
+            EXPECT_EQ(replay.value().discarded_size, torn_size - first_commit_size);
+            ASSERT_EQ(replay.value().records.size(), 2U);
+            EXPECT_EQ(replay.value().records[0].serialized_set, "value_1");
+            EXPECT_TRUE(log.Append({{"set_name_2", "value_4"}}).has_value());
+        }
+        RecordLog log{log_path_};
+        const auto replay = log.Open();
+        ASSERT_TRUE(replay.has_value());
+        EXPECT_EQ(replay.value().discarded_size, 0U);
+        ASSERT_EQ(replay.value().records.size(), 2U);
+        EXPECT_EQ(replay.value().records[1].serialized_set, "value_4");
+    }
+}
+
+TEST_F(RecordLogTest, CorruptedRecordIsCutOff)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::RecordLog::Open()");
+    RecordProperty("Description",
+                   "This test verifies that records failing the CRC check and everything after them are discarded.");
+
+    const std::size_t first_commit_size = WriteTwoCommits();
+    std::string content = ReadFile();
+    content[content.size() - 20U] ^= '\x01';
+    WriteFile(content);
+
+    RecordLog log{log_path_};
+    const auto replay = log.Open();
+
+    ASSERT_TRUE(replay.has_value());
+    EXPECT_EQ(replay.value().discarded_size, content.size() - first_commit_size);
+    ASSERT_EQ(replay.value().records.size(), 2U);
+    EXPECT_EQ(replay.value().records[0].serialized_set, "value_1");
+    EXPECT_EQ(ReadFile().size(), first_commit_size);
+}
+
+TEST_F(RecordLogTest, ForeignFileIsDiscarded)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Fault injection test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::RecordLog::Open()");
+    RecordProperty("Description", "This test verifies that a file which is no log is replaced by an empty log.");
+
+    WriteFile("no record log");
+
+    RecordLog log{log_path_};
+    const auto replay = log.Open();
+
+    ASSERT_TRUE(replay.has_value());
+    EXPECT_EQ(replay.value().discarded_size, 13U);
+    EXPECT_TRUE(replay.value().records.empty());
+    EXPECT_TRUE(log.Append({{"set_name_1", "value_1"}}).has_value());
+}
+
+TEST_F(RecordLogTest, CompactionRemovesGarbage)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::RecordLog::Compact()");
+    RecordProperty("Description", "This test verifies that a compacted log only holds the given records.");
+
+    score::cpp::ignore = WriteTwoCommits();
+    RecordLog log{log_path_};
+    const auto replay = log.Open();
+    ASSERT_TRUE(replay.has_value());
+    const std::size_t garbage_size = log.GetGarbageSize();
+
+    ASSERT_TRUE(log.Compact(replay.value().records).has_value());
+
+    // The replayed records still refer to the mapping of the replaced log
+    EXPECT_EQ(replay.value().records[0].serialized_set, "value_3");
+    EXPECT_LT(log.GetGarbageSize(), garbage_size);
+    EXPECT_EQ(log.GetSize(), ReadFile().size());
+    ASSERT_TRUE(log.Append({{"set_name_3", "value_5"}}).has_value());
+
+    RecordLog compacted_log{log_path_};
+    const auto compacted_replay = compacted_log.Open();
+    ASSERT_TRUE(compacted_replay.has_value());
+    ASSERT_EQ(compacted_replay.value().records.size(), 3U);
+    EXPECT_EQ(compacted_replay.value().records[0].serialized_set, "value_3");
+    EXPECT_EQ(compacted_replay.value().records[2].serialized_set, "value_5");
+}
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
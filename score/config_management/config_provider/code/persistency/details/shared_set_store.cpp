@@ -0,0 +1,202 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/shared_set_store.h"
+#include "score/config_management/config_provider/code/persistency/details/record_compression.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+bool SyncDirectory(const std::string& directory) noexcept
+{
+    const int directory_descriptor = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (directory_descriptor < 0)
+    {
+        return false;
+    }
+    const bool synced = (::fsync(directory_descriptor) == 0);
+    score::cpp::ignore = ::close(directory_descriptor);
+    return synced;
+}
+
+bool WriteFile(const std::string& path, const std::string_view content) noexcept
+{
+    const int file_descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file_descriptor < 0)
+    {
+        return false;
+    }
+    std::size_t written{0U};
+    while (written < content.size())
+    {
+        const auto result = ::write(file_descriptor, content.data() + written, content.size() - written);
+        if ((result < 0) && (errno != EINTR))
+        {
+            break;
+        }
+        written += (result < 0) ? 0U : static_cast<std::size_t>(result);
+    }
+    const bool is_synced = (written == content.size()) && (::fsync(file_descriptor) == 0);
+    score::cpp::ignore = ::close(file_descriptor);
+    return is_synced;
+}
+
+}  // namespace
+
+SharedSetStore::SharedSetStore(std::string shared_directory, std::string private_directory) noexcept
+    : shared_directory_{std::move(shared_directory)}, private_directory_{std::move(private_directory)}
+{
+}
+
+Result<std::string> SharedSetStore::Store(const std::string_view compressed_set,
+                                          const std::uint64_t digest) const noexcept
+{
+    // The compressed size is part of the name, so that a digest collision also needs sets of the same size
+    std::array<char, 48U> name_buffer{};
+    score::cpp::ignore = std::snprintf(
+        name_buffer.data(), name_buffer.size(), "%016" PRIx64 "-%zu.cps", digest, compressed_set.size());
+    std::string name{name_buffer.data()};
+
+    const std::string private_path = GetPrivatePath(name);
+    if (::access(private_path.c_str(), F_OK) == 0)
+    {
+        return name;
+    }
+    if ((::mkdir(private_directory_.c_str(), 0755) != 0) && (errno != EEXIST))
+    {
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Unable to create private directory");
+    }
+
+    const std::string shared_path = GetSharedPath(name);
+    bool is_linked = (::link(shared_path.c_str(), private_path.c_str()) == 0) || (errno == EEXIST);
+    if ((!is_linked) && (errno == ENOENT) && WriteSharedSet(compressed_set, shared_path))
+    {
+        is_linked = (::link(shared_path.c_str(), private_path.c_str()) == 0) || (errno == EEXIST);
+    }
+    if ((!is_linked) || (!SyncDirectory(private_directory_)))
+    {
+        return MakeUnexpected(PersistencyError::kUnableToSaveToPersistency, "Unable to refer to shared set");
+    }
+    return name;
+}
+
+Result<std::string> SharedSetStore::Read(const std::string_view name) const noexcept
+{
+    const int file_descriptor = ::open(GetPrivatePath(name).c_str(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0)
+    {
+        return MakeUnexpected(PersistencyError::kDataNotFound, "Shared set does not exist");
+    }
+    struct stat file_status
+    {
+    };
+    std::size_t file_size{0U};
+    void* address{MAP_FAILED};
+    if ((::fstat(file_descriptor, &file_status) == 0) && (file_status.st_size > 0))
+    {
+        file_size = static_cast<std::size_t>(file_status.st_size);
+        address = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    }
+    score::cpp::ignore = ::close(file_descriptor);
+    if (address == MAP_FAILED)
+    {
+        return MakeUnexpected(PersistencyError::kDataNotFound, "Unable to map shared set");
+    }
+
+    // The set is decompressed straight from the mapping, so its compressed content is never copied
+    auto serialized_set = DecompressParameterSet(std::string_view{static_cast<const char*>(address), file_size});
+    score::cpp::ignore = ::munmap(address, file_size);
+    return serialized_set;
+}
+
+void SharedSetStore::Release(const std::set<std::string, std::less<>>& referenced_names) const noexcept
+{
+    DIR* const directory = ::opendir(private_directory_.c_str());
+    if (directory == nullptr)
+    {
+        return;
+    }
+    std::set<std::string> released_names{};
+    for (const dirent* entry = ::readdir(directory); entry != nullptr; entry = ::readdir(directory))
+    {
+        const std::string_view name{entry->d_name};
+        if ((name != ".") && (name != "..") && (referenced_names.count(name) == 0U))
+        {
+            score::cpp::ignore = released_names.emplace(name);
+        }
+    }
+    score::cpp::ignore = ::closedir(directory);
+
+    for (const auto& name : released_names)
+    {
+        score::cpp::ignore = ::unlink(GetPrivatePath(name).c_str());
+        // Only the shared directory itself refers to the set anymore
+        const std::string shared_path = GetSharedPath(name);
+        struct stat file_status
+        {
+        };
+        if ((::stat(shared_path.c_str(), &file_status) == 0) && (file_status.st_nlink == 1U))
+        {
+            score::cpp::ignore = ::unlink(shared_path.c_str());
+        }
+    }
+}
+
+std::string SharedSetStore::GetSharedPath(const std::string_view name) const
+{
+    return shared_directory_ + "/" + std::string{name};
+}
+
+std::string SharedSetStore::GetPrivatePath(const std::string_view name) const
+{
+    return private_directory_ + "/" + std::string{name};
+}
+
+bool SharedSetStore::WriteSharedSet(const std::string_view compressed_set,
+                                    const std::string& shared_path) const noexcept
+{
+    // Other processes may write the same set at the same time, each one writes its own temporary file and the
+    // rename replaces the set by an identical one
+    const std::string temporary_path = shared_path + "." + std::to_string(::getpid()) + ".tmp";
+    if ((!WriteFile(temporary_path, compressed_set)) || (::rename(temporary_path.c_str(), shared_path.c_str()) != 0))
+    {
+        score::cpp::ignore = ::unlink(temporary_path.c_str());
+        return false;
+    }
+    return SyncDirectory(shared_directory_);
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
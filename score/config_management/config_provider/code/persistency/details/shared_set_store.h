@@ -0,0 +1,82 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_SHARED_SET_STORE_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_SHARED_SET_STORE_H
+
+#include "score/result/result.h"
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief Store of compressed parameter sets which keeps identical sets of several processes only once
+///
+/// Every set is stored as a file in the shared directory, named after the digest of its content. Each process
+/// refers to the sets it persists by a hard link in its private directory, so the link count of a shared file is
+/// the number of processes referring to it plus one. A set is removed from the shared directory once no process
+/// refers to it anymore. Both directories have to be on the same file system.
+///
+/// Removing a set and linking it by another process at the same time is safe, the linked content stays valid and
+/// only the next process storing it writes it again.
+///
+
+class SharedSetStore final
+{
+  public:
+    SharedSetStore(std::string shared_directory, std::string private_directory) noexcept;
+
+    /// @brief Stores the compressed set unless it is stored already and adds the reference of this process to it
+    ///
+    /// @param compressed_set set compressed by CompressParameterSet()
+    /// @param digest digest of the uncompressed set
+    /// @return name of the stored set or kUnableToSaveToPersistency on failure
+    ///
+    Result<std::string> Store(const std::string_view compressed_set, const std::uint64_t digest) const noexcept;
+
+    /// @brief Reads and decompresses a set this process refers to
+    ///
+    /// @return serialized set, kDataNotFound if the set does not exist or kDataCorrupted if it is corrupted
+    ///
+    Result<std::string> Read(const std::string_view name) const noexcept;
+
+    /// @brief Drops the references of this process to all sets but the given ones
+    ///
+    /// Sets which are no longer referred to by any process are removed from the shared directory.
+    ///
+    void Release(const std::set<std::string, std::less<>>& referenced_names) const noexcept;
+
+  private:
+    std::string GetSharedPath(const std::string_view name) const;
+    std::string GetPrivatePath(const std::string_view name) const;
+    bool WriteSharedSet(const std::string_view compressed_set, const std::string& shared_path) const noexcept;
+
+    const std::string shared_directory_;
+    const std::string private_directory_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_SHARED_SET_STORE_H
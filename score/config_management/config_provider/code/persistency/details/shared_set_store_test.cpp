@@ -0,0 +1,127 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/shared_set_store.h"
+#include "score/config_management/config_provider/code/persistency/details/record_compression.h"
+#include "score/config_management/config_provider/code/persistency/error/persistency_error.h"
+
+#include <score/utility.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+class SharedSetStoreTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        shared_directory_ = ::testing::TempDir() + "shared_set_store_test";
+        score::cpp::ignore = ::mkdir(shared_directory_.c_str(), 0755);
+        compressed_set_ = CompressParameterSet(R"({"parameters": {"parameter": 1}, "qualifier": 1})").value();
+    }
+
+    void TearDown() override
+    {
+        store_1_.Release({});
+        store_2_.Release({});
+        score::cpp::ignore = ::rmdir(GetPrivateDirectory("process_1").c_str());
+        score::cpp::ignore = ::rmdir(GetPrivateDirectory("process_2").c_str());
+        score::cpp::ignore = ::rmdir(shared_directory_.c_str());
+    }
+
+    std::string GetPrivateDirectory(const std::string& process) const
+    {
+        return ::testing::TempDir() + "shared_set_store_test_" + process;
+    }
+
+    /// @brief Number of directory entries referring to the shared set, 0 if it does not exist
+    std::size_t GetLinkCount(const std::string& name) const
+    {
+        struct stat file_status
+        {
+        };
+        return (::stat((shared_directory_ + "/" + name).c_str(), &file_status) == 0) ? file_status.st_nlink : 0U;
+    }
+
+    std::string shared_directory_;
+    std::string compressed_set_;
+    SharedSetStore store_1_{::testing::TempDir() + "shared_set_store_test", GetPrivateDirectory("process_1")};
+    SharedSetStore store_2_{::testing::TempDir() + "shared_set_store_test", GetPrivateDirectory("process_2")};
+};
+
+TEST_F(SharedSetStoreTest, IdenticalSetIsStoredOnce)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::SharedSetStore::Store()");
+    RecordProperty("Description",
+                   "This test verifies that a set stored by two processes is kept once and readable by both.");
+
+    const auto name_1 = store_1_.Store(compressed_set_, 42U);
+    const auto name_2 = store_2_.Store(compressed_set_, 42U);
+    const auto name_3 = store_1_.Store(compressed_set_, 42U);
+
+    ASSERT_TRUE(name_1.has_value());
+    ASSERT_TRUE(name_2.has_value());
+    EXPECT_EQ(name_1.value(), name_2.value());
+    EXPECT_EQ(name_1.value(), name_3.value());
+    EXPECT_EQ(GetLinkCount(name_1.value()), 3U);
+    EXPECT_EQ(store_1_.Read(name_1.value()).value(), R"({"parameters": {"parameter": 1}, "qualifier": 1})");
+    EXPECT_EQ(store_2_.Read(name_1.value()).value(), R"({"parameters": {"parameter": 1}, "qualifier": 1})");
+    EXPECT_EQ(store_1_.Read("unknown").error(), PersistencyError::kDataNotFound);
+}
+
+TEST_F(SharedSetStoreTest, SetIsRemovedOnceNoProcessRefersToIt)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::SharedSetStore::Release()");
+    RecordProperty("Description",
+                   "This test verifies that released sets stay available to other processes until the last one "
+                   "releases them.");
+
+    const std::string name = store_1_.Store(compressed_set_, 42U).value();
+    const std::string other_name = store_1_.Store(CompressParameterSet("{}").value(), 43U).value();
+    score::cpp::ignore = store_2_.Store(compressed_set_, 42U);
+
+    store_1_.Release({other_name});
+    EXPECT_EQ(GetLinkCount(name), 2U);
+    EXPECT_EQ(GetLinkCount(other_name), 2U);
+    EXPECT_EQ(store_1_.Read(name).error(), PersistencyError::kDataNotFound);
+    EXPECT_TRUE(store_2_.Read(name).has_value());
+
+    store_2_.Release({});
+    EXPECT_EQ(GetLinkCount(name), 0U);
+    EXPECT_EQ(GetLinkCount(other_name), 2U);
+}
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,146 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/write_behind_persistency.h"
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+WriteBehindPersistency::WriteBehindPersistency(score::cpp::pmr::unique_ptr<Persistency> persistency,
+                                               const std::chrono::milliseconds flush_interval,
+                                               score::cpp::pmr::memory_resource* const memory_resource)
+    : Persistency{},
+      logger_{mw::log::CreateLogger(std::string_view("CfgP"))},
+      flush_interval_{flush_interval},
+      persistency_{std::move(persistency)},
+      persistency_mutex_{},
+      queue_mutex_{},
+      queue_cv_{},
+      queued_parameter_sets_{ParameterMap::allocator_type{memory_resource}},
+      statistics_{},
+      flush_thread_{}
+{
+    score::cpp::ignore = flush_thread_.emplace(
+        [this](const score::cpp::stop_token& stop_token) noexcept { FlushRoutine(stop_token); });
+}
+
+WriteBehindPersistency::~WriteBehindPersistency() noexcept
+{
+    if (flush_thread_.has_value())
+    {
+        score::cpp::ignore = flush_thread_->request_stop();
+        flush_thread_.reset();
+    }
+    Flush();
+}
+
+void WriteBehindPersistency::ReadCachedParameterSets(ParameterMap& cached_parameter_sets,
+                                                     score::cpp::pmr::memory_resource* memory_resource,
+                                                     std::unique_ptr<score::filesystem::Filesystem> filesystem) noexcept
+{
+    std::lock_guard<std::mutex> persistency_lock{persistency_mutex_};
+    persistency_->ReadCachedParameterSets(cached_parameter_sets, memory_resource, std::move(filesystem));
+}
+
+void WriteBehindPersistency::CacheParameterSet(const ParameterMap&,
+                                               const score::cpp::pmr::string param_set_key,
+                                               const std::shared_ptr<const ParameterSet> parameter_set,
+                                               bool) noexcept
+{
+    {
+        std::lock_guard<std::mutex> queue_lock{queue_mutex_};
+        const auto inserted = queued_parameter_sets_.insert_or_assign(param_set_key, parameter_set).second;
+        ++statistics_.queued_updates;
+        if (!inserted)
+        {
+            ++statistics_.coalesced_updates;
+        }
+    }
+    queue_cv_.notify_all();
+}
+
+void WriteBehindPersistency::SyncToStorage() noexcept
+{
+    queue_cv_.notify_all();
+}
+
+void WriteBehindPersistency::Flush() noexcept
+{
+    std::lock_guard<std::mutex> persistency_lock{persistency_mutex_};
+    ParameterMap parameter_sets{queued_parameter_sets_.get_allocator()};
+    {
+        std::lock_guard<std::mutex> queue_lock{queue_mutex_};
+        queued_parameter_sets_.swap(parameter_sets);
+    }
+    if (parameter_sets.empty())
+    {
+        return;
+    }
+
+    logger_.LogDebug() << "WriteBehindPersistency::" << __func__ << ": Writing " << parameter_sets.size()
+                       << " parameter sets";
+    const ParameterMap no_cached_parameter_sets{parameter_sets.get_allocator()};
+    for (const auto& [key, value] : parameter_sets)
+    {
+        persistency_->CacheParameterSet(no_cached_parameter_sets, key, value, false);
+    }
+    persistency_->SyncToStorage();
+
+    std::lock_guard<std::mutex> queue_lock{queue_mutex_};
+    ++statistics_.flushes;
+}
+
+WriteBehindStatistics WriteBehindPersistency::GetStatistics() const noexcept
+{
+    std::lock_guard<std::mutex> queue_lock{queue_mutex_};
+    return statistics_;
+}
+
+void WriteBehindPersistency::FlushRoutine(const score::cpp::stop_token& stop_token) noexcept
+{
+    std::unique_lock<std::mutex> queue_lock{queue_mutex_};
+    while (not stop_token.stop_requested())
+    {
+        const bool has_queued_updates = queue_cv_.wait(queue_lock, stop_token, [this]() noexcept -> bool {
+            return not(queued_parameter_sets_.empty());
+        });
+        if (not has_queued_updates)
+        {
+            break;
+        }
+
+        // Collect further updates for the duration of one interval, so that they are written as one batch.
+        // Only a stop request ends the interval early, queued updates are then written by the destructor.
+        score::cpp::ignore = queue_cv_.wait_for(
+            queue_lock, stop_token, flush_interval_, []() noexcept -> bool { return false; });
+        if (stop_token.stop_requested())
+        {
+            break;
+        }
+
+        queue_lock.unlock();
+        Flush();
+        queue_lock.lock();
+    }
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,109 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_WRITE_BEHIND_PERSISTENCY_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_WRITE_BEHIND_PERSISTENCY_H
+
+#include "platform/aas/lib/concurrency/condition_variable.h"
+#include "score/config_management/config_provider/code/persistency/persistency.h"
+
+#include "score/mw/log/logger.h"
+
+#include <score/jthread.hpp>
+#include <score/optional.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+struct WriteBehindStatistics
+{
+    /// @brief Number of CacheParameterSet() calls
+    std::uint64_t queued_updates;
+    /// @brief Number of queued updates which replaced a not yet written update of the same parameter set
+    std::uint64_t coalesced_updates;
+    /// @brief Number of batches written to the underlying persistency
+    std::uint64_t flushes;
+};
+
+///
+/// @brief Persistency decorator which moves all storage I/O out of the caller's thread
+///
+/// CacheParameterSet() only queues the parameter set and returns. A background thread waits for the flush interval
+/// after the first queued update, so that repeated updates of the same parameter set get coalesced, and then hands
+/// the whole batch to the underlying persistency followed by a single SyncToStorage() call.
+///
+/// The cached_parameter_sets argument of CacheParameterSet() is not forwarded, since every set of ConfigProvider's
+/// in-memory cache has either been read from or already been queued to the persistency.
+///
+/// Queued updates are written on destruction or by an explicit Flush().
+///
+
+class WriteBehindPersistency final : public Persistency
+{
+  public:
+    static constexpr std::chrono::milliseconds kDefaultFlushInterval{500};
+
+    explicit WriteBehindPersistency(
+        score::cpp::pmr::unique_ptr<Persistency> persistency,
+        const std::chrono::milliseconds flush_interval = kDefaultFlushInterval,
+        score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::get_default_resource());
+    ~WriteBehindPersistency() noexcept override;
+
+    void ReadCachedParameterSets(ParameterMap& cached_parameter_sets,
+                                 score::cpp::pmr::memory_resource* memory_resource,
+                                 std::unique_ptr<score::filesystem::Filesystem> filesystem) noexcept override;
+    void CacheParameterSet(const ParameterMap& cached_parameter_sets,
+                           const score::cpp::pmr::string param_set_key,
+                           const std::shared_ptr<const ParameterSet> parameter_set,
+                           bool sync_to_storage) noexcept override;
+    /// @brief Wakes up the background thread, the queued updates are written at the end of the current interval
+    void SyncToStorage() noexcept override;
+
+    /// @brief Writes all queued updates to the underlying persistency and returns once they are synced
+    void Flush() noexcept;
+
+    WriteBehindStatistics GetStatistics() const noexcept;
+
+  private:
+    void FlushRoutine(const score::cpp::stop_token& stop_token) noexcept;
+
+    mw::log::Logger& logger_;
+    const std::chrono::milliseconds flush_interval_;
+    score::cpp::pmr::unique_ptr<Persistency> persistency_;
+    // Serializes the access to persistency_, so that batches are written in the order they were queued
+    std::mutex persistency_mutex_;
+
+    mutable std::mutex queue_mutex_;
+    concurrency::InterruptibleConditionalVariable queue_cv_;
+    ParameterMap queued_parameter_sets_;
+    WriteBehindStatistics statistics_;
+
+    // We intentionally put the jthread as last member since this ensures that upon destruction of our class
+    // we first wait for the jthread to finish prior to destroying any other member which it might still access.
+    score::cpp::optional<score::cpp::jthread> flush_thread_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PERSISTENCY_DETAILS_WRITE_BEHIND_PERSISTENCY_H
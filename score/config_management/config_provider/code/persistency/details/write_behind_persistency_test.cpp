@@ -0,0 +1,161 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+
+#include "score/config_management/config_provider/code/persistency/details/write_behind_persistency.h"
+#include "score/config_management/config_provider/code/persistency/persistency_mock.h"
+
+#include "score/json/json_parser.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Sequence;
+using ::testing::StrictMock;
+
+constexpr std::chrono::hours kNeverElapsingFlushInterval{1};
+
+std::shared_ptr<const ParameterSet> CreateParameterSet(const std::string& set_json)
+{
+    auto parsed_set = json::JsonParser{}.FromBuffer(set_json);
+    EXPECT_TRUE(parsed_set.has_value());
+    return std::make_shared<const ParameterSet>(std::move(parsed_set).value());
+}
+
+class WriteBehindPersistencyTest : public ::testing::Test
+{
+  protected:
+    std::unique_ptr<WriteBehindPersistency> CreateSut(const std::chrono::milliseconds flush_interval)
+    {
+        auto persistency_mock =
+            score::cpp::pmr::make_unique<StrictMock<PersistencyMock>>(score::cpp::pmr::get_default_resource());
+        persistency_mock_ = persistency_mock.get();
+        return std::make_unique<WriteBehindPersistency>(std::move(persistency_mock), flush_interval);
+    }
+
+    StrictMock<PersistencyMock>* persistency_mock_{nullptr};
+    const std::shared_ptr<const ParameterSet> parameter_set_1_{CreateParameterSet(R"({"parameters": {"a": 1}})")};
+    const std::shared_ptr<const ParameterSet> parameter_set_2_{CreateParameterSet(R"({"parameters": {"a": 2}})")};
+};
+
+TEST_F(WriteBehindPersistencyTest, UpdatesAreCoalescedIntoOneBatch)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::WriteBehindPersistency::Flush()");
+    RecordProperty("Description",
+                   "This test verifies that queued updates are not written before a flush and that repeated updates "
+                   "of the same parameter set are written only once, followed by a single sync.");
+
+    auto sut = CreateSut(kNeverElapsingFlushInterval);
+    ParameterMap cached_parameter_sets{};
+    sut->CacheParameterSet(cached_parameter_sets, "set_name_1", parameter_set_2_, true);
+    sut->CacheParameterSet(cached_parameter_sets, "set_name_2", parameter_set_2_, true);
+    sut->CacheParameterSet(cached_parameter_sets, "set_name_1", parameter_set_1_, true);
+    sut->SyncToStorage();
+    ::testing::Mock::VerifyAndClearExpectations(persistency_mock_);
+
+    Sequence set_name_1_sequence{};
+    Sequence set_name_2_sequence{};
+    EXPECT_CALL(*persistency_mock_, CacheParameterSet(_, Eq("set_name_1"), Eq(parameter_set_1_), false))
+        .InSequence(set_name_1_sequence);
+    EXPECT_CALL(*persistency_mock_, CacheParameterSet(_, Eq("set_name_2"), Eq(parameter_set_2_), false))
+        .InSequence(set_name_2_sequence);
+    EXPECT_CALL(*persistency_mock_, SyncToStorage()).InSequence(set_name_1_sequence, set_name_2_sequence);
+    sut->Flush();
+    sut->Flush();
+
+    const auto statistics = sut->GetStatistics();
+    EXPECT_EQ(statistics.queued_updates, 3U);
+    EXPECT_EQ(statistics.coalesced_updates, 1U);
+    EXPECT_EQ(statistics.flushes, 1U);
+}
+
+TEST_F(WriteBehindPersistencyTest, UpdatesAreWrittenAfterFlushInterval)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::WriteBehindPersistency::CacheParameterSet()");
+    RecordProperty("Description", "This test verifies that the background thread writes queued updates on its own.");
+
+    auto sut = CreateSut(std::chrono::milliseconds{10});
+    EXPECT_CALL(*persistency_mock_, CacheParameterSet(_, Eq("set_name_1"), Eq(parameter_set_1_), false));
+    EXPECT_CALL(*persistency_mock_, SyncToStorage());
+
+    sut->CacheParameterSet({}, "set_name_1", parameter_set_1_, true);
+
+    for (std::size_t retry = 0U; (retry < 500U) && (sut->GetStatistics().flushes == 0U); ++retry)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(sut->GetStatistics().flushes, 1U);
+}
+
+TEST_F(WriteBehindPersistencyTest, QueuedUpdatesAreWrittenOnDestruction)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::WriteBehindPersistency::~WriteBehindPersistency()");
+    RecordProperty("Description", "This test verifies that no queued update gets lost on shutdown.");
+
+    auto sut = CreateSut(kNeverElapsingFlushInterval);
+    EXPECT_CALL(*persistency_mock_, CacheParameterSet(_, Eq("set_name_1"), Eq(parameter_set_1_), false));
+    EXPECT_CALL(*persistency_mock_, SyncToStorage());
+
+    sut->CacheParameterSet({}, "set_name_1", parameter_set_1_, false);
+    sut.reset();
+}
+
+TEST_F(WriteBehindPersistencyTest, ReadIsForwarded)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::WriteBehindPersistency::ReadCachedParameterSets()");
+    RecordProperty("Description", "This test verifies that cached parameter sets are read synchronously.");
+
+    auto sut = CreateSut(kNeverElapsingFlushInterval);
+    EXPECT_CALL(*persistency_mock_, ReadCachedParameterSets(_, _, _))
+        .WillOnce([this](ParameterMap& cached_parameter_sets, auto, auto) noexcept {
+            cached_parameter_sets.emplace("set_name_1", parameter_set_1_);
+        });
+
+    ParameterMap cached_parameter_sets{};
+    sut->ReadCachedParameterSets(cached_parameter_sets, score::cpp::pmr::get_default_resource(), nullptr);
+
+    EXPECT_EQ(cached_parameter_sets.size(), 1U);
+}
+
+}  // namespace
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -34,7 +34,7 @@ class PersistencyErrorDomain final : public score::result::ErrorDomain
     /* KW_SUPPRESS_END:AUTOSAR.MEMB.VIRTUAL.FINAL */
     {
         const bool enum_in_range = (code >= score::cpp::to_underlying(PersistencyError::kDataNotFound)) &&
-                                   (code <= score::cpp::to_underlying(PersistencyError::kUnableToSaveToPersistency));
+                                   (code <= score::cpp::to_underlying(PersistencyError::kDataCorrupted));
         SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(enum_in_range, "value of score::result::ErrorCode is out of range of PersistencyError");
 
         // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
@@ -52,6 +52,9 @@ class PersistencyErrorDomain final : public score::result::ErrorDomain
             // coverity[autosar_cpp14_m6_4_5_violation]
             case PersistencyError::kUnableToSaveToPersistency:
                 return "Unable to save data to persistency";
+            // coverity[autosar_cpp14_m6_4_5_violation]
+            case PersistencyError::kDataCorrupted:
+                return "Persisted data is corrupted";
             // LCOV_EXCL_START (Reaching this default case is not possible as range is checked above.)
             // coverity[autosar_cpp14_m6_4_5_violation]
             default:
@@ -28,7 +28,8 @@ namespace config_provider
 enum class PersistencyError : score::result::ErrorCode
 {
     kDataNotFound,
-    kUnableToSaveToPersistency
+    kUnableToSaveToPersistency,
+    kDataCorrupted
 };
 
 /// @brief ADL overload to fulfill design requirements from lib/result
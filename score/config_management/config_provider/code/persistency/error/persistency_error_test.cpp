@@ -45,6 +45,7 @@ TEST(PersistencyErrorTest, CanConvertToString)
 
     TestMessage(PersistencyError::kDataNotFound, "Data not found");
     TestMessage(PersistencyError::kUnableToSaveToPersistency, "Unable to save data to persistency");
+    TestMessage(PersistencyError::kDataCorrupted, "Persisted data is corrupted");
 }
 
 TEST(PersistencyErrorTest, ValueOutOfRangeResultsInAssertionFailure)
@@ -57,15 +58,13 @@ TEST(PersistencyErrorTest, ValueOutOfRangeResultsInAssertionFailure)
 
     ASSERT_DEATH(
         {
-            MakeError(
-                static_cast<PersistencyError>(score::cpp::to_underlying(PersistencyError::kUnableToSaveToPersistency) + 1))
+            MakeError(static_cast<PersistencyError>(score::cpp::to_underlying(PersistencyError::kDataCorrupted) + 1))
                 .Message();
         },
         "");
     ASSERT_DEATH(
         {
-            MakeError(
-                static_cast<PersistencyError>(score::cpp::to_underlying(PersistencyError::kUnableToSaveToPersistency) + 42))
+            MakeError(static_cast<PersistencyError>(score::cpp::to_underlying(PersistencyError::kDataCorrupted) + 42))
                 .Message();
         },
         "");
@@ -0,0 +1,257 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/proxies/details/loopback/internal_config_provider_impl.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/json/json_parser.h"
+
+#include <score/assert.hpp>
+
+#include <utility>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+namespace
+{
+constexpr std::size_t kDefaultMaxSamplesLimit{500U};
+constexpr std::chrono::seconds kDefaultPollingCycleInterval{5U};
+}  // namespace
+
+LoopbackInternalConfigProvider::LoopbackInternalConfigProvider(std::shared_ptr<loopback::LoopbackChannel> channel)
+    : IInternalConfigProvider{},
+      logger_{mw::log::CreateLogger(std::string_view{"CfgP"})},
+      channel_{std::move(channel)},
+      max_samples_limit_{kDefaultMaxSamplesLimit},
+      polling_cycle_interval_{kDefaultPollingCycleInterval}
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__;
+    /* KW_SUPPRESS_START:MISRA.USE.EXPANSION: Macro for assertion is tolerated by decision*/
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(channel_ != nullptr);
+    /* KW_SUPPRESS_END:MISRA.USE.EXPANSION */
+}
+
+LoopbackInternalConfigProvider::~LoopbackInternalConfigProvider() noexcept
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__;
+    // unsubscribing waits for a running event handler, so none accesses the members destroyed below
+    if (subscription_id_.has_value())
+    {
+        channel_->Unsubscribe(subscription_id_.value());
+    }
+    polling_thread_.reset();
+}
+
+Result<json::Any> LoopbackInternalConfigProvider::ParseResponse(const Result<score::cpp::pmr::string>& response) const
+{
+    if (not response.has_value())
+    {
+        return MakeUnexpected<json::Any>(response.error());
+    }
+    auto parsed_response =
+        json::JsonParser{}.FromBuffer(std::string_view{response.value().data(), response.value().size()});
+    if (not parsed_response.has_value())
+    {
+        logger_.LogError() << "LoopbackInternalConfigProvider::" << __func__
+                           << ": Failed to parse response: " << parsed_response.error().Message();
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Response is not valid JSON");
+    }
+    return parsed_response;
+}
+
+Result<json::Any> LoopbackInternalConfigProvider::GetParameterSet(const score::cpp::string_view set_name,
+                                                                  const std::chrono::milliseconds timeout) const
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__ << "[" << set_name
+                       << "]: timeout: " << timeout;
+    return ParseResponse(channel_->GetParameterSet(set_name));
+}
+
+Result<score::cpp::pmr::string> LoopbackInternalConfigProvider::GetParameterSetAsBinary(
+    const score::cpp::string_view set_name,
+    const std::chrono::milliseconds timeout) const
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__ << "[" << set_name
+                       << "]: timeout: " << timeout;
+    return channel_->GetParameterSetAsBinary(set_name);
+}
+
+Result<json::Any> LoopbackInternalConfigProvider::GetParameterSetChanges(const score::cpp::string_view set_name,
+                                                                         const std::uint64_t base_version,
+                                                                         const std::uint64_t base_digest,
+                                                                         const std::chrono::milliseconds timeout) const
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__ << "[" << set_name
+                       << "]: base_version: " << base_version << ", base_digest: " << base_digest
+                       << ", timeout: " << timeout;
+    return ParseResponse(channel_->GetParameterSetChanges(set_name, base_version, base_digest));
+}
+
+bool LoopbackInternalConfigProvider::TrySubscribeToLastUpdatedParameterSetEvent(
+    const score::cpp::stop_token& stop_token,
+    OnChangedParameterSetCallback&& callback)
+{
+    (void)stop_token;
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__;
+
+    // the identifiers of the ConfigDaemon are adopted once per connection, unknown sets get the next ones
+    ParameterSetDictionary parameter_set_dictionary{};
+    const auto dictionary = ParseResponse(channel_->GetParameterSetDictionary());
+    if (dictionary.has_value())
+    {
+        auto adopted_dictionary = ParameterSetDictionary::FromJson(dictionary.value());
+        if (adopted_dictionary.has_value())
+        {
+            parameter_set_dictionary = std::move(adopted_dictionary).value();
+        }
+    }
+    else
+    {
+        logger_.LogWarn() << "LoopbackInternalConfigProvider::" << __func__
+                          << ": No dictionary of parameter set identifiers: " << dictionary.error().Message();
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (subscription_id_.has_value())
+        {
+            logger_.LogError() << "LoopbackInternalConfigProvider::" << __func__ << ": Already subscribed";
+            return false;
+        }
+        parameter_set_dictionary_ = std::move(parameter_set_dictionary);
+        on_changed_parameter_set_callback_ = std::move(callback);
+    }
+    // the channel calls the handler under its own lock, so it is not subscribed while holding mutex_
+    const auto subscription_id = channel_->Subscribe([this](const score::cpp::string_view set_name) {
+        OnLastUpdatedParameterSet(set_name);
+    });
+    const std::lock_guard<std::mutex> lock{mutex_};
+    subscription_id_ = subscription_id;
+    return true;
+}
+
+void LoopbackInternalConfigProvider::OnLastUpdatedParameterSet(const score::cpp::string_view set_name)
+{
+    const std::lock_guard<std::mutex> lock{mutex_};
+    received_samples_.Increment();
+    const auto set_id = parameter_set_dictionary_.FindOrAssign(set_name);
+    if (set_id >= is_update_pending_.size())
+    {
+        is_update_pending_.resize(parameter_set_dictionary_.Size(), false);
+    }
+    // like samples beyond the free slots of the mw::com proxy, updates beyond max_samples_limit_ are lost
+    if (is_update_pending_[set_id] || (pending_set_ids_.size() >= max_samples_limit_))
+    {
+        dropped_samples_.Increment();
+        return;
+    }
+    is_update_pending_[set_id] = true;
+    pending_set_ids_.push_back(set_id);
+    polling_routine_cv_.notify_one();
+}
+
+InitialQualifierState LoopbackInternalConfigProvider::GetInitialQualifierState(
+    const std::chrono::milliseconds timeout) const
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__ << "timeout: " << timeout;
+    return channel_->GetInitialQualifierState();
+}
+
+void LoopbackInternalConfigProvider::StartParameterSetUpdatePollingRoutine(
+    score::cpp::optional<std::size_t> max_samples_limit,
+    score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval)
+{
+    const std::lock_guard<std::mutex> lock{mutex_};
+    if (polling_thread_.has_value() && polling_thread_->joinable())
+    {
+        logger_.LogWarn() << "LoopbackInternalConfigProvider::" << __func__ << ": Routine already in progress";
+        return;
+    }
+
+    max_samples_limit_ = max_samples_limit.value_or(kDefaultMaxSamplesLimit);
+    polling_cycle_interval_ = polling_cycle_interval.value_or(kDefaultPollingCycleInterval);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(max_samples_limit_ > 0U,
+                           "LoopbackInternalConfigProvider max_samples_limit must not be zero");
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(polling_cycle_interval_ > std::chrono::milliseconds{0},
+                           "LoopbackInternalConfigProvider polling_cycle_interval must not be zero");
+    pending_set_ids_.reserve(max_samples_limit_);
+
+    polling_thread_ = score::cpp::jthread([this](const score::cpp::stop_token& stop_token) {
+        std::unique_lock<std::mutex> polling_thread_lock{mutex_};
+        // reused in every cycle, so delivering the updates doesn't allocate
+        std::vector<std::pair<ParameterSetId, score::cpp::string_view>> changed_parameter_sets{};
+        changed_parameter_sets.reserve(max_samples_limit_);
+        while (not stop_token.stop_requested())
+        {
+            for (const auto set_id : pending_set_ids_)
+            {
+                is_update_pending_[set_id] = false;
+                changed_parameter_sets.emplace_back(set_id, parameter_set_dictionary_.GetName(set_id));
+            }
+            pending_set_ids_.clear();
+            if (not changed_parameter_sets.empty())
+            {
+                polling_thread_lock.unlock();
+                for (const auto& changed_parameter_set : changed_parameter_sets)
+                {
+                    if (stop_token.stop_requested())
+                    {
+                        break;
+                    }
+                    on_changed_parameter_set_callback_(changed_parameter_set.first, changed_parameter_set.second);
+                }
+                changed_parameter_sets.clear();
+                polling_thread_lock.lock();
+            }
+            polling_cycles_.Increment();
+            score::cpp::ignore = polling_routine_cv_.wait_for(
+                polling_thread_lock, stop_token, polling_cycle_interval_, [this]() noexcept -> bool {
+                    return not(pending_set_ids_.empty());
+                });
+        }
+    });
+}
+
+void LoopbackInternalConfigProvider::StopParameterSetUpdatePollingRoutine() noexcept
+{
+    logger_.LogDebug() << "LoopbackInternalConfigProvider::" << __func__;
+    if (polling_thread_.has_value())
+    {
+        score::cpp::ignore = polling_thread_->request_stop();
+        polling_thread_.reset();
+    }
+}
+
+void LoopbackInternalConfigProvider::CheckParameterSetUpdates() noexcept
+{
+    // events are queued when they are published, so only the polling routine is woken up
+    const std::lock_guard<std::mutex> lock{mutex_};
+    if (not pending_set_ids_.empty())
+    {
+        polling_routine_cv_.notify_one();
+    }
+}
+
+PollingStatistics LoopbackInternalConfigProvider::GetPollingStatistics() const noexcept
+{
+    return PollingStatistics{polling_cycles_.Get(), received_samples_.Get(), dropped_samples_.Get()};
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,112 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_DETAILS_LOOPBACK_INTERNAL_CONFIG_PROVIDER_IMPL_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_DETAILS_LOOPBACK_INTERNAL_CONFIG_PROVIDER_IMPL_H
+
+#include "score/config_management/config_provider/code/loopback/loopback_channel.h"
+#include "score/config_management/config_provider/code/metrics/counter.h"
+#include "score/config_management/config_provider/code/proxies/internal_config_provider.h"
+
+#include "platform/aas/lib/concurrency/condition_variable.h"
+
+#include "score/mw/log/logger.h"
+
+#include <score/jthread.hpp>
+#include <score/optional.hpp>
+#include <score/vector.hpp>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+///
+/// @brief InternalConfigProvider proxy connected through a loopback::LoopbackChannel instead of mw::com
+///
+/// Requests are answered on the calling thread, so the timeouts are not applied. LastUpdatedParameterSet events are
+/// queued like the samples of the mw::com proxy and delivered by the polling routine, which is woken up by every new
+/// event. Events beyond max_samples_limit pending updates are dropped.
+///
+class LoopbackInternalConfigProvider final : public IInternalConfigProvider
+{
+  public:
+    explicit LoopbackInternalConfigProvider(std::shared_ptr<loopback::LoopbackChannel> channel);
+
+    LoopbackInternalConfigProvider(const LoopbackInternalConfigProvider&) = delete;
+    LoopbackInternalConfigProvider(LoopbackInternalConfigProvider&&) = delete;
+    LoopbackInternalConfigProvider& operator=(const LoopbackInternalConfigProvider&) & = delete;
+    LoopbackInternalConfigProvider& operator=(LoopbackInternalConfigProvider&&) = delete;
+    ~LoopbackInternalConfigProvider() noexcept override;
+
+    Result<json::Any> GetParameterSet(const score::cpp::string_view set_name,
+                                      const std::chrono::milliseconds timeout) const override;
+    /// @brief Hands the buffer received from the channel over as is
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view set_name,
+                                                            const std::chrono::milliseconds timeout) const override;
+    Result<json::Any> GetParameterSetChanges(const score::cpp::string_view set_name,
+                                             const std::uint64_t base_version,
+                                             const std::uint64_t base_digest,
+                                             const std::chrono::milliseconds timeout) const override;
+    /// @brief Fetches the dictionary of the parameter set identifiers once and subscribes to the events
+    bool TrySubscribeToLastUpdatedParameterSetEvent(const score::cpp::stop_token& stop_token,
+                                                    OnChangedParameterSetCallback&& callback) override;
+
+    InitialQualifierState GetInitialQualifierState(const std::chrono::milliseconds timeout) const override;
+
+    void StartParameterSetUpdatePollingRoutine(
+        score::cpp::optional<std::size_t> max_samples_limit,
+        score::cpp::optional<std::chrono::milliseconds> polling_cycle_interval) override;
+    void StopParameterSetUpdatePollingRoutine() noexcept override;
+
+    void CheckParameterSetUpdates() noexcept override;
+
+    PollingStatistics GetPollingStatistics() const noexcept override;
+
+  private:
+    void OnLastUpdatedParameterSet(const score::cpp::string_view set_name);
+    Result<json::Any> ParseResponse(const Result<score::cpp::pmr::string>& response) const;
+
+    mw::log::Logger& logger_;
+    const std::shared_ptr<loopback::LoopbackChannel> channel_;
+    score::cpp::optional<loopback::LoopbackChannel::SubscriptionId> subscription_id_;
+    OnChangedParameterSetCallback on_changed_parameter_set_callback_;
+
+    std::size_t max_samples_limit_;
+    std::chrono::milliseconds polling_cycle_interval_;
+    concurrency::InterruptibleConditionalVariable polling_routine_cv_;
+    ParameterSetDictionary parameter_set_dictionary_;
+    // pending updates in order of arrival, is_update_pending_ is indexed by identifier to drop duplicates
+    score::cpp::pmr::vector<ParameterSetId> pending_set_ids_;
+    std::vector<bool> is_update_pending_;
+    mutable std::mutex mutex_;
+    metrics::Counter polling_cycles_;
+    metrics::Counter received_samples_;
+    metrics::Counter dropped_samples_;
+    // We intentionally put the jthread as last member since this ensures that upon destruction of our class
+    // we first wait for the jthread to finish prior to destroying any other member which it might still access.
+    score::cpp::optional<score::cpp::jthread> polling_thread_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_DETAILS_LOOPBACK_INTERNAL_CONFIG_PROVIDER_IMPL_H
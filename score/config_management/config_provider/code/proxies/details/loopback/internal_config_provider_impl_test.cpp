@@ -0,0 +1,212 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/proxies/details/loopback/internal_config_provider_impl.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+
+class LoopbackServerStub final : public loopback::ILoopbackServer
+{
+  public:
+    Result<score::cpp::pmr::string> GetParameterSet(const score::cpp::string_view set_name) override
+    {
+        if (set_name == "malformed_set")
+        {
+            return score::cpp::pmr::string{"{"};
+        }
+        return score::cpp::pmr::string{R"({"parameters": {"parameter": 1}, "qualifier": 0})"};
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view) override
+    {
+        return score::cpp::pmr::string{"binary_set"};
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetChanges(const score::cpp::string_view,
+                                                           const std::uint64_t,
+                                                           const std::uint64_t) override
+    {
+        return MakeUnexpected(ConfigProviderError::kParameterSetNotFound);
+    }
+
+    Result<score::cpp::pmr::string> GetParameterSetDictionary() override
+    {
+        return score::cpp::pmr::string{R"({"parameter_sets": ["set_name_0", "set_name_1"]})"};
+    }
+};
+
+class LoopbackInternalConfigProviderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        channel_->Offer(server_);
+        unit_ = std::make_unique<LoopbackInternalConfigProvider>(channel_);
+    }
+
+    void TearDown() override
+    {
+        unit_.reset();
+        channel_->StopOffer();
+    }
+
+    void Subscribe()
+    {
+        ASSERT_TRUE(unit_->TrySubscribeToLastUpdatedParameterSetEvent(
+            score::cpp::stop_token{}, [this](const ParameterSetId set_id, const score::cpp::string_view set_name) {
+                const std::lock_guard<std::mutex> lock{mutex_};
+                updates_.emplace_back(set_id, std::string{set_name.data(), set_name.size()});
+                updates_changed_.notify_all();
+            }));
+    }
+
+    bool WaitForUpdates(const std::size_t count)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        return updates_changed_.wait_for(lock, std::chrono::seconds{5}, [this, count]() {
+            return updates_.size() >= count;
+        });
+    }
+
+    LoopbackServerStub server_{};
+    std::shared_ptr<loopback::LoopbackChannel> channel_{std::make_shared<loopback::LoopbackChannel>()};
+    std::unique_ptr<LoopbackInternalConfigProvider> unit_{};
+    std::mutex mutex_{};
+    std::condition_variable updates_changed_{};
+    std::vector<std::pair<ParameterSetId, std::string>> updates_{};
+};
+
+TEST_F(LoopbackInternalConfigProviderTest, GetParameterSetParsesResponseOfServer)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::LoopbackInternalConfigProvider");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that answers of the server are parsed and that malformed answers and errors "
+                   "are reported.");
+
+    const auto parameter_set = unit_->GetParameterSet("set_name_0", std::chrono::milliseconds{100});
+    ASSERT_TRUE(parameter_set.has_value());
+    EXPECT_TRUE(parameter_set.value().As<json::Object>().has_value());
+
+    EXPECT_EQ(unit_->GetParameterSet("malformed_set", std::chrono::milliseconds{100}).error(),
+              ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(unit_->GetParameterSetAsBinary("set_name_0", std::chrono::milliseconds{100}).value(), "binary_set");
+    EXPECT_EQ(unit_->GetParameterSetChanges("set_name_0", 1U, 2U, std::chrono::milliseconds{100}).error(),
+              ConfigProviderError::kParameterSetNotFound);
+
+    channel_->StopOffer();
+    EXPECT_EQ(unit_->GetParameterSet("set_name_0", std::chrono::milliseconds{100}).error(),
+              ConfigProviderError::kProxyNotReady);
+}
+
+TEST_F(LoopbackInternalConfigProviderTest, PollingRoutineDeliversEventsWithIdentifiersOfDictionary)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::LoopbackInternalConfigProvider");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that published events are delivered by the polling routine with the identifiers "
+                   "of the dictionary of the server and that unknown parameter sets get the next identifiers.");
+
+    Subscribe();
+    unit_->StartParameterSetUpdatePollingRoutine(score::cpp::nullopt, score::cpp::nullopt);
+
+    EXPECT_TRUE(channel_->Publish("set_name_1"));
+    ASSERT_TRUE(WaitForUpdates(1U));
+    EXPECT_TRUE(channel_->Publish("new_set"));
+    ASSERT_TRUE(WaitForUpdates(2U));
+
+    const std::lock_guard<std::mutex> lock{mutex_};
+    EXPECT_EQ(updates_[0], (std::pair<ParameterSetId, std::string>{1U, "set_name_1"}));
+    EXPECT_EQ(updates_[1], (std::pair<ParameterSetId, std::string>{2U, "new_set"}));
+}
+
+TEST_F(LoopbackInternalConfigProviderTest, PendingUpdatesOfSameParameterSetAreDropped)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::LoopbackInternalConfigProvider");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that an event is dropped while an update of the same parameter set is pending.");
+
+    Subscribe();
+
+    EXPECT_TRUE(channel_->Publish("set_name_0"));
+    EXPECT_TRUE(channel_->Publish("set_name_0"));
+    EXPECT_TRUE(channel_->Publish("set_name_1"));
+    unit_->StartParameterSetUpdatePollingRoutine(score::cpp::nullopt, score::cpp::nullopt);
+    ASSERT_TRUE(WaitForUpdates(2U));
+
+    const auto statistics = unit_->GetPollingStatistics();
+    EXPECT_EQ(statistics.received_samples, 3U);
+    EXPECT_EQ(statistics.dropped_samples, 1U);
+    const std::lock_guard<std::mutex> lock{mutex_};
+    EXPECT_EQ(updates_.size(), 2U);
+}
+
+TEST_F(LoopbackInternalConfigProviderTest, SubscribingTwiceFails)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::LoopbackInternalConfigProvider");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that a second subscription is rejected.");
+
+    Subscribe();
+
+    EXPECT_FALSE(unit_->TrySubscribeToLastUpdatedParameterSetEvent(
+        score::cpp::stop_token{}, [](const ParameterSetId, const score::cpp::string_view) {}));
+}
+
+TEST_F(LoopbackInternalConfigProviderTest, InitialQualifierStateIsReadFromChannel)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::LoopbackInternalConfigProvider");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the InitialQualifierState set by the service is returned.");
+
+    channel_->SetInitialQualifierState(InitialQualifierState::kQualifying);
+
+    EXPECT_EQ(unit_->GetInitialQualifierState(std::chrono::milliseconds{100}), InitialQualifierState::kQualifying);
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -17,7 +17,10 @@
 #include "platform/aas/lib/concurrency/future/interruptible_promise.h"
 #include "score/json/json_parser.h"
 
+#include <algorithm>
+#include <iterator>
 #include <sstream>
+#include <utility>
 
 namespace score
 {
@@ -102,6 +105,26 @@ Result<json::Any> InternalConfigProvider::GetParameterSet(const score::cpp::stri
     return {};
 }
 
+Result<score::cpp::pmr::string> InternalConfigProvider::GetParameterSetAsBinary(
+    const score::cpp::string_view set_name,
+    const std::chrono::milliseconds timeout) const
+{
+    logger_.LogDebug() << "InternalConfigProvider::" << __func__ << "[" << set_name << "]: timeout: " << timeout;
+    // the generated service interface offers no method for the binary format yet, so the JSON text is fetched instead
+    return MakeUnexpected(ConfigProviderError::kMethodNotSupported, "Binary parameter sets are not offered");
+}
+
+Result<json::Any> InternalConfigProvider::GetParameterSetChanges(const score::cpp::string_view set_name,
+                                                                 const std::uint64_t base_version,
+                                                                 const std::uint64_t base_digest,
+                                                                 const std::chrono::milliseconds timeout) const
+{
+    logger_.LogDebug() << "InternalConfigProvider::" << __func__ << "[" << set_name << "]: base_version: "
+                       << base_version << ", base_digest: " << base_digest << ", timeout: " << timeout;
+    // the generated service interface offers no method for the changes yet, so the whole set is fetched instead
+    return MakeUnexpected(ConfigProviderError::kMethodNotSupported, "Parameter set changes are not offered");
+}
+
 bool InternalConfigProvider::TrySubscribeToLastUpdatedParameterSetEvent(const score::cpp::stop_token& stop_token,
                                                                         OnChangedParameterSetCallback&& callback)
 {
@@ -169,30 +192,40 @@ void InternalConfigProvider::StartParameterSetUpdatePollingRoutine(
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(polling_cycle_interval_ > std::chrono::milliseconds{0},
                            "InternalConfigProvider::OnChangedParameterSet() polling_cycle_interval must not be zero");
 
-    last_updated_parameter_set_names_.reserve(max_samples_limit_);
+    pending_set_ids_.reserve(max_samples_limit_);
 
     polling_thread_ = score::cpp::jthread([this](const score::cpp::stop_token& stop_token) {
         std::unique_lock<std::mutex> polling_thread_lock{mutex_};
+        // reused in every cycle, so delivering the updates doesn't allocate
+        std::vector<std::pair<ParameterSetId, score::cpp::string_view>> changed_parameter_sets{};
+        changed_parameter_sets.reserve(max_samples_limit_);
         while (not stop_token.stop_requested())
         {
             if (GetLastUpdatedParameterSetNewSamples())  // LCOV_EXCL_BR_LINE (the only 2 branches are covered in test)
             {
-                decltype(last_updated_parameter_set_names_) parameter_set_names{};
-                last_updated_parameter_set_names_.swap(parameter_set_names);
+                // the names are taken under the lock, they stay valid while the dictionary grows
+                for (const auto set_id : pending_set_ids_)
+                {
+                    is_update_pending_[set_id] = false;
+                    changed_parameter_sets.emplace_back(set_id, parameter_set_dictionary_.GetName(set_id));
+                }
+                pending_set_ids_.clear();
                 polling_thread_lock.unlock();
-                for (const auto& parameter_set_name : parameter_set_names)
+                for (const auto& changed_parameter_set : changed_parameter_sets)
                 {
                     if (stop_token.stop_requested())
                     {
                         break;
                     }
-                    on_changed_parameter_set_callback_(parameter_set_name);
+                    on_changed_parameter_set_callback_(changed_parameter_set.first, changed_parameter_set.second);
                 }
+                changed_parameter_sets.clear();
                 polling_thread_lock.lock();
             }
+            polling_cycles_.Increment();
             score::cpp::ignore = polling_routine_cv_.wait_for(
                 polling_thread_lock, stop_token, polling_cycle_interval_, [this]() noexcept -> bool {
-                    return not(last_updated_parameter_set_names_.empty());
+                    return not(pending_set_ids_.empty());
                 });
         }
     });
@@ -219,6 +252,11 @@ void InternalConfigProvider::CheckParameterSetUpdates() noexcept
     }
 }
 
+PollingStatistics InternalConfigProvider::GetPollingStatistics() const noexcept
+{
+    return PollingStatistics{polling_cycles_.Get(), received_samples_.Get(), dropped_samples_.Get()};
+}
+
 bool InternalConfigProvider::GetLastUpdatedParameterSetNewSamples()
 {
     /// @brief This method get from proxy last updated samples of parameter sets.
@@ -236,11 +274,27 @@ bool InternalConfigProvider::GetLastUpdatedParameterSetNewSamples()
     const auto callback{[this](auto sample_ptr) {
         // move used to clear cache in which it calls reset method to return memory_ptr_ to backend
         const auto value = std::move(sample_ptr);
-        const std::string set_name{value->begin(), std::find(value->begin(), value->end(), 0)};
-        score::cpp::ignore = last_updated_parameter_set_names_.insert(set_name);
+        // the name is zero-padded, it is looked up in place without copying it into a string
+        const auto name_length = std::distance(value->begin(), std::find(value->begin(), value->end(), 0U));
+        // coverity[autosar_cpp14_a5_2_4_violation] the characters of the name are transported as bytes
+        const score::cpp::string_view set_name{reinterpret_cast<const char*>(value->data()),
+                                               static_cast<std::size_t>(name_length)};
+        const auto set_id = parameter_set_dictionary_.FindOrAssign(set_name);
+        received_samples_.Increment();
+        if (set_id >= is_update_pending_.size())
+        {
+            is_update_pending_.resize(parameter_set_dictionary_.Size(), false);
+        }
+        if (is_update_pending_[set_id])
+        {
+            dropped_samples_.Increment();
+            return;
+        }
+        is_update_pending_[set_id] = true;
+        pending_set_ids_.push_back(set_id);
     }};
-    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(max_samples_limit_ >= last_updated_parameter_set_names_.size());
-    const std::size_t free_slots_in_samples_container = max_samples_limit_ - last_updated_parameter_set_names_.size();
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(max_samples_limit_ >= pending_set_ids_.size());
+    const std::size_t free_slots_in_samples_container = max_samples_limit_ - pending_set_ids_.size();
     const auto get_new_samples_result =
         proxy_->last_updated_parameterset.GetNewSamples(callback, free_slots_in_samples_container);
     if (not get_new_samples_result.has_value())
@@ -250,14 +304,14 @@ bool InternalConfigProvider::GetLastUpdatedParameterSetNewSamples()
                            << get_new_samples_result.error().Message();
         return false;
     }
-    if (!last_updated_parameter_set_names_.empty())
+    if (!pending_set_ids_.empty())
     {
         std::stringstream sstr;  // LCOV_EXCL_LINE tooling issue
 
         sstr << "[";
-        for (const auto& f : last_updated_parameter_set_names_)
+        for (const auto set_id : pending_set_ids_)
         {
-            sstr << f << ", ";
+            sstr << parameter_set_dictionary_.GetName(set_id) << ", ";
         }
         score::cpp::ignore = sstr.seekp(-2, std::ios::cur);
         sstr << "]";
@@ -15,6 +15,7 @@
 #define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_DETAILS_MW_COM_INTERNAL_CONFIG_PROVIDER_IMPL_H
 
 #include "config_management/ConfigDaemon/code/services/details/mw_com/generated_service/internal_config_provider_type.h"
+#include "score/config_management/config_provider/code/metrics/counter.h"
 #include "score/config_management/config_provider/code/proxies/internal_config_provider.h"
 
 #include "platform/aas/lib/concurrency/condition_variable.h"
@@ -25,10 +26,11 @@
 
 #include <score/jthread.hpp>
 #include <score/optional.hpp>
-#include <score/unordered_set.hpp>
+#include <score/vector.hpp>
 
 #include <chrono>
 #include <mutex>
+#include <vector>
 
 namespace score
 {
@@ -53,6 +55,12 @@ class InternalConfigProvider final : public IInternalConfigProvider
 
     Result<json::Any> GetParameterSet(const score::cpp::string_view set_name,
                                       const std::chrono::milliseconds timeout) const override;
+    Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view set_name,
+                                                            const std::chrono::milliseconds timeout) const override;
+    Result<json::Any> GetParameterSetChanges(const score::cpp::string_view set_name,
+                                             const std::uint64_t base_version,
+                                             const std::uint64_t base_digest,
+                                             const std::chrono::milliseconds timeout) const override;
     bool TrySubscribeToLastUpdatedParameterSetEvent(const score::cpp::stop_token& stop_token,
                                                     OnChangedParameterSetCallback&& callback) override;
 
@@ -65,10 +73,12 @@ class InternalConfigProvider final : public IInternalConfigProvider
 
     void CheckParameterSetUpdates() noexcept override;
 
+    PollingStatistics GetPollingStatistics() const noexcept override;
+
   private:
     /// @brief This method get from proxy last updated samples of parameter sets.
     /// @details Assumption of use.
-    /// last_updated_parameter_set_names_mutex_ should be locked before call.
+    /// mutex_ should be locked before call.
     bool GetLastUpdatedParameterSetNewSamples();
 
     mw::log::Logger& logger_;
@@ -79,8 +89,16 @@ class InternalConfigProvider final : public IInternalConfigProvider
     std::size_t max_samples_limit_;
     std::chrono::milliseconds polling_cycle_interval_;
     concurrency::InterruptibleConditionalVariable polling_routine_cv_;
-    score::cpp::pmr::unordered_set<std::string> last_updated_parameter_set_names_;
+    // the identifiers of the parameter sets named by the LastUpdatedParameterSet samples, the generated service
+    // interface offers no method for the dictionary of the ConfigDaemon yet, so they are assigned on first sight
+    ParameterSetDictionary parameter_set_dictionary_;
+    // pending updates in order of arrival, is_update_pending_ is indexed by identifier to drop duplicates
+    score::cpp::pmr::vector<ParameterSetId> pending_set_ids_;
+    std::vector<bool> is_update_pending_;
     mutable std::mutex mutex_;
+    metrics::Counter polling_cycles_;
+    metrics::Counter received_samples_;
+    metrics::Counter dropped_samples_;
     // We intentionally put the jthread as last member since this ensures that upon destruction of our class
     // we first wait for the jthread to finish prior to destroying any other member which it might still access.
     score::cpp::optional<score::cpp::jthread> polling_thread_;
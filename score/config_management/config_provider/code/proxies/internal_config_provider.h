@@ -15,15 +15,18 @@
 #define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_INTERNAL_CONFIG_PROVIDER_H
 
 #include "score/config_management/config_provider/code/config_provider/initial_qualifier_state_types.h"
+#include "score/config_management/config_provider/code/proxies/parameter_set_dictionary.h"
 
 #include "score/json/internal/model/any.h"
 
 #include <score/callback.hpp>
 #include <score/optional.hpp>
 #include <score/stop_token.hpp>
+#include <score/string.hpp>
 #include <score/string_view.hpp>
 
 #include <chrono>
+#include <cstdint>
 
 namespace score
 {
@@ -33,10 +36,27 @@ namespace config_provider
 {
 using IsAvailableNotificationCallback = score::cpp::callback<void()>;
 
+/// @brief Counters of the routine polling LastUpdatedParameterSet event samples
+struct PollingStatistics
+{
+    /// Completed cycles of the polling routine
+    std::uint64_t polling_cycles;
+    /// Received LastUpdatedParameterSet event samples
+    std::uint64_t received_samples;
+    /// Samples dropped because an update of the same parameter set was already pending
+    std::uint64_t dropped_samples;
+};
+
 class IInternalConfigProvider
 {
   public:
-    using OnChangedParameterSetCallback = score::cpp::callback<void(const score::cpp::string_view set_name)>;
+    /// @brief Called for every changed parameter set with its identifier and its name
+    ///
+    /// The identifier stays the same for a parameter set as long as the proxy exists, so receivers can index their
+    /// per-set state by it. The name stays valid as long as the proxy exists.
+    ///
+    using OnChangedParameterSetCallback =
+        score::cpp::callback<void(const ParameterSetId set_id, const score::cpp::string_view set_name)>;
     IInternalConfigProvider() = default;
     virtual ~IInternalConfigProvider() noexcept = default;
 
@@ -48,6 +68,24 @@ class IInternalConfigProvider
 
     virtual Result<json::Any> GetParameterSet(const score::cpp::string_view set_name,
                                               const std::chrono::milliseconds timeout) const = 0;
+    /// @brief Fetches the parameter set in the binary wire format, so it is read in place instead of being parsed
+    ///
+    /// @return the received buffer, which wire_format::BinarySetView validates, or kMethodNotSupported if the
+    /// connection to the ConfigDaemon doesn't carry the binary format
+    ///
+    virtual Result<score::cpp::pmr::string> GetParameterSetAsBinary(const score::cpp::string_view set_name,
+                                                                    const std::chrono::milliseconds timeout) const = 0;
+    /// @brief Fetches the changes of a parameter set since base_version as parameter-level delta
+    ///
+    /// The delta has the format {"version": v, "is_complete": b, "parameters": {...}, "removed_parameters": [...],
+    /// "qualifier": q}. For base_version zero or a version unknown to the ConfigDaemon it holds the complete set.
+    /// If base_version or base_digest (wire_format::ComputeBinarySetDigest(), zero if unknown) identify the current
+    /// content of the set, only {"version": v, "is_modified": false} is returned.
+    ///
+    virtual Result<json::Any> GetParameterSetChanges(const score::cpp::string_view set_name,
+                                                     const std::uint64_t base_version,
+                                                     const std::uint64_t base_digest,
+                                                     const std::chrono::milliseconds timeout) const = 0;
     virtual bool TrySubscribeToLastUpdatedParameterSetEvent(const score::cpp::stop_token& stop_token,
                                                             OnChangedParameterSetCallback&& callback) = 0;
 
@@ -59,6 +97,8 @@ class IInternalConfigProvider
     virtual void StopParameterSetUpdatePollingRoutine() noexcept = 0;
 
     virtual void CheckParameterSetUpdates() noexcept = 0;
+
+    virtual PollingStatistics GetPollingStatistics() const noexcept = 0;
 };
 
 }  // namespace config_provider
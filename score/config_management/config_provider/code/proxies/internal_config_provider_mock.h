@@ -34,6 +34,17 @@ class InternalConfigProviderMock final : public IInternalConfigProvider
                 GetParameterSet,
                 (const score::cpp::string_view, const std::chrono::milliseconds),
                 (const, override));
+    MOCK_METHOD(Result<score::cpp::pmr::string>,
+                GetParameterSetAsBinary,
+                (const score::cpp::string_view, const std::chrono::milliseconds),
+                (const, override));
+    MOCK_METHOD(Result<json::Any>,
+                GetParameterSetChanges,
+                (const score::cpp::string_view,
+                 const std::uint64_t,
+                 const std::uint64_t,
+                 const std::chrono::milliseconds),
+                (const, override));
     MOCK_METHOD(bool,
                 TrySubscribeToLastUpdatedParameterSetEvent,
                 (const score::cpp::stop_token&, OnChangedParameterSetCallback&& callback),
@@ -46,6 +57,7 @@ class InternalConfigProviderMock final : public IInternalConfigProvider
                 (noexcept, override));
     MOCK_METHOD(void, StopParameterSetUpdatePollingRoutine, (), (noexcept, override));
     MOCK_METHOD(void, CheckParameterSetUpdates, (), (noexcept, override));
+    MOCK_METHOD(PollingStatistics, GetPollingStatistics, (), (const, noexcept, override));
 };
 
 }  // namespace config_provider
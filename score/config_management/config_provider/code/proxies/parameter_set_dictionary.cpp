@@ -0,0 +1,106 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/proxies/parameter_set_dictionary.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/assert.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+Result<ParameterSetDictionary> ParameterSetDictionary::FromJson(const json::Any& dictionary)
+{
+    const auto dictionary_object = dictionary.As<json::Object>();
+    if (not dictionary_object.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to cast dictionary to object instance";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Dictionary is not a JSON object");
+    }
+    const auto set_names_entry = dictionary_object.value().get().find("parameter_sets");
+    if (set_names_entry == dictionary_object.value().get().end())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to find parameter_sets";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "Dictionary has no parameter_sets");
+    }
+    const auto set_names = set_names_entry->second.As<json::List>();
+    if (not set_names.has_value())
+    {
+        mw::log::LogError("CfgP") << __func__ << ": Failed to cast parameter_sets to JSON list";
+        return MakeUnexpected(ConfigProviderError::kParsingFailed, "parameter_sets of dictionary is not a list");
+    }
+
+    ParameterSetDictionary parameter_set_dictionary{};
+    for (const auto& set_name : set_names.value().get())
+    {
+        const auto name = set_name.As<std::string>();
+        if (not name.has_value())
+        {
+            mw::log::LogError("CfgP") << __func__ << ": Failed to cast parameter set name to string";
+            return MakeUnexpected(ConfigProviderError::kParsingFailed, "Parameter set name is not a string");
+        }
+        const std::string_view name_view{name.value().get()};
+        if (parameter_set_dictionary.Find(name_view).has_value())
+        {
+            mw::log::LogError("CfgP") << __func__ << ": Parameter set " << name_view << " is listed twice";
+            return MakeUnexpected(ConfigProviderError::kParsingFailed, "Parameter set name is not unique");
+        }
+        score::cpp::ignore = parameter_set_dictionary.FindOrAssign(name_view);
+    }
+    return parameter_set_dictionary;
+}
+
+ParameterSetId ParameterSetDictionary::FindOrAssign(const score::cpp::string_view set_name)
+{
+    const auto id = ids_.find(std::string_view{set_name.data(), set_name.size()});
+    if (id != ids_.end())
+    {
+        return id->second;
+    }
+    const auto new_id = static_cast<ParameterSetId>(names_.size());
+    const auto& name = names_.emplace_back(set_name.data(), set_name.size());
+    score::cpp::ignore = ids_.emplace(std::string_view{name}, new_id);
+    return new_id;
+}
+
+score::cpp::optional<ParameterSetId> ParameterSetDictionary::Find(const score::cpp::string_view set_name) const noexcept
+{
+    const auto id = ids_.find(std::string_view{set_name.data(), set_name.size()});
+    if (id == ids_.end())
+    {
+        return {};
+    }
+    return id->second;
+}
+
+score::cpp::string_view ParameterSetDictionary::GetName(const ParameterSetId set_id) const noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(set_id < names_.size());
+    const auto& name = names_[set_id];
+    return score::cpp::string_view{name.data(), name.size()};
+}
+
+std::size_t ParameterSetDictionary::Size() const noexcept
+{
+    return names_.size();
+}
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,79 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_PARAMETER_SET_DICTIONARY_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_PARAMETER_SET_DICTIONARY_H
+
+#include "score/json/internal/model/any.h"
+#include "score/result/result.h"
+
+#include <score/optional.hpp>
+#include <score/string_view.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+
+/// @brief Compact numeric identifier of a parameter set, the index of the set in its ParameterSetDictionary
+using ParameterSetId = std::uint32_t;
+
+/// @brief Maps the names of parameter sets to compact numeric identifiers and back
+///
+/// Identifiers are dense and never reused, so caches keep their entries in flat arrays indexed by identifier instead
+/// of hashing the name of a parameter set on every access. Names are looked up by string_view, so no string is
+/// allocated for known names. The names keep their addresses while the dictionary exists, so the string_views
+/// returned by GetName() stay valid. The dictionary is not synchronized.
+///
+class ParameterSetDictionary final
+{
+  public:
+    ParameterSetDictionary() = default;
+    ~ParameterSetDictionary() noexcept = default;
+    ParameterSetDictionary(ParameterSetDictionary&&) noexcept = default;
+    ParameterSetDictionary(const ParameterSetDictionary&) = delete;
+    ParameterSetDictionary& operator=(ParameterSetDictionary&&) noexcept = default;
+    ParameterSetDictionary& operator=(const ParameterSetDictionary&) = delete;
+
+    /// @brief Adopts the identifiers of the dictionary served by the ConfigDaemon
+    ///
+    /// The dictionary has the format {"parameter_sets": ["set_name_0", "set_name_1", ...]}, the identifier of a
+    /// parameter set is its index. Malformed dictionaries are rejected with ConfigProviderError::kParsingFailed.
+    ///
+    static Result<ParameterSetDictionary> FromJson(const json::Any& dictionary);
+
+    /// @brief Returns the identifier of set_name, a parameter set seen for the first time gets the next identifier
+    ParameterSetId FindOrAssign(const score::cpp::string_view set_name);
+    score::cpp::optional<ParameterSetId> Find(const score::cpp::string_view set_name) const noexcept;
+    /// @brief Returns the name of a parameter set, set_id has to be smaller than Size()
+    score::cpp::string_view GetName(const ParameterSetId set_id) const noexcept;
+    std::size_t Size() const noexcept;
+
+  private:
+    std::deque<std::string> names_;
+    std::unordered_map<std::string_view, ParameterSetId> ids_;
+};
+
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_PROXIES_PARAMETER_SET_DICTIONARY_H
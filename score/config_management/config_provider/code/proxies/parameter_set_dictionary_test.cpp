@@ -0,0 +1,130 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/proxies/parameter_set_dictionary.h"
+#include "score/config_management/config_provider/code/config_provider/error/error.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace test
+{
+
+class ParameterSetDictionaryTest : public ::testing::Test
+{
+  protected:
+    Result<ParameterSetDictionary> Parse(const std::string& dictionary) const
+    {
+        const auto dictionary_json = json::JsonParser{}.FromBuffer(dictionary);
+        EXPECT_TRUE(dictionary_json.has_value());
+        return ParameterSetDictionary::FromJson(dictionary_json.value());
+    }
+};
+
+TEST_F(ParameterSetDictionaryTest, FindOrAssignAssignsDenseIdentifiers)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSetDictionary::FindOrAssign()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that new parameter sets get the next identifier and known ones keep theirs.");
+
+    ParameterSetDictionary dictionary{};
+    EXPECT_FALSE(dictionary.Find("set_name_1").has_value());
+
+    EXPECT_EQ(dictionary.FindOrAssign("set_name_1"), 0U);
+    EXPECT_EQ(dictionary.FindOrAssign("set_name_2"), 1U);
+    const std::string known_name{"set_name_1"};
+    EXPECT_EQ(dictionary.FindOrAssign(known_name), 0U);
+
+    EXPECT_EQ(dictionary.Size(), 2U);
+    EXPECT_EQ(dictionary.Find("set_name_2").value(), 1U);
+    EXPECT_EQ(dictionary.GetName(0U), "set_name_1");
+    EXPECT_EQ(dictionary.GetName(1U), "set_name_2");
+}
+
+TEST_F(ParameterSetDictionaryTest, NamesStayValidWhileDictionaryGrows)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSetDictionary::GetName()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the names returned by GetName() stay valid when further parameter sets "
+                   "are added and the dictionary is moved.");
+
+    ParameterSetDictionary dictionary{};
+    const auto first_name = dictionary.GetName(dictionary.FindOrAssign("set"));
+    for (std::uint32_t index = 0U; index < 1000U; ++index)
+    {
+        const auto set_name = "set_name_with_a_length_beyond_small_strings_" + std::to_string(index);
+        score::cpp::ignore = dictionary.FindOrAssign(set_name);
+    }
+    const ParameterSetDictionary moved_dictionary{std::move(dictionary)};
+
+    EXPECT_EQ(first_name, "set");
+    EXPECT_EQ(first_name.data(), moved_dictionary.GetName(0U).data());
+    EXPECT_EQ(moved_dictionary.Find("set_name_with_a_length_beyond_small_strings_999").value(), 1000U);
+}
+
+TEST_F(ParameterSetDictionaryTest, FromJsonAdoptsIdentifiersOfConfigDaemon)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSetDictionary::FromJson()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the identifier of a parameter set is its index.");
+
+    auto result = Parse(R"({"parameter_sets": ["set_name_2", "set_name_1"]})");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value().Size(), 2U);
+    EXPECT_EQ(result.value().Find("set_name_2").value(), 0U);
+    EXPECT_EQ(result.value().Find("set_name_1").value(), 1U);
+    EXPECT_EQ(result.value().FindOrAssign("set_name_3"), 2U);
+}
+
+TEST_F(ParameterSetDictionaryTest, FromJsonRejectsMalformedDictionary)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::ParameterSetDictionary::FromJson()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that malformed dictionaries are rejected with kParsingFailed.");
+
+    EXPECT_EQ(Parse(R"(["set_name_1"])").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Parse(R"({"sets": ["set_name_1"]})").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Parse(R"({"parameter_sets": "set_name_1"})").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Parse(R"({"parameter_sets": ["set_name_1", 2]})").error(), ConfigProviderError::kParsingFailed);
+    EXPECT_EQ(Parse(R"({"parameter_sets": ["set_name_1", "set_name_1"]})").error(),
+              ConfigProviderError::kParsingFailed);
+}
+
+}  // namespace test
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,643 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace wire_format
+{
+
+namespace
+{
+// header: magic, version, flags, qualifier, reserved byte, parameter count, size of the buffer
+constexpr std::array<char, 4U> kMagic{'C', 'P', 'W', 'F'};
+constexpr std::uint8_t kVersion{1U};
+constexpr std::size_t kVersionOffset{4U};
+constexpr std::size_t kFlagsOffset{5U};
+constexpr std::size_t kQualifierOffset{6U};
+constexpr std::size_t kParameterCountOffset{8U};
+constexpr std::size_t kSizeOffset{12U};
+constexpr std::size_t kHeaderSize{16U};
+constexpr std::uint8_t kHasQualifierFlag{1U};
+// member table entry: name offset, name size, value offset, reserved
+constexpr std::size_t kMemberSize{16U};
+// value header: type, three reserved bytes, element count or string size or bool value
+constexpr std::size_t kValueHeaderSize{8U};
+constexpr std::size_t kCountOffset{4U};
+constexpr std::size_t kAlignment{8U};
+constexpr std::size_t kMaxDepth{32U};
+// 64 bit FNV-1a
+constexpr std::uint64_t kDigestOffsetBasis{14695981039346656037ULL};
+constexpr std::uint64_t kDigestPrime{1099511628211ULL};
+
+template <typename T>
+T LoadAt(const std::string_view buffer, const std::size_t offset) noexcept
+{
+    T value{};
+    score::cpp::ignore = std::memcpy(&value, buffer.data() + offset, sizeof(T));
+    return value;
+}
+
+std::size_t GetArrayElementSize(const ValueType type) noexcept
+{
+    return (type == ValueType::kBoolArray) ? sizeof(std::uint8_t) : sizeof(std::uint64_t);
+}
+
+/// @brief Returns the type of a bool or a number, nothing for any other value
+score::cpp::optional<ValueType> GetScalarType(const json::Any& value) noexcept
+{
+    if (value.As<bool>().has_value())
+    {
+        return ValueType::kBool;
+    }
+    if (value.As<std::int64_t>().has_value())
+    {
+        return ValueType::kInt64;
+    }
+    if (value.As<std::uint64_t>().has_value())
+    {
+        return ValueType::kUint64;
+    }
+    if (value.As<double>().has_value())
+    {
+        return ValueType::kDouble;
+    }
+    return score::cpp::nullopt;
+}
+
+std::vector<std::pair<std::string_view, const json::Any*>> SortMembers(const json::Object& members)
+{
+    std::vector<std::pair<std::string_view, const json::Any*>> sorted_members{};
+    sorted_members.reserve(members.size());
+    for (const auto& member : members)
+    {
+        sorted_members.emplace_back(member.first.GetAsStringView(), &member.second);
+    }
+    std::sort(sorted_members.begin(), sorted_members.end(), [](const auto& lhs, const auto& rhs) noexcept {
+        return lhs.first < rhs.first;
+    });
+    return sorted_members;
+}
+
+class Encoder final
+{
+  public:
+    Result<std::string> Encode(const json::Object& set)
+    {
+        const auto parameters = set.find("parameters");
+        if (parameters == set.end())
+        {
+            return MakeUnexpected(WireFormatError::kUnsupportedValue, "Parameter set has no parameters");
+        }
+        const auto parameters_object = parameters->second.As<json::Object>();
+        if (!parameters_object.has_value())
+        {
+            return MakeUnexpected(WireFormatError::kUnsupportedValue, "Parameters are not an object");
+        }
+
+        score::cpp::ignore = Reserve(kHeaderSize);
+        score::cpp::ignore = std::copy(kMagic.begin(), kMagic.end(), buffer_.begin());
+        buffer_[kVersionOffset] = static_cast<char>(kVersion);
+        const auto qualifier = set.find("qualifier");
+        if (qualifier != set.end())
+        {
+            const auto qualifier_value = qualifier->second.As<std::uint8_t>();
+            if (qualifier_value.has_value())
+            {
+                buffer_[kFlagsOffset] = static_cast<char>(kHasQualifierFlag);
+                buffer_[kQualifierOffset] = static_cast<char>(qualifier_value.value());
+            }
+        }
+
+        const auto& members = parameters_object.value().get();
+        Store(kParameterCountOffset, static_cast<std::uint32_t>(members.size()));
+        const auto encode_result = EncodeMembers(members, 0U);
+        if (!encode_result.has_value())
+        {
+            return MakeUnexpected<std::string>(encode_result.error());
+        }
+        if (buffer_.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            return MakeUnexpected(WireFormatError::kUnsupportedValue, "Parameter set exceeds 4 GiB");
+        }
+        Store(kSizeOffset, static_cast<std::uint32_t>(buffer_.size()));
+        return std::move(buffer_);
+    }
+
+  private:
+    /// @brief Encodes the member table followed by the names and the values of the members
+    ResultBlank EncodeMembers(const json::Object& members, const std::size_t depth)
+    {
+        const auto sorted_members = SortMembers(members);
+        const auto table_offset = Reserve(sorted_members.size() * kMemberSize);
+        for (std::size_t index = 0U; index < sorted_members.size(); ++index)
+        {
+            const auto entry_offset = table_offset + (index * kMemberSize);
+            const auto& name = sorted_members[index].first;
+            Store(entry_offset, static_cast<std::uint32_t>(buffer_.size()));
+            Store(entry_offset + 4U, static_cast<std::uint32_t>(name.size()));
+            buffer_.append(name.data(), name.size());
+
+            const auto value_offset = EncodeValue(*sorted_members[index].second, depth + 1U);
+            if (!value_offset.has_value())
+            {
+                return MakeUnexpected<score::cpp::blank>(value_offset.error());
+            }
+            Store(entry_offset + 8U, static_cast<std::uint32_t>(value_offset.value()));
+        }
+        return {};
+    }
+
+    Result<std::size_t> EncodeValue(const json::Any& value, const std::size_t depth)
+    {
+        if (depth > kMaxDepth)
+        {
+            return MakeUnexpected(WireFormatError::kUnsupportedValue, "Value is nested too deeply");
+        }
+
+        const auto scalar_type = GetScalarType(value);
+        if (scalar_type.has_value())
+        {
+            const auto value_offset = AppendValueHeader(scalar_type.value(), 0U);
+            StoreScalar(scalar_type.value(), value, Reserve(sizeof(std::uint64_t)));
+            return value_offset;
+        }
+        const auto string = value.As<std::string>();
+        if (string.has_value())
+        {
+            const std::string& string_value = string.value();
+            const auto value_offset = AppendValueHeader(ValueType::kString, string_value.size());
+            buffer_.append(string_value);
+            return value_offset;
+        }
+        const auto list = value.As<json::List>();
+        if (list.has_value())
+        {
+            return EncodeList(list.value().get(), depth);
+        }
+        const auto object = value.As<json::Object>();
+        if (object.has_value())
+        {
+            const auto value_offset = AppendValueHeader(ValueType::kObject, object.value().get().size());
+            const auto encode_result = EncodeMembers(object.value().get(), depth);
+            if (!encode_result.has_value())
+            {
+                return MakeUnexpected<std::size_t>(encode_result.error());
+            }
+            return value_offset;
+        }
+        if (value.As<json::Null>().has_value())
+        {
+            return AppendValueHeader(ValueType::kNull, 0U);
+        }
+        return MakeUnexpected(WireFormatError::kUnsupportedValue, "Value has an unknown type");
+    }
+
+    Result<std::size_t> EncodeList(const json::List& list, const std::size_t depth)
+    {
+        // lists of bools or numbers of the same kind are stored as plain arrays, which are read without any lookup
+        score::cpp::optional<ValueType> element_type{};
+        for (const auto& element : list)
+        {
+            const auto scalar_type = GetScalarType(element);
+            if ((!scalar_type.has_value()) || (element_type.has_value() && (element_type != scalar_type)))
+            {
+                element_type.reset();
+                break;
+            }
+            element_type = scalar_type;
+        }
+
+        if (element_type.has_value())
+        {
+            const auto array_type = static_cast<ValueType>(score::cpp::to_underlying(element_type.value()) +
+                                                           score::cpp::to_underlying(ValueType::kBoolArray) -
+                                                           score::cpp::to_underlying(ValueType::kBool));
+            const auto element_size = GetArrayElementSize(array_type);
+            const auto value_offset = AppendValueHeader(array_type, list.size());
+            const auto elements_offset = Reserve(list.size() * element_size);
+            for (std::size_t index = 0U; index < list.size(); ++index)
+            {
+                StoreScalar(element_type.value(), list[index], elements_offset + (index * element_size));
+            }
+            return value_offset;
+        }
+
+        const auto value_offset = AppendValueHeader(ValueType::kList, list.size());
+        const auto table_offset = Reserve(list.size() * sizeof(std::uint32_t));
+        for (std::size_t index = 0U; index < list.size(); ++index)
+        {
+            const auto element_offset = EncodeValue(list[index], depth + 1U);
+            if (!element_offset.has_value())
+            {
+                return element_offset;
+            }
+            Store(table_offset + (index * sizeof(std::uint32_t)), static_cast<std::uint32_t>(element_offset.value()));
+        }
+        return value_offset;
+    }
+
+    void StoreScalar(const ValueType type, const json::Any& value, const std::size_t offset)
+    {
+        switch (type)
+        {
+            case ValueType::kBool:
+                buffer_[offset] = value.As<bool>().value() ? '\1' : '\0';
+                break;
+            case ValueType::kInt64:
+                Store(offset, value.As<std::int64_t>().value());
+                break;
+            case ValueType::kUint64:
+                Store(offset, value.As<std::uint64_t>().value());
+                break;
+            default:
+                Store(offset, value.As<double>().value());
+                break;
+        }
+    }
+
+    std::size_t AppendValueHeader(const ValueType type, const std::size_t count)
+    {
+        buffer_.resize(((buffer_.size() + kAlignment) - 1U) & ~(kAlignment - 1U), '\0');
+        const auto value_offset = Reserve(kValueHeaderSize);
+        buffer_[value_offset] = static_cast<char>(type);
+        Store(value_offset + kCountOffset, static_cast<std::uint32_t>(count));
+        return value_offset;
+    }
+
+    std::size_t Reserve(const std::size_t size)
+    {
+        const auto offset = buffer_.size();
+        buffer_.resize(offset + size, '\0');
+        return offset;
+    }
+
+    template <typename T>
+    void Store(const std::size_t offset, const T value) noexcept
+    {
+        score::cpp::ignore = std::memcpy(&buffer_[offset], &value, sizeof(T));
+    }
+
+    std::string buffer_{};
+};
+
+class Validator final
+{
+  public:
+    explicit Validator(const std::string_view buffer) noexcept
+        : buffer_{buffer}, remaining_values_{buffer.size() / kValueHeaderSize}
+    {
+    }
+
+    bool IsValidMembers(const std::size_t table_offset, const std::uint64_t count, const std::size_t depth) noexcept
+    {
+        if (!IsInBuffer(table_offset, count * kMemberSize))
+        {
+            return false;
+        }
+        std::string_view previous_name{};
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            const auto entry_offset = table_offset + (index * kMemberSize);
+            const auto name_offset = LoadAt<std::uint32_t>(buffer_, entry_offset);
+            const auto name_size = LoadAt<std::uint32_t>(buffer_, entry_offset + 4U);
+            if (!IsInBuffer(name_offset, name_size))
+            {
+                return false;
+            }
+            // the names are sorted, so they are found by a binary search
+            const auto name = buffer_.substr(name_offset, name_size);
+            if ((index > 0U) && (!(previous_name < name)))
+            {
+                return false;
+            }
+            previous_name = name;
+            if (!IsValidValue(LoadAt<std::uint32_t>(buffer_, entry_offset + 8U), depth + 1U))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    bool IsValidValue(const std::size_t offset, const std::size_t depth) noexcept
+    {
+        // every value takes at least a value header, so a buffer referring to values repeatedly is rejected
+        if ((depth > kMaxDepth) || (remaining_values_ == 0U) || ((offset % kAlignment) != 0U) ||
+            (!IsInBuffer(offset, kValueHeaderSize)))
+        {
+            return false;
+        }
+        --remaining_values_;
+
+        const auto type = static_cast<ValueType>(buffer_[offset]);
+        const std::uint64_t count = LoadAt<std::uint32_t>(buffer_, offset + kCountOffset);
+        const auto payload_offset = offset + kValueHeaderSize;
+        switch (type)
+        {
+            case ValueType::kNull:
+                return true;
+            case ValueType::kBool:
+            case ValueType::kInt64:
+            case ValueType::kUint64:
+            case ValueType::kDouble:
+                return IsInBuffer(payload_offset, sizeof(std::uint64_t));
+            case ValueType::kString:
+                return IsInBuffer(payload_offset, count);
+            case ValueType::kBoolArray:
+            case ValueType::kInt64Array:
+            case ValueType::kUint64Array:
+            case ValueType::kDoubleArray:
+                return IsInBuffer(payload_offset, count * GetArrayElementSize(type));
+            case ValueType::kList:
+                return IsValidList(payload_offset, count, depth);
+            case ValueType::kObject:
+                return IsValidMembers(payload_offset, count, depth);
+            default:
+                return false;
+        }
+    }
+
+    bool IsValidList(const std::size_t table_offset, const std::uint64_t count, const std::size_t depth) noexcept
+    {
+        if (!IsInBuffer(table_offset, count * sizeof(std::uint32_t)))
+        {
+            return false;
+        }
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            if (!IsValidValue(LoadAt<std::uint32_t>(buffer_, table_offset + (index * sizeof(std::uint32_t))),
+                              depth + 1U))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IsInBuffer(const std::uint64_t offset, const std::uint64_t size) const noexcept
+    {
+        return (offset <= buffer_.size()) && (size <= (buffer_.size() - offset));
+    }
+
+    std::string_view buffer_;
+    std::size_t remaining_values_;
+};
+
+json::Any ArrayElementToJson(const BinaryValue& array, const std::size_t index)
+{
+    switch (array.GetType())
+    {
+        case ValueType::kBoolArray:
+            return json::Any{array.GetElementAs<bool>(index).value()};
+        case ValueType::kInt64Array:
+            return json::Any{array.GetElementAs<std::int64_t>(index).value()};
+        case ValueType::kUint64Array:
+            return json::Any{array.GetElementAs<std::uint64_t>(index).value()};
+        default:
+            return json::Any{array.GetElementAs<double>(index).value()};
+    }
+}
+
+}  // namespace
+
+Result<std::string> EncodeBinarySet(const json::Object& set)
+{
+    return Encoder{}.Encode(set);
+}
+
+std::uint64_t ComputeBinarySetDigest(const std::string_view encoded_set) noexcept
+{
+    std::uint64_t digest{kDigestOffsetBasis};
+    for (const char byte : encoded_set)
+    {
+        digest = (digest ^ static_cast<std::uint8_t>(byte)) * kDigestPrime;
+    }
+    return (digest != 0U) ? digest : 1U;
+}
+
+BinaryValue::BinaryValue(const std::string_view buffer, const std::size_t offset) noexcept
+    : buffer_{buffer}, offset_{offset}
+{
+}
+
+ValueType BinaryValue::GetType() const noexcept
+{
+    return static_cast<ValueType>(buffer_[offset_]);
+}
+
+const char* BinaryValue::GetPayload() const noexcept
+{
+    return buffer_.data() + offset_ + kValueHeaderSize;
+}
+
+Result<std::string_view> BinaryValue::AsString() const noexcept
+{
+    if (GetType() != ValueType::kString)
+    {
+        return MakeUnexpected(WireFormatError::kWrongType);
+    }
+    return std::string_view{GetPayload(), LoadAt<std::uint32_t>(buffer_, offset_ + kCountOffset)};
+}
+
+bool BinaryValue::IsList() const noexcept
+{
+    const auto type = GetType();
+    return (type == ValueType::kBoolArray) || (type == ValueType::kInt64Array) || (type == ValueType::kUint64Array) ||
+           (type == ValueType::kDoubleArray) || (type == ValueType::kList);
+}
+
+std::size_t BinaryValue::GetElementCount() const noexcept
+{
+    switch (GetType())
+    {
+        case ValueType::kBoolArray:
+        case ValueType::kInt64Array:
+        case ValueType::kUint64Array:
+        case ValueType::kDoubleArray:
+        case ValueType::kList:
+        case ValueType::kObject:
+            return LoadAt<std::uint32_t>(buffer_, offset_ + kCountOffset);
+        default:
+            return 0U;
+    }
+}
+
+Result<BinaryValue> BinaryValue::GetElement(const std::size_t index) const noexcept
+{
+    if ((GetType() != ValueType::kList) || (index >= GetElementCount()))
+    {
+        return MakeUnexpected(WireFormatError::kWrongType);
+    }
+    const auto table_offset = offset_ + kValueHeaderSize;
+    return BinaryValue{buffer_, LoadAt<std::uint32_t>(buffer_, table_offset + (index * sizeof(std::uint32_t)))};
+}
+
+Result<json::Any> BinaryValue::ToJson() const
+{
+    switch (GetType())
+    {
+        case ValueType::kNull:
+            return json::Any{json::Null{}};
+        case ValueType::kBool:
+            return json::Any{As<bool>().value()};
+        case ValueType::kInt64:
+            return json::Any{As<std::int64_t>().value()};
+        case ValueType::kUint64:
+            return json::Any{As<std::uint64_t>().value()};
+        case ValueType::kDouble:
+            return json::Any{As<double>().value()};
+        case ValueType::kString:
+            return json::Any{std::string{AsString().value()}};
+        case ValueType::kObject:
+        {
+            json::Object object{};
+            const auto table_offset = offset_ + kValueHeaderSize;
+            for (std::size_t index = 0U; index < GetElementCount(); ++index)
+            {
+                const auto entry_offset = table_offset + (index * kMemberSize);
+                const std::string name{buffer_.substr(LoadAt<std::uint32_t>(buffer_, entry_offset),
+                                                      LoadAt<std::uint32_t>(buffer_, entry_offset + 4U))};
+                auto member = BinaryValue{buffer_, LoadAt<std::uint32_t>(buffer_, entry_offset + 8U)}.ToJson();
+                if (!member.has_value())
+                {
+                    return member;
+                }
+                object[name.c_str()] = std::move(member).value();
+            }
+            return json::Any{std::move(object)};
+        }
+        default:
+            break;
+    }
+
+    // arrays and lists
+    json::List list{};
+    list.reserve(GetElementCount());
+    for (std::size_t index = 0U; index < GetElementCount(); ++index)
+    {
+        auto element = (GetType() == ValueType::kList) ? GetElement(index).value().ToJson()
+                                                       : Result<json::Any>{ArrayElementToJson(*this, index)};
+        if (!element.has_value())
+        {
+            return element;
+        }
+        list.push_back(std::move(element).value());
+    }
+    return json::Any{std::move(list)};
+}
+
+Result<BinarySetView> BinarySetView::Create(const std::string_view buffer) noexcept
+{
+    if ((buffer.size() < kHeaderSize) || (!std::equal(kMagic.begin(), kMagic.end(), buffer.begin())) ||
+        (static_cast<std::uint8_t>(buffer[kVersionOffset]) != kVersion) ||
+        (LoadAt<std::uint32_t>(buffer, kSizeOffset) != buffer.size()))
+    {
+        return MakeUnexpected(WireFormatError::kInvalidBuffer, "Header of binary parameter set is invalid");
+    }
+    Validator validator{buffer};
+    if (!validator.IsValidMembers(kHeaderSize, LoadAt<std::uint32_t>(buffer, kParameterCountOffset), 0U))
+    {
+        return MakeUnexpected(WireFormatError::kInvalidBuffer, "Content of binary parameter set is invalid");
+    }
+    return BinarySetView{buffer};
+}
+
+BinarySetView::BinarySetView(const std::string_view buffer) noexcept : buffer_{buffer} {}
+
+std::string_view BinarySetView::GetBuffer() const noexcept
+{
+    return buffer_;
+}
+
+std::size_t BinarySetView::GetParameterCount() const noexcept
+{
+    return LoadAt<std::uint32_t>(buffer_, kParameterCountOffset);
+}
+
+score::cpp::optional<std::uint8_t> BinarySetView::GetQualifier() const noexcept
+{
+    if ((static_cast<std::uint8_t>(buffer_[kFlagsOffset]) & kHasQualifierFlag) == 0U)
+    {
+        return score::cpp::nullopt;
+    }
+    return static_cast<std::uint8_t>(buffer_[kQualifierOffset]);
+}
+
+Result<BinaryValue> BinarySetView::FindParameter(const std::string_view parameter_name) const noexcept
+{
+    std::size_t first{0U};
+    std::size_t last{GetParameterCount()};
+    while (first < last)
+    {
+        const auto middle = first + ((last - first) / 2U);
+        const auto entry_offset = kHeaderSize + (middle * kMemberSize);
+        const auto name = buffer_.substr(LoadAt<std::uint32_t>(buffer_, entry_offset),
+                                         LoadAt<std::uint32_t>(buffer_, entry_offset + 4U));
+        if (name == parameter_name)
+        {
+            return BinaryValue{buffer_, LoadAt<std::uint32_t>(buffer_, entry_offset + 8U)};
+        }
+        if (name < parameter_name)
+        {
+            first = middle + 1U;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    return MakeUnexpected(WireFormatError::kParameterNotFound);
+}
+
+Result<json::Any> BinarySetView::ToJson() const
+{
+    json::Object parameters{};
+    for (std::size_t index = 0U; index < GetParameterCount(); ++index)
+    {
+        const auto entry_offset = kHeaderSize + (index * kMemberSize);
+        const std::string name{buffer_.substr(LoadAt<std::uint32_t>(buffer_, entry_offset),
+                                              LoadAt<std::uint32_t>(buffer_, entry_offset + 4U))};
+        auto parameter = BinaryValue{buffer_, LoadAt<std::uint32_t>(buffer_, entry_offset + 8U)}.ToJson();
+        if (!parameter.has_value())
+        {
+            return parameter;
+        }
+        parameters[name.c_str()] = std::move(parameter).value();
+    }
+
+    json::Object set{};
+    set["parameters"] = json::Any{std::move(parameters)};
+    const auto qualifier = GetQualifier();
+    if (qualifier.has_value())
+    {
+        set["qualifier"] = json::Any{qualifier.value()};
+    }
+    return json::Any{std::move(set)};
+}
+
+}  // namespace wire_format
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
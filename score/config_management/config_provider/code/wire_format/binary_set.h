@@ -0,0 +1,244 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#ifndef SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_WIRE_FORMAT_BINARY_SET_H
+#define SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_WIRE_FORMAT_BINARY_SET_H
+
+#include "score/config_management/config_provider/code/wire_format/wire_format_error.h"
+
+#include "score/json/internal/model/any.h"
+#include "score/result/result.h"
+
+#include <score/optional.hpp>
+#include <score/utility.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace wire_format
+{
+
+///
+/// @brief Binary wire format of parameter sets
+///
+/// A parameter set {"parameters": {...}, "qualifier": <number>} is encoded into a single buffer, which the receiver
+/// reads in place. The buffer starts with a header and a table of all parameters sorted by name, so a parameter is
+/// found by a binary search without decoding the other ones. Every value starts with its type and its element count,
+/// numbers are stored in host byte order as the daemon and its clients run on the same machine. Arrays whose elements
+/// are all booleans, signed integers, unsigned integers or floating point numbers are stored as plain arrays of these
+/// numbers.
+///
+/// All offsets are 32 bit and relative to the begin of the buffer, values are aligned to 8 bytes relative to it.
+///
+enum class ValueType : std::uint8_t
+{
+    kNull,
+    kBool,
+    kInt64,
+    kUint64,
+    kDouble,
+    kString,
+    kBoolArray,
+    kInt64Array,
+    kUint64Array,
+    kDoubleArray,
+    kList,
+    kObject,
+};
+
+/// @brief Encodes the JSON representation of a parameter set into the binary wire format
+///
+/// @return encoded set or kUnsupportedValue if the set has no parameters object or is nested too deeply
+///
+Result<std::string> EncodeBinarySet(const json::Object& set);
+
+/// @brief Computes the digest of an encoded parameter set
+///
+/// The encoding stores the parameters sorted by name and every number by its value, so the ConfigDaemon and its
+/// clients compute the same digest for the same content, independently of how the set was parsed or stored. The digest
+/// is never zero, which stands for an unknown digest.
+///
+std::uint64_t ComputeBinarySetDigest(const std::string_view encoded_set) noexcept;
+
+class BinarySetView;
+
+/// @brief Read-only view of a value within a validated binary parameter set
+class BinaryValue final
+{
+  public:
+    ValueType GetType() const noexcept;
+
+    /// @brief Reads a bool or a number, integers are converted to floating point types as by the JSON access path
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+    Result<T> As() const noexcept
+    {
+        return ReadScalar<T>(GetType(), GetPayload());
+    }
+    Result<std::string_view> AsString() const noexcept;
+
+    /// @brief True for plain arrays and for lists
+    bool IsList() const noexcept;
+    /// @brief Number of elements of an array or a list, number of members of an object, zero for any other value
+    std::size_t GetElementCount() const noexcept;
+    /// @brief Reads an element of an array or a list of bools or numbers
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+    Result<T> GetElementAs(const std::size_t index) const noexcept
+    {
+        if (index >= GetElementCount())
+        {
+            return MakeUnexpected(WireFormatError::kWrongType);
+        }
+        switch (GetType())
+        {
+            case ValueType::kBoolArray:
+                return ReadScalar<T>(ValueType::kBool, GetPayload() + index);
+            case ValueType::kInt64Array:
+                return ReadScalar<T>(ValueType::kInt64, GetPayload() + (index * sizeof(std::int64_t)));
+            case ValueType::kUint64Array:
+                return ReadScalar<T>(ValueType::kUint64, GetPayload() + (index * sizeof(std::uint64_t)));
+            case ValueType::kDoubleArray:
+                return ReadScalar<T>(ValueType::kDouble, GetPayload() + (index * sizeof(double)));
+            case ValueType::kList:
+                return GetElement(index).value().template As<T>();
+            default:
+                return MakeUnexpected(WireFormatError::kWrongType);
+        }
+    }
+    /// @brief Returns an element of a list, the elements of plain number arrays are read by GetElementAs()
+    Result<BinaryValue> GetElement(const std::size_t index) const noexcept;
+
+    /// @brief Decodes the value into its JSON representation
+    Result<json::Any> ToJson() const;
+
+  private:
+    friend class BinarySetView;
+    BinaryValue(const std::string_view buffer, const std::size_t offset) noexcept;
+
+    const char* GetPayload() const noexcept;
+
+    template <typename T>
+    static Result<T> ReadScalar(const ValueType type, const char* const payload) noexcept
+    {
+        if constexpr (std::is_same<T, bool>::value)
+        {
+            if (type == ValueType::kBool)
+            {
+                return *payload != '\0';
+            }
+        }
+        else if constexpr (std::is_floating_point<T>::value)
+        {
+            if (type == ValueType::kDouble)
+            {
+                return static_cast<T>(Load<double>(payload));
+            }
+            if (type == ValueType::kInt64)
+            {
+                return static_cast<T>(Load<std::int64_t>(payload));
+            }
+            if (type == ValueType::kUint64)
+            {
+                return static_cast<T>(Load<std::uint64_t>(payload));
+            }
+        }
+        else
+        {
+            if (type == ValueType::kInt64)
+            {
+                const auto value = Load<std::int64_t>(payload);
+                if (IsInRange<T>(value))
+                {
+                    return static_cast<T>(value);
+                }
+            }
+            if (type == ValueType::kUint64)
+            {
+                const auto value = Load<std::uint64_t>(payload);
+                if (value <= static_cast<std::uint64_t>(std::numeric_limits<T>::max()))
+                {
+                    return static_cast<T>(value);
+                }
+            }
+        }
+        return MakeUnexpected(WireFormatError::kWrongType);
+    }
+
+    template <typename T>
+    static T Load(const char* const payload) noexcept
+    {
+        T value{};
+        score::cpp::ignore = std::memcpy(&value, payload, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    static bool IsInRange(const std::int64_t value) noexcept
+    {
+        if constexpr (std::is_signed<T>::value)
+        {
+            return (value >= static_cast<std::int64_t>(std::numeric_limits<T>::min())) &&
+                   (value <= static_cast<std::int64_t>(std::numeric_limits<T>::max()));
+        }
+        else
+        {
+            return (value >= 0) && (static_cast<std::uint64_t>(value) <= std::numeric_limits<T>::max());
+        }
+    }
+
+    std::string_view buffer_;
+    std::size_t offset_;
+};
+
+/// @brief Read-only view of a binary parameter set, the viewed buffer has to outlive the view
+class BinarySetView final
+{
+  public:
+    /// @brief Validates the complete buffer once, so the values are read afterwards without further checks
+    ///
+    /// @return view of the buffer or kInvalidBuffer if the buffer is not a binary parameter set of a known version
+    ///
+    static Result<BinarySetView> Create(const std::string_view buffer) noexcept;
+
+    /// @brief Encoded set the view refers to, e.g. to compute its digest
+    std::string_view GetBuffer() const noexcept;
+    std::size_t GetParameterCount() const noexcept;
+    score::cpp::optional<std::uint8_t> GetQualifier() const noexcept;
+    /// @brief Looks up a parameter by a binary search in the parameter table
+    Result<BinaryValue> FindParameter(const std::string_view parameter_name) const noexcept;
+
+    /// @brief Decodes the set into its JSON representation {"parameters": {...}, "qualifier": <number>}
+    Result<json::Any> ToJson() const;
+
+  private:
+    explicit BinarySetView(const std::string_view buffer) noexcept;
+
+    std::string_view buffer_;
+};
+
+}  // namespace wire_format
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
+
+#endif  // SCORE_CONFIG_MANAGEMENT_CONFIGPROVIDER_CODE_WIRE_FORMAT_BINARY_SET_H
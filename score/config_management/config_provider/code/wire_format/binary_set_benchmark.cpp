@@ -0,0 +1,252 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include "score/json/json_parser.h"
+#include "score/json/json_writer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace wire_format
+{
+namespace
+{
+
+constexpr std::int64_t kScalarSet{0};
+constexpr std::int64_t kLookupTableSet{1};
+constexpr std::int64_t kMixedSet{2};
+
+/// @brief Builds a parameter set of one of the shapes seen on target
+///
+/// kScalarSet: 3000 calibration values, kLookupTableSet: 20 maps of 16x16 doubles, kMixedSet: 200 scalars, strings and
+/// curves of 32 elements.
+///
+json::Object MakeSet(const std::int64_t shape)
+{
+    json::Object parameters{};
+    if (shape == kScalarSet)
+    {
+        for (std::int64_t index = 0; index < 3000; ++index)
+        {
+            const std::string name = "parameter_" + std::to_string(index);
+            parameters[name.c_str()] =
+                ((index % 2) == 0) ? json::Any{index * 7} : json::Any{static_cast<double>(index) * 0.25};
+        }
+    }
+    else if (shape == kLookupTableSet)
+    {
+        for (std::int64_t index = 0; index < 20; ++index)
+        {
+            json::List map{};
+            for (std::int64_t row_index = 0; row_index < 16; ++row_index)
+            {
+                json::List row{};
+                for (std::int64_t column_index = 0; column_index < 16; ++column_index)
+                {
+                    row.emplace_back(static_cast<double>(row_index * column_index) * 0.1);
+                }
+                map.emplace_back(std::move(row));
+            }
+            const std::string name = "map_" + std::to_string(index);
+            parameters[name.c_str()] = json::Any{std::move(map)};
+        }
+    }
+    else
+    {
+        for (std::int64_t index = 0; index < 200; ++index)
+        {
+            const std::string name = "parameter_" + std::to_string(index);
+            switch (index % 3)
+            {
+                case 0:
+                    parameters[name.c_str()] = json::Any{index};
+                    break;
+                case 1:
+                    parameters[name.c_str()] = json::Any{"variant_" + std::to_string(index)};
+                    break;
+                default:
+                {
+                    json::List curve{};
+                    for (std::int64_t element_index = 0; element_index < 32; ++element_index)
+                    {
+                        curve.emplace_back(element_index);
+                    }
+                    parameters[name.c_str()] = json::Any{std::move(curve)};
+                    break;
+                }
+            }
+        }
+    }
+
+    json::Object set{};
+    set["parameters"] = json::Any{std::move(parameters)};
+    set["qualifier"] = json::Any{std::uint8_t{1U}};
+    return set;
+}
+
+/// @brief Names of all parameters of the set, ConfigProvider users look up parameters by name
+std::vector<std::string> GetNames(const json::Object& set)
+{
+    std::vector<std::string> names{};
+    for (const auto& parameter : set.at("parameters").As<json::Object>().value().get())
+    {
+        names.emplace_back(parameter.first.GetAsStringView());
+    }
+    return names;
+}
+
+double ReadNumber(const json::Any& value)
+{
+    const auto number = value.As<double>();
+    if (number.has_value())
+    {
+        return number.value();
+    }
+    const auto integer = value.As<std::int64_t>();
+    return integer.has_value() ? static_cast<double>(integer.value()) : 0.0;
+}
+
+/// @brief Reads every number of every parameter, returns the sum of them
+double ReadAll(const json::Object& parameters, const std::vector<std::string>& names)
+{
+    double sum{0.0};
+    for (const auto& name : names)
+    {
+        const auto& parameter = parameters.find(name)->second;
+        const auto list = parameter.As<json::List>();
+        if (!list.has_value())
+        {
+            sum += ReadNumber(parameter);
+            continue;
+        }
+        for (const auto& element : list.value().get())
+        {
+            const auto row = element.As<json::List>();
+            if (!row.has_value())
+            {
+                sum += ReadNumber(element);
+                continue;
+            }
+            for (const auto& cell : row.value().get())
+            {
+                sum += ReadNumber(cell);
+            }
+        }
+    }
+    return sum;
+}
+
+double ReadAll(const BinarySetView& view, const std::vector<std::string>& names)
+{
+    double sum{0.0};
+    for (const auto& name : names)
+    {
+        const auto parameter = view.FindParameter(name).value();
+        if (parameter.GetType() != ValueType::kList)
+        {
+            const auto number = parameter.As<double>();
+            sum += number.has_value() ? number.value() : 0.0;
+            for (std::size_t index = 0U; index < parameter.GetElementCount(); ++index)
+            {
+                sum += parameter.GetElementAs<double>(index).value();
+            }
+            continue;
+        }
+        for (std::size_t row_index = 0U; row_index < parameter.GetElementCount(); ++row_index)
+        {
+            const auto row = parameter.GetElement(row_index).value();
+            for (std::size_t column_index = 0U; column_index < row.GetElementCount(); ++column_index)
+            {
+                sum += row.GetElementAs<double>(column_index).value();
+            }
+        }
+    }
+    return sum;
+}
+
+void BM_EncodeJson(benchmark::State& state)
+{
+    const auto set = MakeSet(state.range(0));
+    json::JsonWriter writer{};
+    std::size_t size{0U};
+    for (auto _ : state)
+    {
+        auto buffer = writer.ToBuffer(set);
+        size = buffer.value().size();
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.counters["bytes"] = static_cast<double>(size);
+}
+
+void BM_EncodeBinary(benchmark::State& state)
+{
+    const auto set = MakeSet(state.range(0));
+    std::size_t size{0U};
+    for (auto _ : state)
+    {
+        auto buffer = EncodeBinarySet(set);
+        size = buffer.value().size();
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.counters["bytes"] = static_cast<double>(size);
+}
+
+/// @brief Parses the received JSON text and reads all parameters, as ConfigProvider users did before
+void BM_DecodeJson(benchmark::State& state)
+{
+    const auto set = MakeSet(state.range(0));
+    const auto names = GetNames(set);
+    json::JsonWriter writer{};
+    const auto buffer = writer.ToBuffer(set).value();
+    const json::JsonParser parser{};
+    for (auto _ : state)
+    {
+        const auto received_set = parser.FromBuffer(buffer);
+        const auto& parameters = received_set.value().As<json::Object>().value().get().at("parameters");
+        benchmark::DoNotOptimize(ReadAll(parameters.As<json::Object>().value().get(), names));
+    }
+}
+
+/// @brief Validates the received binary set and reads all parameters in place
+void BM_DecodeBinary(benchmark::State& state)
+{
+    const auto set = MakeSet(state.range(0));
+    const auto names = GetNames(set);
+    const auto buffer = EncodeBinarySet(set).value();
+    for (auto _ : state)
+    {
+        const auto view = BinarySetView::Create(buffer);
+        benchmark::DoNotOptimize(ReadAll(view.value(), names));
+    }
+}
+
+BENCHMARK(BM_EncodeJson)->Arg(kScalarSet)->Arg(kLookupTableSet)->Arg(kMixedSet)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EncodeBinary)->Arg(kScalarSet)->Arg(kLookupTableSet)->Arg(kMixedSet)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecodeJson)->Arg(kScalarSet)->Arg(kLookupTableSet)->Arg(kMixedSet)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecodeBinary)->Arg(kScalarSet)->Arg(kLookupTableSet)->Arg(kMixedSet)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace wire_format
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,261 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/wire_format/binary_set.h"
+
+#include "score/json/json_parser.h"
+
+#include <gtest/gtest.h>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace wire_format
+{
+namespace test
+{
+
+class BinarySetTest : public ::testing::Test
+{
+  protected:
+    static json::Any Parse(const std::string& set)
+    {
+        auto set_json = json::JsonParser{}.FromBuffer(set);
+        EXPECT_TRUE(set_json.has_value());
+        return std::move(set_json).value();
+    }
+
+    static std::string Encode(const std::string& set)
+    {
+        const auto set_json = Parse(set);
+        const auto buffer = EncodeBinarySet(set_json.As<json::Object>().value().get());
+        EXPECT_TRUE(buffer.has_value());
+        return buffer.value();
+    }
+
+    const std::string set_{R"({
+        "parameters": {
+            "speed": 42,
+            "offset": -7,
+            "large": 18446744073709551615,
+            "factor": 0.5,
+            "enabled": true,
+            "name": "engine",
+            "nothing": null,
+            "flags": [true, false, true],
+            "curve": [1.5, 2.5, 3.5],
+            "ids": [1, 2, 3],
+            "map": [[1, 2], [3, 4], [5, 6]],
+            "mixed": [1, "two", 3.0],
+            "empty": [],
+            "nested": {"b": 2, "a": {"c": [1.0]}}
+        },
+        "qualifier": 3
+    })"};
+};
+
+TEST_F(BinarySetTest, RoundTripKeepsAllValues)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::wire_format::BinarySetView::ToJson()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that an encoded set is decoded into the original JSON set.");
+
+    const auto buffer = Encode(set_);
+    const auto view = BinarySetView::Create(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    const auto set_json = view.value().ToJson();
+
+    ASSERT_TRUE(set_json.has_value());
+    const auto original_json = Parse(set_);
+    const auto& set = set_json.value().As<json::Object>().value().get();
+    const auto& original_set = original_json.As<json::Object>().value().get();
+    EXPECT_EQ(set.at("parameters"), original_set.at("parameters"));
+    EXPECT_EQ(set.at("qualifier").As<std::uint8_t>().value(), 3U);
+}
+
+TEST_F(BinarySetTest, ReadScalarsInPlace)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::wire_format::BinaryValue::As()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that scalar parameters are read with the conversions of JSON.");
+
+    const auto buffer = Encode(set_);
+    const auto view = BinarySetView::Create(buffer).value();
+
+    EXPECT_EQ(view.GetParameterCount(), 14U);
+    EXPECT_EQ(view.FindParameter("speed").value().As<std::uint8_t>().value(), 42U);
+    EXPECT_EQ(view.FindParameter("speed").value().As<float>().value(), 42.0F);
+    EXPECT_EQ(view.FindParameter("offset").value().As<std::int16_t>().value(), -7);
+    EXPECT_EQ(view.FindParameter("large").value().As<std::uint64_t>().value(), 18446744073709551615U);
+    EXPECT_EQ(view.FindParameter("factor").value().As<double>().value(), 0.5);
+    EXPECT_TRUE(view.FindParameter("enabled").value().As<bool>().value());
+    EXPECT_EQ(view.FindParameter("name").value().AsString().value(), "engine");
+    EXPECT_EQ(view.FindParameter("nothing").value().GetType(), ValueType::kNull);
+
+    EXPECT_EQ(view.FindParameter("offset").value().As<std::uint32_t>().error(), WireFormatError::kWrongType);
+    EXPECT_EQ(view.FindParameter("large").value().As<std::int64_t>().error(), WireFormatError::kWrongType);
+    EXPECT_EQ(view.FindParameter("factor").value().As<std::int32_t>().error(), WireFormatError::kWrongType);
+    EXPECT_EQ(view.FindParameter("name").value().As<bool>().error(), WireFormatError::kWrongType);
+    EXPECT_EQ(view.FindParameter("unknown").error(), WireFormatError::kParameterNotFound);
+}
+
+TEST_F(BinarySetTest, ReadArraysInPlace)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::wire_format::BinaryValue::GetElementAs()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that homogeneous lists are stored as plain arrays and read element-wise.");
+
+    const auto buffer = Encode(set_);
+    const auto view = BinarySetView::Create(buffer).value();
+
+    const auto flags = view.FindParameter("flags").value();
+    EXPECT_EQ(flags.GetType(), ValueType::kBoolArray);
+    EXPECT_FALSE(flags.GetElementAs<bool>(1U).value());
+
+    const auto curve = view.FindParameter("curve").value();
+    EXPECT_EQ(curve.GetType(), ValueType::kDoubleArray);
+    ASSERT_EQ(curve.GetElementCount(), 3U);
+    EXPECT_EQ(curve.GetElementAs<float>(2U).value(), 3.5F);
+    EXPECT_EQ(curve.GetElementAs<float>(3U).error(), WireFormatError::kWrongType);
+
+    const auto ids = view.FindParameter("ids").value();
+    EXPECT_EQ(ids.GetType(), ValueType::kInt64Array);
+    EXPECT_EQ(ids.GetElementAs<std::uint16_t>(0U).value(), 1U);
+
+    const auto map = view.FindParameter("map").value();
+    EXPECT_EQ(map.GetType(), ValueType::kList);
+    EXPECT_TRUE(map.IsList());
+    EXPECT_FALSE(view.FindParameter("nested").value().IsList());
+    ASSERT_EQ(map.GetElementCount(), 3U);
+    const auto row = map.GetElement(2U).value();
+    EXPECT_EQ(row.GetType(), ValueType::kInt64Array);
+    EXPECT_EQ(row.GetElementAs<std::int32_t>(1U).value(), 6);
+
+    const auto mixed = view.FindParameter("mixed").value();
+    EXPECT_EQ(mixed.GetType(), ValueType::kList);
+    EXPECT_EQ(mixed.GetElementAs<std::int32_t>(0U).value(), 1);
+    EXPECT_EQ(mixed.GetElement(1U).value().AsString().value(), "two");
+    EXPECT_EQ(mixed.GetElementAs<std::int32_t>(1U).error(), WireFormatError::kWrongType);
+}
+
+TEST_F(BinarySetTest, QualifierIsOptional)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies",
+                   "::score::config_management::config_provider::wire_format::BinarySetView::GetQualifier()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that the qualifier is only reported if the set has one.");
+
+    const auto buffer_with_qualifier = Encode(set_);
+    const auto buffer_without_qualifier = Encode(R"({"parameters": {}})");
+
+    EXPECT_EQ(BinarySetView::Create(buffer_with_qualifier).value().GetQualifier(), 3U);
+    const auto view = BinarySetView::Create(buffer_without_qualifier);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_FALSE(view.value().GetQualifier().has_value());
+    EXPECT_EQ(view.value().GetParameterCount(), 0U);
+}
+
+TEST_F(BinarySetTest, DigestDependsOnlyOnContent)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::wire_format::ComputeBinarySetDigest()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description",
+                   "This test verifies that the digest of a set does not depend on the order of its members, but on "
+                   "every value and the qualifier.");
+
+    const auto digest = ComputeBinarySetDigest(Encode(R"({"parameters": {"a": 1, "b": {"c": 2.5, "d": [1, 2]}},
+                                                           "qualifier": 3})"));
+    const auto reordered_set = R"({"qualifier": 3, "parameters": {"b": {"d": [1, 2], "c": 2.5}, "a": 1}})";
+    const auto changed_value_set = R"({"parameters": {"a": 1, "b": {"c": 2.5, "d": [1, 3]}}, "qualifier": 3})";
+    const auto changed_qualifier_set = R"({"parameters": {"a": 1, "b": {"c": 2.5, "d": [1, 2]}}, "qualifier": 2})";
+
+    EXPECT_NE(digest, 0U);
+    EXPECT_EQ(ComputeBinarySetDigest(Encode(reordered_set)), digest);
+    EXPECT_NE(ComputeBinarySetDigest(Encode(changed_value_set)), digest);
+    EXPECT_NE(ComputeBinarySetDigest(Encode(changed_qualifier_set)), digest);
+}
+
+TEST_F(BinarySetTest, EncodeRejectsSetWithoutParameters)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::wire_format::EncodeBinarySet()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that sets without a parameters object are not encoded.");
+
+    EXPECT_EQ(EncodeBinarySet(Parse(R"({"qualifier": 1})").As<json::Object>().value().get()).error(),
+              WireFormatError::kUnsupportedValue);
+    EXPECT_EQ(EncodeBinarySet(Parse(R"({"parameters": [1]})").As<json::Object>().value().get()).error(),
+              WireFormatError::kUnsupportedValue);
+}
+
+TEST_F(BinarySetTest, CreateRejectsInvalidBuffers)
+{
+    RecordProperty("Priority", "3");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("Verifies", "::score::config_management::config_provider::wire_format::BinarySetView::Create()");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Description", "This test verifies that truncated and corrupted buffers are rejected.");
+
+    const auto buffer = Encode(set_);
+    ASSERT_TRUE(BinarySetView::Create(buffer).has_value());
+
+    EXPECT_EQ(BinarySetView::Create("").error(), WireFormatError::kInvalidBuffer);
+    EXPECT_EQ(BinarySetView::Create(R"({"parameters": {}})").error(), WireFormatError::kInvalidBuffer);
+    EXPECT_EQ(BinarySetView::Create(std::string_view{buffer}.substr(0U, buffer.size() - 1U)).error(),
+              WireFormatError::kInvalidBuffer);
+
+    auto wrong_version = buffer;
+    wrong_version[4] = '\2';
+    EXPECT_EQ(BinarySetView::Create(wrong_version).error(), WireFormatError::kInvalidBuffer);
+
+    // the first parameter refers to a value beyond the end of the buffer
+    auto wrong_offset = buffer;
+    wrong_offset[24] = '\xff';
+    wrong_offset[25] = '\xff';
+    EXPECT_EQ(BinarySetView::Create(wrong_offset).error(), WireFormatError::kInvalidBuffer);
+
+    // the first two parameters are swapped, so the names are not sorted anymore
+    auto unsorted = buffer;
+    std::swap_ranges(unsorted.begin() + 16, unsorted.begin() + 32, unsorted.begin() + 32);
+    EXPECT_EQ(BinarySetView::Create(unsorted).error(), WireFormatError::kInvalidBuffer);
+}
+
+}  // namespace test
+}  // namespace wire_format
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score
@@ -0,0 +1,78 @@
+// *******************************************************************************
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+#include "score/config_management/config_provider/code/wire_format/wire_format_error.h"
+
+#include "score/result/error_domain.h"
+
+#include <score/utility.hpp>
+
+namespace score
+{
+namespace config_management
+{
+namespace config_provider
+{
+namespace wire_format
+{
+
+namespace
+{
+class WireFormatErrorDomain final : public score::result::ErrorDomain
+{
+  public:
+    std::string_view MessageFor(const score::result::ErrorCode& code) const noexcept override
+    {
+        if ((code < score::cpp::to_underlying(WireFormatError::kInvalidBuffer)) ||
+            (code > score::cpp::to_underlying(WireFormatError::kWrongType)))
+        {
+            return std::string_view{"Unknown Error!"};
+        }
+
+        std::string_view message;
+        switch (static_cast<WireFormatError>(code))
+        {
+            case WireFormatError::kInvalidBuffer:
+                message = std::string_view{"Buffer is not a valid binary parameter set"};
+                break;
+            case WireFormatError::kUnsupportedValue:
+                message = std::string_view{"Value can't be encoded"};
+                break;
+            case WireFormatError::kParameterNotFound:
+                message = std::string_view{"Parameter not found"};
+                break;
+            case WireFormatError::kWrongType:
+                message = std::string_view{"Value has a different type"};
+                break;
+            // LCOV_EXCL_START (Reaching this default case is not possible as range is checked above.)
+            default:
+                message = std::string_view{"Unknown Error!"};
+                break;
+                // LCOV_EXCL_STOP
+        }
+        return message;
+    }
+};
+
+constexpr WireFormatErrorDomain kWireFormatErrorDomain;
+}  // namespace
+
+score::result::Error MakeError(const WireFormatError code, const std::string_view user_message) noexcept
+{
+    return {static_cast<score::result::ErrorCode>(code), kWireFormatErrorDomain, user_message};
+}
+
+}  // namespace wire_format
+}  // namespace config_provider
+}  // namespace config_management
+}  // namespace score